@@ -6,6 +6,11 @@ dnl Function to detect if libfsrefs dependencies are available
 AC_DEFUN([AX_LIBFSREFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsrefs/libfsrefs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for monotonic clock functions in libfsrefs/libfsrefs_statistics.c
+  AC_CHECK_HEADERS([time.h])
+  AC_SEARCH_LIBS([clock_gettime], [rt])
+  AC_CHECK_FUNCS([clock_gettime])
 ])
 
 dnl Function to check if DLL support is needed
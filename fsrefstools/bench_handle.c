@@ -0,0 +1,4589 @@
+/*
+ * Benchmark handle
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#include "bench_handle.h"
+#include "fsrefstools_libbfio.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libcthreads.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_system_string.h"
+#include "fsrefstools_unused.h"
+
+#if !defined( LIBFSREFS_HAVE_BFIO )
+
+extern \
+int libfsrefs_volume_open_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsrefs_error_t **error );
+
+#endif /* !defined( LIBFSREFS_HAVE_BFIO ) */
+
+#define BENCH_HANDLE_NOTIFY_STREAM	stderr
+#define BENCH_HANDLE_OUTPUT_STREAM	stdout
+
+/* The names of the scenarios
+ */
+static const char *bench_handle_scenario_names[ BENCH_HANDLE_NUMBER_OF_SCENARIOS ] = {
+	"open",
+	"walk",
+	"path_lookup",
+	"object_lookup",
+	"sequential_read",
+	"random_read",
+	"stat" };
+
+/* Retrieves the name of a specific scenario
+ * Returns the name or NULL if not supported
+ */
+const char *bench_handle_get_scenario_name(
+             int scenario )
+{
+	if( ( scenario < 0 )
+	 || ( scenario >= BENCH_HANDLE_NUMBER_OF_SCENARIOS ) )
+	{
+		return( NULL );
+	}
+	return( bench_handle_scenario_names[ scenario ] );
+}
+
+/* Retrieves a monotonic timestamp in nano seconds
+ * Returns the timestamp or 0 if not supported
+ */
+uint64_t bench_handle_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	      + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Retrieves the peak resident set size of the process in bytes
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int bench_handle_get_peak_resident_set_size(
+     uint64_t *peak_resident_set_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_GETRUSAGE )
+	struct rusage resource_usage;
+#endif
+
+	static char *function = "bench_handle_get_peak_resident_set_size";
+
+	if( peak_resident_set_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid peak resident set size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_GETRUSAGE )
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource usage.",
+		 function );
+
+		return( -1 );
+	}
+	/* The maximum resident set size is in bytes on Mac OS X and in KiB elsewhere
+	 */
+#if defined( __APPLE__ )
+	*peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss;
+#else
+	*peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss * 1024;
+#endif
+	return( 1 );
+#else
+	*peak_resident_set_size = 0;
+
+	return( 0 );
+#endif
+}
+
+/* Retrieves the next value of a xorshift64* random number generator
+ * The generator is used instead of rand so that runs are reproducible
+ * across platforms and independent per thread
+ * Returns the random value
+ */
+uint64_t bench_handle_get_random(
+          uint64_t *random_state )
+{
+	uint64_t value = 0;
+
+	if( random_state == NULL )
+	{
+		return( 0 );
+	}
+	value = *random_state;
+
+	/* A state of 0 would only generate zeros
+	 */
+	if( value == 0 )
+	{
+		value = 0x9e3779b97f4a7c15ULL;
+	}
+	value ^= value >> 12;
+	value ^= value << 25;
+	value ^= value >> 27;
+
+	*random_state = value;
+
+	return( value * 0x2545f4914f6cdd1dULL );
+}
+
+/* Compares two latencies
+ * Callback function for qsort
+ * Returns -1 if the first latency is less than the second, 0 if equal or 1 if greater
+ */
+int bench_handle_compare_latencies(
+     const void *first_latency,
+     const void *second_latency )
+{
+	uint64_t first  = *( (const uint64_t *) first_latency );
+	uint64_t second = *( (const uint64_t *) second_latency );
+
+	if( first < second )
+	{
+		return( -1 );
+	}
+	else if( first > second )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific percentile of sorted latencies
+ * The nearest-rank method is used, for 0 latencies the percentile is 0
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_percentile(
+     const uint64_t *latencies,
+     uint64_t number_of_latencies,
+     int percentile,
+     uint64_t *latency,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_get_percentile";
+	uint64_t rank         = 0;
+
+	if( ( latencies == NULL )
+	 && ( number_of_latencies > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( percentile < 0 )
+	 || ( percentile > 100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid percentile value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( latency == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_latencies == 0 )
+	{
+		*latency = 0;
+
+		return( 1 );
+	}
+	rank = ( ( number_of_latencies * (uint64_t) percentile ) + 99 ) / 100;
+
+	if( rank == 0 )
+	{
+		rank = 1;
+	}
+	*latency = latencies[ rank - 1 ];
+
+	return( 1 );
+}
+
+/* Creates a bench handle
+ * Make sure the value bench_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_initialize";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bench_handle = memory_allocate_structure(
+	                 bench_handle_t );
+
+	if( *bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bench_handle,
+	     0,
+	     sizeof( bench_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_initialize(
+	     &( ( *bench_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input volume.",
+		 function );
+
+		goto on_error;
+	}
+	( *bench_handle )->backend               = BENCH_HANDLE_BACKEND_FILE;
+	( *bench_handle )->scenario_flags        = BENCH_HANDLE_SCENARIO_FLAGS_ALL;
+	( *bench_handle )->number_of_threads     = BENCH_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *bench_handle )->number_of_operations  = BENCH_HANDLE_DEFAULT_NUMBER_OF_OPERATIONS;
+	( *bench_handle )->number_of_repetitions = BENCH_HANDLE_DEFAULT_NUMBER_OF_REPETITIONS;
+	( *bench_handle )->buffer_size           = BENCH_HANDLE_DEFAULT_BUFFER_SIZE;
+	( *bench_handle )->seed                  = BENCH_HANDLE_DEFAULT_SEED;
+	( *bench_handle )->output_stream         = BENCH_HANDLE_OUTPUT_STREAM;
+	( *bench_handle )->notify_stream         = BENCH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *bench_handle != NULL )
+	{
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bench handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_free";
+	int result            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		if( bench_handle_free_samples(
+		     *bench_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free samples.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsrefs_volume_free(
+		     &( ( *bench_handle )->input_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input volume.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *bench_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *bench_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bench_handle )->input_data != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->input_data );
+		}
+		if( ( *bench_handle )->path_buffer != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->path_buffer );
+		}
+		if( ( *bench_handle )->latencies != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->latencies );
+		}
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the bench handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_signal_abort";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->abort = 1;
+
+	if( bench_handle->input_volume != NULL )
+	{
+		if( libfsrefs_volume_signal_abort(
+		     bench_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input volume to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies a decimal string to a value
+ * Returns 1 if successful, 0 if the value exceeds the maximum or -1 on error
+ */
+int bench_handle_copy_decimal_string(
+     const system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_copy_decimal_string";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fsrefstools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > maximum_value )
+	{
+		return( 0 );
+	}
+	*value = value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_set_volume_offset(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_volume_offset";
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_copy_decimal_string(
+	     string,
+	     (uint64_t) INT64_MAX,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the backend
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_backend(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_backend";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "file" ),
+		     4 ) == 0 )
+		{
+			bench_handle->backend = BENCH_HANDLE_BACKEND_FILE;
+			result                = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "memory" ),
+		     6 ) == 0 )
+		{
+			bench_handle->backend = BENCH_HANDLE_BACKEND_MEMORY;
+			result                = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the scenarios
+ * The scenarios are a comma separated list of scenario names or all
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int bench_handle_set_scenarios(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	const char *scenario_name = NULL;
+	static char *function     = "bench_handle_set_scenarios";
+	size_t name_index         = 0;
+	size_t name_length        = 0;
+	size_t segment_index      = 0;
+	size_t segment_length     = 0;
+	size_t string_index       = 0;
+	size_t string_length      = 0;
+	uint8_t scenario_flags    = 0;
+	int scenario              = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_index;
+
+		if( ( segment_length == 3 )
+		 && ( system_string_compare(
+		       &( string[ segment_index ] ),
+		       _SYSTEM_STRING( "all" ),
+		       3 ) == 0 ) )
+		{
+			scenario_flags |= BENCH_HANDLE_SCENARIO_FLAGS_ALL;
+		}
+		else
+		{
+			for( scenario = 0;
+			     scenario < BENCH_HANDLE_NUMBER_OF_SCENARIOS;
+			     scenario++ )
+			{
+				scenario_name = bench_handle_scenario_names[ scenario ];
+				name_length   = narrow_string_length(
+				                 scenario_name );
+
+				if( name_length != segment_length )
+				{
+					continue;
+				}
+				for( name_index = 0;
+				     name_index < name_length;
+				     name_index++ )
+				{
+					if( string[ segment_index + name_index ] != (system_character_t) scenario_name[ name_index ] )
+					{
+						break;
+					}
+				}
+				if( name_index == name_length )
+				{
+					break;
+				}
+			}
+			if( scenario >= BENCH_HANDLE_NUMBER_OF_SCENARIOS )
+			{
+				return( 0 );
+			}
+			scenario_flags |= (uint8_t) ( 1 << scenario );
+		}
+		segment_index = string_index + 1;
+	}
+	bench_handle->scenario_flags = scenario_flags;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_threads(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_threads";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = bench_handle_copy_decimal_string(
+	          string,
+	          (uint64_t) BENCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( value_64bit == 0 ) )
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of operations of the lookup, read and stat scenarios
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_operations(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_operations";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = bench_handle_copy_decimal_string(
+	          string,
+	          (uint64_t) BENCH_HANDLE_MAXIMUM_NUMBER_OF_OPERATIONS,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to number of operations.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( value_64bit == 0 ) )
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_operations = value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of repetitions of the open and walk scenarios
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_repetitions(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_repetitions";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = bench_handle_copy_decimal_string(
+	          string,
+	          (uint64_t) BENCH_HANDLE_MAXIMUM_NUMBER_OF_REPETITIONS,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to number of repetitions.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( value_64bit == 0 ) )
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_repetitions = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the read buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_buffer_size(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_buffer_size";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = bench_handle_copy_decimal_string(
+	          string,
+	          (uint64_t) BENCH_HANDLE_MAXIMUM_BUFFER_SIZE,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( value_64bit == 0 ) )
+	{
+		return( 0 );
+	}
+	bench_handle->buffer_size = (size_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the memory limit of the volume
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_set_memory_limit(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_memory_limit";
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_copy_decimal_string(
+	     string,
+	     (uint64_t) UINT64_MAX,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to memory limit.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_set_memory_limit(
+	     bench_handle->input_volume,
+	     (size64_t) value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory limit of input volume.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->memory_limit = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the seed of the random number generators
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_set_seed(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_seed";
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_copy_decimal_string(
+	     string,
+	     (uint64_t) UINT64_MAX,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to seed.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->seed = value_64bit;
+
+	return( 1 );
+}
+
+/* Reads the volume data of the memory backend
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_load_input_data(
+     bench_handle_t *bench_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_load_input_data";
+	size64_t data_offset  = 0;
+	size64_t data_size    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	int is_open           = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - input data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The volume data is not limited by MEMORY_MAXIMUM_ALLOCATION_SIZE
+	 * since the memory backend is meant to hold complete volumes
+	 */
+	if( ( data_size == 0 )
+	 || ( data_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->input_data = (uint8_t *) memory_allocate(
+	                                        (size_t) data_size );
+
+	if( bench_handle->input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	while( data_offset < data_size )
+	{
+		read_size = BENCH_HANDLE_LOAD_READ_SIZE;
+
+		if( read_size > (size_t) ( data_size - data_offset ) )
+		{
+			read_size = (size_t) ( data_size - data_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( bench_handle->input_data[ data_offset ] ),
+		              read_size,
+		              (off64_t) data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			goto on_error;
+		}
+		data_offset += read_size;
+	}
+	is_open = 0;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->input_data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( is_open != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( bench_handle->input_data != NULL )
+	{
+		memory_free(
+		 bench_handle->input_data );
+
+		bench_handle->input_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens the input
+ * With the memory backend the volume is read into memory first
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_open_input(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "bench_handle_open_input";
+	size_t filename_length           = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - input file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open set file name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     bench_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open set volume offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle->backend == BENCH_HANDLE_BACKEND_MEMORY )
+	{
+		if( bench_handle_load_input_data(
+		     bench_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read input data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_memory_range_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize memory range IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_memory_range_set(
+		     file_io_handle,
+		     bench_handle->input_data,
+		     (size_t) bench_handle->input_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set memory range of IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	bench_handle->input_file_io_handle = file_io_handle;
+	file_io_handle                     = NULL;
+
+	if( bench_handle_open_volume(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( bench_handle->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( bench_handle->input_file_io_handle ),
+		 NULL );
+	}
+	if( bench_handle->input_data != NULL )
+	{
+		memory_free(
+		 bench_handle->input_data );
+
+		bench_handle->input_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int bench_handle_close_input(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_close_input";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_close_volume(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Opens the input volume on the input file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_open_volume(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_open_volume";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_volume_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - input volume already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_open_file_io_handle(
+	     bench_handle->input_volume,
+	     bench_handle->input_file_io_handle,
+	     LIBFSREFS_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input volume.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->input_volume_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the input volume
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_close_volume(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_close_volume";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_volume_is_open == 0 )
+	{
+		return( 1 );
+	}
+	bench_handle->input_volume_is_open = 0;
+
+	if( libfsrefs_volume_close(
+	     bench_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the path buffer
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_resize_path_buffer(
+     bench_handle_t *bench_handle,
+     size_t path_buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t *path_buffer  = NULL;
+	static char *function = "bench_handle_resize_path_buffer";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_buffer_size <= bench_handle->path_buffer_size )
+	{
+		return( 1 );
+	}
+	if( path_buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Grow the buffer in steps to limit the number of reallocations
+	 */
+	path_buffer_size = ( path_buffer_size & ~( (size_t) 1023 ) ) + 1024;
+
+	path_buffer = (uint8_t *) memory_reallocate(
+	                           bench_handle->path_buffer,
+	                           sizeof( uint8_t ) * path_buffer_size );
+
+	if( path_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize path buffer.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->path_buffer      = path_buffer;
+	bench_handle->path_buffer_size = path_buffer_size;
+
+	return( 1 );
+}
+
+/* Appends a sample
+ * Reservoir sampling is used so that every candidate has the same chance
+ * to be sampled, independent of the number of candidates
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_append_sample(
+     bench_handle_t *bench_handle,
+     bench_handle_sample_t *samples,
+     int *number_of_samples,
+     uint64_t number_of_candidates,
+     uint64_t parent_identifier,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     int sub_file_entry_index,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	bench_handle_sample_t *sample = NULL;
+	uint8_t *path                 = NULL;
+	static char *function         = "bench_handle_append_sample";
+	uint64_t sample_index         = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > bench_handle->path_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_samples < BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES )
+	{
+		sample_index = (uint64_t) *number_of_samples;
+	}
+	else
+	{
+		sample_index = bench_handle_get_random(
+		                &( bench_handle->random_state ) ) % number_of_candidates;
+
+		if( sample_index >= BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES )
+		{
+			return( 1 );
+		}
+	}
+	path = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( path_length + 1 ) );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     path,
+		     bench_handle->path_buffer,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			memory_free(
+			 path );
+
+			return( -1 );
+		}
+	}
+	path[ path_length ] = 0;
+
+	sample = &( samples[ sample_index ] );
+
+	if( sample->path != NULL )
+	{
+		memory_free(
+		 sample->path );
+	}
+	sample->parent_identifier    = parent_identifier;
+	sample->object_identifier    = file_entry_stat->object_identifier;
+	sample->sub_file_entry_index = sub_file_entry_index;
+	sample->size                 = file_entry_stat->size;
+	sample->path                 = path;
+	sample->path_length          = path_length;
+
+	if( (uint64_t) *number_of_samples == sample_index )
+	{
+		*number_of_samples += 1;
+	}
+	return( 1 );
+}
+
+/* Samples the sub directories and files of a directory
+ * The path of the directory is stored in the path buffer, with a trailing separator
+ * for directories other than the root directory
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_sample_directory(
+     bench_handle_t *bench_handle,
+     bench_handle_worker_t *worker,
+     libfsrefs_file_entry_t *file_entry,
+     uint64_t directory_identifier,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_stat_t file_entry_stat;
+
+	libfsrefs_file_entry_t *sub_file_entry = NULL;
+	static char *function                  = "bench_handle_sample_directory";
+	size_t name_length                     = 0;
+	size_t name_offset                     = 0;
+	size_t sub_path_length                 = 0;
+	int number_of_sub_file_entries         = 0;
+	int stat_values_are_stale              = 0;
+	int sub_file_entry_index               = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_worker_get_sub_file_entries_stat(
+	     worker,
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entries stat values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The worker buffers are reused by the sub directories, hence the stat
+	 * values are retrieved again after a sub directory was sampled
+	 */
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			break;
+		}
+		if( stat_values_are_stale != 0 )
+		{
+			stat_values_are_stale = 0;
+
+			if( bench_handle_worker_get_sub_file_entries_stat(
+			     worker,
+			     file_entry,
+			     &number_of_sub_file_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entries stat values.",
+				 function );
+
+				goto on_error;
+			}
+			if( sub_file_entry_index >= number_of_sub_file_entries )
+			{
+				break;
+			}
+		}
+		file_entry_stat = worker->file_entry_stats[ sub_file_entry_index ];
+
+		name_offset = file_entry_stat.name_offset;
+
+		/* Skip sub file entries with a name that cannot be converted to UTF-8
+		 */
+		if( file_entry_stat.name_size == 0 )
+		{
+			continue;
+		}
+		if( ( name_offset >= worker->utf8_names_size )
+		 || ( file_entry_stat.name_size > ( worker->utf8_names_size - name_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub file entry: %d name value out of bounds.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		name_length     = file_entry_stat.name_size - 1;
+		sub_path_length = path_length + name_length;
+
+		/* Reserve space for the separator of the sub path
+		 */
+		if( bench_handle_resize_path_buffer(
+		     bench_handle,
+		     sub_path_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize path buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( bench_handle->path_buffer[ path_length ] ),
+		     &( worker->utf8_names[ name_offset ] ),
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to path buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( file_entry_stat.file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
+		{
+			bench_handle->number_of_files += 1;
+
+			if( bench_handle_append_sample(
+			     bench_handle,
+			     bench_handle->file_samples,
+			     &( bench_handle->number_of_file_samples ),
+			     bench_handle->number_of_files,
+			     directory_identifier,
+			     &file_entry_stat,
+			     sub_file_entry_index,
+			     sub_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append file sample.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		bench_handle->number_of_directories += 1;
+
+		if( bench_handle_append_sample(
+		     bench_handle,
+		     bench_handle->directory_samples,
+		     &( bench_handle->number_of_directory_samples ),
+		     bench_handle->number_of_directories,
+		     directory_identifier,
+		     &file_entry_stat,
+		     sub_file_entry_index,
+		     sub_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory sample.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		bench_handle->path_buffer[ sub_path_length ] = (uint8_t) LIBFSREFS_SEPARATOR;
+
+		stat_values_are_stale = 1;
+
+		if( bench_handle_sample_directory(
+		     bench_handle,
+		     worker,
+		     sub_file_entry,
+		     file_entry_stat.object_identifier,
+		     sub_path_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sample sub directory: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Samples the directories and files of the file system
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_sample_file_system(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_stat_t file_entry_stat;
+	bench_handle_worker_t worker;
+
+	libfsrefs_file_entry_t *root_directory = NULL;
+	static char *function                  = "bench_handle_sample_file_system";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_handle->directory_samples != NULL )
+	 || ( bench_handle->file_samples != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - samples value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &worker,
+	     0,
+	     sizeof( bench_handle_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_entry_stat,
+	     0,
+	     sizeof( libfsrefs_file_entry_stat_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	worker.bench_handle = bench_handle;
+
+	bench_handle->directory_samples = (bench_handle_sample_t *) memory_allocate(
+	                                                             sizeof( bench_handle_sample_t ) * BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES );
+
+	if( bench_handle->directory_samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory samples.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bench_handle->directory_samples,
+	     0,
+	     sizeof( bench_handle_sample_t ) * BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory samples.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->file_samples = (bench_handle_sample_t *) memory_allocate(
+	                                                        sizeof( bench_handle_sample_t ) * BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES );
+
+	if( bench_handle->file_samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file samples.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bench_handle->file_samples,
+	     0,
+	     sizeof( bench_handle_sample_t ) * BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file samples.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->number_of_directories = 1;
+	bench_handle->number_of_files       = 0;
+	bench_handle->random_state          = bench_handle->seed;
+
+	if( libfsrefs_volume_get_root_directory(
+	     bench_handle->input_volume,
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_object_identifier(
+	     root_directory,
+	     &( file_entry_stat.object_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory object identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_resize_path_buffer(
+	     bench_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize path buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The root directory is sampled with an empty path and without parent
+	 */
+	if( bench_handle_append_sample(
+	     bench_handle,
+	     bench_handle->directory_samples,
+	     &( bench_handle->number_of_directory_samples ),
+	     bench_handle->number_of_directories,
+	     0,
+	     &file_entry_stat,
+	     -1,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root directory sample.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_sample_directory(
+	     bench_handle,
+	     &worker,
+	     root_directory,
+	     file_entry_stat.object_identifier,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sample root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_free(
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_worker_clear(
+	     &worker,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear worker.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	bench_handle_worker_clear(
+	 &worker,
+	 NULL );
+
+	bench_handle_free_samples(
+	 bench_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the samples
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_free_samples(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_free_samples";
+	int sample_index      = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->directory_samples != NULL )
+	{
+		for( sample_index = 0;
+		     sample_index < bench_handle->number_of_directory_samples;
+		     sample_index++ )
+		{
+			if( bench_handle->directory_samples[ sample_index ].path != NULL )
+			{
+				memory_free(
+				 bench_handle->directory_samples[ sample_index ].path );
+			}
+		}
+		memory_free(
+		 bench_handle->directory_samples );
+
+		bench_handle->directory_samples = NULL;
+	}
+	if( bench_handle->file_samples != NULL )
+	{
+		for( sample_index = 0;
+		     sample_index < bench_handle->number_of_file_samples;
+		     sample_index++ )
+		{
+			if( bench_handle->file_samples[ sample_index ].path != NULL )
+			{
+				memory_free(
+				 bench_handle->file_samples[ sample_index ].path );
+			}
+		}
+		memory_free(
+		 bench_handle->file_samples );
+
+		bench_handle->file_samples = NULL;
+	}
+	bench_handle->number_of_directory_samples = 0;
+	bench_handle->number_of_file_samples      = 0;
+
+	return( 1 );
+}
+
+/* Clears a worker
+ * Frees the buffers of the worker
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_worker_clear(
+     bench_handle_worker_t *worker,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_worker_clear";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->buffer != NULL )
+	{
+		memory_free(
+		 worker->buffer );
+
+		worker->buffer = NULL;
+	}
+	if( worker->file_entry_stats != NULL )
+	{
+		memory_free(
+		 worker->file_entry_stats );
+
+		worker->file_entry_stats = NULL;
+	}
+	if( worker->utf8_names != NULL )
+	{
+		memory_free(
+		 worker->utf8_names );
+
+		worker->utf8_names = NULL;
+	}
+	worker->number_of_file_entry_stats = 0;
+	worker->utf8_names_size            = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the stat values of the sub file entries of a file entry
+ * The stat values and names are stored in the buffers of the worker,
+ * which are resized as needed
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_worker_get_sub_file_entries_stat(
+     bench_handle_worker_t *worker,
+     libfsrefs_file_entry_t *file_entry,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_stat_t *file_entry_stats = NULL;
+	uint8_t *utf8_names                           = NULL;
+	static char *function                         = "bench_handle_worker_get_sub_file_entries_stat";
+	size_t utf8_names_size                        = 0;
+	int safe_number_of_sub_file_entries           = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &safe_number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_number_of_sub_file_entries <= 0 )
+	{
+		*number_of_sub_file_entries = 0;
+
+		return( 1 );
+	}
+	if( (size_t) safe_number_of_sub_file_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsrefs_file_entry_stat_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub file entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_sub_file_entries_utf8_names_size(
+	     file_entry,
+	     &utf8_names_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entries UTF-8 names size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The names size is 0 if none of the names can be converted to UTF-8
+	 */
+	if( utf8_names_size == 0 )
+	{
+		utf8_names_size = 1;
+	}
+	if( utf8_names_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub file entries UTF-8 names size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_number_of_sub_file_entries > worker->number_of_file_entry_stats )
+	{
+		file_entry_stats = (libfsrefs_file_entry_stat_t *) memory_reallocate(
+		                                                    worker->file_entry_stats,
+		                                                    sizeof( libfsrefs_file_entry_stat_t ) * safe_number_of_sub_file_entries );
+
+		if( file_entry_stats == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize file entry stats.",
+			 function );
+
+			return( -1 );
+		}
+		worker->file_entry_stats           = file_entry_stats;
+		worker->number_of_file_entry_stats = safe_number_of_sub_file_entries;
+	}
+	if( utf8_names_size > worker->utf8_names_size )
+	{
+		utf8_names = (uint8_t *) memory_reallocate(
+		                          worker->utf8_names,
+		                          sizeof( uint8_t ) * utf8_names_size );
+
+		if( utf8_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize UTF-8 names.",
+			 function );
+
+			return( -1 );
+		}
+		worker->utf8_names      = utf8_names;
+		worker->utf8_names_size = utf8_names_size;
+	}
+	if( libfsrefs_file_entry_get_sub_file_entries_stat(
+	     file_entry,
+	     worker->file_entry_stats,
+	     safe_number_of_sub_file_entries,
+	     worker->utf8_names,
+	     worker->utf8_names_size,
+	     &safe_number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entries stat values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sub_file_entries = safe_number_of_sub_file_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the file entry of a sample
+ * The file entry is retrieved from its parent directory, which is looked up by
+ * object identifier, or is the root directory for a sample without parent
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int bench_handle_worker_get_file_entry_by_sample(
+     bench_handle_worker_t *worker,
+     const bench_handle_sample_t *sample,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *parent_file_entry = NULL;
+	static char *function                     = "bench_handle_worker_get_file_entry_by_sample";
+	int result                                = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sample == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sample.",
+		 function );
+
+		return( -1 );
+	}
+	if( sample->sub_file_entry_index < 0 )
+	{
+		if( libfsrefs_volume_get_root_directory(
+		     worker->bench_handle->input_volume,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root directory.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libfsrefs_volume_get_file_entry_by_identifier(
+	          worker->bench_handle->input_volume,
+	          sample->parent_identifier,
+	          &parent_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file entry: 0x%08" PRIx64 ".",
+		 function,
+		 sample->parent_identifier );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     parent_file_entry,
+		     sample->sub_file_entry_index,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sample->sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_free(
+		     &parent_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parent file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( parent_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &parent_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Looks up the file entry of the path of a sample
+ * The path is resolved segment by segment from the root directory, where the
+ * name of every segment is looked up in the stat values of its parent directory
+ * Returns 1 if found, 0 if not or -1 on error
+ */
+int bench_handle_worker_lookup_path(
+     bench_handle_worker_t *worker,
+     const bench_handle_sample_t *sample,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *file_entry     = NULL;
+	libfsrefs_file_entry_t *sub_file_entry = NULL;
+	static char *function                  = "bench_handle_worker_lookup_path";
+	size_t name_offset                     = 0;
+	size_t path_index                      = 0;
+	size_t segment_length                  = 0;
+	size_t segment_start                   = 0;
+	int number_of_sub_file_entries         = 0;
+	int sub_file_entry_index               = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sample == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sample.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_get_root_directory(
+	     worker->bench_handle->input_volume,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
+		 function );
+
+		goto on_error;
+	}
+	while( path_index < sample->path_length )
+	{
+		segment_start = path_index;
+
+		while( ( path_index < sample->path_length )
+		    && ( sample->path[ path_index ] != (uint8_t) LIBFSREFS_SEPARATOR ) )
+		{
+			path_index++;
+		}
+		segment_length = path_index - segment_start;
+
+		/* Skip the segment separator
+		 */
+		path_index++;
+
+		if( segment_length == 0 )
+		{
+			continue;
+		}
+		if( bench_handle_worker_get_sub_file_entries_stat(
+		     worker,
+		     file_entry,
+		     &number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entries stat values.",
+			 function );
+
+			goto on_error;
+		}
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < number_of_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			name_offset = worker->file_entry_stats[ sub_file_entry_index ].name_offset;
+
+			if( ( worker->file_entry_stats[ sub_file_entry_index ].name_size != ( segment_length + 1 ) )
+			 || ( name_offset >= worker->utf8_names_size )
+			 || ( segment_length >= ( worker->utf8_names_size - name_offset ) ) )
+			{
+				continue;
+			}
+			if( memory_compare(
+			     &( worker->utf8_names[ name_offset ] ),
+			     &( sample->path[ segment_start ] ),
+			     segment_length ) == 0 )
+			{
+				break;
+			}
+		}
+		if( sub_file_entry_index >= number_of_sub_file_entries )
+		{
+			break;
+		}
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			goto on_error;
+		}
+		file_entry     = sub_file_entry;
+		sub_file_entry = NULL;
+	}
+	if( libfsrefs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_index < sample->path_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs a single operation of the lookup, read or stat scenarios
+ * The latency of read operations only covers the reads, not retrieving the file entry
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_worker_run_operation(
+     bench_handle_worker_t *worker,
+     uint64_t operation_index,
+     libcerror_error_t **error )
+{
+	bench_handle_sample_t *sample      = NULL;
+	bench_handle_t *bench_handle       = NULL;
+	libfsrefs_file_entry_t *file_entry = NULL;
+	static char *function              = "bench_handle_worker_run_operation";
+	uint64_t end_timestamp             = 0;
+	uint64_t random_value              = 0;
+	uint64_t start_timestamp           = 0;
+	off64_t read_offset                = 0;
+	ssize_t read_count                 = 0;
+	int number_of_sub_file_entries     = 0;
+	int result                         = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle = worker->bench_handle;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( operation_index >= bench_handle->number_of_operations )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid operation index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	random_value = bench_handle_get_random(
+	                &( worker->random_state ) );
+
+	switch( worker->scenario )
+	{
+		case BENCH_HANDLE_SCENARIO_PATH_LOOKUP:
+			/* Files are looked up, or directories on a volume without files
+			 */
+			if( bench_handle->number_of_file_samples > 0 )
+			{
+				sample = &( bench_handle->file_samples[ random_value % (uint64_t) bench_handle->number_of_file_samples ] );
+			}
+			else
+			{
+				sample = &( bench_handle->directory_samples[ random_value % (uint64_t) bench_handle->number_of_directory_samples ] );
+			}
+			start_timestamp = bench_handle_get_timestamp();
+
+			result = bench_handle_worker_lookup_path(
+			          worker,
+			          sample,
+			          error );
+
+			end_timestamp = bench_handle_get_timestamp();
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to look up path.",
+				 function );
+
+				goto on_error;
+			}
+			worker->number_of_items += (uint64_t) result;
+
+			break;
+
+		case BENCH_HANDLE_SCENARIO_OBJECT_LOOKUP:
+			sample = &( bench_handle->directory_samples[ random_value % (uint64_t) bench_handle->number_of_directory_samples ] );
+
+			start_timestamp = bench_handle_get_timestamp();
+
+			result = libfsrefs_volume_get_file_entry_by_identifier(
+			          bench_handle->input_volume,
+			          sample->object_identifier,
+			          &file_entry,
+			          error );
+
+			if( result == 1 )
+			{
+				if( libfsrefs_file_entry_free(
+				     &file_entry,
+				     error ) != 1 )
+				{
+					result = -1;
+				}
+			}
+			end_timestamp = bench_handle_get_timestamp();
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to look up object identifier: 0x%08" PRIx64 ".",
+				 function,
+				 sample->object_identifier );
+
+				goto on_error;
+			}
+			worker->number_of_items += (uint64_t) result;
+
+			break;
+
+		case BENCH_HANDLE_SCENARIO_SEQUENTIAL_READ:
+		case BENCH_HANDLE_SCENARIO_RANDOM_READ:
+			/* Sequential reads read the sampled files in order, random reads
+			 * read a single buffer at a random offset of a random file
+			 */
+			if( worker->scenario == BENCH_HANDLE_SCENARIO_SEQUENTIAL_READ )
+			{
+				sample = &( bench_handle->file_samples[ operation_index % (uint64_t) bench_handle->number_of_file_samples ] );
+			}
+			else
+			{
+				sample = &( bench_handle->file_samples[ random_value % (uint64_t) bench_handle->number_of_file_samples ] );
+			}
+			result = bench_handle_worker_get_file_entry_by_sample(
+			          worker,
+			          sample,
+			          &file_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file entry.",
+				 function );
+
+				goto on_error;
+			}
+			start_timestamp = bench_handle_get_timestamp();
+
+			if( result == 0 )
+			{
+				end_timestamp = start_timestamp;
+
+				break;
+			}
+			if( worker->scenario == BENCH_HANDLE_SCENARIO_SEQUENTIAL_READ )
+			{
+				do
+				{
+					read_count = libfsrefs_file_entry_read_buffer_at_offset(
+					              file_entry,
+					              worker->buffer,
+					              bench_handle->buffer_size,
+					              read_offset,
+					              error );
+
+					if( read_count < 0 )
+					{
+						break;
+					}
+					read_offset += (off64_t) read_count;
+				}
+				while( ( read_count > 0 )
+				    && ( bench_handle->abort == 0 ) );
+			}
+			else
+			{
+				if( sample->size > 0 )
+				{
+					/* Use a second random value to make the offset independent of the file
+					 */
+					read_offset = (off64_t) ( bench_handle_get_random(
+					                           &( worker->random_state ) ) % sample->size );
+				}
+				read_count = libfsrefs_file_entry_read_buffer_at_offset(
+				              file_entry,
+				              worker->buffer,
+				              bench_handle->buffer_size,
+				              read_offset,
+				              error );
+
+				if( read_count > 0 )
+				{
+					read_offset = (off64_t) read_count;
+				}
+				else
+				{
+					read_offset = 0;
+				}
+			}
+			end_timestamp = bench_handle_get_timestamp();
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of file entry.",
+				 function );
+
+				goto on_error;
+			}
+			worker->number_of_bytes += (uint64_t) read_offset;
+			worker->number_of_items += 1;
+
+			if( libfsrefs_file_entry_free(
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case BENCH_HANDLE_SCENARIO_STAT:
+			sample = &( bench_handle->directory_samples[ random_value % (uint64_t) bench_handle->number_of_directory_samples ] );
+
+			start_timestamp = bench_handle_get_timestamp();
+
+			result = libfsrefs_volume_get_file_entry_by_identifier(
+			          bench_handle->input_volume,
+			          sample->object_identifier,
+			          &file_entry,
+			          error );
+
+			if( result == 1 )
+			{
+				if( bench_handle_worker_get_sub_file_entries_stat(
+				     worker,
+				     file_entry,
+				     &number_of_sub_file_entries,
+				     error ) != 1 )
+				{
+					result = -1;
+				}
+				else if( libfsrefs_file_entry_free(
+				          &file_entry,
+				          error ) != 1 )
+				{
+					result = -1;
+				}
+			}
+			end_timestamp = bench_handle_get_timestamp();
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve stat values of directory: 0x%08" PRIx64 ".",
+				 function,
+				 sample->object_identifier );
+
+				goto on_error;
+			}
+			worker->number_of_items += (uint64_t) number_of_sub_file_entries;
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scenario: %d.",
+			 function,
+			 worker->scenario );
+
+			return( -1 );
+	}
+	bench_handle->latencies[ operation_index ] = end_timestamp - start_timestamp;
+
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the operations of a worker
+ * Callback function for libcthreads_thread_create
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_worker_run(
+     void *arguments )
+{
+	bench_handle_worker_t *worker = NULL;
+	libcerror_error_t *error      = NULL;
+	static char *function         = "bench_handle_worker_run";
+	uint64_t operation_index      = 0;
+
+	worker = (bench_handle_worker_t *) arguments;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	if( worker->bench_handle == NULL )
+	{
+		worker->result = -1;
+
+		return( -1 );
+	}
+	worker->result = 1;
+
+	for( operation_index = worker->first_operation_index;
+	     operation_index < ( worker->first_operation_index + worker->number_of_operations );
+	     operation_index++ )
+	{
+		if( worker->bench_handle->abort != 0 )
+		{
+			break;
+		}
+		if( bench_handle_worker_run_operation(
+		     worker,
+		     operation_index,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run operation: %" PRIu64 ".",
+			 function,
+			 operation_index );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			worker->result = -1;
+
+			break;
+		}
+	}
+	return( worker->result );
+}
+
+/* Runs the operations of a scenario on the workers
+ * The operations are divided over the workers, where every worker has its own
+ * random number generator derived from the seed. Without multi-threading support
+ * the workers run one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_workers(
+     bench_handle_t *bench_handle,
+     int scenario,
+     libcerror_error_t **error )
+{
+	bench_handle_worker_t *worker = NULL;
+	static char *function         = "bench_handle_run_workers";
+	uint64_t first_operation      = 0;
+	uint64_t number_of_operations = 0;
+	int result                    = 1;
+	int worker_index              = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_handle->number_of_threads <= 0 )
+	 || ( bench_handle->number_of_threads > BENCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bench handle - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->workers = (bench_handle_worker_t *) memory_allocate(
+	                                                   sizeof( bench_handle_worker_t ) * bench_handle->number_of_threads );
+
+	if( bench_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bench_handle->workers,
+	     0,
+	     sizeof( bench_handle_worker_t ) * bench_handle->number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < bench_handle->number_of_threads;
+	     worker_index++ )
+	{
+		worker = &( bench_handle->workers[ worker_index ] );
+
+		number_of_operations = bench_handle->number_of_operations / (uint64_t) bench_handle->number_of_threads;
+
+		if( (uint64_t) worker_index < ( bench_handle->number_of_operations % (uint64_t) bench_handle->number_of_threads ) )
+		{
+			number_of_operations += 1;
+		}
+		worker->bench_handle          = bench_handle;
+		worker->worker_index          = worker_index;
+		worker->scenario              = scenario;
+		worker->first_operation_index = first_operation;
+		worker->number_of_operations  = number_of_operations;
+		worker->random_state          = bench_handle->seed ^ ( ( (uint64_t) scenario << 32 ) | (uint64_t) ( worker_index + 1 ) );
+
+		first_operation += number_of_operations;
+
+		worker->buffer = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * bench_handle->buffer_size );
+
+		if( worker->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( bench_handle->number_of_threads > 1 )
+	{
+		for( worker_index = 0;
+		     worker_index < bench_handle->number_of_threads;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( bench_handle->workers[ worker_index ].thread ),
+			     NULL,
+			     &bench_handle_worker_run,
+			     (void *) &( bench_handle->workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* Join the threads that were created, also when creating a thread failed
+		 */
+		for( worker_index = 0;
+		     worker_index < bench_handle->number_of_threads;
+		     worker_index++ )
+		{
+			if( bench_handle->workers[ worker_index ].thread == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( bench_handle->workers[ worker_index ].thread ),
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of worker: %d.",
+					 function,
+					 worker_index );
+				}
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( worker_index = 0;
+		     worker_index < bench_handle->number_of_threads;
+		     worker_index++ )
+		{
+			bench_handle_worker_run(
+			 (void *) &( bench_handle->workers[ worker_index ] ) );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < bench_handle->number_of_threads;
+	     worker_index++ )
+	{
+		worker = &( bench_handle->workers[ worker_index ] );
+
+		if( ( result == 1 )
+		 && ( worker->result != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: worker: %d failed.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+		bench_handle->results[ bench_handle->number_of_results ].number_of_items += worker->number_of_items;
+		bench_handle->results[ bench_handle->number_of_results ].number_of_bytes += worker->number_of_bytes;
+
+		bench_handle_worker_clear(
+		 worker,
+		 NULL );
+	}
+	memory_free(
+	 bench_handle->workers );
+
+	bench_handle->workers = NULL;
+
+	return( result );
+
+on_error:
+	if( bench_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < bench_handle->number_of_threads;
+		     worker_index++ )
+		{
+			bench_handle_worker_clear(
+			 &( bench_handle->workers[ worker_index ] ),
+			 NULL );
+		}
+		memory_free(
+		 bench_handle->workers );
+
+		bench_handle->workers = NULL;
+	}
+	return( -1 );
+}
+
+/* Counts the file entries of a walk
+ * Callback function for libfsrefs_volume_walk_file_entries
+ * Returns 1 to continue the walk or 0 to stop
+ */
+int bench_handle_walk_callback(
+     libfsrefs_file_entry_t *file_entry FSREFSTOOLS_ATTRIBUTE_UNUSED,
+     intptr_t *user_data )
+{
+	bench_handle_t *bench_handle = NULL;
+
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( file_entry )
+
+	bench_handle = (bench_handle_t *) user_data;
+
+	if( bench_handle == NULL )
+	{
+		return( 0 );
+	}
+	bench_handle->results[ bench_handle->number_of_results ].number_of_items += 1;
+
+	if( bench_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a statistics value summed over all node types
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_statistics_value(
+     bench_handle_t *bench_handle,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_get_statistics_value";
+	uint64_t node_value   = 0;
+	uint64_t total_value  = 0;
+	int node_type         = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_type = LIBFSREFS_NODE_TYPE_UNKNOWN;
+	     node_type <= LIBFSREFS_NODE_TYPE_DATA;
+	     node_type++ )
+	{
+		if( libfsrefs_volume_get_statistics(
+		     bench_handle->input_volume,
+		     node_type,
+		     statistics_value,
+		     &node_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics value: %d of node type: %d.",
+			 function,
+			 statistics_value,
+			 node_type );
+
+			return( -1 );
+		}
+		total_value += node_value;
+	}
+	*value = total_value;
+
+	return( 1 );
+}
+
+/* Determines the speed of the system using a fixed workload
+ * The workload calculates a FNV-1a hash over a buffer, which depends on the
+ * same processor and memory performance as parsing metadata
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_calibrate(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data                = NULL;
+	static char *function        = "bench_handle_calibrate";
+	volatile uint32_t hash_value = 0;
+	uint64_t duration            = 0;
+	uint64_t start_timestamp     = 0;
+	size_t data_index            = 0;
+	int operation_index          = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * BENCH_HANDLE_CALIBRATION_DATA_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_index = 0;
+	     data_index < BENCH_HANDLE_CALIBRATION_DATA_SIZE;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index * 31 );
+	}
+	start_timestamp = bench_handle_get_timestamp();
+
+	for( operation_index = 0;
+	     operation_index < BENCH_HANDLE_NUMBER_OF_CALIBRATION_OPERATIONS;
+	     operation_index++ )
+	{
+		hash_value = 0x811c9dc5UL ^ (uint32_t) operation_index;
+
+		for( data_index = 0;
+		     data_index < BENCH_HANDLE_CALIBRATION_DATA_SIZE;
+		     data_index++ )
+		{
+			hash_value = ( hash_value ^ data[ data_index ] ) * 0x01000193UL;
+		}
+	}
+	duration = bench_handle_get_timestamp() - start_timestamp;
+
+	memory_free(
+	 data );
+
+	if( duration == 0 )
+	{
+		bench_handle->calibration_operations_per_second = 0.0;
+	}
+	else
+	{
+		bench_handle->calibration_operations_per_second = ( (double) BENCH_HANDLE_NUMBER_OF_CALIBRATION_OPERATIONS * 1000000000.0 ) / (double) duration;
+	}
+	return( 1 );
+}
+
+/* Runs a scenario
+ * The volume is reopened before every scenario so that every scenario starts
+ * without cached data and the library statistics only cover the scenario
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_scenario(
+     bench_handle_t *bench_handle,
+     int scenario,
+     libcerror_error_t **error )
+{
+	bench_handle_result_t *result = NULL;
+	static char *function         = "bench_handle_run_scenario";
+	uint64_t end_timestamp        = 0;
+	uint64_t number_of_operations = 0;
+	uint64_t operation_index      = 0;
+	uint64_t start_timestamp      = 0;
+	int walk_result               = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scenario < 0 )
+	 || ( scenario >= BENCH_HANDLE_NUMBER_OF_SCENARIOS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scenario: %d.",
+		 function,
+		 scenario );
+
+		return( -1 );
+	}
+	if( bench_handle->number_of_results >= BENCH_HANDLE_NUMBER_OF_SCENARIOS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bench handle - number of results value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = &( bench_handle->results[ bench_handle->number_of_results ] );
+
+	if( memory_set(
+	     result,
+	     0,
+	     sizeof( bench_handle_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result.",
+		 function );
+
+		return( -1 );
+	}
+	result->scenario = scenario;
+
+	if( ( scenario == BENCH_HANDLE_SCENARIO_OPEN )
+	 || ( scenario == BENCH_HANDLE_SCENARIO_WALK ) )
+	{
+		number_of_operations = (uint64_t) bench_handle->number_of_repetitions;
+	}
+	else if( ( ( scenario == BENCH_HANDLE_SCENARIO_SEQUENTIAL_READ )
+	        || ( scenario == BENCH_HANDLE_SCENARIO_RANDOM_READ ) )
+	      && ( bench_handle->number_of_file_samples == 0 ) )
+	{
+		number_of_operations = 0;
+	}
+	else if( bench_handle->number_of_directory_samples == 0 )
+	{
+		number_of_operations = 0;
+	}
+	else
+	{
+		number_of_operations = bench_handle->number_of_operations;
+	}
+	/* A scenario without operations is reported with zero values
+	 */
+	if( number_of_operations == 0 )
+	{
+		bench_handle->number_of_results += 1;
+
+		return( 1 );
+	}
+	bench_handle->latencies = (uint64_t *) memory_allocate(
+	                                        sizeof( uint64_t ) * (size_t) number_of_operations );
+
+	if( bench_handle->latencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create latencies.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bench_handle->latencies,
+	     0,
+	     sizeof( uint64_t ) * (size_t) number_of_operations ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear latencies.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_close_volume(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( scenario != BENCH_HANDLE_SCENARIO_OPEN )
+	{
+		if( bench_handle_open_volume(
+		     bench_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input volume.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsrefs_volume_clear_statistics(
+	     bench_handle->input_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+	start_timestamp = bench_handle_get_timestamp();
+
+	if( scenario == BENCH_HANDLE_SCENARIO_OPEN )
+	{
+		for( operation_index = 0;
+		     operation_index < number_of_operations;
+		     operation_index++ )
+		{
+			if( bench_handle->abort != 0 )
+			{
+				break;
+			}
+			/* The last open is kept for the next scenario
+			 */
+			if( operation_index > 0 )
+			{
+				if( bench_handle_close_volume(
+				     bench_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close input volume.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			end_timestamp = bench_handle_get_timestamp();
+
+			if( bench_handle_open_volume(
+			     bench_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open input volume.",
+				 function );
+
+				goto on_error;
+			}
+			bench_handle->latencies[ operation_index ] = bench_handle_get_timestamp() - end_timestamp;
+
+			result->number_of_items += 1;
+		}
+	}
+	else if( scenario == BENCH_HANDLE_SCENARIO_WALK )
+	{
+		for( operation_index = 0;
+		     operation_index < number_of_operations;
+		     operation_index++ )
+		{
+			if( bench_handle->abort != 0 )
+			{
+				break;
+			}
+			end_timestamp = bench_handle_get_timestamp();
+
+			walk_result = libfsrefs_volume_walk_file_entries(
+			               bench_handle->input_volume,
+			               NULL,
+			               &bench_handle_walk_callback,
+			               (intptr_t *) bench_handle,
+			               error );
+
+			if( walk_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to walk file entries.",
+				 function );
+
+				goto on_error;
+			}
+			bench_handle->latencies[ operation_index ] = bench_handle_get_timestamp() - end_timestamp;
+		}
+	}
+	else
+	{
+		if( bench_handle_run_workers(
+		     bench_handle,
+		     scenario,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run workers.",
+			 function );
+
+			goto on_error;
+		}
+		operation_index = number_of_operations;
+	}
+	end_timestamp = bench_handle_get_timestamp();
+
+	/* An aborted scenario only reports the operations that were run
+	 */
+	if( operation_index < number_of_operations )
+	{
+		number_of_operations = operation_index;
+	}
+	result->number_of_operations = number_of_operations;
+	result->duration             = end_timestamp - start_timestamp;
+
+	qsort(
+	 bench_handle->latencies,
+	 (size_t) number_of_operations,
+	 sizeof( uint64_t ),
+	 &bench_handle_compare_latencies );
+
+	if( bench_handle_get_percentile(
+	     bench_handle->latencies,
+	     number_of_operations,
+	     50,
+	     &( result->latency_p50 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 50th percentile latency.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_percentile(
+	     bench_handle->latencies,
+	     number_of_operations,
+	     99,
+	     &( result->latency_p99 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 99th percentile latency.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_operations > 0 )
+	{
+		result->latency_maximum = bench_handle->latencies[ number_of_operations - 1 ];
+	}
+	memory_free(
+	 bench_handle->latencies );
+
+	bench_handle->latencies = NULL;
+
+	if( bench_handle_get_statistics_value(
+	     bench_handle,
+	     LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+	     &( result->number_of_allocations ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_statistics_value(
+	     bench_handle,
+	     LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	     &( result->library_bytes_read ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_statistics_value(
+	     bench_handle,
+	     LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_READS,
+	     &( result->library_number_of_reads ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of reads.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_statistics_value(
+	     bench_handle,
+	     LIBFSREFS_STATISTICS_VALUE_CACHE_HITS,
+	     &( result->cache_hits ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache hits.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_statistics_value(
+	     bench_handle,
+	     LIBFSREFS_STATISTICS_VALUE_CACHE_MISSES,
+	     &( result->cache_misses ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache misses.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_peak_resident_set_size(
+	     &( result->peak_resident_set_size ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve peak resident set size.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->number_of_results += 1;
+
+	return( 1 );
+
+on_error:
+	if( bench_handle->latencies != NULL )
+	{
+		memory_free(
+		 bench_handle->latencies );
+
+		bench_handle->latencies = NULL;
+	}
+	return( -1 );
+}
+
+/* Runs the benchmark
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_run(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_run";
+	int scenario          = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->number_of_results = 0;
+
+	if( bench_handle_calibrate(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calibrate.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( bench_handle->scenario_flags & BENCH_HANDLE_SCENARIO_FLAGS_SAMPLED ) != 0 )
+	 && ( bench_handle->directory_samples == NULL ) )
+	{
+		if( bench_handle_sample_file_system(
+		     bench_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sample file system.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( scenario = 0;
+	     scenario < BENCH_HANDLE_NUMBER_OF_SCENARIOS;
+	     scenario++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		if( ( bench_handle->scenario_flags & ( 1 << scenario ) ) == 0 )
+		{
+			continue;
+		}
+		if( bench_handle_run_scenario(
+		     bench_handle,
+		     scenario,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run scenario: %s.",
+			 function,
+			 bench_handle_scenario_names[ scenario ] );
+
+			return( -1 );
+		}
+	}
+	if( bench_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Prints a string as a JSON string
+ */
+void bench_handle_json_string_fprint(
+      bench_handle_t *bench_handle,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	if( bench_handle == NULL )
+	{
+		return;
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "\"" );
+
+	if( string != NULL )
+	{
+		for( string_index = 0;
+		     string[ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( string[ string_index ] == (system_character_t) '"' )
+			 || ( string[ string_index ] == (system_character_t) '\\' ) )
+			{
+				fprintf(
+				 bench_handle->output_stream,
+				 "\\%" PRIc_SYSTEM "",
+				 string[ string_index ] );
+			}
+			else if( string[ string_index ] < (system_character_t) 0x20 )
+			{
+				fprintf(
+				 bench_handle->output_stream,
+				 "\\u%04x",
+				 (unsigned int) string[ string_index ] );
+			}
+			else
+			{
+				fprintf(
+				 bench_handle->output_stream,
+				 "%" PRIc_SYSTEM "",
+				 string[ string_index ] );
+			}
+		}
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "\"" );
+}
+
+/* Prints a rate per second as a JSON member
+ */
+void bench_handle_rate_fprint(
+      bench_handle_t *bench_handle,
+      const char *name,
+      uint64_t count,
+      uint64_t duration )
+{
+	double rate = 0.0;
+
+	if( bench_handle == NULL )
+	{
+		return;
+	}
+	if( duration > 0 )
+	{
+		rate = ( (double) count * 1000000000.0 ) / (double) duration;
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"%s\": %.3f,\n",
+	 name,
+	 rate );
+}
+
+/* Prints a result as a JSON object
+ */
+void bench_handle_result_fprint(
+      bench_handle_t *bench_handle,
+      const bench_handle_result_t *result )
+{
+	double allocations_per_operation = 0.0;
+	double normalized_rate           = 0.0;
+
+	if( bench_handle == NULL )
+	{
+		return;
+	}
+	if( result == NULL )
+	{
+		return;
+	}
+	if( result->number_of_operations > 0 )
+	{
+		allocations_per_operation = (double) result->number_of_allocations / (double) result->number_of_operations;
+	}
+	/* The normalized throughput is the number of operations per calibration
+	 * operation, which allows to compare runs on systems of different speed
+	 */
+	if( ( result->duration > 0 )
+	 && ( bench_handle->calibration_operations_per_second > 0.0 ) )
+	{
+		normalized_rate = ( ( (double) result->number_of_operations * 1000000000.0 ) / (double) result->duration )
+		                / bench_handle->calibration_operations_per_second;
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t{\n" );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"name\": \"%s\",\n",
+	 bench_handle_scenario_names[ result->scenario ] );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"operations\": %" PRIu64 ",\n",
+	 result->number_of_operations );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"items\": %" PRIu64 ",\n",
+	 result->number_of_items );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"bytes\": %" PRIu64 ",\n",
+	 result->number_of_bytes );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"duration_ns\": %" PRIu64 ",\n",
+	 result->duration );
+
+	bench_handle_rate_fprint(
+	 bench_handle,
+	 "operations_per_second",
+	 result->number_of_operations,
+	 result->duration );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"normalized_operations_per_second\": %.6f,\n",
+	 normalized_rate );
+
+	bench_handle_rate_fprint(
+	 bench_handle,
+	 "items_per_second",
+	 result->number_of_items,
+	 result->duration );
+
+	bench_handle_rate_fprint(
+	 bench_handle,
+	 "bytes_per_second",
+	 result->number_of_bytes,
+	 result->duration );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"latency_p50_ns\": %" PRIu64 ",\n",
+	 result->latency_p50 );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"latency_p99_ns\": %" PRIu64 ",\n",
+	 result->latency_p99 );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"latency_maximum_ns\": %" PRIu64 ",\n",
+	 result->latency_maximum );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"allocations\": %" PRIu64 ",\n",
+	 result->number_of_allocations );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"allocations_per_operation\": %.3f,\n",
+	 allocations_per_operation );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"library_bytes_read\": %" PRIu64 ",\n",
+	 result->library_bytes_read );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"library_reads\": %" PRIu64 ",\n",
+	 result->library_number_of_reads );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"cache_hits\": %" PRIu64 ",\n",
+	 result->cache_hits );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"cache_misses\": %" PRIu64 ",\n",
+	 result->cache_misses );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t\t\"peak_rss_bytes\": %" PRIu64 "\n",
+	 result->peak_resident_set_size );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\t}" );
+}
+
+/* Prints the results as a JSON document
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	const char *backend_name        = NULL;
+	static char *function           = "bench_handle_results_fprint";
+	uint64_t peak_resident_set_size = 0;
+	int result                      = 0;
+	int result_index                = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = bench_handle_get_peak_resident_set_size(
+	          &peak_resident_set_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve peak resident set size.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->backend == BENCH_HANDLE_BACKEND_MEMORY )
+	{
+		backend_name = "memory";
+	}
+	else
+	{
+		backend_name = "file";
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "{\n" );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"program\": \"fsrefsbench\",\n" );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"version\": \"%s\",\n",
+	 LIBFSREFS_VERSION_STRING );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"source\": " );
+
+	bench_handle_json_string_fprint(
+	 bench_handle,
+	 source );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 ",\n" );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"backend\": \"%s\",\n",
+	 backend_name );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"threads\": %d,\n",
+	 bench_handle->number_of_threads );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"operations\": %" PRIu64 ",\n",
+	 bench_handle->number_of_operations );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"repetitions\": %d,\n",
+	 bench_handle->number_of_repetitions );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"buffer_size\": %" PRIu64 ",\n",
+	 (uint64_t) bench_handle->buffer_size );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"memory_limit\": %" PRIu64 ",\n",
+	 bench_handle->memory_limit );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"seed\": %" PRIu64 ",\n",
+	 bench_handle->seed );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"directories\": %" PRIu64 ",\n",
+	 bench_handle->number_of_directories );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"files\": %" PRIu64 ",\n",
+	 bench_handle->number_of_files );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"calibration_operations_per_second\": %.3f,\n",
+	 bench_handle->calibration_operations_per_second );
+
+	if( result == 0 )
+	{
+		fprintf(
+		 bench_handle->output_stream,
+		 "\t\"peak_rss_bytes\": null,\n" );
+	}
+	else
+	{
+		fprintf(
+		 bench_handle->output_stream,
+		 "\t\"peak_rss_bytes\": %" PRIu64 ",\n",
+		 peak_resident_set_size );
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t\"scenarios\": [\n" );
+
+	for( result_index = 0;
+	     result_index < bench_handle->number_of_results;
+	     result_index++ )
+	{
+		bench_handle_result_fprint(
+		 bench_handle,
+		 &( bench_handle->results[ result_index ] ) );
+
+		if( result_index < ( bench_handle->number_of_results - 1 ) )
+		{
+			fprintf(
+			 bench_handle->output_stream,
+			 "," );
+		}
+		fprintf(
+		 bench_handle->output_stream,
+		 "\n" );
+	}
+	fprintf(
+	 bench_handle->output_stream,
+	 "\t]\n" );
+
+	fprintf(
+	 bench_handle->output_stream,
+	 "}\n" );
+
+	return( 1 );
+}
+
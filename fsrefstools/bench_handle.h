@@ -0,0 +1,605 @@
+/*
+ * Benchmark handle
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_HANDLE_H )
+#define _BENCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefstools_libbfio.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcthreads.h"
+#include "fsrefstools_libfsrefs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_OPERATIONS	10000
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_OPERATIONS	10000000
+
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_REPETITIONS	5
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_REPETITIONS	10000
+
+#define BENCH_HANDLE_DEFAULT_BUFFER_SIZE		65536
+#define BENCH_HANDLE_MAXIMUM_BUFFER_SIZE		( 16 * 1024 * 1024 )
+
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_THREADS		1
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS		32
+
+#define BENCH_HANDLE_DEFAULT_SEED			1
+
+/* The maximum number of directories and files that are sampled as targets of
+ * the lookup, read and stat scenarios
+ */
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_SAMPLES		65536
+
+/* The calibration workload is used to normalize the throughput of the scenarios
+ * for the speed of the system the benchmark runs on
+ */
+#define BENCH_HANDLE_CALIBRATION_DATA_SIZE		65536
+#define BENCH_HANDLE_NUMBER_OF_CALIBRATION_OPERATIONS	2000
+
+/* The size of the reads used to load the volume into memory
+ */
+#define BENCH_HANDLE_LOAD_READ_SIZE			( 16 * 1024 * 1024 )
+
+enum BENCH_HANDLE_BACKENDS
+{
+	BENCH_HANDLE_BACKEND_FILE			= (int) 'f',
+	BENCH_HANDLE_BACKEND_MEMORY			= (int) 'm'
+};
+
+enum BENCH_HANDLE_SCENARIOS
+{
+	BENCH_HANDLE_SCENARIO_OPEN			= 0,
+	BENCH_HANDLE_SCENARIO_WALK			= 1,
+	BENCH_HANDLE_SCENARIO_PATH_LOOKUP		= 2,
+	BENCH_HANDLE_SCENARIO_OBJECT_LOOKUP		= 3,
+	BENCH_HANDLE_SCENARIO_SEQUENTIAL_READ		= 4,
+	BENCH_HANDLE_SCENARIO_RANDOM_READ		= 5,
+	BENCH_HANDLE_SCENARIO_STAT			= 6,
+
+	BENCH_HANDLE_NUMBER_OF_SCENARIOS		= 7
+};
+
+#define BENCH_HANDLE_SCENARIO_FLAGS_ALL			0x7f
+
+/* The scenarios that operate on the sampled directories and files
+ */
+#define BENCH_HANDLE_SCENARIO_FLAGS_SAMPLED \
+	( ( 1 << BENCH_HANDLE_SCENARIO_PATH_LOOKUP ) \
+	| ( 1 << BENCH_HANDLE_SCENARIO_OBJECT_LOOKUP ) \
+	| ( 1 << BENCH_HANDLE_SCENARIO_SEQUENTIAL_READ ) \
+	| ( 1 << BENCH_HANDLE_SCENARIO_RANDOM_READ ) \
+	| ( 1 << BENCH_HANDLE_SCENARIO_STAT ) )
+
+typedef struct bench_handle_sample bench_handle_sample_t;
+
+struct bench_handle_sample
+{
+	/* The object identifier of the parent directory
+	 */
+	uint64_t parent_identifier;
+
+	/* The object identifier
+	 */
+	uint64_t object_identifier;
+
+	/* The index of the sub file entry in the parent directory
+	 */
+	int sub_file_entry_index;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The UTF-8 encoded path relative to the root directory
+	 */
+	uint8_t *path;
+
+	/* The path length, without the end of string character
+	 */
+	size_t path_length;
+};
+
+typedef struct bench_handle_result bench_handle_result_t;
+
+struct bench_handle_result
+{
+	/* The scenario
+	 */
+	int scenario;
+
+	/* The number of operations
+	 */
+	uint64_t number_of_operations;
+
+	/* The number of items, such as walked file entries, found lookups or stat values
+	 */
+	uint64_t number_of_items;
+
+	/* The number of bytes of file data read
+	 */
+	uint64_t number_of_bytes;
+
+	/* The duration in nano seconds
+	 */
+	uint64_t duration;
+
+	/* The median operation latency in nano seconds
+	 */
+	uint64_t latency_p50;
+
+	/* The 99th percentile operation latency in nano seconds
+	 */
+	uint64_t latency_p99;
+
+	/* The maximum operation latency in nano seconds
+	 */
+	uint64_t latency_maximum;
+
+	/* The number of allocations reported by the library statistics
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of bytes read by the library
+	 */
+	uint64_t library_bytes_read;
+
+	/* The number of reads of the library
+	 */
+	uint64_t library_number_of_reads;
+
+	/* The number of cache hits
+	 */
+	uint64_t cache_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t cache_misses;
+
+	/* The peak resident set size in bytes after the scenario or 0 if not available
+	 */
+	uint64_t peak_resident_set_size;
+};
+
+typedef struct bench_handle bench_handle_t;
+
+typedef struct bench_handle_worker bench_handle_worker_t;
+
+struct bench_handle_worker
+{
+	/* The bench handle
+	 */
+	bench_handle_t *bench_handle;
+
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The scenario
+	 */
+	int scenario;
+
+	/* The index of the first operation of the worker
+	 */
+	uint64_t first_operation_index;
+
+	/* The number of operations of the worker
+	 */
+	uint64_t number_of_operations;
+
+	/* The random number generator state
+	 */
+	uint64_t random_state;
+
+	/* The number of items
+	 */
+	uint64_t number_of_items;
+
+	/* The number of bytes of file data read
+	 */
+	uint64_t number_of_bytes;
+
+	/* The read buffer
+	 */
+	uint8_t *buffer;
+
+	/* The sub file entry stat values
+	 */
+	libfsrefs_file_entry_stat_t *file_entry_stats;
+
+	/* The number of allocated sub file entry stat values
+	 */
+	int number_of_file_entry_stats;
+
+	/* The UTF-8 encoded sub file entry names
+	 */
+	uint8_t *utf8_names;
+
+	/* The allocated size of the UTF-8 encoded sub file entry names
+	 */
+	size_t utf8_names_size;
+
+	/* The result of the worker
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct bench_handle
+{
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The backend
+	 */
+	int backend;
+
+	/* The scenario flags
+	 */
+	uint8_t scenario_flags;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of operations of the lookup, read and stat scenarios
+	 */
+	uint64_t number_of_operations;
+
+	/* The number of repetitions of the open and walk scenarios
+	 */
+	int number_of_repetitions;
+
+	/* The read buffer size
+	 */
+	size_t buffer_size;
+
+	/* The memory limit of the volume
+	 */
+	size64_t memory_limit;
+
+	/* The seed of the random number generators
+	 */
+	uint64_t seed;
+
+	/* The libbfio input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The volume data of the memory backend
+	 */
+	uint8_t *input_data;
+
+	/* The size of the volume data of the memory backend
+	 */
+	size64_t input_data_size;
+
+	/* The libfsrefs input volume
+	 */
+	libfsrefs_volume_t *input_volume;
+
+	/* Value to indicate the input volume is open
+	 */
+	int input_volume_is_open;
+
+	/* The path buffer used while sampling
+	 */
+	uint8_t *path_buffer;
+
+	/* The path buffer size
+	 */
+	size_t path_buffer_size;
+
+	/* The random number generator state used while sampling
+	 */
+	uint64_t random_state;
+
+	/* The directory samples
+	 */
+	bench_handle_sample_t *directory_samples;
+
+	/* The number of directory samples
+	 */
+	int number_of_directory_samples;
+
+	/* The number of directories
+	 */
+	uint64_t number_of_directories;
+
+	/* The file samples
+	 */
+	bench_handle_sample_t *file_samples;
+
+	/* The number of file samples
+	 */
+	int number_of_file_samples;
+
+	/* The number of files
+	 */
+	uint64_t number_of_files;
+
+	/* The operation latencies in nano seconds
+	 */
+	uint64_t *latencies;
+
+	/* The workers
+	 */
+	bench_handle_worker_t *workers;
+
+	/* The number of calibration operations per second
+	 */
+	double calibration_operations_per_second;
+
+	/* The results
+	 */
+	bench_handle_result_t results[ BENCH_HANDLE_NUMBER_OF_SCENARIOS ];
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+const char *bench_handle_get_scenario_name(
+             int scenario );
+
+uint64_t bench_handle_get_timestamp(
+          void );
+
+int bench_handle_get_peak_resident_set_size(
+     uint64_t *peak_resident_set_size,
+     libcerror_error_t **error );
+
+uint64_t bench_handle_get_random(
+          uint64_t *random_state );
+
+int bench_handle_compare_latencies(
+     const void *first_latency,
+     const void *second_latency );
+
+int bench_handle_get_percentile(
+     const uint64_t *latencies,
+     uint64_t number_of_latencies,
+     int percentile,
+     uint64_t *latency,
+     libcerror_error_t **error );
+
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_copy_decimal_string(
+     const system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int bench_handle_set_volume_offset(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_backend(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_scenarios(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_threads(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_operations(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_repetitions(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_buffer_size(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_memory_limit(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_seed(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_load_input_data(
+     bench_handle_t *bench_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int bench_handle_open_input(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int bench_handle_close_input(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_open_volume(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_close_volume(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_resize_path_buffer(
+     bench_handle_t *bench_handle,
+     size_t path_buffer_size,
+     libcerror_error_t **error );
+
+int bench_handle_append_sample(
+     bench_handle_t *bench_handle,
+     bench_handle_sample_t *samples,
+     int *number_of_samples,
+     uint64_t number_of_candidates,
+     uint64_t parent_identifier,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     int sub_file_entry_index,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int bench_handle_sample_directory(
+     bench_handle_t *bench_handle,
+     bench_handle_worker_t *worker,
+     libfsrefs_file_entry_t *file_entry,
+     uint64_t directory_identifier,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int bench_handle_sample_file_system(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_free_samples(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_worker_clear(
+     bench_handle_worker_t *worker,
+     libcerror_error_t **error );
+
+int bench_handle_worker_get_sub_file_entries_stat(
+     bench_handle_worker_t *worker,
+     libfsrefs_file_entry_t *file_entry,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error );
+
+int bench_handle_worker_get_file_entry_by_sample(
+     bench_handle_worker_t *worker,
+     const bench_handle_sample_t *sample,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int bench_handle_worker_lookup_path(
+     bench_handle_worker_t *worker,
+     const bench_handle_sample_t *sample,
+     libcerror_error_t **error );
+
+int bench_handle_worker_run_operation(
+     bench_handle_worker_t *worker,
+     uint64_t operation_index,
+     libcerror_error_t **error );
+
+int bench_handle_worker_run(
+     void *arguments );
+
+int bench_handle_run_workers(
+     bench_handle_t *bench_handle,
+     int scenario,
+     libcerror_error_t **error );
+
+int bench_handle_walk_callback(
+     libfsrefs_file_entry_t *file_entry,
+     intptr_t *user_data );
+
+int bench_handle_get_statistics_value(
+     bench_handle_t *bench_handle,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int bench_handle_calibrate(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_scenario(
+     bench_handle_t *bench_handle,
+     int scenario,
+     libcerror_error_t **error );
+
+int bench_handle_run(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+void bench_handle_json_string_fprint(
+      bench_handle_t *bench_handle,
+      const system_character_t *string );
+
+void bench_handle_rate_fprint(
+      bench_handle_t *bench_handle,
+      const char *name,
+      uint64_t count,
+      uint64_t duration );
+
+void bench_handle_result_fprint(
+      bench_handle_t *bench_handle,
+      const bench_handle_result_t *result );
+
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_HANDLE_H ) */
+
@@ -0,0 +1,1481 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "export_handle.h"
+#include "fsrefstools_libbfio.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcpath.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_system_string.h"
+
+#if !defined( LIBFSREFS_HAVE_BFIO )
+
+extern \
+int libfsrefs_volume_open_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsrefs_error_t **error );
+
+#endif /* !defined( LIBFSREFS_HAVE_BFIO ) */
+
+#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_initialize(
+	     &( ( *export_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_initialize(
+	     &( ( *export_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input volume.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->notify_stream = EXPORT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->input_file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *export_handle )->input_file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( export_handle_clear_batch(
+		     *export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsrefs_volume_free(
+		     &( ( *export_handle )->input_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input volume.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *export_handle )->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->target_path != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->target_path );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	if( export_handle->input_volume != NULL )
+	{
+		if( libfsrefs_volume_signal_abort(
+		     export_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input volume to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_volume_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_volume_offset";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fsrefstools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the target path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_set_target_path";
+	size_t target_path_length = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path != NULL )
+	{
+		memory_free(
+		 export_handle->target_path );
+
+		export_handle->target_path      = NULL;
+		export_handle->target_path_size = 0;
+	}
+	target_path_length = system_string_length(
+	                      target_path );
+
+	if( target_path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->target_path = system_string_allocate(
+	                              target_path_length + 1 );
+
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     export_handle->target_path,
+	     target_path,
+	     target_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target path.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->target_path[ target_path_length ] = 0;
+
+	export_handle->target_path_size = target_path_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->target_path != NULL )
+	{
+		memory_free(
+		 export_handle->target_path );
+
+		export_handle->target_path = NULL;
+	}
+	export_handle->target_path_size = 0;
+
+	return( -1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_open_input";
+	size_t filename_length = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     export_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     export_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open set file name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_range_set(
+	     export_handle->input_file_io_handle,
+	     export_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open set volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_open_file_io_handle(
+	     export_handle->input_volume,
+	     export_handle->input_file_io_handle,
+	     LIBFSREFS_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_close(
+	     export_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Writes data of a batch file entry to its output stream
+ * Callback function for libfsrefs_volume_read_file_entries_data
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_data(
+     int file_entry_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     intptr_t *user_data )
+{
+	export_handle_t *export_handle = NULL;
+	FILE *output_stream            = NULL;
+
+	export_handle = (export_handle_t *) user_data;
+
+	if( export_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( ( file_entry_index < 0 )
+	 || ( file_entry_index >= export_handle->number_of_batch_file_entries ) )
+	{
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 || ( data_offset < 0 ) )
+	{
+		return( -1 );
+	}
+	output_stream = export_handle->batch_output_streams[ file_entry_index ];
+
+	if( output_stream == NULL )
+	{
+		return( -1 );
+	}
+	if( file_stream_seek_offset(
+	     output_stream,
+	     data_offset,
+	     SEEK_SET ) != 0 )
+	{
+		return( -1 );
+	}
+	if( file_stream_write(
+	     output_stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		return( -1 );
+	}
+	if( ( data_offset + (off64_t) data_size ) > export_handle->batch_end_offsets[ file_entry_index ] )
+	{
+		export_handle->batch_end_offsets[ file_entry_index ] = data_offset + (off64_t) data_size;
+	}
+	return( 1 );
+}
+
+/* Clears the batch without exporting the data of its file entries
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_clear_batch(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_clear_batch";
+	int batch_index       = 0;
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( batch_index = 0;
+	     batch_index < export_handle->number_of_batch_file_entries;
+	     batch_index++ )
+	{
+		if( export_handle->batch_output_streams[ batch_index ] != NULL )
+		{
+			file_stream_close(
+			 export_handle->batch_output_streams[ batch_index ] );
+
+			export_handle->batch_output_streams[ batch_index ] = NULL;
+		}
+		export_handle->batch_end_offsets[ batch_index ] = 0;
+
+		if( libfsrefs_file_entry_free(
+		     &( export_handle->batch_file_entries[ batch_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free batch file entry: %d.",
+			 function,
+			 batch_index );
+
+			result = -1;
+		}
+	}
+	export_handle->number_of_batch_file_entries = 0;
+
+	return( result );
+}
+
+/* Exports the data of the file entries in the batch in physical order
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_flush_batch(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	uint8_t zero_byte     = 0;
+	static char *function = "export_handle_flush_batch";
+	size64_t file_size    = 0;
+	int batch_index       = 0;
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_batch_file_entries == 0 )
+	{
+		return( 1 );
+	}
+	result = libfsrefs_volume_read_file_entries_data(
+	          export_handle->input_volume,
+	          export_handle->batch_file_entries,
+	          export_handle->number_of_batch_file_entries,
+	          &export_handle_write_data,
+	          (intptr_t *) export_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data of batch file entries.",
+		 function );
+	}
+	for( batch_index = 0;
+	     batch_index < export_handle->number_of_batch_file_entries;
+	     batch_index++ )
+	{
+		if( result == 1 )
+		{
+			if( libfsrefs_file_entry_get_size(
+			     export_handle->batch_file_entries[ batch_index ],
+			     &file_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of batch file entry: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+			/* Extend the output file to the file size when it ends with a sparse range,
+			 * seeking beyond the end of the file leaves the skipped range as a hole
+			 */
+			else if( (size64_t) export_handle->batch_end_offsets[ batch_index ] < file_size )
+			{
+				if( file_stream_seek_offset(
+				     export_handle->batch_output_streams[ batch_index ],
+				     (off64_t) file_size - 1,
+				     SEEK_SET ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek end of output file of batch file entry: %d.",
+					 function,
+					 batch_index );
+
+					result = -1;
+				}
+				else if( file_stream_write(
+				          export_handle->batch_output_streams[ batch_index ],
+				          &zero_byte,
+				          1 ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write end of output file of batch file entry: %d.",
+					 function,
+					 batch_index );
+
+					result = -1;
+				}
+			}
+		}
+		if( file_stream_close(
+		     export_handle->batch_output_streams[ batch_index ] ) != 0 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file of batch file entry: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+		}
+		export_handle->batch_output_streams[ batch_index ] = NULL;
+		export_handle->batch_end_offsets[ batch_index ]    = 0;
+
+		if( libfsrefs_file_entry_free(
+		     &( export_handle->batch_file_entries[ batch_index ] ),
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free batch file entry: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		export_handle->number_of_exported_files += export_handle->number_of_batch_file_entries;
+	}
+	export_handle->number_of_batch_file_entries = 0;
+
+	return( result );
+}
+
+/* Appends a file entry to the batch and creates its output file
+ * The batch takes over the file entry if successful
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_append_batch_file_entry(
+     export_handle_t *export_handle,
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	FILE *output_stream   = NULL;
+	static char *function = "export_handle_append_batch_file_entry";
+	int batch_index       = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_batch_file_entries >= EXPORT_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILE_ENTRIES )
+	{
+		result = export_handle_flush_batch(
+		          export_handle,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to flush batch.",
+				 function );
+			}
+			return( result );
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	output_stream = file_stream_open_wide(
+	                 target_path,
+	                 L"wb" );
+#else
+	output_stream = file_stream_open(
+	                 target_path,
+	                 "wb" );
+#endif
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file: %" PRIs_SYSTEM ".",
+		 function,
+		 target_path );
+
+		return( -1 );
+	}
+	batch_index = export_handle->number_of_batch_file_entries;
+
+	export_handle->batch_file_entries[ batch_index ]   = file_entry;
+	export_handle->batch_output_streams[ batch_index ] = output_stream;
+	export_handle->batch_end_offsets[ batch_index ]    = 0;
+
+	export_handle->number_of_batch_file_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the target path of a sub file entry
+ * The name of the file entry is sanitized for use as a filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_sub_target_path(
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_length,
+     system_character_t **sub_target_path,
+     libcerror_error_t **error )
+{
+	system_character_t *name           = NULL;
+	system_character_t *sanitized_name = NULL;
+	static char *function              = "export_handle_get_sub_target_path";
+	size_t name_size                   = 0;
+	size_t sanitized_name_size         = 0;
+	size_t sub_target_path_size        = 0;
+	int result                         = 0;
+
+	if( sub_target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub target path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsrefs_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#else
+	result = libfsrefs_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_size <= 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing file entry name.",
+		 function );
+
+		goto on_error;
+	}
+	name = system_string_allocate(
+	        name_size );
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsrefs_file_entry_get_utf16_name(
+	          file_entry,
+	          (uint16_t *) name,
+	          name_size,
+	          error );
+#else
+	result = libfsrefs_file_entry_get_utf8_name(
+	          file_entry,
+	          (uint8_t *) name,
+	          name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_get_sanitized_filename_wide(
+	          name,
+	          name_size - 1,
+	          &sanitized_name,
+	          &sanitized_name_size,
+	          error );
+#else
+	result = libcpath_path_get_sanitized_filename(
+	          name,
+	          name_size - 1,
+	          &sanitized_name,
+	          &sanitized_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sanitized file entry name.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 name );
+
+	name = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+	          sub_target_path,
+	          &sub_target_path_size,
+	          target_path,
+	          target_path_length,
+	          sanitized_name,
+	          sanitized_name_size - 1,
+	          error );
+#else
+	result = libcpath_path_join(
+	          sub_target_path,
+	          &sub_target_path_size,
+	          target_path,
+	          target_path_length,
+	          sanitized_name,
+	          sanitized_name_size - 1,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub target path.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 sanitized_name );
+
+	return( 1 );
+
+on_error:
+	if( sanitized_name != NULL )
+	{
+		memory_free(
+		 sanitized_name );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	return( -1 );
+}
+
+/* Exports the sub file entries of a directory file entry
+ * Files are appended to the batch, sub directories are created and exported recursively.
+ * The batch is flushed before the directory file entry is released by the caller,
+ * since the sub file entries depend on it
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_directory(
+     export_handle_t *export_handle,
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *sub_file_entry = NULL;
+	system_character_t *sub_target_path    = NULL;
+	static char *function                  = "export_handle_export_directory";
+	size_t target_path_length              = 0;
+	uint32_t file_attribute_flags          = 0;
+	int number_of_sub_file_entries         = 0;
+	int result                             = 1;
+	int sub_file_entry_index               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	target_path_length = system_string_length(
+	                      target_path );
+
+	if( libfsrefs_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_get_file_attribute_flags(
+		     sub_file_entry,
+		     &file_attribute_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file attribute flags of sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_sub_target_path(
+		     sub_file_entry,
+		     target_path,
+		     target_path_length,
+		     &sub_target_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve target path of sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( ( file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) != 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libcpath_path_make_directory_wide(
+			          sub_target_path,
+			          error );
+#else
+			result = libcpath_path_make_directory(
+			          sub_target_path,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to create directory: %" PRIs_SYSTEM ".",
+				 function,
+				 sub_target_path );
+
+				goto on_error;
+			}
+			result = export_handle_export_directory(
+			          export_handle,
+			          sub_file_entry,
+			          sub_target_path,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			if( libfsrefs_file_entry_free(
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = export_handle_append_batch_file_entry(
+			          export_handle,
+			          sub_file_entry,
+			          sub_target_path,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub file entry: %d to batch.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			else if( result == 1 )
+			{
+				/* The batch took over the sub file entry
+				 */
+				sub_file_entry = NULL;
+			}
+		}
+		memory_free(
+		 sub_target_path );
+
+		sub_target_path = NULL;
+
+		if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( sub_file_entry != NULL )
+	{
+		if( libfsrefs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The batch can contain sub file entries of this directory
+	 * and must be flushed or cleared before the caller frees it
+	 */
+	if( result == 1 )
+	{
+		result = export_handle_flush_batch(
+		          export_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( export_handle_clear_batch(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( sub_target_path != NULL )
+	{
+		memory_free(
+		 sub_target_path );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	export_handle_clear_batch(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the file system
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_file_system(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *file_entry = NULL;
+	static char *function              = "export_handle_export_file_system";
+	int result                         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_make_directory_wide(
+	          export_handle->target_path,
+	          error );
+#else
+	result = libcpath_path_make_directory(
+	          export_handle->target_path,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to create target directory: %" PRIs_SYSTEM ".",
+		 function,
+		 export_handle->target_path );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_get_root_directory(
+	     export_handle->input_volume,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file entry.",
+		 function );
+
+		goto on_error;
+	}
+	result = export_handle_export_directory(
+	          export_handle,
+	          file_entry,
+	          export_handle->target_path,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exported %d files.\n",
+		 export_handle->number_of_exported_files );
+	}
+	return( result );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
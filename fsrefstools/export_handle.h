@@ -0,0 +1,169 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefstools_libbfio.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of file entries that are exported in a single physical order pass
+ * this also bounds the number of simultaneously open output files
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILE_ENTRIES	128
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The target path
+	 */
+	system_character_t *target_path;
+
+	/* The target path size
+	 */
+	size_t target_path_size;
+
+	/* The libbfio input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The libfsrefs input volume
+	 */
+	libfsrefs_volume_t *input_volume;
+
+	/* The file entries of the current batch
+	 */
+	libfsrefs_file_entry_t *batch_file_entries[ EXPORT_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILE_ENTRIES ];
+
+	/* The output streams of the current batch
+	 */
+	FILE *batch_output_streams[ EXPORT_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILE_ENTRIES ];
+
+	/* The end offsets of the data written to the output streams of the current batch
+	 */
+	off64_t batch_end_offsets[ EXPORT_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILE_ENTRIES ];
+
+	/* The number of file entries in the current batch
+	 */
+	int number_of_batch_file_entries;
+
+	/* The number of exported files
+	 */
+	int number_of_exported_files;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_volume_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_data(
+     int file_entry_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     intptr_t *user_data );
+
+int export_handle_clear_batch(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_flush_batch(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_append_batch_file_entry(
+     export_handle_t *export_handle,
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+int export_handle_get_sub_target_path(
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_length,
+     system_character_t **sub_target_path,
+     libcerror_error_t **error );
+
+int export_handle_export_directory(
+     export_handle_t *export_handle,
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+int export_handle_export_file_system(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
@@ -0,0 +1,627 @@
+/*
+ * Benchmarks reading a Resiliant File System (ReFS) volume.
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "bench_handle.h"
+#include "fsrefstools_getopt.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libclocale.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_output.h"
+#include "fsrefstools_signal.h"
+#include "fsrefstools_unused.h"
+
+bench_handle_t *fsrefsbench_bench_handle = NULL;
+int fsrefsbench_abort                    = 0;
+
+/* Signal handler for fsrefsbench
+ */
+void fsrefsbench_signal_handler(
+      fsrefstools_signal_t signal FSREFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fsrefsbench_signal_handler";
+
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsrefsbench_abort = 1;
+
+	if( fsrefsbench_bench_handle != NULL )
+	{
+		if( bench_handle_signal_abort(
+		     fsrefsbench_bench_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal bench handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use fsrefsbench to benchmark reading a Resiliant File System (ReFS) volume.\n"
+		"The results of the scenarios are written to stdout as JSON.";
+
+	fsrefstools_option_t options[ ] = {
+		{ 'B', "backend", "read the volume from: file (default) or memory, where memory reads the whole volume into memory first" },
+		{ 'b', "size", "specify the read buffer size in bytes (default is 65536)" },
+		{ 'h', NULL, "shows this help" },
+		{ 'm', "size", "specify the memory limit of the volume in bytes, 0 represents no limit (default)" },
+		{ 'n', "number", "specify the number of operations of the lookup, read and stat scenarios (default is 10000)" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'r', "number", "specify the number of repetitions of the open and walk scenarios (default is 5)" },
+		{ 'S', "seed", "specify the seed of the random number generators (default is 1)" },
+		{ 's', "scenarios", "run scenarios, options: all (default), open, walk, path_lookup, object_lookup, sequential_read, random_read, stat, a combination is specified as a comma separated list" },
+		{ 't', "threads", "specify the number of threads of the lookup, read and stat scenarios (default is 1)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libfsrefs_error_t *error                         = NULL;
+	system_character_t *option_backend               = NULL;
+	system_character_t *option_buffer_size           = NULL;
+	system_character_t *option_memory_limit          = NULL;
+	system_character_t *option_number_of_operations  = NULL;
+	system_character_t *option_number_of_repetitions = NULL;
+	system_character_t *option_number_of_threads     = NULL;
+	system_character_t *option_scenarios             = NULL;
+	system_character_t *option_seed                  = NULL;
+	system_character_t *option_volume_offset         = NULL;
+	system_character_t *source                       = NULL;
+	char *program                                    = "fsrefsbench";
+	system_integer_t option                          = 0;
+	int number_of_options                            = (int) ( sizeof( options ) / sizeof( fsrefstools_option_t ) );
+	int result                                       = 0;
+	int verbose                                      = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsrefstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The results are written to stdout
+	 */
+	fsrefstools_output_version_fprint(
+	 stderr,
+	 program );
+
+	if( fsrefstools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = fsrefstools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'B':
+				option_backend = optarg;
+
+				break;
+
+			case (system_integer_t) 'b':
+				option_buffer_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				option_memory_limit = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_number_of_operations = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_volume_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_number_of_repetitions = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_scenarios = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsrefstools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		fsrefstools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfsrefs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsrefs_notify_set_verbose(
+	 verbose );
+
+	if( bench_handle_initialize(
+	     &fsrefsbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize bench handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( fsrefsbench_bench_handle != NULL );
+#endif
+	if( option_volume_offset != NULL )
+	{
+		if( bench_handle_set_volume_offset(
+		     fsrefsbench_bench_handle,
+		     option_volume_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 fsrefsbench_bench_handle->volume_offset );
+		}
+	}
+	if( option_backend != NULL )
+	{
+		result = bench_handle_set_backend(
+		          fsrefsbench_bench_handle,
+		          option_backend,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set backend.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported backend defaulting to: file.\n" );
+		}
+	}
+	if( option_scenarios != NULL )
+	{
+		result = bench_handle_set_scenarios(
+		          fsrefsbench_bench_handle,
+		          option_scenarios,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set scenarios.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported scenarios defaulting to: all.\n" );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = bench_handle_set_number_of_threads(
+		          fsrefsbench_bench_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 fsrefsbench_bench_handle->number_of_threads );
+		}
+	}
+	if( option_number_of_operations != NULL )
+	{
+		result = bench_handle_set_number_of_operations(
+		          fsrefsbench_bench_handle,
+		          option_number_of_operations,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of operations defaulting to: %" PRIu64 ".\n",
+			 fsrefsbench_bench_handle->number_of_operations );
+		}
+	}
+	if( option_number_of_repetitions != NULL )
+	{
+		result = bench_handle_set_number_of_repetitions(
+		          fsrefsbench_bench_handle,
+		          option_number_of_repetitions,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of repetitions defaulting to: %d.\n",
+			 fsrefsbench_bench_handle->number_of_repetitions );
+		}
+	}
+	if( option_buffer_size != NULL )
+	{
+		result = bench_handle_set_buffer_size(
+		          fsrefsbench_bench_handle,
+		          option_buffer_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported buffer size defaulting to: %" PRIu64 ".\n",
+			 (uint64_t) fsrefsbench_bench_handle->buffer_size );
+		}
+	}
+	if( option_memory_limit != NULL )
+	{
+		if( bench_handle_set_memory_limit(
+		     fsrefsbench_bench_handle,
+		     option_memory_limit,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported memory limit defaulting to: no limit.\n" );
+		}
+	}
+	if( option_seed != NULL )
+	{
+		if( bench_handle_set_seed(
+		     fsrefsbench_bench_handle,
+		     option_seed,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported seed defaulting to: %" PRIu64 ".\n",
+			 fsrefsbench_bench_handle->seed );
+		}
+	}
+	if( bench_handle_open_input(
+	     fsrefsbench_bench_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( fsrefstools_signal_attach(
+	     fsrefsbench_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = bench_handle_run(
+	          fsrefsbench_bench_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fsrefsbench_abort == 0 )
+	{
+		if( bench_handle_results_fprint(
+		     fsrefsbench_bench_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print results.\n" );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_close_input(
+	     fsrefsbench_bench_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close bench handle.\n" );
+
+		goto on_error;
+	}
+	if( bench_handle_free(
+	     &fsrefsbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free bench handle.\n" );
+
+		goto on_error;
+	}
+	if( fsrefsbench_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fsrefsbench_bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &fsrefsbench_bench_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,454 @@
+/*
+ * Exports the files of a Resiliant File System (ReFS) volume.
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "fsrefstools_getopt.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libclocale.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_output.h"
+#include "fsrefstools_signal.h"
+#include "fsrefstools_unused.h"
+
+export_handle_t *fsrefsexport_export_handle = NULL;
+int fsrefsexport_abort                      = 0;
+
+/* Signal handler for fsrefsexport
+ */
+void fsrefsexport_signal_handler(
+      fsrefstools_signal_t signal FSREFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fsrefsexport_signal_handler";
+
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsrefsexport_abort = 1;
+
+	if( fsrefsexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     fsrefsexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use fsrefsexport to export the files of a Resiliant File System (ReFS) volume.\n"
+		"The file data is read in physical order of the volume.";
+
+	fsrefstools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 't', "target", "specify the target directory to export to (default is source.export)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libfsrefs_error_t *error                 = NULL;
+	system_character_t *option_target_path   = NULL;
+	system_character_t *option_volume_offset = NULL;
+	system_character_t *source               = NULL;
+	system_character_t *target_path          = NULL;
+	char *program                            = "fsrefsexport";
+	size_t source_length                     = 0;
+	system_integer_t option                  = 0;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( fsrefstools_option_t ) );
+	int result                               = 0;
+	int verbose                              = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsrefstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	fsrefstools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( fsrefstools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = fsrefstools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_volume_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsrefstools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		fsrefstools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfsrefs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsrefs_notify_set_verbose(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &fsrefsexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( fsrefsexport_export_handle != NULL );
+#endif
+	if( option_volume_offset != NULL )
+	{
+		if( export_handle_set_volume_offset(
+		     fsrefsexport_export_handle,
+		     option_volume_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 fsrefsexport_export_handle->volume_offset );
+		}
+	}
+	if( option_target_path == NULL )
+	{
+		source_length = system_string_length(
+		                 source );
+
+		target_path = system_string_allocate(
+		               source_length + 8 );
+
+		if( target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create target path.\n" );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     target_path,
+		     source,
+		     source_length ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to copy source to target path.\n" );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     &( target_path[ source_length ] ),
+		     _SYSTEM_STRING( ".export" ),
+		     7 ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to copy extension to target path.\n" );
+
+			goto on_error;
+		}
+		target_path[ source_length + 7 ] = 0;
+
+		option_target_path = target_path;
+	}
+	if( export_handle_set_target_path(
+	     fsrefsexport_export_handle,
+	     option_target_path,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set target path.\n" );
+
+		goto on_error;
+	}
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+
+		target_path = NULL;
+	}
+	if( export_handle_open_input(
+	     fsrefsexport_export_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( fsrefstools_signal_attach(
+	     fsrefsexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = export_handle_export_file_system(
+	          fsrefsexport_export_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export file system.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_close_input(
+	     fsrefsexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close export handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &fsrefsexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( fsrefsexport_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	if( fsrefsexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &fsrefsexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,471 @@
+/*
+ * Calculates digest hashes of the files of a Resiliant File System (ReFS) volume.
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fsrefstools_getopt.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libclocale.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_output.h"
+#include "fsrefstools_signal.h"
+#include "fsrefstools_unused.h"
+#include "hash_handle.h"
+
+hash_handle_t *fsrefshash_hash_handle = NULL;
+int fsrefshash_abort                  = 0;
+
+/* Signal handler for fsrefshash
+ */
+void fsrefshash_signal_handler(
+      fsrefstools_signal_t signal FSREFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fsrefshash_signal_handler";
+
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsrefshash_abort = 1;
+
+	if( fsrefshash_hash_handle != NULL )
+	{
+		if( hash_handle_signal_abort(
+		     fsrefshash_hash_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal hash handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use fsrefshash to calculate digest hashes of the files of a Resiliant File System (ReFS) volume.\n"
+		"The file data is read in physical order of the volume and hashed by multiple threads.";
+
+	fsrefstools_option_t options[ ] = {
+		{ 'd', "type", "calculate digest (hash) types, options: md5 (default), sha1, sha256, a combination is specified as a comma separated list" },
+		{ 'f', "format", "output format, options: csv (default), bodyfile" },
+		{ 'h', NULL, "shows this help" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 't', "threads", "specify the number of hashing threads (default is 4), 0 hashes the data in the reading thread" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libfsrefs_error_t *error                     = NULL;
+	system_character_t *option_digest_types      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_output_format     = NULL;
+	system_character_t *option_volume_offset     = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "fsrefshash";
+	system_integer_t option                      = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( fsrefstools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsrefstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The digest hashes are written to stdout
+	 */
+	fsrefstools_output_version_fprint(
+	 stderr,
+	 program );
+
+	if( fsrefstools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = fsrefstools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'd':
+				option_digest_types = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_volume_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsrefstools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		fsrefstools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfsrefs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsrefs_notify_set_verbose(
+	 verbose );
+
+	if( hash_handle_initialize(
+	     &fsrefshash_hash_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize hash handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( fsrefshash_hash_handle != NULL );
+#endif
+	if( option_volume_offset != NULL )
+	{
+		if( hash_handle_set_volume_offset(
+		     fsrefshash_hash_handle,
+		     option_volume_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 fsrefshash_hash_handle->volume_offset );
+		}
+	}
+	if( option_digest_types != NULL )
+	{
+		result = hash_handle_set_digest_types(
+		          fsrefshash_hash_handle,
+		          option_digest_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set digest types.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported digest types defaulting to: md5.\n" );
+		}
+	}
+	if( option_output_format != NULL )
+	{
+		result = hash_handle_set_output_format(
+		          fsrefshash_hash_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: csv.\n" );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = hash_handle_set_number_of_threads(
+		          fsrefshash_hash_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 fsrefshash_hash_handle->number_of_threads );
+		}
+	}
+	if( hash_handle_open_input(
+	     fsrefshash_hash_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( fsrefstools_signal_attach(
+	     fsrefshash_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = hash_handle_hash_file_system(
+	          fsrefshash_hash_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to hash file system.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_handle_close_input(
+	     fsrefshash_hash_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close hash handle.\n" );
+
+		goto on_error;
+	}
+	if( hash_handle_free(
+	     &fsrefshash_hash_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free hash handle.\n" );
+
+		goto on_error;
+	}
+	if( fsrefshash_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fsrefshash_hash_handle != NULL )
+	{
+		hash_handle_free(
+		 &fsrefshash_hash_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -117,9 +117,12 @@ int main( int argc, char * const argv[] )
 		"Use fsrefsinfo to determine information about a Resiliant File System (ReFS) volume.";
 
 	fsrefstools_option_t options[ ] = {
+		{ 'B', "bodyfile", "output file system information as a bodyfile" },
+		{ 'f', "format", "output format of the file system hierarchy, options: text (default), binary, csv, jsonl" },
 		{ 'h', NULL, "shows this help" },
 		{ 'H', NULL, "shows the file system hierarchy" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'T', "timeline", "output a timeline in the mactime CSV format sorted by date and time" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source volume" },
@@ -127,6 +130,9 @@ int main( int argc, char * const argv[] )
 	system_character_t options_string[ 32 ];
 
 	libfsrefs_error_t *error                 = NULL;
+	system_character_t *option_bodyfile      = NULL;
+	system_character_t *option_output_format = NULL;
+	system_character_t *option_timeline      = NULL;
 	system_character_t *option_volume_offset = NULL;
 	system_character_t *source               = NULL;
 	char *program                            = "fsrefsinfo";
@@ -134,6 +140,7 @@ int main( int argc, char * const argv[] )
 	uint8_t calculate_md5                    = 0;
 	int number_of_options                    = (int) ( sizeof( options ) / sizeof( fsrefstools_option_t ) );
 	int option_mode                          = FSREFSINFO_MODE_VOLUME;
+	int result                               = 0;
 	int verbose                              = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
@@ -167,10 +174,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	fsrefstools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( fsrefstools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -192,6 +195,10 @@ int main( int argc, char * const argv[] )
 		{
 			case (system_integer_t) '?':
 			default:
+				fsrefstools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -206,7 +213,23 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'B':
+				option_bodyfile = optarg;
+				option_mode     = FSREFSINFO_MODE_FILE_SYSTEM_HIERARCHY;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_output_format = optarg;
+				option_mode          = FSREFSINFO_MODE_FILE_SYSTEM_HIERARCHY;
+
+				break;
+
 			case (system_integer_t) 'h':
+				fsrefstools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fsrefstools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -226,12 +249,22 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'T':
+				option_timeline = optarg;
+				option_mode     = FSREFSINFO_MODE_FILE_SYSTEM_HIERARCHY;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				fsrefstools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fsrefstools_output_copyright_fprint(
 				 stdout );
 
@@ -240,6 +273,10 @@ int main( int argc, char * const argv[] )
 	}
 	if( optind == argc )
 	{
+		fsrefstools_output_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source volume.\n" );
@@ -277,6 +314,67 @@ int main( int argc, char * const argv[] )
 #if defined( __clang_analyzer__ )
 	__builtin_assume( fsrefsinfo_info_handle != NULL );
 #endif
+	if( option_output_format != NULL )
+	{
+		result = info_handle_set_output_format(
+		          fsrefsinfo_info_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The version is not printed when the file system hierarchy is output
+	 * in a record format so that the output only contains records
+	 */
+	if( fsrefsinfo_info_handle->output_format == 0 )
+	{
+		fsrefstools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( option_bodyfile != NULL )
+	{
+		if( info_handle_set_bodyfile(
+		     fsrefsinfo_info_handle,
+		     option_bodyfile,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set bodyfile.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_timeline != NULL )
+	{
+		if( info_handle_set_timeline(
+		     fsrefsinfo_info_handle,
+		     option_timeline,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set timeline.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_volume_offset != NULL )
 	{
 		if( info_handle_set_volume_offset(
@@ -0,0 +1,598 @@
+/*
+ * Mounts a Resiliant File System (ReFS) volume.
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fsrefstools_getopt.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libclocale.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_output.h"
+#include "fsrefstools_signal.h"
+#include "fsrefstools_unused.h"
+#include "mount_fuse.h"
+#include "mount_handle.h"
+
+mount_handle_t *fsrefsmount_mount_handle = NULL;
+int fsrefsmount_abort                    = 0;
+
+/* Signal handler for fsrefsmount
+ */
+void fsrefsmount_signal_handler(
+      fsrefstools_signal_t signal FSREFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fsrefsmount_signal_handler";
+
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsrefsmount_abort = 1;
+
+	if( fsrefsmount_mount_handle != NULL )
+	{
+		if( mount_handle_signal_abort(
+		     fsrefsmount_mount_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal mount handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use fsrefsmount to mount a Resiliant File System (ReFS) volume read-only.";
+
+	fsrefstools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 's', NULL, "handle file system requests in a single thread" },
+		{ 'v', NULL, "verbose output to stderr, while mount_point remains running in the foreground" },
+		{ 'V', NULL, "print version" },
+		{ 'X', "extended_options", "extended options to pass to sub system" },
+		{ 0, "source", "the source volume" },
+		{ 0, "mount_point", "the directory to serve as mount point" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libfsrefs_error_t *error                     = NULL;
+	system_character_t *mount_point              = NULL;
+	system_character_t *option_extended_options  = NULL;
+	system_character_t *option_volume_offset     = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "fsrefsmount";
+	system_integer_t option                      = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( fsrefstools_option_t ) );
+	int result                                   = 0;
+	int single_threaded                          = 0;
+	int verbose                                  = 0;
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	struct fuse_operations fsrefsmount_fuse_operations;
+
+	struct fuse_args fsrefsmount_fuse_arguments  = FUSE_ARGS_INIT(0, NULL);
+	struct fuse *fsrefsmount_fuse_handle         = NULL;
+
+#if !defined( HAVE_LIBFUSE3 )
+	struct fuse_chan *fsrefsmount_fuse_channel   = NULL;
+#endif
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) */
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsrefstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsrefstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	fsrefstools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( fsrefstools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = fsrefstools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				fsrefstools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_volume_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				single_threaded = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsrefstools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'X':
+				option_extended_options = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		fsrefstools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind++ ];
+
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing mount point.\n" );
+
+		fsrefstools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	mount_point = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfsrefs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsrefs_notify_set_verbose(
+	 verbose );
+
+	if( mount_handle_initialize(
+	     &fsrefsmount_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize mount handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( fsrefsmount_mount_handle != NULL );
+#endif
+	if( option_volume_offset != NULL )
+	{
+		if( mount_handle_set_volume_offset(
+		     fsrefsmount_mount_handle,
+		     option_volume_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 fsrefsmount_mount_handle->volume_offset );
+		}
+	}
+	if( mount_handle_open(
+	     fsrefsmount_mount_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	if( option_extended_options != NULL )
+	{
+		/* This argument is required but ignored
+		 */
+		if( fuse_opt_add_arg(
+		     &fsrefsmount_fuse_arguments,
+		     "" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &fsrefsmount_fuse_arguments,
+		     "-o" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &fsrefsmount_fuse_arguments,
+		     option_extended_options ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+#if !defined( HAVE_LIBFUSE3 )
+	else if( fuse_opt_add_arg(
+	          &fsrefsmount_fuse_arguments,
+	          "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	/* Let the kernel cache data, names and attributes since the volume is read-only
+	 * fuse 3 sets these in the init callback
+	 */
+	if( fuse_opt_add_arg(
+	     &fsrefsmount_fuse_arguments,
+	     "-okernel_cache,entry_timeout=3600,attr_timeout=3600,negative_timeout=3600" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+#endif
+	if( memory_set(
+	     &fsrefsmount_fuse_operations,
+	     0,
+	     sizeof( struct fuse_operations ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear fuse operations.\n" );
+
+		goto on_error;
+	}
+	fsrefsmount_fuse_operations.open       = &mount_fuse_open;
+	fsrefsmount_fuse_operations.read       = &mount_fuse_read;
+	fsrefsmount_fuse_operations.release    = &mount_fuse_release;
+	fsrefsmount_fuse_operations.opendir    = &mount_fuse_opendir;
+	fsrefsmount_fuse_operations.readdir    = &mount_fuse_readdir;
+	fsrefsmount_fuse_operations.releasedir = &mount_fuse_releasedir;
+	fsrefsmount_fuse_operations.getattr    = &mount_fuse_getattr;
+	fsrefsmount_fuse_operations.init       = &mount_fuse_init;
+
+#if defined( HAVE_LIBFUSE3 )
+	fsrefsmount_fuse_handle = fuse_new(
+	                           &fsrefsmount_fuse_arguments,
+	                           &fsrefsmount_fuse_operations,
+	                           sizeof( struct fuse_operations ),
+	                           fsrefsmount_mount_handle );
+
+	if( fsrefsmount_fuse_handle == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse handle.\n" );
+
+		goto on_error;
+	}
+	result = fuse_mount(
+	          fsrefsmount_fuse_handle,
+	          mount_point );
+
+	if( result != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to fuse mount file system.\n" );
+
+		goto on_error;
+	}
+#else
+	fsrefsmount_fuse_channel = fuse_mount(
+	                            mount_point,
+	                            &fsrefsmount_fuse_arguments );
+
+	if( fsrefsmount_fuse_channel == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse channel.\n" );
+
+		goto on_error;
+	}
+	fsrefsmount_fuse_handle = fuse_new(
+	                           fsrefsmount_fuse_channel,
+	                           &fsrefsmount_fuse_arguments,
+	                           &fsrefsmount_fuse_operations,
+	                           sizeof( struct fuse_operations ),
+	                           fsrefsmount_mount_handle );
+
+	if( fsrefsmount_fuse_handle == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse handle.\n" );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
+	if( verbose == 0 )
+	{
+		if( fuse_daemonize(
+		     0 ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to daemonize fuse.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The directory cache of the file system is guarded by a mutex
+	 * hence requests, including reads of different files, are handled concurrently
+	 */
+	if( single_threaded == 0 )
+	{
+#if defined( HAVE_LIBFUSE3 )
+		result = fuse_loop_mt(
+		          fsrefsmount_fuse_handle,
+		          0 );
+#else
+		result = fuse_loop_mt(
+		          fsrefsmount_fuse_handle );
+#endif
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		result = fuse_loop(
+		          fsrefsmount_fuse_handle );
+	}
+	if( result != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run fuse loop.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFUSE3 )
+	fuse_unmount(
+	 fsrefsmount_fuse_handle );
+#else
+	fuse_unmount(
+	 mount_point,
+	 fsrefsmount_fuse_channel );
+#endif
+	fuse_destroy(
+	 fsrefsmount_fuse_handle );
+
+	fuse_opt_free_args(
+	 &fsrefsmount_fuse_arguments );
+
+	if( mount_handle_close(
+	     fsrefsmount_mount_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close mount handle.\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_free(
+	     &fsrefsmount_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free mount handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+#else
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( mount_point )
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( option_extended_options )
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( single_threaded )
+
+	fprintf(
+	 stderr,
+	 "No sub system to mount ReFS format.\n" );
+
+	goto on_error;
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	if( fsrefsmount_fuse_handle != NULL )
+	{
+		fuse_destroy(
+		 fsrefsmount_fuse_handle );
+	}
+	fuse_opt_free_args(
+	 &fsrefsmount_fuse_arguments );
+#endif
+	if( fsrefsmount_mount_handle != NULL )
+	{
+		mount_handle_free(
+		 &fsrefsmount_mount_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,4081 @@
+/*
+ * Hash handle
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fsrefstools_libbfio.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libcthreads.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_libhmac.h"
+#include "fsrefstools_system_string.h"
+#include "fsrefstools_unused.h"
+#include "hash_handle.h"
+
+#if !defined( LIBFSREFS_HAVE_BFIO )
+
+extern \
+int libfsrefs_volume_open_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsrefs_error_t **error );
+
+#endif /* !defined( LIBFSREFS_HAVE_BFIO ) */
+
+#define HASH_HANDLE_NOTIFY_STREAM	stderr
+#define HASH_HANDLE_OUTPUT_STREAM	stdout
+
+/* The data used to hash the sparse ranges of a file
+ */
+static const uint8_t hash_handle_zero_data[ 65536 ] = { 0 };
+
+/* Creates a hash handle
+ * Make sure the value hash_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_initialize(
+     hash_handle_t **hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_initialize";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_handle = memory_allocate_structure(
+	                hash_handle_t );
+
+	if( *hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_handle,
+	     0,
+	     sizeof( hash_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_initialize(
+	     &( ( *hash_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_initialize(
+	     &( ( *hash_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input volume.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_handle )->digest_types  = HASH_HANDLE_DIGEST_TYPE_FLAG_MD5;
+	( *hash_handle )->output_format = HASH_HANDLE_OUTPUT_FORMAT_CSV;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	( *hash_handle )->number_of_threads = HASH_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+#endif
+	( *hash_handle )->output_stream = HASH_HANDLE_OUTPUT_STREAM;
+	( *hash_handle )->notify_stream = HASH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *hash_handle != NULL )
+	{
+		if( ( *hash_handle )->input_file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *hash_handle )->input_file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *hash_handle );
+
+		*hash_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash handle
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_free(
+     hash_handle_t **hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_free";
+	int result            = 1;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_handle != NULL )
+	{
+		if( hash_handle_stop_workers(
+		     *hash_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop workers.",
+			 function );
+
+			result = -1;
+		}
+		if( hash_handle_clear_batch(
+		     *hash_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsrefs_volume_free(
+		     &( ( *hash_handle )->input_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input volume.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *hash_handle )->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *hash_handle );
+
+		*hash_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the hash handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_signal_abort(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_signal_abort";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	hash_handle->abort = 1;
+
+	if( hash_handle->input_volume != NULL )
+	{
+		if( libfsrefs_volume_signal_abort(
+		     hash_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input volume to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_set_volume_offset(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_set_volume_offset";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fsrefstools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	hash_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the digest types
+ * The digest types are a comma separated list of: md5, sha1 and sha256
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int hash_handle_set_digest_types(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function        = "hash_handle_set_digest_types";
+	size_t string_index          = 0;
+	size_t string_length         = 0;
+	size_t segment_index         = 0;
+	size_t segment_length        = 0;
+	uint8_t digest_types         = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_index;
+
+		if( ( segment_length == 3 )
+		 && ( system_string_compare_no_case(
+		       &( string[ segment_index ] ),
+		       _SYSTEM_STRING( "md5" ),
+		       3 ) == 0 ) )
+		{
+			digest_types |= HASH_HANDLE_DIGEST_TYPE_FLAG_MD5;
+		}
+		else if( ( segment_length == 4 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_index ] ),
+		            _SYSTEM_STRING( "sha1" ),
+		            4 ) == 0 ) )
+		{
+			digest_types |= HASH_HANDLE_DIGEST_TYPE_FLAG_SHA1;
+		}
+		else if( ( segment_length == 6 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_index ] ),
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			digest_types |= HASH_HANDLE_DIGEST_TYPE_FLAG_SHA256;
+		}
+		else
+		{
+			return( 0 );
+		}
+		segment_index = string_index + 1;
+	}
+	hash_handle->digest_types = digest_types;
+
+	return( 1 );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int hash_handle_set_output_format(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			hash_handle->output_format = HASH_HANDLE_OUTPUT_FORMAT_CSV;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bodyfile" ),
+		     8 ) == 0 )
+		{
+			hash_handle->output_format = HASH_HANDLE_OUTPUT_FORMAT_BODYFILE;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of hashing threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int hash_handle_set_number_of_threads(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fsrefstools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) HASH_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	hash_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_open_input(
+     hash_handle_t *hash_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "hash_handle_open_input";
+	size_t filename_length = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     hash_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     hash_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open set file name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_range_set(
+	     hash_handle->input_file_io_handle,
+	     hash_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open set volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_open_file_io_handle(
+	     hash_handle->input_volume,
+	     hash_handle->input_file_io_handle,
+	     LIBFSREFS_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int hash_handle_close_input(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_close_input";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_close(
+	     hash_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Starts the hashing threads and creates the buffer ring
+ * Without multi-threading support, or when the number of threads is 0,
+ * the data is hashed by the reading thread
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_start_workers(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_start_workers";
+	int job_index         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int worker_index      = 0;
+#endif
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->jobs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash handle - jobs value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	hash_handle->number_of_workers = hash_handle->number_of_threads;
+#else
+	hash_handle->number_of_workers = 0;
+#endif
+	/* Two buffers per hashing thread allow the reading thread to fill a buffer
+	 * while the previous one is being hashed
+	 */
+	if( hash_handle->number_of_workers > 0 )
+	{
+		hash_handle->number_of_jobs = ( 2 * hash_handle->number_of_workers ) + 2;
+	}
+	else
+	{
+		hash_handle->number_of_jobs = 1;
+	}
+	hash_handle->jobs = (hash_handle_job_t *) memory_allocate(
+	                                           sizeof( hash_handle_job_t ) * hash_handle->number_of_jobs );
+
+	if( hash_handle->jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_handle->jobs,
+	     0,
+	     sizeof( hash_handle_job_t ) * hash_handle->number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_handle->number_of_workers == 0 )
+	{
+		/* The reading thread hashes the data directly from the read buffer
+		 */
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	hash_handle->buffers_data = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * HASH_HANDLE_BUFFER_SIZE * hash_handle->number_of_jobs );
+
+	if( hash_handle->buffers_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( hash_handle->free_jobs_queue ),
+	     hash_handle->number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free jobs queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < hash_handle->number_of_jobs;
+	     job_index++ )
+	{
+		hash_handle->jobs[ job_index ].data = &( hash_handle->buffers_data[ job_index * HASH_HANDLE_BUFFER_SIZE ] );
+
+		if( libcthreads_queue_push(
+		     hash_handle->free_jobs_queue,
+		     (intptr_t *) &( hash_handle->jobs[ job_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push job: %d onto free jobs queue.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( hash_handle->status_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create status mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( hash_handle->status_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create status condition.",
+		 function );
+
+		goto on_error;
+	}
+	hash_handle->workers = (hash_handle_worker_t *) memory_allocate(
+	                                                 sizeof( hash_handle_worker_t ) * hash_handle->number_of_workers );
+
+	if( hash_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_handle->workers,
+	     0,
+	     sizeof( hash_handle_worker_t ) * hash_handle->number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < hash_handle->number_of_workers;
+	     worker_index++ )
+	{
+		hash_handle->workers[ worker_index ].hash_handle = hash_handle;
+
+		if( libcthreads_queue_initialize(
+		     &( hash_handle->workers[ worker_index ].jobs_queue ),
+		     hash_handle->number_of_jobs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create jobs queue of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_create(
+		     &( hash_handle->workers[ worker_index ].thread ),
+		     NULL,
+		     &hash_handle_worker_run,
+		     (void *) &( hash_handle->workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	hash_handle_stop_workers(
+	 hash_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Stops the hashing threads and frees the buffer ring
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_stop_workers(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "hash_handle_stop_workers";
+	int result              = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	hash_handle_job_t *job  = NULL;
+	int worker_index        = 0;
+#endif
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( hash_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < hash_handle->number_of_workers;
+		     worker_index++ )
+		{
+			if( hash_handle->workers[ worker_index ].thread == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_queue_pop(
+			     hash_handle->free_jobs_queue,
+			     (intptr_t **) &job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop job from free jobs queue.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			job->type = HASH_HANDLE_JOB_TYPE_STOP;
+
+			if( libcthreads_queue_push(
+			     hash_handle->workers[ worker_index ].jobs_queue,
+			     (intptr_t *) job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push stop job onto jobs queue of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+			if( libcthreads_thread_join(
+			     &( hash_handle->workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < hash_handle->number_of_workers;
+		     worker_index++ )
+		{
+			if( hash_handle->workers[ worker_index ].jobs_queue != NULL )
+			{
+				if( libcthreads_queue_free(
+				     &( hash_handle->workers[ worker_index ].jobs_queue ),
+				     NULL,
+				     ( result == -1 ) ? NULL : error ) != 1 )
+				{
+					if( result == 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free jobs queue of worker: %d.",
+						 function,
+						 worker_index );
+					}
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 hash_handle->workers );
+
+		hash_handle->workers = NULL;
+	}
+	if( hash_handle->status_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( hash_handle->status_condition ),
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free status condition.",
+				 function );
+			}
+			result = -1;
+		}
+	}
+	if( hash_handle->status_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( hash_handle->status_mutex ),
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free status mutex.",
+				 function );
+			}
+			result = -1;
+		}
+	}
+	if( hash_handle->free_jobs_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( hash_handle->free_jobs_queue ),
+		     NULL,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free free jobs queue.",
+				 function );
+			}
+			result = -1;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( hash_handle->buffers_data != NULL )
+	{
+		memory_free(
+		 hash_handle->buffers_data );
+
+		hash_handle->buffers_data = NULL;
+	}
+	if( hash_handle->jobs != NULL )
+	{
+		memory_free(
+		 hash_handle->jobs );
+
+		hash_handle->jobs = NULL;
+	}
+	hash_handle->number_of_jobs    = 0;
+	hash_handle->number_of_workers = 0;
+
+	return( result );
+}
+
+/* Processes a job
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_process_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t *job,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file = NULL;
+	static char *function    = "hash_handle_process_job";
+	size_t data_offset       = 0;
+	size_t read_size         = 0;
+	int result               = 1;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( job->batch_index < 0 )
+	 || ( job->batch_index >= hash_handle->number_of_batch_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid job - batch index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ job->batch_index ] );
+
+	while( ( job->type == HASH_HANDLE_JOB_TYPE_DATA )
+	    || ( job->type == HASH_HANDLE_JOB_TYPE_ZERO_DATA ) )
+	{
+		if( data_offset >= job->data_size )
+		{
+			break;
+		}
+		if( job->type == HASH_HANDLE_JOB_TYPE_ZERO_DATA )
+		{
+			read_size = job->data_size - data_offset;
+
+			if( read_size > sizeof( hash_handle_zero_data ) )
+			{
+				read_size = sizeof( hash_handle_zero_data );
+			}
+		}
+		else
+		{
+			read_size = job->data_size;
+		}
+		if( file->md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     file->md5_context,
+			     ( job->type == HASH_HANDLE_JOB_TYPE_DATA ) ? job->data : hash_handle_zero_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( file->sha1_context != NULL )
+		{
+			if( libhmac_sha1_update(
+			     file->sha1_context,
+			     ( job->type == HASH_HANDLE_JOB_TYPE_DATA ) ? job->data : hash_handle_zero_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA1 digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( file->sha256_context != NULL )
+		{
+			if( libhmac_sha256_update(
+			     file->sha256_context,
+			     ( job->type == HASH_HANDLE_JOB_TYPE_DATA ) ? job->data : hash_handle_zero_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA256 digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		data_offset += read_size;
+	}
+	if( job->type == HASH_HANDLE_JOB_TYPE_FINALIZE )
+	{
+		if( file->md5_context != NULL )
+		{
+			if( libhmac_md5_finalize(
+			     file->md5_context,
+			     file->md5_hash,
+			     LIBHMAC_MD5_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize MD5 digest hash.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( result == 1 )
+		 && ( file->sha1_context != NULL ) )
+		{
+			if( libhmac_sha1_finalize(
+			     file->sha1_context,
+			     file->sha1_hash,
+			     LIBHMAC_SHA1_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize SHA1 digest hash.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( result == 1 )
+		 && ( file->sha256_context != NULL ) )
+		{
+			if( libhmac_sha256_finalize(
+			     file->sha256_context,
+			     file->sha256_hash,
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize SHA256 digest hash.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file is counted as finalized even if finalizing failed
+		 * so that the reading thread does not wait for it indefinitely
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( hash_handle->number_of_workers > 0 )
+		{
+			if( libcthreads_mutex_grab(
+			     hash_handle->status_mutex,
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab status mutex.",
+				 function );
+
+				return( -1 );
+			}
+			hash_handle->number_of_unfinalized_files -= 1;
+
+			if( result == -1 )
+			{
+				hash_handle->worker_failed = 1;
+			}
+			if( libcthreads_condition_broadcast(
+			     hash_handle->status_condition,
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to broadcast status condition.",
+					 function );
+				}
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     hash_handle->status_mutex,
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release status mutex.",
+					 function );
+				}
+				result = -1;
+			}
+		}
+		else
+#endif
+		{
+			hash_handle->number_of_unfinalized_files -= 1;
+		}
+	}
+	return( result );
+}
+
+/* Runs a hashing thread
+ * Callback function for libcthreads_thread_create
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_worker_run(
+     void *arguments )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	hash_handle_job_t *job       = NULL;
+	hash_handle_t *hash_handle   = NULL;
+	hash_handle_worker_t *worker = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "hash_handle_worker_run";
+	uint8_t job_type             = 0;
+	int result                   = 0;
+
+	worker = (hash_handle_worker_t *) arguments;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	hash_handle = worker->hash_handle;
+
+	do
+	{
+		if( libcthreads_queue_pop(
+		     worker->jobs_queue,
+		     (intptr_t **) &job,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop job from jobs queue.",
+			 function );
+
+			goto on_error;
+		}
+		job_type = job->type;
+
+		if( job_type == HASH_HANDLE_JOB_TYPE_STOP )
+		{
+			result = hash_handle_release_job(
+			          hash_handle,
+			          job,
+			          &error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			break;
+		}
+		result = hash_handle_process_job(
+		          hash_handle,
+		          job,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			/* Finalize jobs set the failure status themselves
+			 */
+			if( job_type != HASH_HANDLE_JOB_TYPE_FINALIZE )
+			{
+				if( libcthreads_mutex_grab(
+				     hash_handle->status_mutex,
+				     &error ) == 1 )
+				{
+					hash_handle->worker_failed = 1;
+
+					libcthreads_mutex_release(
+					 hash_handle->status_mutex,
+					 NULL );
+				}
+			}
+		}
+		if( hash_handle_release_job(
+		     hash_handle,
+		     job,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release job.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( job_type != HASH_HANDLE_JOB_TYPE_STOP );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+#else
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	return( -1 );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Retrieves a free job from the buffer ring
+ * This function blocks until a hashing thread releases a job
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_get_free_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t **job,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_get_free_job";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash handle - missing jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( hash_handle->number_of_workers > 0 )
+	{
+		if( libcthreads_queue_pop(
+		     hash_handle->free_jobs_queue,
+		     (intptr_t **) job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop job from free jobs queue.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	/* Without hashing threads the job is processed before the next one is retrieved
+	 */
+	*job = &( hash_handle->jobs[ 0 ] );
+
+	return( 1 );
+}
+
+/* Releases a job after it was processed
+ * Jobs of the buffer ring are returned to the ring, allocated jobs are freed
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_release_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_release_job";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( job->is_allocated != 0 )
+	{
+		if( job->data != NULL )
+		{
+			memory_free(
+			 job->data );
+		}
+		memory_free(
+		 job );
+
+		return( 1 );
+	}
+	job->type        = 0;
+	job->batch_index = 0;
+	job->data_offset = 0;
+	job->data_size   = 0;
+	job->next_job    = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( hash_handle->number_of_workers > 0 )
+	{
+		if( libcthreads_queue_push(
+		     hash_handle->free_jobs_queue,
+		     (intptr_t *) job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push job onto free jobs queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Dispatches a job to the hashing thread of its file
+ * All jobs of a file are processed by the same hashing thread, in order
+ * Without hashing threads the job is processed directly
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_dispatch_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_dispatch_job";
+	int result            = 1;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( hash_handle->number_of_workers > 0 )
+	{
+		if( libcthreads_queue_push(
+		     hash_handle->workers[ job->batch_index % hash_handle->number_of_workers ].jobs_queue,
+		     (intptr_t *) job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push job onto jobs queue.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( hash_handle_process_job(
+	     hash_handle,
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process job.",
+		 function );
+
+		result = -1;
+	}
+	if( hash_handle_release_job(
+	     hash_handle,
+	     job,
+	     ( result == -1 ) ? NULL : error ) != 1 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release job.",
+			 function );
+		}
+		result = -1;
+	}
+	return( result );
+}
+
+/* Dispatches data of a file that directly follows the data already dispatched
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_dispatch_data(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	hash_handle_job_t direct_job;
+
+	hash_handle_job_t *job = NULL;
+	static char *function  = "hash_handle_dispatch_data";
+	size_t data_offset     = 0;
+	size_t write_size      = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->number_of_workers == 0 )
+	{
+		/* Without hashing threads the data does not need to be copied
+		 */
+		if( memory_set(
+		     &direct_job,
+		     0,
+		     sizeof( hash_handle_job_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear direct job.",
+			 function );
+
+			return( -1 );
+		}
+		direct_job.type        = HASH_HANDLE_JOB_TYPE_DATA;
+		direct_job.batch_index = batch_index;
+		direct_job.data        = (uint8_t *) data;
+		direct_job.data_size   = data_size;
+
+		if( hash_handle_process_job(
+		     hash_handle,
+		     &direct_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process direct job.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	while( data_offset < data_size )
+	{
+		write_size = data_size - data_offset;
+
+		if( write_size > HASH_HANDLE_BUFFER_SIZE )
+		{
+			write_size = HASH_HANDLE_BUFFER_SIZE;
+		}
+		if( hash_handle_get_free_job(
+		     hash_handle,
+		     &job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve free job.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     job->data,
+		     &( data[ data_offset ] ),
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to job.",
+			 function );
+
+			hash_handle_release_job(
+			 hash_handle,
+			 job,
+			 NULL );
+
+			return( -1 );
+		}
+		job->type        = HASH_HANDLE_JOB_TYPE_DATA;
+		job->batch_index = batch_index;
+		job->data_size   = write_size;
+
+		if( hash_handle_dispatch_job(
+		     hash_handle,
+		     job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to dispatch job.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += write_size;
+	}
+	return( 1 );
+}
+
+/* Dispatches the sparse ranges of a file that start at the offset of the next data
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_dispatch_holes(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file = NULL;
+	hash_handle_job_t *job   = NULL;
+	static char *function    = "hash_handle_dispatch_holes";
+	off64_t hole_end_offset  = 0;
+	size64_t hole_size       = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ batch_index ] );
+
+	while( file->hole_range_index < file->number_of_hole_ranges )
+	{
+		if( file->hole_ranges[ 2 * file->hole_range_index ] > file->next_offset )
+		{
+			break;
+		}
+		hole_end_offset = file->hole_ranges[ ( 2 * file->hole_range_index ) + 1 ];
+
+		while( hole_end_offset > file->next_offset )
+		{
+			hole_size = (size64_t) ( hole_end_offset - file->next_offset );
+
+			if( hole_size > HASH_HANDLE_BUFFER_SIZE )
+			{
+				hole_size = HASH_HANDLE_BUFFER_SIZE;
+			}
+			if( hash_handle_get_free_job(
+			     hash_handle,
+			     &job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve free job.",
+				 function );
+
+				return( -1 );
+			}
+			job->type        = HASH_HANDLE_JOB_TYPE_ZERO_DATA;
+			job->batch_index = batch_index;
+			job->data_size   = (size_t) hole_size;
+
+			if( hash_handle_dispatch_job(
+			     hash_handle,
+			     job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to dispatch job.",
+				 function );
+
+				return( -1 );
+			}
+			file->next_offset += (off64_t) hole_size;
+		}
+		file->hole_range_index += 1;
+	}
+	return( 1 );
+}
+
+/* Dispatches the pending jobs of a file that follow the data already dispatched
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_dispatch_pending_jobs(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file = NULL;
+	hash_handle_job_t *job   = NULL;
+	static char *function    = "hash_handle_dispatch_pending_jobs";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ batch_index ] );
+
+	while( file->pending_jobs != NULL )
+	{
+		if( hash_handle_dispatch_holes(
+		     hash_handle,
+		     batch_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to dispatch holes.",
+			 function );
+
+			return( -1 );
+		}
+		job = file->pending_jobs;
+
+		if( job->data_offset != file->next_offset )
+		{
+			break;
+		}
+		file->pending_jobs = job->next_job;
+		job->next_job      = NULL;
+
+		file->next_offset              += (off64_t) job->data_size;
+		file->pending_data_size        -= (size64_t) job->data_size;
+		hash_handle->pending_data_size -= (size64_t) job->data_size;
+
+		if( hash_handle_dispatch_job(
+		     hash_handle,
+		     job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to dispatch pending job.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a copy of data of a file that was read before the data preceding it
+ * The pending jobs are kept sorted by data offset
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_append_pending_job(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file       = NULL;
+	hash_handle_job_t *job         = NULL;
+	hash_handle_job_t **next_job   = NULL;
+	static char *function          = "hash_handle_append_pending_job";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ batch_index ] );
+
+	job = memory_allocate_structure(
+	       hash_handle_job_t );
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     job,
+	     0,
+	     sizeof( hash_handle_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job.",
+		 function );
+
+		memory_free(
+		 job );
+
+		return( -1 );
+	}
+	job->type         = HASH_HANDLE_JOB_TYPE_DATA;
+	job->is_allocated = 1;
+	job->batch_index  = batch_index;
+	job->data_offset  = data_offset;
+	job->data_size    = data_size;
+
+	job->data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * data_size );
+
+	if( job->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     job->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to job.",
+		 function );
+
+		goto on_error;
+	}
+	next_job = &( file->pending_jobs );
+
+	while( ( *next_job != NULL )
+	    && ( ( *next_job )->data_offset < data_offset ) )
+	{
+		next_job = &( ( *next_job )->next_job );
+	}
+	job->next_job = *next_job;
+	*next_job     = job;
+
+	file->pending_data_size        += (size64_t) data_size;
+	hash_handle->pending_data_size += (size64_t) data_size;
+
+	return( 1 );
+
+on_error:
+	if( job != NULL )
+	{
+		hash_handle_release_job(
+		 hash_handle,
+		 job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Discards the pending jobs of a file
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_discard_pending_jobs(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file = NULL;
+	hash_handle_job_t *job   = NULL;
+	static char *function    = "hash_handle_discard_pending_jobs";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ batch_index ] );
+
+	while( file->pending_jobs != NULL )
+	{
+		job                = file->pending_jobs;
+		file->pending_jobs = job->next_job;
+
+		memory_free(
+		 job->data );
+		memory_free(
+		 job );
+	}
+	hash_handle->pending_data_size -= file->pending_data_size;
+	file->pending_data_size         = 0;
+
+	return( 1 );
+}
+
+/* Reads the remaining data of a batch file in logical order and passes it to the hashing threads
+ * Used for a file of which the out of order data did not fit in the maximum pending data size
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int hash_handle_read_file_data(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file = NULL;
+	hash_handle_job_t *job   = NULL;
+	static char *function    = "hash_handle_read_file_data";
+	size64_t read_size       = 0;
+	ssize_t read_count       = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ batch_index ] );
+
+	while( (size64_t) file->next_offset < file->size )
+	{
+		if( hash_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		if( hash_handle_dispatch_holes(
+		     hash_handle,
+		     batch_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to dispatch holes.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size64_t) file->next_offset >= file->size )
+		{
+			break;
+		}
+		read_size = file->size - (size64_t) file->next_offset;
+
+		if( read_size > HASH_HANDLE_BUFFER_SIZE )
+		{
+			read_size = HASH_HANDLE_BUFFER_SIZE;
+		}
+		/* Holes are dispatched separately so the data is read up to the next hole
+		 */
+		if( ( file->hole_range_index < file->number_of_hole_ranges )
+		 && ( read_size > (size64_t) ( file->hole_ranges[ 2 * file->hole_range_index ] - file->next_offset ) ) )
+		{
+			read_size = (size64_t) ( file->hole_ranges[ 2 * file->hole_range_index ] - file->next_offset );
+		}
+		if( hash_handle_get_free_job(
+		     hash_handle,
+		     &job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve free job.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = libfsrefs_file_entry_read_buffer_at_offset(
+		              file->file_entry,
+		              job->data,
+		              (size_t) read_size,
+		              file->next_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 file->next_offset );
+
+			hash_handle_release_job(
+			 hash_handle,
+			 job,
+			 NULL );
+
+			return( -1 );
+		}
+		job->type        = HASH_HANDLE_JOB_TYPE_DATA;
+		job->batch_index = batch_index;
+		job->data_size   = (size_t) read_size;
+
+		if( hash_handle_dispatch_job(
+		     hash_handle,
+		     job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to dispatch job.",
+			 function );
+
+			return( -1 );
+		}
+		file->next_offset += (off64_t) read_size;
+	}
+	return( 1 );
+}
+
+/* Passes data of a batch file to the hashing threads
+ * Callback function for libfsrefs_volume_read_file_entries_data
+ * Since the data is read in physical order the data of a file can be passed out of order,
+ * such data is kept until the data preceding it has been passed. If the data kept for the batch
+ * would exceed the maximum pending data size, the data of the file is discarded instead and
+ * its remaining data is read in logical order after the physical order pass
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_write_data(
+     int file_entry_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     intptr_t *user_data )
+{
+	hash_handle_file_t *file   = NULL;
+	hash_handle_t *hash_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	static char *function      = "hash_handle_write_data";
+
+	hash_handle = (hash_handle_t *) user_data;
+
+	if( hash_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( ( file_entry_index < 0 )
+	 || ( file_entry_index >= hash_handle->number_of_batch_files ) )
+	{
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( -1 );
+	}
+	file = &( hash_handle->batch_files[ file_entry_index ] );
+
+	if( file->read_sequentially != 0 )
+	{
+		return( 1 );
+	}
+	if( hash_handle_dispatch_holes(
+	     hash_handle,
+	     file_entry_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to dispatch holes.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_offset < file->next_offset )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	else if( data_offset > file->next_offset )
+	{
+		if( ( hash_handle->pending_data_size + (size64_t) data_size ) > HASH_HANDLE_MAXIMUM_PENDING_DATA_SIZE )
+		{
+			if( hash_handle_discard_pending_jobs(
+			     hash_handle,
+			     file_entry_index,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to discard pending jobs.",
+				 function );
+
+				goto on_error;
+			}
+			file->read_sequentially = 1;
+
+			return( 1 );
+		}
+		if( hash_handle_append_pending_job(
+		     hash_handle,
+		     file_entry_index,
+		     data_offset,
+		     data,
+		     data_size,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append pending job.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( hash_handle_dispatch_data(
+	     hash_handle,
+	     file_entry_index,
+	     data,
+	     data_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to dispatch data.",
+		 function );
+
+		goto on_error;
+	}
+	file->next_offset += (off64_t) data_size;
+
+	if( hash_handle_dispatch_pending_jobs(
+	     hash_handle,
+	     file_entry_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to dispatch pending jobs.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Clears a batch file
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_file_clear(
+     hash_handle_file_t *file,
+     libcerror_error_t **error )
+{
+	hash_handle_job_t *job = NULL;
+	static char *function  = "hash_handle_file_clear";
+	int result             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	while( file->pending_jobs != NULL )
+	{
+		job                = file->pending_jobs;
+		file->pending_jobs = job->next_job;
+
+		memory_free(
+		 job->data );
+		memory_free(
+		 job );
+	}
+	if( file->md5_context != NULL )
+	{
+		if( libhmac_md5_free(
+		     &( file->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file->sha1_context != NULL )
+	{
+		if( libhmac_sha1_free(
+		     &( file->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file->sha256_context != NULL )
+	{
+		if( libhmac_sha256_free(
+		     &( file->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file->file_entry != NULL )
+	{
+		if( libfsrefs_file_entry_free(
+		     &( file->file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file->hole_ranges != NULL )
+	{
+		memory_free(
+		 file->hole_ranges );
+	}
+	if( file->path != NULL )
+	{
+		memory_free(
+		 file->path );
+	}
+	if( memory_set(
+	     file,
+	     0,
+	     sizeof( hash_handle_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Clears the batch without hashing the data of its files
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_clear_batch(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_clear_batch";
+	int batch_index       = 0;
+	int result            = 1;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( batch_index = 0;
+	     batch_index < hash_handle->number_of_batch_files;
+	     batch_index++ )
+	{
+		if( hash_handle_file_clear(
+		     &( hash_handle->batch_files[ batch_index ] ),
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear batch file: %d.",
+				 function,
+				 batch_index );
+			}
+			result = -1;
+		}
+	}
+	hash_handle->number_of_batch_files       = 0;
+	hash_handle->number_of_unfinalized_files = 0;
+	hash_handle->pending_data_size           = 0;
+
+	return( result );
+}
+
+/* Hashes the data of the files in the batch in physical order and prints the results
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int hash_handle_flush_batch(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *file_entries[ HASH_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILES ];
+
+	hash_handle_file_t *file = NULL;
+	hash_handle_job_t *job   = NULL;
+	static char *function    = "hash_handle_flush_batch";
+	int batch_index          = 0;
+	int result               = 1;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->number_of_batch_files == 0 )
+	{
+		return( 1 );
+	}
+	for( batch_index = 0;
+	     batch_index < hash_handle->number_of_batch_files;
+	     batch_index++ )
+	{
+		file_entries[ batch_index ] = hash_handle->batch_files[ batch_index ].file_entry;
+	}
+	hash_handle->number_of_unfinalized_files = hash_handle->number_of_batch_files;
+
+	result = libfsrefs_volume_read_file_entries_data(
+	          hash_handle->input_volume,
+	          file_entries,
+	          hash_handle->number_of_batch_files,
+	          &hash_handle_write_data,
+	          (intptr_t *) hash_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data of batch files.",
+		 function );
+	}
+	/* Every file is finalized, also when reading failed or was aborted,
+	 * so that no hashing thread references the batch after it is cleared
+	 */
+	for( batch_index = 0;
+	     batch_index < hash_handle->number_of_batch_files;
+	     batch_index++ )
+	{
+		file = &( hash_handle->batch_files[ batch_index ] );
+
+		if( ( result == 1 )
+		 && ( file->read_sequentially != 0 ) )
+		{
+			result = hash_handle_read_file_data(
+			          hash_handle,
+			          batch_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of batch file: %d.",
+				 function,
+				 batch_index );
+			}
+		}
+		if( result == 1 )
+		{
+			if( hash_handle_dispatch_holes(
+			     hash_handle,
+			     batch_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to dispatch holes of batch file: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+			else if( hash_handle_dispatch_pending_jobs(
+			          hash_handle,
+			          batch_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to dispatch pending jobs of batch file: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+			else if( ( file->pending_jobs != NULL )
+			      || ( (size64_t) file->next_offset != file->size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data of batch file: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+		}
+		job = NULL;
+
+		if( hash_handle_get_free_job(
+		     hash_handle,
+		     &job,
+		     ( result == -1 ) ? NULL : error ) == 1 )
+		{
+			job->type        = HASH_HANDLE_JOB_TYPE_FINALIZE;
+			job->batch_index = batch_index;
+
+			if( hash_handle_dispatch_job(
+			     hash_handle,
+			     job,
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				job = NULL;
+			}
+		}
+		else
+		{
+			job = NULL;
+		}
+		if( job == NULL )
+		{
+			/* A hashing thread was never given the file so it will not finalize it
+			 */
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to finalize batch file: %d.",
+				 function,
+				 batch_index );
+			}
+			result = -1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( hash_handle->number_of_workers > 0 )
+			{
+				if( libcthreads_mutex_grab(
+				     hash_handle->status_mutex,
+				     NULL ) != 1 )
+				{
+					return( -1 );
+				}
+				hash_handle->number_of_unfinalized_files -= 1;
+
+				libcthreads_mutex_release(
+				 hash_handle->status_mutex,
+				 NULL );
+			}
+			else
+#endif
+			{
+				hash_handle->number_of_unfinalized_files -= 1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( hash_handle->number_of_workers > 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     hash_handle->status_mutex,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab status mutex.",
+				 function );
+			}
+			return( -1 );
+		}
+		while( hash_handle->number_of_unfinalized_files > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     hash_handle->status_condition,
+			     hash_handle->status_mutex,
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for status condition.",
+					 function );
+				}
+				libcthreads_mutex_release(
+				 hash_handle->status_mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( ( result == 1 )
+		 && ( hash_handle->worker_failed != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: hashing thread failed.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     hash_handle->status_mutex,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release status mutex.",
+				 function );
+			}
+			result = -1;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( result == 1 )
+	{
+		for( batch_index = 0;
+		     batch_index < hash_handle->number_of_batch_files;
+		     batch_index++ )
+		{
+			hash_handle_file_fprint(
+			 hash_handle,
+			 &( hash_handle->batch_files[ batch_index ] ) );
+		}
+		hash_handle->number_of_hashed_files += hash_handle->number_of_batch_files;
+	}
+	if( hash_handle_clear_batch(
+	     hash_handle,
+	     ( result == -1 ) ? NULL : error ) != 1 )
+	{
+		if( result != -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+		}
+		result = -1;
+	}
+	return( result );
+}
+
+/* Determines the hole ranges of a batch file
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_determine_hole_ranges(
+     hash_handle_file_t *file,
+     libcerror_error_t **error )
+{
+	off64_t *hole_ranges          = NULL;
+	static char *function         = "hash_handle_determine_hole_ranges";
+	off64_t data_offset           = 0;
+	off64_t hole_offset           = 0;
+	off64_t offset                = 0;
+	int number_of_allocated_holes = 0;
+	int result                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	while( (size64_t) offset < file->size )
+	{
+		result = libfsrefs_file_entry_seek_hole(
+		          file->file_entry,
+		          offset,
+		          &hole_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek hole at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( (size64_t) hole_offset >= file->size ) )
+		{
+			break;
+		}
+		result = libfsrefs_file_entry_seek_data(
+		          file->file_entry,
+		          hole_offset,
+		          &data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek data at offset: %" PRIi64 ".",
+			 function,
+			 hole_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			data_offset = (off64_t) file->size;
+		}
+		if( data_offset <= hole_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( file->number_of_hole_ranges >= number_of_allocated_holes )
+		{
+			if( number_of_allocated_holes == 0 )
+			{
+				number_of_allocated_holes = 4;
+			}
+			else
+			{
+				number_of_allocated_holes *= 2;
+			}
+			hole_ranges = (off64_t *) memory_reallocate(
+			                           file->hole_ranges,
+			                           sizeof( off64_t ) * 2 * number_of_allocated_holes );
+
+			if( hole_ranges == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize hole ranges.",
+				 function );
+
+				return( -1 );
+			}
+			file->hole_ranges = hole_ranges;
+		}
+		file->hole_ranges[ 2 * file->number_of_hole_ranges ]         = hole_offset;
+		file->hole_ranges[ ( 2 * file->number_of_hole_ranges ) + 1 ] = data_offset;
+
+		file->number_of_hole_ranges += 1;
+
+		offset = data_offset;
+	}
+	return( 1 );
+}
+
+/* Appends a file entry to the batch
+ * The batch takes over the file entry and path if successful
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int hash_handle_append_batch_file_entry(
+     hash_handle_t *hash_handle,
+     libfsrefs_file_entry_t *file_entry,
+     system_character_t *path,
+     libcerror_error_t **error )
+{
+	hash_handle_file_t *file = NULL;
+	static char *function    = "hash_handle_append_batch_file_entry";
+	int result               = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->number_of_batch_files >= HASH_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILES )
+	{
+		result = hash_handle_flush_batch(
+		          hash_handle,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to flush batch.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	file = &( hash_handle->batch_files[ hash_handle->number_of_batch_files ] );
+
+	file->file_entry = file_entry;
+
+	if( libfsrefs_file_entry_get_size(
+	     file_entry,
+	     &( file->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_file_attribute_flags(
+	     file_entry,
+	     &( file->file_attribute_flags ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_creation_time(
+	     file_entry,
+	     &( file->creation_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_modification_time(
+	     file_entry,
+	     &( file->modification_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_access_time(
+	     file_entry,
+	     &( file->access_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_entry_modification_time(
+	     file_entry,
+	     &( file->entry_modification_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_handle_determine_hole_ranges(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine hole ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( hash_handle->digest_types & HASH_HANDLE_DIGEST_TYPE_FLAG_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( file->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( hash_handle->digest_types & HASH_HANDLE_DIGEST_TYPE_FLAG_SHA1 ) != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( file->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( hash_handle->digest_types & HASH_HANDLE_DIGEST_TYPE_FLAG_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( file->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file->path = path;
+
+	hash_handle->number_of_batch_files += 1;
+
+	return( 1 );
+
+on_error:
+	/* The caller retains the file entry and path on error
+	 */
+	file->file_entry = NULL;
+
+	hash_handle_file_clear(
+	 file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the path of a sub file entry
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_get_sub_path(
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     system_character_t **sub_path,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_sub_path = NULL;
+	static char *function             = "hash_handle_get_sub_path";
+	size_t name_size                  = 0;
+	int result                        = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsrefs_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#else
+	result = libfsrefs_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( name_size <= 1 )
+	 || ( name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - path_length - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file entry name string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* ReFS uses \ as path segment separator
+	 */
+	safe_sub_path = system_string_allocate(
+	                 path_length + 1 + name_size );
+
+	if( safe_sub_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub path.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_length > 0 )
+	{
+		if( system_string_copy(
+		     safe_sub_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	safe_sub_path[ path_length ] = (system_character_t) '\\';
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsrefs_file_entry_get_utf16_name(
+	          file_entry,
+	          (uint16_t *) &( safe_sub_path[ path_length + 1 ] ),
+	          name_size,
+	          error );
+#else
+	result = libfsrefs_file_entry_get_utf8_name(
+	          file_entry,
+	          (uint8_t *) &( safe_sub_path[ path_length + 1 ] ),
+	          name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+	*sub_path = safe_sub_path;
+
+	return( 1 );
+
+on_error:
+	if( safe_sub_path != NULL )
+	{
+		memory_free(
+		 safe_sub_path );
+	}
+	return( -1 );
+}
+
+/* Prints a path
+ * Characters that have a special meaning in the output format are escaped
+ */
+void hash_handle_path_fprint(
+      hash_handle_t *hash_handle,
+      const system_character_t *path )
+{
+	size_t path_index = 0;
+
+	if( ( hash_handle == NULL )
+	 || ( path == NULL ) )
+	{
+		return;
+	}
+	for( path_index = 0;
+	     path[ path_index ] != 0;
+	     path_index++ )
+	{
+		if( ( hash_handle->output_format == HASH_HANDLE_OUTPUT_FORMAT_CSV )
+		 && ( path[ path_index ] == (system_character_t) '"' ) )
+		{
+			fprintf(
+			 hash_handle->output_stream,
+			 "\"" );
+		}
+		else if( ( hash_handle->output_format == HASH_HANDLE_OUTPUT_FORMAT_BODYFILE )
+		      && ( ( path[ path_index ] == (system_character_t) '|' )
+		       ||  ( path[ path_index ] == (system_character_t) '\\' ) ) )
+		{
+			fprintf(
+			 hash_handle->output_stream,
+			 "\\" );
+		}
+		fprintf(
+		 hash_handle->output_stream,
+		 "%" PRIc_SYSTEM "",
+		 path[ path_index ] );
+	}
+}
+
+/* Prints a digest hash as a hexadecimal string
+ */
+void hash_handle_digest_hash_fprint(
+      hash_handle_t *hash_handle,
+      const uint8_t *digest_hash,
+      size_t digest_hash_size )
+{
+	size_t digest_hash_index = 0;
+
+	if( ( hash_handle == NULL )
+	 || ( digest_hash == NULL ) )
+	{
+		return;
+	}
+	for( digest_hash_index = 0;
+	     digest_hash_index < digest_hash_size;
+	     digest_hash_index++ )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "%02" PRIx8 "",
+		 digest_hash[ digest_hash_index ] );
+	}
+}
+
+/* Prints a FILETIME value as a POSIX timestamp with a fraction of 100th nano seconds
+ */
+void hash_handle_filetime_fprint(
+      hash_handle_t *hash_handle,
+      uint64_t filetime )
+{
+	int64_t posix_time = 0;
+
+	if( hash_handle == NULL )
+	{
+		return;
+	}
+	if( filetime == 0 )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "0" );
+
+		return;
+	}
+	/* The FILETIME epoch is 1601-01-01, the POSIX epoch is 1970-01-01
+	 */
+	posix_time = (int64_t) filetime - (int64_t) 116444736000000000LL;
+
+	if( posix_time < 0 )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "-%" PRIi64 ".%07" PRIi64 "",
+		 -posix_time / 10000000,
+		 -posix_time % 10000000 );
+	}
+	else
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "%" PRIi64 ".%07" PRIi64 "",
+		 posix_time / 10000000,
+		 posix_time % 10000000 );
+	}
+}
+
+/* Prints the header
+ */
+void hash_handle_header_fprint(
+      hash_handle_t *hash_handle )
+{
+	if( hash_handle == NULL )
+	{
+		return;
+	}
+	if( hash_handle->output_format != HASH_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		return;
+	}
+	fprintf(
+	 hash_handle->output_stream,
+	 "path,size" );
+
+	if( ( hash_handle->digest_types & HASH_HANDLE_DIGEST_TYPE_FLAG_MD5 ) != 0 )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 ",md5" );
+	}
+	if( ( hash_handle->digest_types & HASH_HANDLE_DIGEST_TYPE_FLAG_SHA1 ) != 0 )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 ",sha1" );
+	}
+	if( ( hash_handle->digest_types & HASH_HANDLE_DIGEST_TYPE_FLAG_SHA256 ) != 0 )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 ",sha256" );
+	}
+	fprintf(
+	 hash_handle->output_stream,
+	 "\n" );
+}
+
+/* Prints the digest hashes of a batch file
+ */
+void hash_handle_file_fprint(
+      hash_handle_t *hash_handle,
+      hash_handle_file_t *file )
+{
+	const char *mode_string = NULL;
+
+	if( ( hash_handle == NULL )
+	 || ( file == NULL ) )
+	{
+		return;
+	}
+	if( hash_handle->output_format == HASH_HANDLE_OUTPUT_FORMAT_BODYFILE )
+	{
+		/* The bodyfile format only has a field for the MD5
+		 * Format: MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+		 */
+		if( file->md5_context != NULL )
+		{
+			hash_handle_digest_hash_fprint(
+			 hash_handle,
+			 file->md5_hash,
+			 LIBHMAC_MD5_HASH_SIZE );
+		}
+		else
+		{
+			fprintf(
+			 hash_handle->output_stream,
+			 "0" );
+		}
+		fprintf(
+		 hash_handle->output_stream,
+		 "|" );
+
+		hash_handle_path_fprint(
+		 hash_handle,
+		 file->path );
+
+		if( ( file->file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_READ_ONLY ) != 0 )
+		{
+			mode_string = "r/rr-xr-xr-x";
+		}
+		else
+		{
+			mode_string = "r/rrwxrwxrwx";
+		}
+		fprintf(
+		 hash_handle->output_stream,
+		 "|0|%s|0|0|%" PRIu64 "|",
+		 mode_string,
+		 file->size );
+
+		hash_handle_filetime_fprint(
+		 hash_handle,
+		 file->access_time );
+
+		fprintf(
+		 hash_handle->output_stream,
+		 "|" );
+
+		hash_handle_filetime_fprint(
+		 hash_handle,
+		 file->modification_time );
+
+		fprintf(
+		 hash_handle->output_stream,
+		 "|" );
+
+		hash_handle_filetime_fprint(
+		 hash_handle,
+		 file->entry_modification_time );
+
+		fprintf(
+		 hash_handle->output_stream,
+		 "|" );
+
+		hash_handle_filetime_fprint(
+		 hash_handle,
+		 file->creation_time );
+
+		fprintf(
+		 hash_handle->output_stream,
+		 "\n" );
+
+		return;
+	}
+	fprintf(
+	 hash_handle->output_stream,
+	 "\"" );
+
+	hash_handle_path_fprint(
+	 hash_handle,
+	 file->path );
+
+	fprintf(
+	 hash_handle->output_stream,
+	 "\",%" PRIu64 "",
+	 file->size );
+
+	if( file->md5_context != NULL )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "," );
+
+		hash_handle_digest_hash_fprint(
+		 hash_handle,
+		 file->md5_hash,
+		 LIBHMAC_MD5_HASH_SIZE );
+	}
+	if( file->sha1_context != NULL )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "," );
+
+		hash_handle_digest_hash_fprint(
+		 hash_handle,
+		 file->sha1_hash,
+		 LIBHMAC_SHA1_HASH_SIZE );
+	}
+	if( file->sha256_context != NULL )
+	{
+		fprintf(
+		 hash_handle->output_stream,
+		 "," );
+
+		hash_handle_digest_hash_fprint(
+		 hash_handle,
+		 file->sha256_hash,
+		 LIBHMAC_SHA256_HASH_SIZE );
+	}
+	fprintf(
+	 hash_handle->output_stream,
+	 "\n" );
+}
+
+/* Hashes the files of a directory file entry
+ * Files are appended to the batch, sub directories are hashed recursively.
+ * The batch is flushed before the directory file entry is released by the caller,
+ * since the sub file entries depend on it
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int hash_handle_hash_directory(
+     hash_handle_t *hash_handle,
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *sub_file_entry = NULL;
+	system_character_t *sub_path           = NULL;
+	static char *function                  = "hash_handle_hash_directory";
+	size_t path_length                     = 0;
+	uint32_t file_attribute_flags          = 0;
+	int number_of_sub_file_entries         = 0;
+	int result                             = 1;
+	int sub_file_entry_index               = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( libfsrefs_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( hash_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		file_attribute_flags = 0;
+
+		if( libfsrefs_file_entry_get_file_attribute_flags(
+		     sub_file_entry,
+		     &file_attribute_flags,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file attribute flags of sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( hash_handle_get_sub_path(
+		     sub_file_entry,
+		     path,
+		     path_length,
+		     &sub_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path of sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( ( file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) != 0 )
+		{
+			result = hash_handle_hash_directory(
+			          hash_handle,
+			          sub_file_entry,
+			          sub_path,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to hash sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			memory_free(
+			 sub_path );
+
+			sub_path = NULL;
+
+			if( libfsrefs_file_entry_free(
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = hash_handle_append_batch_file_entry(
+			          hash_handle,
+			          sub_file_entry,
+			          sub_path,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub file entry: %d to batch.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			else if( result == 1 )
+			{
+				/* The batch took over the sub file entry and its path
+				 */
+				sub_file_entry = NULL;
+				sub_path       = NULL;
+			}
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+
+		sub_path = NULL;
+	}
+	if( sub_file_entry != NULL )
+	{
+		if( libfsrefs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The batch can contain sub file entries of this directory
+	 * and must be flushed or cleared before the caller frees it
+	 */
+	if( result == 1 )
+	{
+		result = hash_handle_flush_batch(
+		          hash_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( hash_handle_clear_batch(
+		     hash_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	hash_handle_clear_batch(
+	 hash_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Hashes the files of the file system
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int hash_handle_hash_file_system(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *file_entry = NULL;
+	static char *function              = "hash_handle_hash_file_system";
+	int result                         = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle_start_workers(
+	     hash_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_get_root_directory(
+	     hash_handle->input_volume,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file entry.",
+		 function );
+
+		goto on_error;
+	}
+	hash_handle_header_fprint(
+	 hash_handle );
+
+	result = hash_handle_hash_directory(
+	          hash_handle,
+	          file_entry,
+	          _SYSTEM_STRING( "" ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to hash root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_handle_stop_workers(
+	     hash_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 hash_handle->notify_stream,
+		 "Hashed %d files.\n",
+		 hash_handle->number_of_hashed_files );
+	}
+	return( result );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	hash_handle_stop_workers(
+	 hash_handle,
+	 NULL );
+
+	return( -1 );
+}
+
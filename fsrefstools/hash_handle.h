@@ -0,0 +1,495 @@
+/*
+ * Hash handle
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HASH_HANDLE_H )
+#define _HASH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefstools_libbfio.h"
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcthreads.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of files that are hashed in a single physical order pass
+ */
+#define HASH_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILES	128
+
+/* The size of the buffers that pass data from the reading thread to the hashing threads
+ */
+#define HASH_HANDLE_BUFFER_SIZE				( 4 * 1024 * 1024 )
+
+/* The maximum size of the out of order data of a batch that is kept until the data preceding it is read
+ */
+#define HASH_HANDLE_MAXIMUM_PENDING_DATA_SIZE		( 64 * 1024 * 1024 )
+
+#define HASH_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+#define HASH_HANDLE_MAXIMUM_NUMBER_OF_THREADS		32
+
+enum HASH_HANDLE_DIGEST_TYPE_FLAGS
+{
+	HASH_HANDLE_DIGEST_TYPE_FLAG_MD5		= 0x01,
+	HASH_HANDLE_DIGEST_TYPE_FLAG_SHA1		= 0x02,
+	HASH_HANDLE_DIGEST_TYPE_FLAG_SHA256		= 0x04
+};
+
+enum HASH_HANDLE_OUTPUT_FORMATS
+{
+	HASH_HANDLE_OUTPUT_FORMAT_CSV			= (int) 'c',
+	HASH_HANDLE_OUTPUT_FORMAT_BODYFILE		= (int) 'b'
+};
+
+enum HASH_HANDLE_JOB_TYPES
+{
+	HASH_HANDLE_JOB_TYPE_DATA			= 1,
+	HASH_HANDLE_JOB_TYPE_ZERO_DATA			= 2,
+	HASH_HANDLE_JOB_TYPE_FINALIZE			= 3,
+	HASH_HANDLE_JOB_TYPE_STOP			= 4
+};
+
+typedef struct hash_handle_job hash_handle_job_t;
+
+struct hash_handle_job
+{
+	/* The job type
+	 */
+	uint8_t type;
+
+	/* Value to indicate the job was allocated to hold out of order data
+	 * instead of being taken from the buffer ring
+	 */
+	uint8_t is_allocated;
+
+	/* The batch index of the file
+	 */
+	int batch_index;
+
+	/* The offset of the data in the file
+	 */
+	off64_t data_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The next pending job of the same file
+	 */
+	hash_handle_job_t *next_job;
+};
+
+typedef struct hash_handle_file hash_handle_file_t;
+
+struct hash_handle_file
+{
+	/* The file entry
+	 */
+	libfsrefs_file_entry_t *file_entry;
+
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The creation date and time
+	 */
+	uint64_t creation_time;
+
+	/* The modification date and time
+	 */
+	uint64_t modification_time;
+
+	/* The access date and time
+	 */
+	uint64_t access_time;
+
+	/* The entry modification date and time
+	 */
+	uint64_t entry_modification_time;
+
+	/* The hole ranges, stored as pairs of start and end offset
+	 */
+	off64_t *hole_ranges;
+
+	/* The number of hole ranges
+	 */
+	int number_of_hole_ranges;
+
+	/* The index of the next hole range
+	 */
+	int hole_range_index;
+
+	/* The offset of the next data to pass to the hashing thread
+	 */
+	off64_t next_offset;
+
+	/* The pending jobs of data that was read before the data preceding it
+	 */
+	hash_handle_job_t *pending_jobs;
+
+	/* The size of the data of the pending jobs
+	 */
+	size64_t pending_data_size;
+
+	/* Value to indicate the remaining data is read in logical order after
+	 * the physical order pass, since its pending data did not fit
+	 */
+	uint8_t read_sequentially;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The MD5 hash
+	 */
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The SHA1 hash
+	 */
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	/* The SHA256 hash
+	 */
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+};
+
+typedef struct hash_handle hash_handle_t;
+
+typedef struct hash_handle_worker hash_handle_worker_t;
+
+struct hash_handle_worker
+{
+	/* The hash handle
+	 */
+	hash_handle_t *hash_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The jobs queue
+	 */
+	libcthreads_queue_t *jobs_queue;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct hash_handle
+{
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The digest types
+	 */
+	uint8_t digest_types;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The number of hashing threads
+	 */
+	int number_of_threads;
+
+	/* The libbfio input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The libfsrefs input volume
+	 */
+	libfsrefs_volume_t *input_volume;
+
+	/* The files of the current batch
+	 */
+	hash_handle_file_t batch_files[ HASH_HANDLE_MAXIMUM_NUMBER_OF_BATCH_FILES ];
+
+	/* The number of files in the current batch
+	 */
+	int number_of_batch_files;
+
+	/* The number of files in the current batch that are not finalized
+	 */
+	int number_of_unfinalized_files;
+
+	/* The size of the data of the pending jobs of the files in the current batch
+	 */
+	size64_t pending_data_size;
+
+	/* The jobs of the buffer ring
+	 */
+	hash_handle_job_t *jobs;
+
+	/* The number of jobs of the buffer ring
+	 */
+	int number_of_jobs;
+
+	/* The data of the buffer ring
+	 */
+	uint8_t *buffers_data;
+
+	/* The workers
+	 */
+	hash_handle_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The free jobs queue
+	 */
+	libcthreads_queue_t *free_jobs_queue;
+
+	/* The status mutex
+	 */
+	libcthreads_mutex_t *status_mutex;
+
+	/* The status condition
+	 */
+	libcthreads_condition_t *status_condition;
+#endif
+
+	/* Value to indicate a hashing thread failed
+	 */
+	int worker_failed;
+
+	/* The number of hashed files
+	 */
+	int number_of_hashed_files;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int hash_handle_initialize(
+     hash_handle_t **hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_free(
+     hash_handle_t **hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_signal_abort(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_set_volume_offset(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int hash_handle_set_digest_types(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int hash_handle_set_output_format(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int hash_handle_set_number_of_threads(
+     hash_handle_t *hash_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int hash_handle_open_input(
+     hash_handle_t *hash_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int hash_handle_close_input(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_start_workers(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_stop_workers(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_process_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t *job,
+     libcerror_error_t **error );
+
+int hash_handle_worker_run(
+     void *arguments );
+
+int hash_handle_get_free_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t **job,
+     libcerror_error_t **error );
+
+int hash_handle_release_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t *job,
+     libcerror_error_t **error );
+
+int hash_handle_dispatch_job(
+     hash_handle_t *hash_handle,
+     hash_handle_job_t *job,
+     libcerror_error_t **error );
+
+int hash_handle_dispatch_data(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int hash_handle_dispatch_holes(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error );
+
+int hash_handle_dispatch_pending_jobs(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error );
+
+int hash_handle_append_pending_job(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int hash_handle_discard_pending_jobs(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error );
+
+int hash_handle_read_file_data(
+     hash_handle_t *hash_handle,
+     int batch_index,
+     libcerror_error_t **error );
+
+int hash_handle_write_data(
+     int file_entry_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     intptr_t *user_data );
+
+int hash_handle_file_clear(
+     hash_handle_file_t *file,
+     libcerror_error_t **error );
+
+int hash_handle_clear_batch(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_flush_batch(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_determine_hole_ranges(
+     hash_handle_file_t *file,
+     libcerror_error_t **error );
+
+int hash_handle_append_batch_file_entry(
+     hash_handle_t *hash_handle,
+     libfsrefs_file_entry_t *file_entry,
+     system_character_t *path,
+     libcerror_error_t **error );
+
+int hash_handle_get_sub_path(
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     system_character_t **sub_path,
+     libcerror_error_t **error );
+
+void hash_handle_path_fprint(
+      hash_handle_t *hash_handle,
+      const system_character_t *path );
+
+void hash_handle_digest_hash_fprint(
+      hash_handle_t *hash_handle,
+      const uint8_t *digest_hash,
+      size_t digest_hash_size );
+
+void hash_handle_filetime_fprint(
+      hash_handle_t *hash_handle,
+      uint64_t filetime );
+
+void hash_handle_header_fprint(
+      hash_handle_t *hash_handle );
+
+void hash_handle_file_fprint(
+      hash_handle_t *hash_handle,
+      hash_handle_file_t *file );
+
+int hash_handle_hash_directory(
+     hash_handle_t *hash_handle,
+     libfsrefs_file_entry_t *file_entry,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int hash_handle_hash_file_system(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HASH_HANDLE_H ) */
+
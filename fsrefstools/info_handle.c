@@ -31,8 +31,11 @@
 #include "fsrefstools_libcerror.h"
 #include "fsrefstools_libclocale.h"
 #include "fsrefstools_libfsrefs.h"
-#include "fsrefstools_libuna.h"
+#include "fsrefstools_system_string.h"
 #include "info_handle.h"
+#include "output_buffer.h"
+#include "record_writer.h"
+#include "timeline.h"
 
 #if !defined( LIBFSREFS_HAVE_BFIO )
 
@@ -47,116 +50,6 @@ int libfsrefs_volume_open_file_io_handle(
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
-/* Copies a string of a decimal value to a 64-bit value
- * Returns 1 if successful or -1 on error
- */
-int fsrefstools_system_string_copy_from_64_bit_in_decimal(
-     const system_character_t *string,
-     size_t string_size,
-     uint64_t *value_64bit,
-     libcerror_error_t **error )
-{
-	static char *function              = "fsrefstools_system_string_copy_from_64_bit_in_decimal";
-	size_t string_index                = 0;
-	system_character_t character_value = 0;
-	uint8_t maximum_string_index       = 20;
-	int8_t sign                        = 1;
-
-	if( string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
-		 function );
-
-		return( -1 );
-	}
-	if( string_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid string size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( value_64bit == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value 64-bit.",
-		 function );
-
-		return( -1 );
-	}
-	*value_64bit = 0;
-
-	if( string[ string_index ] == (system_character_t) '-' )
-	{
-		string_index++;
-		maximum_string_index++;
-
-		sign = -1;
-	}
-	else if( string[ string_index ] == (system_character_t) '+' )
-	{
-		string_index++;
-		maximum_string_index++;
-	}
-	while( string_index < string_size )
-	{
-		if( string[ string_index ] == 0 )
-		{
-			break;
-		}
-		if( string_index > (size_t) maximum_string_index )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-			 "%s: string too large.",
-			 function );
-
-			return( -1 );
-		}
-		*value_64bit *= 10;
-
-		if( ( string[ string_index ] >= (system_character_t) '0' )
-		 && ( string[ string_index ] <= (system_character_t) '9' ) )
-		{
-			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
-			 function,
-			 string[ string_index ],
-			 string_index );
-
-			return( -1 );
-		}
-		*value_64bit += character_value;
-
-		string_index++;
-	}
-	if( sign == -1 )
-	{
-		*value_64bit *= (uint64_t) -1;
-	}
-	return( 1 );
-}
-
 /* Creates an info handle
  * Make sure the value info_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -315,6 +208,73 @@ int info_handle_free(
 
 			result = -1;
 		}
+		if( ( *info_handle )->bodyfile_output_buffer != NULL )
+		{
+			if( output_buffer_free(
+			     &( ( *info_handle )->bodyfile_output_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bodyfile output buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->bodyfile_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *info_handle )->bodyfile_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close bodyfile stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->timeline != NULL )
+		{
+			if( timeline_free(
+			     &( ( *info_handle )->timeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free timeline.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->timeline_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *info_handle )->timeline_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close timeline stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->path_buffer != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->path_buffer );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -425,9 +385,209 @@ int info_handle_set_bodyfile(
 		 "%s: unable to open bodyfile stream.",
 		 function );
 
+		goto on_error;
+	}
+	if( output_buffer_initialize(
+	     &( info_handle->bodyfile_output_buffer ),
+	     info_handle->bodyfile_stream,
+	     OUTPUT_BUFFER_DEFAULT_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bodyfile output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->bodyfile_stream != NULL )
+	{
+		file_stream_close(
+		 info_handle->bodyfile_stream );
+
+		info_handle->bodyfile_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the timeline
+ * The timeline is written in the mactime CSV format sorted by date and time
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_timeline(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_timeline";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->timeline_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - timeline stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
 		return( -1 );
 	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	info_handle->timeline_stream = file_stream_open_wide(
+	                                filename,
+	                                L"wb" );
+#else
+	info_handle->timeline_stream = file_stream_open(
+	                                filename,
+	                                "wb" );
+#endif
+	if( info_handle->timeline_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open timeline stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( timeline_initialize(
+	     &( info_handle->timeline ),
+	     TIMELINE_DEFAULT_RUN_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timeline.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( info_handle->timeline_stream != NULL )
+	{
+		file_stream_close(
+		 info_handle->timeline_stream );
+
+		info_handle->timeline_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the output format of the file system hierarchy
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			info_handle->output_format = RECORD_WRITER_FORMAT_CSV;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			info_handle->output_format = 0;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			info_handle->output_format = RECORD_WRITER_FORMAT_JSONL;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "binary" ),
+		     6 ) == 0 )
+		{
+			info_handle->output_format = RECORD_WRITER_FORMAT_BINARY;
+			result                     = 1;
+		}
+	}
+	return( result );
 }
 
 /* Sets the volume offset
@@ -593,23 +753,17 @@ int info_handle_close_input(
 	return( 0 );
 }
 
-/* Prints a file entry or data stream name
+/* Resizes the path buffer
  * Returns 1 if successful or -1 on error
  */
-int info_handle_name_value_fprint(
+int info_handle_resize_path_buffer(
      info_handle_t *info_handle,
-     const system_character_t *value_string,
-     size_t value_string_length,
+     size_t path_size,
      libcerror_error_t **error )
 {
-	system_character_t *escaped_value_string     = NULL;
-	static char *function                        = "info_handle_name_value_fprint";
-	libuna_unicode_character_t unicode_character = 0;
-	size_t escaped_value_string_index            = 0;
-	size_t escaped_value_string_size             = 0;
-	size_t value_string_index                    = 0;
-	int print_count                              = 0;
-	int result                                   = 0;
+	uint8_t *path_buffer    = NULL;
+	static char *function   = "info_handle_resize_path_buffer";
+	size_t path_buffer_size = 0;
 
 	if( info_handle == NULL )
 	{
@@ -622,321 +776,213 @@ int info_handle_name_value_fprint(
 
 		return( -1 );
 	}
-	if( value_string == NULL )
+	if( path_size <= info_handle->path_buffer_size )
+	{
+		return( 1 );
+	}
+	if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value string.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	/* To ensure normalization in the escaped string is handled correctly
-	 * it stored in a temporary variable. Note that there is a worst-case of
-	 * a 1 to 4 ratio for each escaped character.
+	/* The path buffer is grown exponentially so that it is only resized
+	 * a couple of times while traversing the file system hierarchy
 	 */
-	if( value_string_length > (size_t) ( ( SSIZE_MAX - 1 ) / ( sizeof( system_character_t ) * 4 ) ) )
+	path_buffer_size = info_handle->path_buffer_size;
+
+	if( path_buffer_size < 256 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid value string length value exceeds maximum.",
-		 function );
-
-		return( -1 );
+		path_buffer_size = 256;
 	}
-	escaped_value_string_size = ( value_string_length * 4 ) + 1;
-
-	escaped_value_string = (system_character_t *) memory_allocate(
-	                                               sizeof( system_character_t ) * escaped_value_string_size );
+	while( path_buffer_size < path_size )
+	{
+		path_buffer_size *= 2;
+	}
+	path_buffer = (uint8_t *) memory_reallocate(
+	                           info_handle->path_buffer,
+	                           sizeof( uint8_t ) * path_buffer_size );
 
-	if( escaped_value_string == NULL )
+	if( path_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create escaped value string.",
+		 "%s: unable to resize path buffer.",
 		 function );
 
-		goto on_error;
-	}
-	/* Using UCS-2 or RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
-	 */
-	while( value_string_index < value_string_length )
-	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libuna_unicode_character_copy_from_ucs2(
-		          &unicode_character,
-		          (libuna_utf16_character_t *) value_string,
-		          value_string_length,
-		          &value_string_index,
-		          error );
-#else
-		result = libuna_unicode_character_copy_from_utf8_rfc2279(
-		          &unicode_character,
-		          (libuna_utf8_character_t *) value_string,
-		          value_string_length,
-		          &value_string_index,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from value string.",
-			 function );
-
-			goto on_error;
-		}
-		/* Replace:
-		 *   Control characters ([U+0-U+1f, U+7f-U+9f]) by \x##
-		 */
-		if( ( unicode_character <= 0x1f )
-		 || ( ( unicode_character >= 0x7f )
-		  &&  ( unicode_character <= 0x9f ) ) )
-		{
-			print_count = system_string_sprintf(
-			               &( escaped_value_string[ escaped_value_string_index ] ),
-			               escaped_value_string_size - escaped_value_string_index,
-			               "\\x%02" PRIx32 "",
-			               unicode_character );
-
-			if( print_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-				 "%s: unable to copy escaped Unicode character to escaped value string.",
-				 function );
-
-				goto on_error;
-			}
-			escaped_value_string_index += print_count;
-		}
-		/* Replace:
-		 *   Unicode surrogate characters ([U+d800-U+dfff]) by \u####
-		 *   Undefined Unicode characters ([U+fdd0-U+fddf, U+fffe-U+ffff]) by \u####
-		 */
-		else if( ( ( unicode_character >= 0x0000d800UL )
-		       &&  ( unicode_character <= 0x0000dfffUL ) )
-		      || ( ( unicode_character >= 0x0000fdd0UL )
-		       &&  ( unicode_character <= 0x0000fddfUL ) )
-		      || ( ( unicode_character >= 0x0000fffeUL )
-		       &&  ( unicode_character <= 0x0000ffffUL ) ) )
-		{
-			print_count = system_string_sprintf(
-			               &( escaped_value_string[ escaped_value_string_index ] ),
-			               escaped_value_string_size - escaped_value_string_index,
-			               "\\u%04" PRIx32 "",
-			               unicode_character );
-
-			if( print_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-				 "%s: unable to copy escaped Unicode character to escaped value string.",
-				 function );
-
-				goto on_error;
-			}
-			escaped_value_string_index += print_count;
-		}
-		/* Replace:
-		 *   Undefined Unicode characters ([
-		 *       U+1fffe-U+1ffff, U+2fffe-U+2ffff, U+3fffe-U+3ffff, U+4fffe-U+4ffff,
-		 *       U+5fffe-U+5ffff, U+6fffe-U+6ffff, U+7fffe-U+7ffff, U+8fffe-U+8ffff,
-		 *       U+9fffe-U+9ffff, U+afffe-U+affff, U+bfffe-U+bffff, U+cfffe-U+cffff,
-		 *       U+dfffe-U+dffff, U+efffe-U+effff, U+ffffe-U+fffff, U+10fffe-U+ffffffff]) by \U########
-		 */
-		else if( ( ( ( unicode_character & 0x0000ffffUL ) >= 0x0000fffeUL )
-		       &&  ( ( unicode_character & 0x0000ffffUL ) <= 0x0000ffffUL ) )
-		      || ( unicode_character > 0x0010fffeUL ) )
-		{
-			print_count = system_string_sprintf(
-			               &( escaped_value_string[ escaped_value_string_index ] ),
-			               escaped_value_string_size - escaped_value_string_index,
-			               "\\U%08" PRIx32 "",
-			               unicode_character );
-
-			if( print_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-				 "%s: unable to copy escaped Unicode character to escaped value string.",
-				 function );
-
-				goto on_error;
-			}
-			escaped_value_string_index += print_count;
-		}
-		else
-		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libuna_unicode_character_copy_to_utf16(
-			          unicode_character,
-			          (libuna_utf16_character_t *) escaped_value_string,
-			          escaped_value_string_size,
-			          &escaped_value_string_index,
-			          error );
-#else
-			result = libuna_unicode_character_copy_to_utf8(
-			          unicode_character,
-			          (libuna_utf8_character_t *) escaped_value_string,
-			          escaped_value_string_size,
-			          &escaped_value_string_index,
-			          error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-				 "%s: unable to copy Unicode character to escaped value string.",
-				 function );
-
-				goto on_error;
-			}
-		}
+		return( -1 );
 	}
-	escaped_value_string[ escaped_value_string_index ] = 0;
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "%" PRIs_SYSTEM "",
-	 escaped_value_string );
-
-	memory_free(
-	 escaped_value_string );
+	info_handle->path_buffer      = path_buffer;
+	info_handle->path_buffer_size = path_buffer_size;
 
 	return( 1 );
-
-on_error:
-	if( escaped_value_string != NULL )
-	{
-		memory_free(
-		 escaped_value_string );
-	}
-	return( -1 );
 }
 
-/* Prints file entry as part of the file system hierarchy or to a bodyfile
+/* Retrieves the stat values of a file entry
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_entry_fprint(
-     info_handle_t *info_handle,
+int info_handle_get_file_entry_stat(
      libfsrefs_file_entry_t *file_entry,
-     const system_character_t *path,
-     const system_character_t *file_entry_name,
+     libfsrefs_file_entry_stat_t *file_entry_stat,
      libcerror_error_t **error )
 {
-	static char *function         = "info_handle_file_entry_fprint";
-	size_t file_entry_name_length = 0;
-	size_t path_length            = 0;
+	static char *function = "info_handle_get_file_entry_stat";
 
-	if( info_handle == NULL )
+	if( file_entry_stat == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid info handle.",
+		 "%s: invalid file entry stat.",
 		 function );
 
 		return( -1 );
 	}
-	if( path == NULL )
+	if( memory_set(
+	     file_entry_stat,
+	     0,
+	     sizeof( libfsrefs_file_entry_stat_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_object_identifier(
+	     file_entry,
+	     &( file_entry_stat->object_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object identifier.",
 		 function );
 
 		return( -1 );
 	}
-	path_length = system_string_length(
-	               path );
+	if( libfsrefs_file_entry_get_creation_time(
+	     file_entry,
+	     &( file_entry_stat->creation_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
 
-	if( file_entry_name != NULL )
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_modification_time(
+	     file_entry,
+	     &( file_entry_stat->modification_time ),
+	     error ) != 1 )
 	{
-		file_entry_name_length = system_string_length(
-		                          file_entry_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
 	}
-	if( info_handle_name_value_fprint(
-	     info_handle,
-	     path,
-	     path_length,
+	if( libfsrefs_file_entry_get_access_time(
+	     file_entry,
+	     &( file_entry_stat->access_time ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print path string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( file_entry_name != NULL )
+	if( libfsrefs_file_entry_get_entry_modification_time(
+	     file_entry,
+	     &( file_entry_stat->entry_modification_time ),
+	     error ) != 1 )
 	{
-		if( info_handle_name_value_fprint(
-		     info_handle,
-		     file_entry_name,
-		     file_entry_name_length,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print file entry name string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry modification time.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+	if( libfsrefs_file_entry_get_file_attribute_flags(
+	     file_entry,
+	     &( file_entry_stat->file_attribute_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_size(
+	     file_entry,
+	     &( file_entry_stat->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
 
-on_error:
-	return( -1 );
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Prints file entry information as part of the file system hierarchy
+/* Prints a file entry as part of the file system hierarchy, to the bodyfile,
+ * the timeline or as a record
+ * The path of the file entry is stored in the path buffer
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_system_hierarchy_fprint_file_entry(
+int info_handle_file_entry_stat_fprint(
      info_handle_t *info_handle,
-     libfsrefs_file_entry_t *file_entry,
-     const system_character_t *path,
+     uint64_t parent_identifier,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     size_t path_length,
      libcerror_error_t **error )
 {
-	libfsrefs_file_entry_t *sub_file_entry = NULL;
-	system_character_t *file_entry_name    = NULL;
-	system_character_t *sub_path           = NULL;
-	static char *function                  = "info_handle_file_system_hierarchy_fprint_file_entry";
-	size_t file_entry_name_size            = 0;
-	size_t path_length                     = 0;
-	size_t sub_path_size                   = 0;
-	int number_of_sub_file_entries         = 0;
-	int result                             = 0;
-	int sub_file_entry_index               = 0;
+	char access_time_string[ 32 ];
+	char creation_time_string[ 32 ];
+	char entry_modification_time_string[ 32 ];
+	char line[ 256 ];
+	char modification_time_string[ 32 ];
+
+	static char *function = "info_handle_file_entry_stat_fprint";
+	int print_count       = 0;
 
 	if( info_handle == NULL )
 	{
@@ -949,104 +995,273 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 
 		return( -1 );
 	}
-	if( path == NULL )
+	if( file_entry_stat == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid file entry stat.",
 		 function );
 
 		return( -1 );
 	}
-	path_length = system_string_length(
-	               path );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsrefs_file_entry_get_utf16_name_size(
-	          file_entry,
-	          &file_entry_name_size,
-	          error );
-#else
-	result = libfsrefs_file_entry_get_utf8_name_size(
-	          file_entry,
-	          &file_entry_name_size,
-	          error );
-#endif
-	if( result == -1 )
+	if( path_length > info_handle->path_buffer_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry name string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( result == 1 )
-	 && ( file_entry_name_size > 0 ) )
+	if( info_handle->notify_output_buffer != NULL )
 	{
-		file_entry_name = system_string_allocate(
-		                   file_entry_name_size );
-
-		if( file_entry_name == NULL )
+		if( output_buffer_append_escaped_utf8_string(
+		     info_handle->notify_output_buffer,
+		     info_handle->path_buffer,
+		     path_length,
+		     NULL,
+		     0,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create file entry name string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print path.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfsrefs_file_entry_get_utf16_name(
-		          file_entry,
-		          (uint16_t *) file_entry_name,
-		          file_entry_name_size,
-		          error );
-#else
-		result = libfsrefs_file_entry_get_utf8_name(
-		          file_entry,
-		          (uint8_t *) file_entry_name,
-		          file_entry_name_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( output_buffer_append_string(
+		     info_handle->notify_output_buffer,
+		     "\n",
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry name string.",
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print end of line.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( ( info_handle->bodyfile_stream != NULL )
-	 || ( file_entry_name != NULL ) )
+	if( info_handle->bodyfile_output_buffer != NULL )
 	{
-		if( info_handle_file_entry_fprint(
-		     info_handle,
-		     file_entry,
-		     path,
-		     file_entry_name,
+		/* Format: MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+		 */
+		if( output_buffer_append_string(
+		     info_handle->bodyfile_output_buffer,
+		     "0|",
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print file entry.",
+			 "%s: unable to print MD5.",
 			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		if( output_buffer_append_escaped_utf8_string(
+		     info_handle->bodyfile_output_buffer,
+		     info_handle->path_buffer,
+		     path_length,
+		     "|\\",
+		     (uint8_t) '\\',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print path.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_copy_filetime_to_posix_time_string(
+		     file_entry_stat->access_time,
+		     access_time_string,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy access time to string.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_copy_filetime_to_posix_time_string(
+		     file_entry_stat->modification_time,
+		     modification_time_string,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy modification time to string.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_copy_filetime_to_posix_time_string(
+		     file_entry_stat->entry_modification_time,
+		     entry_modification_time_string,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry modification time to string.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_copy_filetime_to_posix_time_string(
+		     file_entry_stat->creation_time,
+		     creation_time_string,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy creation time to string.",
+			 function );
+
+			return( -1 );
+		}
+		print_count = narrow_string_snprintf(
+		               line,
+		               256,
+		               "|%" PRIu64 "|%s|0|0|%" PRIu64 "|%s|%s|%s|%s\n",
+		               file_entry_stat->object_identifier,
+		               timeline_get_mode_string(
+		                file_entry_stat->file_attribute_flags ),
+		               (uint64_t) file_entry_stat->size,
+		               access_time_string,
+		               modification_time_string,
+		               entry_modification_time_string,
+		               creation_time_string );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 256 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set line.",
+			 function );
+
+			return( -1 );
+		}
+		if( output_buffer_append_data(
+		     info_handle->bodyfile_output_buffer,
+		     (uint8_t *) line,
+		     (size_t) print_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_handle->timeline != NULL )
+	{
+		if( timeline_append_file_entry(
+		     info_handle->timeline,
+		     file_entry_stat,
+		     info_handle->path_buffer,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file entry to timeline.",
+			 function );
+
+			return( -1 );
 		}
 	}
+	if( info_handle->record_writer != NULL )
+	{
+		if( record_writer_write_file_entry(
+		     info_handle->record_writer,
+		     parent_identifier,
+		     file_entry_stat,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file entry record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the sub file entries of a directory as part of the file system hierarchy
+ * The stat values of the sub file entries are retrieved at once and the path of
+ * each sub file entry is appended to the path of the directory in the path buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_system_hierarchy_fprint_directory(
+     info_handle_t *info_handle,
+     libfsrefs_file_entry_t *file_entry,
+     uint64_t directory_identifier,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_stat_t *file_entry_stats = NULL;
+	libfsrefs_file_entry_t *sub_file_entry        = NULL;
+	uint8_t *utf8_names                           = NULL;
+	static char *function                         = "info_handle_file_system_hierarchy_fprint_directory";
+	size_t name_length                            = 0;
+	size_t sub_path_length                        = 0;
+	size_t utf8_names_size                        = 0;
+	int number_of_sub_file_entries                = 0;
+	int sub_file_entry_index                      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfsrefs_file_entry_get_number_of_sub_file_entries(
 	     file_entry,
 	     &number_of_sub_file_entries,
@@ -1061,128 +1276,237 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 
 		goto on_error;
 	}
-	if( number_of_sub_file_entries > 0 )
+	if( number_of_sub_file_entries <= 0 )
 	{
-		sub_path_size = path_length + 1;
+		return( 1 );
+	}
+	if( (size_t) number_of_sub_file_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsrefs_file_entry_stat_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub file entries value out of bounds.",
+		 function );
 
-		if( file_entry_name != NULL )
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_sub_file_entries_utf8_names_size(
+	     file_entry,
+	     &utf8_names_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entries UTF-8 names size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The names size is 0 if none of the names can be converted to UTF-8
+	 */
+	if( utf8_names_size == 0 )
+	{
+		utf8_names_size = 1;
+	}
+	if( utf8_names_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub file entries UTF-8 names size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_entry_stats = (libfsrefs_file_entry_stat_t *) memory_allocate(
+	                                                    sizeof( libfsrefs_file_entry_stat_t ) * number_of_sub_file_entries );
+
+	if( file_entry_stats == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file entry stats.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_names = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * utf8_names_size );
+
+	if( utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 names.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_sub_file_entries_stat(
+	     file_entry,
+	     file_entry_stats,
+	     number_of_sub_file_entries,
+	     utf8_names,
+	     utf8_names_size,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entries stat values.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		/* Skip sub file entries with a name that cannot be converted to UTF-8
+		 */
+		if( file_entry_stats[ sub_file_entry_index ].name_size == 0 )
+		{
+			continue;
+		}
+		if( ( file_entry_stats[ sub_file_entry_index ].name_offset >= utf8_names_size )
+		 || ( file_entry_stats[ sub_file_entry_index ].name_size > ( utf8_names_size - file_entry_stats[ sub_file_entry_index ].name_offset ) ) )
 		{
-			sub_path_size += file_entry_name_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub file entry: %d name value out of bounds.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
 		}
-		sub_path = system_string_allocate(
-		            sub_path_size );
+		name_length     = file_entry_stats[ sub_file_entry_index ].name_size - 1;
+		sub_path_length = path_length + name_length;
 
-		if( sub_path == NULL )
+		/* Reserve space for the separator of the sub path
+		 */
+		if( info_handle_resize_path_buffer(
+		     info_handle,
+		     sub_path_length + 1,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub path.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize path buffer.",
 			 function );
 
 			goto on_error;
 		}
-		if( system_string_copy(
-		     sub_path,
-		     path,
-		     path_length ) == NULL )
+		if( memory_copy(
+		     &( info_handle->path_buffer[ path_length ] ),
+		     &( utf8_names[ file_entry_stats[ sub_file_entry_index ].name_offset ] ),
+		     name_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy path to sub path.",
+			 "%s: unable to copy name to path buffer.",
 			 function );
 
 			goto on_error;
 		}
-		if( file_entry_name != NULL )
+		if( info_handle_file_entry_stat_fprint(
+		     info_handle,
+		     directory_identifier,
+		     &( file_entry_stats[ sub_file_entry_index ] ),
+		     &( utf8_names[ file_entry_stats[ sub_file_entry_index ].name_offset ] ),
+		     name_length,
+		     sub_path_length,
+		     error ) != 1 )
 		{
-			if( system_string_copy(
-			     &( sub_path[ path_length ] ),
-			     file_entry_name,
-			     file_entry_name_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy file entry name to sub path.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
 
-				goto on_error;
-			}
-			sub_path[ sub_path_size - 2 ] = (system_character_t) LIBFSREFS_SEPARATOR;
+			goto on_error;
 		}
-		sub_path[ sub_path_size - 1 ] = (system_character_t) 0;
-
-		for( sub_file_entry_index = 0;
-		     sub_file_entry_index < number_of_sub_file_entries;
-		     sub_file_entry_index++ )
+		if( ( file_entry_stats[ sub_file_entry_index ].file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
 		{
-			if( libfsrefs_file_entry_get_sub_file_entry_by_index(
-			     file_entry,
-			     sub_file_entry_index,
-			     &sub_file_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve sub file entry: %d.",
-				 function,
-				 sub_file_entry_index );
+			continue;
+		}
+		info_handle->path_buffer[ sub_path_length ] = (uint8_t) LIBFSREFS_SEPARATOR;
 
-				goto on_error;
-			}
-			if( info_handle_file_system_hierarchy_fprint_file_entry(
-			     info_handle,
-			     sub_file_entry,
-			     sub_path,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print file entry: %d information.",
-				 function,
-				 sub_file_entry_index );
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
 
-				goto on_error;
-			}
-			if( libfsrefs_file_entry_free(
-			     &sub_file_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free sub file entry: %d.",
-				 function,
-				 sub_file_entry_index );
+			goto on_error;
+		}
+		if( info_handle_file_system_hierarchy_fprint_directory(
+		     info_handle,
+		     sub_file_entry,
+		     file_entry_stats[ sub_file_entry_index ].object_identifier,
+		     sub_path_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print sub file entry: %d directory.",
+			 function,
+			 sub_file_entry_index );
 
-				goto on_error;
-			}
+			goto on_error;
 		}
-		if( sub_path != NULL )
+		if( libfsrefs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
 		{
-			memory_free(
-			 sub_path );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
 
-			sub_path = NULL;
+			goto on_error;
 		}
 	}
-	if( file_entry_name != NULL )
-	{
-		memory_free(
-		 file_entry_name );
+	memory_free(
+	 utf8_names );
+
+	memory_free(
+	 file_entry_stats );
 
-		file_entry_name = NULL;
-	}
 	return( 1 );
 
 on_error:
@@ -1192,28 +1516,33 @@ on_error:
 		 &sub_file_entry,
 		 NULL );
 	}
-	if( sub_path != NULL )
+	if( utf8_names != NULL )
 	{
 		memory_free(
-		 sub_path );
+		 utf8_names );
 	}
-	if( file_entry_name != NULL )
+	if( file_entry_stats != NULL )
 	{
 		memory_free(
-		 file_entry_name );
+		 file_entry_stats );
 	}
 	return( -1 );
 }
 
 /* Prints the file system hierarchy information
+ * When a bodyfile or timeline is set the file entries are written to them instead
+ * and when a record output format is set the file entries are written as records
  * Returns 1 if successful or -1 on error
  */
 int info_handle_file_system_hierarchy_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error )
 {
-	libfsrefs_file_entry_t *file_entry = NULL;
-	static char *function              = "info_handle_file_system_hierarchy_fprint";
+	libfsrefs_file_entry_stat_t file_entry_stat;
+
+	output_buffer_t *timeline_output_buffer = NULL;
+	libfsrefs_file_entry_t *file_entry      = NULL;
+	static char *function                   = "info_handle_file_system_hierarchy_fprint";
 
 	if( info_handle == NULL )
 	{
@@ -1226,7 +1555,61 @@ int info_handle_file_system_hierarchy_fprint(
 
 		return( -1 );
 	}
-	if( info_handle->bodyfile_stream == NULL )
+	if( info_handle->notify_output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - notify output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->record_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - record writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format != 0 )
+	{
+		if( record_writer_initialize(
+		     &( info_handle->record_writer ),
+		     info_handle->notify_stream,
+		     info_handle->output_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record writer.",
+			 function );
+
+			goto on_error;
+		}
+		if( record_writer_write_header(
+		     info_handle->record_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( info_handle->bodyfile_stream == NULL )
+	      && ( info_handle->timeline == NULL ) )
 	{
 		fprintf(
 		 info_handle->notify_stream,
@@ -1235,6 +1618,22 @@ int info_handle_file_system_hierarchy_fprint(
 		fprintf(
 		 info_handle->notify_stream,
 		 "File system hierarchy:\n" );
+
+		if( output_buffer_initialize(
+		     &( info_handle->notify_output_buffer ),
+		     info_handle->notify_stream,
+		     OUTPUT_BUFFER_DEFAULT_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create notify output buffer.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libfsrefs_volume_get_root_directory(
 	     info_handle->input_volume,
@@ -1250,10 +1649,67 @@ int info_handle_file_system_hierarchy_fprint(
 
 		goto on_error;
 	}
-	if( info_handle_file_system_hierarchy_fprint_file_entry(
+	if( info_handle_resize_path_buffer(
+	     info_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize path buffer.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->path_buffer[ 0 ] = (uint8_t) LIBFSREFS_SEPARATOR;
+
+	if( info_handle_get_file_entry_stat(
+	     file_entry,
+	     &file_entry_stat,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file entry stat values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The root directory is only printed to the bodyfile, the timeline and
+	 * as a record, where it has no name and is its own parent
+	 */
+	if( ( info_handle->bodyfile_output_buffer != NULL )
+	 || ( info_handle->timeline != NULL )
+	 || ( info_handle->record_writer != NULL ) )
+	{
+		if( info_handle_file_entry_stat_fprint(
+		     info_handle,
+		     file_entry_stat.object_identifier,
+		     &file_entry_stat,
+		     info_handle->path_buffer,
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print root directory file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle_file_system_hierarchy_fprint_directory(
 	     info_handle,
 	     file_entry,
-	     _SYSTEM_STRING( "\\" ),
+	     file_entry_stat.object_identifier,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1278,8 +1734,124 @@ int info_handle_file_system_hierarchy_fprint(
 
 		goto on_error;
 	}
-	if( info_handle->bodyfile_stream == NULL )
+	if( info_handle->bodyfile_output_buffer != NULL )
+	{
+		if( output_buffer_flush(
+		     info_handle->bodyfile_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush bodyfile output buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->record_writer != NULL )
+	{
+		if( record_writer_flush(
+		     info_handle->record_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush record writer.",
+			 function );
+
+			goto on_error;
+		}
+		if( record_writer_free(
+		     &( info_handle->record_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->timeline != NULL )
+	{
+		if( output_buffer_initialize(
+		     &timeline_output_buffer,
+		     info_handle->timeline_stream,
+		     OUTPUT_BUFFER_DEFAULT_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create timeline output buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( timeline_write(
+		     info_handle->timeline,
+		     timeline_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write timeline.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_free(
+		     &timeline_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free timeline output buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->notify_output_buffer != NULL )
 	{
+		if( output_buffer_flush(
+		     info_handle->notify_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush notify output buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_free(
+		     &( info_handle->notify_output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free notify output buffer.",
+			 function );
+
+			goto on_error;
+		}
 		fprintf(
 		 info_handle->notify_stream,
 		 "\n" );
@@ -1287,6 +1859,24 @@ int info_handle_file_system_hierarchy_fprint(
 	return( 1 );
 
 on_error:
+	if( timeline_output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &timeline_output_buffer,
+		 NULL );
+	}
+	if( info_handle->record_writer != NULL )
+	{
+		record_writer_free(
+		 &( info_handle->record_writer ),
+		 NULL );
+	}
+	if( info_handle->notify_output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &( info_handle->notify_output_buffer ),
+		 NULL );
+	}
 	if( file_entry != NULL )
 	{
 		libfsrefs_file_entry_free(
@@ -1307,6 +1897,7 @@ int info_handle_volume_fprint(
 	static char *function           = "info_handle_volume_fprint";
 	size32_t cluster_block_size     = 0;
 	size_t volume_name_size         = 0;
+	uint64_t sequence_number        = 0;
 	uint64_t serial_number          = 0;
 	uint16_t bytes_per_sector       = 0;
 	uint8_t major_version           = 0;
@@ -1463,6 +2054,25 @@ int info_handle_volume_fprint(
 	 "\tSerial number\t\t\t: %08" PRIx64 "\n",
 	 serial_number );
 
+	if( libfsrefs_volume_get_checkpoint_sequence_number(
+	     info_handle->input_volume,
+	     &sequence_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCheckpoint sequence number\t: %" PRIu64 "\n",
+	 sequence_number );
+
 	if( libfsrefs_volume_get_bytes_per_sector(
 	     info_handle->input_volume,
 	     &bytes_per_sector,
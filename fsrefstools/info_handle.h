@@ -29,6 +29,9 @@
 #include "fsrefstools_libbfio.h"
 #include "fsrefstools_libcerror.h"
 #include "fsrefstools_libfsrefs.h"
+#include "output_buffer.h"
+#include "record_writer.h"
+#include "timeline.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -58,6 +61,40 @@ struct info_handle
 	 */
 	FILE *bodyfile_stream;
 
+	/* The bodyfile output buffer
+	 */
+	output_buffer_t *bodyfile_output_buffer;
+
+	/* The timeline output stream
+	 */
+	FILE *timeline_stream;
+
+	/* The timeline
+	 */
+	timeline_t *timeline;
+
+	/* The path buffer
+	 * Contains the UTF-8 encoded path of the file entry that is being printed
+	 */
+	uint8_t *path_buffer;
+
+	/* The path buffer size
+	 */
+	size_t path_buffer_size;
+
+	/* The notification output buffer
+	 */
+	output_buffer_t *notify_output_buffer;
+
+	/* The output format of the file system hierarchy
+	 * Contains 0 for text or a record writer format
+	 */
+	int output_format;
+
+	/* The record writer
+	 */
+	record_writer_t *record_writer;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -67,12 +104,6 @@ struct info_handle
 	int abort;
 };
 
-int fsrefstools_system_string_copy_from_64_bit_in_decimal(
-     const system_character_t *string,
-     size_t string_size,
-     uint64_t *value_64bit,
-     libcerror_error_t **error );
-
 int info_handle_initialize(
      info_handle_t **info_handle,
      uint8_t calculate_md5,
@@ -91,6 +122,16 @@ int info_handle_set_bodyfile(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_set_timeline(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_set_volume_offset(
      info_handle_t *info_handle,
      const system_character_t *string,
@@ -105,23 +146,30 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
-int info_handle_name_value_fprint(
+int info_handle_resize_path_buffer(
      info_handle_t *info_handle,
-     const system_character_t *value_string,
-     size_t value_string_length,
+     size_t path_size,
      libcerror_error_t **error );
 
-int info_handle_file_entry_fprint(
-     info_handle_t *info_handle,
+int info_handle_get_file_entry_stat(
      libfsrefs_file_entry_t *file_entry,
-     const system_character_t *path,
-     const system_character_t *file_entry_name,
+     libfsrefs_file_entry_stat_t *file_entry_stat,
+     libcerror_error_t **error );
+
+int info_handle_file_entry_stat_fprint(
+     info_handle_t *info_handle,
+     uint64_t parent_identifier,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     size_t path_length,
      libcerror_error_t **error );
 
-int info_handle_file_system_hierarchy_fprint_file_entry(
+int info_handle_file_system_hierarchy_fprint_directory(
      info_handle_t *info_handle,
      libfsrefs_file_entry_t *file_entry,
-     const system_character_t *path,
+     uint64_t directory_identifier,
+     size_t path_length,
      libcerror_error_t **error );
 
 int info_handle_file_system_hierarchy_fprint(
@@ -0,0 +1,801 @@
+/*
+ * Mount directory
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+#include "mount_directory.h"
+
+/* Creates a mount directory
+ * Make sure the value directory is referencing, is set to NULL
+ * The stat values and names of the sub file entries are read and sorted by name
+ * The directory takes over management of the file entry if successful
+ * Returns 1 if successful or -1 on error
+ */
+int mount_directory_initialize(
+     mount_directory_t **directory,
+     libfsrefs_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	mount_directory_t *safe_directory = NULL;
+	static char *function             = "mount_directory_initialize";
+	int number_of_sub_file_entries    = 0;
+	int sorted_name_index             = 0;
+	int sub_file_entry_index          = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	safe_directory = memory_allocate_structure(
+	                  mount_directory_t );
+
+	if( safe_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_directory,
+	     0,
+	     sizeof( mount_directory_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory.",
+		 function );
+
+		memory_free(
+		 safe_directory );
+
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_sub_file_entries < 0 )
+	 || ( (size_t) number_of_sub_file_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsrefs_file_entry_stat_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub file entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sub_file_entries > 0 )
+	{
+		if( libfsrefs_file_entry_get_sub_file_entries_utf8_names_size(
+		     file_entry,
+		     &( safe_directory->sub_file_entry_names_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of sub file entries names.",
+			 function );
+
+			goto on_error;
+		}
+		/* The names size is 0 if none of the names can be converted to UTF-8
+		 */
+		if( safe_directory->sub_file_entry_names_size == 0 )
+		{
+			safe_directory->sub_file_entry_names_size = 1;
+		}
+		if( safe_directory->sub_file_entry_names_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub file entries names size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_directory->sub_file_entry_names = (uint8_t *) memory_allocate(
+		                                                    sizeof( uint8_t ) * safe_directory->sub_file_entry_names_size );
+
+		if( safe_directory->sub_file_entry_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub file entries names.",
+			 function );
+
+			goto on_error;
+		}
+		safe_directory->sub_file_entry_stats = (libfsrefs_file_entry_stat_t *) memory_allocate(
+		                                                                        sizeof( libfsrefs_file_entry_stat_t ) * number_of_sub_file_entries );
+
+		if( safe_directory->sub_file_entry_stats == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub file entries stat values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_get_sub_file_entries_stat(
+		     file_entry,
+		     safe_directory->sub_file_entry_stats,
+		     number_of_sub_file_entries,
+		     safe_directory->sub_file_entry_names,
+		     safe_directory->sub_file_entry_names_size,
+		     &( safe_directory->number_of_sub_file_entries ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entries stat values.",
+			 function );
+
+			goto on_error;
+		}
+		safe_directory->sorted_names = (mount_directory_sorted_name_t *) memory_allocate(
+		                                                                  sizeof( mount_directory_sorted_name_t ) * number_of_sub_file_entries );
+
+		if( safe_directory->sorted_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted names.",
+			 function );
+
+			goto on_error;
+		}
+		safe_directory->sub_directories = (mount_directory_t **) memory_allocate(
+		                                                          sizeof( mount_directory_t * ) * number_of_sub_file_entries );
+
+		if( safe_directory->sub_directories == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub directories.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     safe_directory->sub_directories,
+		     0,
+		     sizeof( mount_directory_t * ) * number_of_sub_file_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear sub directories.",
+			 function );
+
+			goto on_error;
+		}
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < safe_directory->number_of_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			/* Sub file entries with a name that cannot be converted to UTF-8 cannot be looked up by name
+			 */
+			if( safe_directory->sub_file_entry_stats[ sub_file_entry_index ].name_size == 0 )
+			{
+				continue;
+			}
+			if( safe_directory->sub_file_entry_stats[ sub_file_entry_index ].name_offset >= safe_directory->sub_file_entry_names_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid sub file entry: %d name offset value out of bounds.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			sorted_name_index = safe_directory->number_of_sorted_names;
+
+			safe_directory->sorted_names[ sorted_name_index ].name                 = (const char *) &( safe_directory->sub_file_entry_names[ safe_directory->sub_file_entry_stats[ sub_file_entry_index ].name_offset ] );
+			safe_directory->sorted_names[ sorted_name_index ].sub_file_entry_index = sub_file_entry_index;
+
+			safe_directory->number_of_sorted_names += 1;
+		}
+		/* Sort the names once so that lookups by name are a binary search
+		 */
+		qsort(
+		 safe_directory->sorted_names,
+		 (size_t) safe_directory->number_of_sorted_names,
+		 sizeof( mount_directory_sorted_name_t ),
+		 &mount_directory_sorted_name_compare );
+	}
+	safe_directory->file_entry = file_entry;
+
+	*directory = safe_directory;
+
+	return( 1 );
+
+on_error:
+	if( safe_directory != NULL )
+	{
+		if( safe_directory->sub_directories != NULL )
+		{
+			memory_free(
+			 safe_directory->sub_directories );
+		}
+		if( safe_directory->sorted_names != NULL )
+		{
+			memory_free(
+			 safe_directory->sorted_names );
+		}
+		if( safe_directory->sub_file_entry_stats != NULL )
+		{
+			memory_free(
+			 safe_directory->sub_file_entry_stats );
+		}
+		if( safe_directory->sub_file_entry_names != NULL )
+		{
+			memory_free(
+			 safe_directory->sub_file_entry_names );
+		}
+		memory_free(
+		 safe_directory );
+	}
+	return( -1 );
+}
+
+/* Frees a mount directory and its sub directories
+ * Returns 1 if successful or -1 on error
+ */
+int mount_directory_free(
+     mount_directory_t **directory,
+     libcerror_error_t **error )
+{
+	static char *function    = "mount_directory_free";
+	int result               = 1;
+	int sub_file_entry_index = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		/* The sub directories reference the file entry of the directory
+		 * and are freed first
+		 */
+		if( ( *directory )->sub_directories != NULL )
+		{
+			for( sub_file_entry_index = 0;
+			     sub_file_entry_index < ( *directory )->number_of_sub_file_entries;
+			     sub_file_entry_index++ )
+			{
+				if( ( *directory )->sub_directories[ sub_file_entry_index ] == NULL )
+				{
+					continue;
+				}
+				if( mount_directory_free(
+				     &( ( *directory )->sub_directories[ sub_file_entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free sub directory: %d.",
+					 function,
+					 sub_file_entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *directory )->sub_directories );
+		}
+		if( ( *directory )->sorted_names != NULL )
+		{
+			memory_free(
+			 ( *directory )->sorted_names );
+		}
+		if( ( *directory )->sub_file_entry_stats != NULL )
+		{
+			memory_free(
+			 ( *directory )->sub_file_entry_stats );
+		}
+		if( ( *directory )->sub_file_entry_names != NULL )
+		{
+			memory_free(
+			 ( *directory )->sub_file_entry_names );
+		}
+		if( libfsrefs_file_entry_free(
+		     &( ( *directory )->file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+	}
+	return( result );
+}
+
+/* Compares two sorted names
+ * Callback function for qsort
+ * Returns a value less than, equal to or greater than 0
+ */
+int mount_directory_sorted_name_compare(
+     const void *first_sorted_name,
+     const void *second_sorted_name )
+{
+	const uint8_t *first_name  = NULL;
+	const uint8_t *second_name = NULL;
+
+	first_name  = (const uint8_t *) ( (const mount_directory_sorted_name_t *) first_sorted_name )->name;
+	second_name = (const uint8_t *) ( (const mount_directory_sorted_name_t *) second_sorted_name )->name;
+
+	while( ( *first_name != 0 )
+	    && ( *first_name == *second_name ) )
+	{
+		first_name++;
+		second_name++;
+	}
+	return( (int) *first_name - (int) *second_name );
+}
+
+/* Compares a sorted name with a name that is not terminated by an end of string character
+ * The names are compared in the same order as mount_directory_sorted_name_compare
+ * Returns a value less than, equal to or greater than 0
+ */
+int mount_directory_compare_name(
+     const char *sorted_name,
+     const char *name,
+     size_t name_length )
+{
+	size_t name_index = 0;
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( sorted_name[ name_index ] != name[ name_index ] )
+		{
+			return( (int) ( (uint8_t) sorted_name[ name_index ] ) - (int) ( (uint8_t) name[ name_index ] ) );
+		}
+		/* The name contains an end of string character
+		 */
+		if( sorted_name[ name_index ] == 0 )
+		{
+			return( -1 );
+		}
+	}
+	if( sorted_name[ name_length ] != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of sub file entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_directory_get_number_of_sub_file_entries(
+     mount_directory_t *directory,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_directory_get_number_of_sub_file_entries";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sub_file_entries = directory->number_of_sub_file_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the stat values and UTF-8 encoded name of a specific sub file entry
+ * The stat values and name are owned by the directory
+ * The name is NULL if the name of the sub file entry cannot be converted to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int mount_directory_get_sub_file_entry_stat_by_index(
+     mount_directory_t *directory,
+     int sub_file_entry_index,
+     libfsrefs_file_entry_stat_t **file_entry_stat,
+     const char **name,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_directory_get_sub_file_entry_stat_by_index";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_file_entry_index < 0 )
+	 || ( sub_file_entry_index >= directory->number_of_sub_file_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub file entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	*file_entry_stat = &( directory->sub_file_entry_stats[ sub_file_entry_index ] );
+
+	if( name != NULL )
+	{
+		if( ( *file_entry_stat )->name_size == 0 )
+		{
+			*name = NULL;
+		}
+		else
+		{
+			*name = (const char *) &( directory->sub_file_entry_names[ ( *file_entry_stat )->name_offset ] );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the sub file entry with the UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such sub file entry or -1 on error
+ */
+int mount_directory_get_sub_file_entry_index_by_name(
+     mount_directory_t *directory,
+     const char *name,
+     size_t name_length,
+     int *sub_file_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_directory_get_sub_file_entry_index_by_name";
+	int first_index       = 0;
+	int last_index        = 0;
+	int middle_index      = 0;
+	int result            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry index.",
+		 function );
+
+		return( -1 );
+	}
+	last_index = directory->number_of_sorted_names;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+		result = mount_directory_compare_name(
+		          directory->sorted_names[ middle_index ].name,
+		          name,
+		          name_length );
+
+		if( result == 0 )
+		{
+			*sub_file_entry_index = directory->sorted_names[ middle_index ].sub_file_entry_index;
+
+			return( 1 );
+		}
+		else if( result < 0 )
+		{
+			first_index = middle_index + 1;
+		}
+		else
+		{
+			last_index = middle_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the mount directory of a specific sub file entry
+ * The sub directory is created on first use and owned by the directory
+ * Returns 1 if successful, 0 if the sub file entry is not a directory or -1 on error
+ */
+int mount_directory_get_sub_directory_by_index(
+     mount_directory_t *directory,
+     int sub_file_entry_index,
+     mount_directory_t **sub_directory,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *sub_file_entry = NULL;
+	static char *function                  = "mount_directory_get_sub_directory_by_index";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_file_entry_index < 0 )
+	 || ( sub_file_entry_index >= directory->number_of_sub_file_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub file entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory->sub_file_entry_stats[ sub_file_entry_index ].file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
+	{
+		return( 0 );
+	}
+	if( directory->sub_directories[ sub_file_entry_index ] == NULL )
+	{
+		if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+		     directory->file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( mount_directory_initialize(
+		     &( directory->sub_directories[ sub_file_entry_index ] ),
+		     sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub directory: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	*sub_directory = directory->sub_directories[ sub_file_entry_index ];
+
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry of a specific sub file entry
+ * The sub file entry references the file entry of the directory
+ * and must be freed before the directory
+ * Returns 1 if successful or -1 on error
+ */
+int mount_directory_get_sub_file_entry_by_index(
+     mount_directory_t *directory,
+     int sub_file_entry_index,
+     libfsrefs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_directory_get_sub_file_entry_by_index";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+	     directory->file_entry,
+	     sub_file_entry_index,
+	     sub_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Mount directory
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_DIRECTORY_H )
+#define _MOUNT_DIRECTORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mount_directory_sorted_name mount_directory_sorted_name_t;
+
+struct mount_directory_sorted_name
+{
+	/* The UTF-8 encoded name
+	 */
+	const char *name;
+
+	/* The sub file entry index
+	 */
+	int sub_file_entry_index;
+};
+
+typedef struct mount_directory mount_directory_t;
+
+struct mount_directory
+{
+	/* The file entry
+	 */
+	libfsrefs_file_entry_t *file_entry;
+
+	/* The number of sub file entries
+	 */
+	int number_of_sub_file_entries;
+
+	/* The stat values of the sub file entries
+	 */
+	libfsrefs_file_entry_stat_t *sub_file_entry_stats;
+
+	/* The UTF-8 encoded names of the sub file entries
+	 */
+	uint8_t *sub_file_entry_names;
+
+	/* The size of the UTF-8 encoded names of the sub file entries
+	 */
+	size_t sub_file_entry_names_size;
+
+	/* The names of the sub file entries sorted for lookup
+	 */
+	mount_directory_sorted_name_t *sorted_names;
+
+	/* The number of sorted names
+	 * Sub file entries without a name are not included
+	 */
+	int number_of_sorted_names;
+
+	/* The sub directories, created on first use
+	 */
+	mount_directory_t **sub_directories;
+};
+
+int mount_directory_initialize(
+     mount_directory_t **directory,
+     libfsrefs_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+int mount_directory_free(
+     mount_directory_t **directory,
+     libcerror_error_t **error );
+
+int mount_directory_sorted_name_compare(
+     const void *first_sorted_name,
+     const void *second_sorted_name );
+
+int mount_directory_compare_name(
+     const char *sorted_name,
+     const char *name,
+     size_t name_length );
+
+int mount_directory_get_number_of_sub_file_entries(
+     mount_directory_t *directory,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error );
+
+int mount_directory_get_sub_file_entry_stat_by_index(
+     mount_directory_t *directory,
+     int sub_file_entry_index,
+     libfsrefs_file_entry_stat_t **file_entry_stat,
+     const char **name,
+     libcerror_error_t **error );
+
+int mount_directory_get_sub_file_entry_index_by_name(
+     mount_directory_t *directory,
+     const char *name,
+     size_t name_length,
+     int *sub_file_entry_index,
+     libcerror_error_t **error );
+
+int mount_directory_get_sub_directory_by_index(
+     mount_directory_t *directory,
+     int sub_file_entry_index,
+     mount_directory_t **sub_directory,
+     libcerror_error_t **error );
+
+int mount_directory_get_sub_file_entry_by_index(
+     mount_directory_t *directory,
+     int sub_file_entry_index,
+     libfsrefs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_DIRECTORY_H ) */
+
@@ -0,0 +1,925 @@
+/*
+ * Mount file system
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcthreads.h"
+#include "fsrefstools_libfsrefs.h"
+#include "mount_directory.h"
+#include "mount_file_system.h"
+
+/* Creates a file system
+ * Make sure the value file_system is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_initialize(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_initialize";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_system = memory_allocate_structure(
+	                mount_file_system_t );
+
+	if( *file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file system.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_system,
+	     0,
+	     sizeof( mount_file_system_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file system.",
+		 function );
+
+		memory_free(
+		 *file_system );
+
+		*file_system = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *file_system )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *file_system != NULL )
+	{
+		memory_free(
+		 *file_system );
+
+		*file_system = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file system
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_free(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_free";
+	int result            = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_system != NULL )
+	{
+		/* The volume reference is freed elsewhere
+		 */
+		if( ( *file_system )->root_directory != NULL )
+		{
+			if( mount_directory_free(
+			     &( ( *file_system )->root_directory ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free root directory.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *file_system )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *file_system );
+
+		*file_system = NULL;
+	}
+	return( result );
+}
+
+/* Sets the volume
+ * Reads the root directory and its stat values
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_volume(
+     mount_file_system_t *file_system,
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *root_file_entry = NULL;
+	static char *function                   = "mount_file_system_set_volume";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->root_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - root directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_get_root_directory(
+	     volume,
+	     &root_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     &( file_system->root_directory_stat ),
+	     0,
+	     sizeof( libfsrefs_file_entry_stat_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear root directory stat.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_creation_time(
+	     root_file_entry,
+	     &( file_system->root_directory_stat.creation_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_modification_time(
+	     root_file_entry,
+	     &( file_system->root_directory_stat.modification_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_access_time(
+	     root_file_entry,
+	     &( file_system->root_directory_stat.access_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory access time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_entry_modification_time(
+	     root_file_entry,
+	     &( file_system->root_directory_stat.entry_modification_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory entry modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_file_entry_get_file_attribute_flags(
+	     root_file_entry,
+	     &( file_system->root_directory_stat.file_attribute_flags ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file attribute flags.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->root_directory_stat.file_attribute_flags |= LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY;
+
+	if( mount_directory_initialize(
+	     &( file_system->root_directory ),
+	     root_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create root directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* The root directory took over management of the root file entry
+	 */
+	file_system->volume = volume;
+
+	return( 1 );
+
+on_error:
+	if( root_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the parent directory and sub file entry index of a specific path
+ * The path is relative to the root of the file system and uses '/' as segment separator
+ * For the root directory the parent directory is NULL and the sub file entry index -1
+ * The caller must hold the mutex of the file system
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_file_system_get_parent_directory_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     mount_directory_t **parent_directory,
+     int *sub_file_entry_index,
+     libcerror_error_t **error )
+{
+	mount_directory_t *directory  = NULL;
+	static char *function         = "mount_file_system_get_parent_directory_by_path";
+	size_t path_index             = 0;
+	size_t segment_length         = 0;
+	size_t segment_start          = 0;
+	int result                    = 0;
+	int safe_sub_file_entry_index = -1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->root_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing root directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry index.",
+		 function );
+
+		return( -1 );
+	}
+	while( path_index < path_length )
+	{
+		/* Skip consecutive segment separators
+		 */
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] == '/' ) )
+		{
+			path_index++;
+		}
+		segment_start = path_index;
+
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != '/' ) )
+		{
+			path_index++;
+		}
+		segment_length = path_index - segment_start;
+
+		if( segment_length == 0 )
+		{
+			break;
+		}
+		/* Descend into the sub file entry of the previous segment
+		 */
+		if( directory == NULL )
+		{
+			directory = file_system->root_directory;
+		}
+		else
+		{
+			result = mount_directory_get_sub_directory_by_index(
+			          directory,
+			          safe_sub_file_entry_index,
+			          &directory,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub directory: %d.",
+				 function,
+				 safe_sub_file_entry_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+		}
+		result = mount_directory_get_sub_file_entry_index_by_name(
+		          directory,
+		          &( path[ segment_start ] ),
+		          segment_length,
+		          &safe_sub_file_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry index by name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	*parent_directory     = directory;
+	*sub_file_entry_index = safe_sub_file_entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the stat values of a specific path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_file_system_get_stat_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     libfsrefs_file_entry_stat_t *file_entry_stat,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_stat_t *sub_file_entry_stat = NULL;
+	mount_directory_t *parent_directory              = NULL;
+	static char *function                            = "mount_file_system_get_stat_by_path";
+	int result                                       = 0;
+	int sub_file_entry_index                         = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_system->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = mount_file_system_get_parent_directory_by_path(
+	          file_system,
+	          path,
+	          path_length,
+	          &parent_directory,
+	          &sub_file_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent directory by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( parent_directory == NULL )
+		{
+			sub_file_entry_stat = &( file_system->root_directory_stat );
+		}
+		else if( mount_directory_get_sub_file_entry_stat_by_index(
+		          parent_directory,
+		          sub_file_entry_index,
+		          &sub_file_entry_stat,
+		          NULL,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d stat.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     file_entry_stat,
+		     sub_file_entry_stat,
+		     sizeof( libfsrefs_file_entry_stat_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file entry stat.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_system->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_system->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the directory of a specific path
+ * The directory is owned by the file system and remains valid until the file system is freed
+ * Returns 1 if successful, 0 if no such directory or -1 on error
+ */
+int mount_file_system_get_directory_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     mount_directory_t **directory,
+     libcerror_error_t **error )
+{
+	mount_directory_t *parent_directory = NULL;
+	static char *function               = "mount_file_system_get_directory_by_path";
+	int result                          = 0;
+	int sub_file_entry_index            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_system->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = mount_file_system_get_parent_directory_by_path(
+	          file_system,
+	          path,
+	          path_length,
+	          &parent_directory,
+	          &sub_file_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent directory by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( parent_directory == NULL )
+		{
+			*directory = file_system->root_directory;
+		}
+		else
+		{
+			result = mount_directory_get_sub_directory_by_index(
+			          parent_directory,
+			          sub_file_entry_index,
+			          directory,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub directory: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_system->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_system->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the file entry of a specific path
+ * The file entry references the directory that contains it and must be freed
+ * before the file system
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_file_system_get_file_entry_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	mount_directory_t *parent_directory = NULL;
+	static char *function               = "mount_file_system_get_file_entry_by_path";
+	int result                          = 0;
+	int sub_file_entry_index            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_system->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = mount_file_system_get_parent_directory_by_path(
+	          file_system,
+	          path,
+	          path_length,
+	          &parent_directory,
+	          &sub_file_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent directory by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The root directory has no data to read
+		 */
+		if( parent_directory == NULL )
+		{
+			result = 0;
+		}
+		else if( mount_directory_get_sub_file_entry_by_index(
+		          parent_directory,
+		          sub_file_entry_index,
+		          file_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_system->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( *file_entry != NULL )
+		{
+			libfsrefs_file_entry_free(
+			 file_entry,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_system->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
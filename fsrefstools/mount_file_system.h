@@ -0,0 +1,107 @@
+/*
+ * Mount file system
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_FILE_SYSTEM_H )
+#define _MOUNT_FILE_SYSTEM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcthreads.h"
+#include "fsrefstools_libfsrefs.h"
+#include "mount_directory.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mount_file_system mount_file_system_t;
+
+struct mount_file_system
+{
+	/* The volume
+	 */
+	libfsrefs_volume_t *volume;
+
+	/* The root directory
+	 */
+	mount_directory_t *root_directory;
+
+	/* The stat values of the root directory
+	 */
+	libfsrefs_file_entry_stat_t root_directory_stat;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes access to the directories
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int mount_file_system_initialize(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_free(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_set_volume(
+     mount_file_system_t *file_system,
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error );
+
+int mount_file_system_get_parent_directory_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     mount_directory_t **parent_directory,
+     int *sub_file_entry_index,
+     libcerror_error_t **error );
+
+int mount_file_system_get_stat_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     libfsrefs_file_entry_stat_t *file_entry_stat,
+     libcerror_error_t **error );
+
+int mount_file_system_get_directory_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     mount_directory_t **directory,
+     libcerror_error_t **error );
+
+int mount_file_system_get_file_entry_by_path(
+     mount_file_system_t *file_system,
+     const char *path,
+     size_t path_length,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_FILE_SYSTEM_H ) */
+
@@ -0,0 +1,998 @@
+/*
+ * Mount tool fuse functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libcnotify.h"
+#include "fsrefstools_libfsrefs.h"
+#include "fsrefstools_unused.h"
+#include "mount_directory.h"
+#include "mount_file_system.h"
+#include "mount_fuse.h"
+#include "mount_handle.h"
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+
+/* The number of 100th nano seconds between the FILETIME epoch (January 1, 1601)
+ * and the POSIX epoch (January 1, 1970)
+ */
+#define MOUNT_FUSE_FILETIME_POSIX_EPOCH_DELTA	(int64_t) 116444736000000000LL
+
+/* The number of directory entries that precede the sub file entries: "." and ".."
+ */
+#define MOUNT_FUSE_NUMBER_OF_SELF_ENTRIES	2
+
+/* Sets a time value from a FILETIME
+ */
+#if defined( HAVE_STRUCT_STAT_ST_ATIM )
+#define mount_fuse_set_time_value( time_value, filetime ) \
+	if( (int64_t) ( filetime ) > MOUNT_FUSE_FILETIME_POSIX_EPOCH_DELTA ) \
+	{ \
+		( time_value ).tv_sec  = (time_t) ( ( (int64_t) ( filetime ) - MOUNT_FUSE_FILETIME_POSIX_EPOCH_DELTA ) / 10000000 ); \
+		( time_value ).tv_nsec = (long) ( ( ( (int64_t) ( filetime ) - MOUNT_FUSE_FILETIME_POSIX_EPOCH_DELTA ) % 10000000 ) * 100 ); \
+	}
+#else
+#define mount_fuse_set_time_value( time_value, filetime ) \
+	if( (int64_t) ( filetime ) > MOUNT_FUSE_FILETIME_POSIX_EPOCH_DELTA ) \
+	{ \
+		time_value = (time_t) ( ( (int64_t) ( filetime ) - MOUNT_FUSE_FILETIME_POSIX_EPOCH_DELTA ) / 10000000 ); \
+	}
+#endif
+
+/* Sets the values in a stat info structure
+ * Returns 1 if successful or -1 on error
+ */
+int mount_fuse_set_stat_info(
+     struct stat *stat_info,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_fuse_set_stat_info";
+
+	if( stat_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_OFF_T <= 4
+	if( file_entry_stat->size > (size64_t) UINT32_MAX )
+#else
+	if( file_entry_stat->size > (size64_t) INT64_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     stat_info,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry_stat->file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) != 0 )
+	{
+		stat_info->st_mode  = S_IFDIR | 0555;
+		stat_info->st_nlink = 2;
+	}
+	else
+	{
+		stat_info->st_mode  = S_IFREG | 0444;
+		stat_info->st_nlink = 1;
+		stat_info->st_size  = (off_t) file_entry_stat->size;
+	}
+#if defined( HAVE_GETEUID )
+	stat_info->st_uid = geteuid();
+#else
+	stat_info->st_uid = 0;
+#endif
+#if defined( HAVE_GETEGID )
+	stat_info->st_gid = getegid();
+#else
+	stat_info->st_gid = 0;
+#endif
+
+#if defined( HAVE_STRUCT_STAT_ST_ATIM )
+	mount_fuse_set_time_value(
+	 stat_info->st_atim,
+	 file_entry_stat->access_time );
+
+	mount_fuse_set_time_value(
+	 stat_info->st_ctim,
+	 file_entry_stat->entry_modification_time );
+
+	mount_fuse_set_time_value(
+	 stat_info->st_mtim,
+	 file_entry_stat->modification_time );
+#else
+	mount_fuse_set_time_value(
+	 stat_info->st_atime,
+	 file_entry_stat->access_time );
+
+	mount_fuse_set_time_value(
+	 stat_info->st_ctime,
+	 file_entry_stat->entry_modification_time );
+
+	mount_fuse_set_time_value(
+	 stat_info->st_mtime,
+	 file_entry_stat->modification_time );
+#endif
+	return( 1 );
+}
+
+/* Opens a file or directory
+ * The file entry is kept open until release, so reads do not need to resolve the path
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_open(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error           = NULL;
+	libfsrefs_file_entry_t *file_entry = NULL;
+	mount_handle_t *mount_handle       = NULL;
+	static char *function              = "mount_fuse_open";
+	size_t path_length                 = 0;
+	int result                         = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( file_info->flags & 0x03 ) != O_RDONLY )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		result = -EACCES;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+
+	path_length = narrow_string_length(
+	               path );
+
+	result = mount_file_system_get_file_entry_by_path(
+	          mount_handle->file_system,
+	          path,
+	          path_length,
+	          &file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry for path: %s.",
+		 function,
+		 path );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = -ENOENT;
+
+		goto on_error;
+	}
+	/* The volume is read-only hence the page cache of the file
+	 * remains valid between opens
+	 */
+	file_info->fh         = (uint64_t) file_entry;
+	file_info->keep_cache = 1;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Reads a buffer of data at the specified offset
+ * Sparse ranges are returned as zero bytes
+ * Returns number of bytes read if successful or a negative errno value otherwise
+ */
+int mount_fuse_read(
+     const char *path,
+     char *buffer,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error           = NULL;
+	libfsrefs_file_entry_t *file_entry = NULL;
+	static char *function              = "mount_fuse_read";
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( size > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info - missing file handle.",
+		 function );
+
+		result = -EBADF;
+
+		goto on_error;
+	}
+	file_entry = (libfsrefs_file_entry_t *) file_info->fh;
+
+	read_count = libfsrefs_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              (uint8_t *) buffer,
+	              size,
+	              (off64_t) offset,
+	              &error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	return( (int) read_count );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Releases a file or directory
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_release(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error           = NULL;
+	libfsrefs_file_entry_t *file_entry = NULL;
+	static char *function              = "mount_fuse_release";
+	int result                         = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	file_entry = (libfsrefs_file_entry_t *) file_info->fh;
+
+	if( file_entry != NULL )
+	{
+		if( libfsrefs_file_entry_free(
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+	}
+	file_info->fh = (uint64_t) NULL;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Opens a directory
+ * The directory is owned by the file system and remains cached for the lifetime of the mount
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_opendir(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error     = NULL;
+	mount_directory_t *directory = NULL;
+	mount_handle_t *mount_handle = NULL;
+	static char *function        = "mount_fuse_opendir";
+	size_t path_length           = 0;
+	int result                   = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+
+	path_length = narrow_string_length(
+	               path );
+
+	result = mount_file_system_get_directory_by_path(
+	          mount_handle->file_system,
+	          path,
+	          path_length,
+	          &directory,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory for path: %s.",
+		 function,
+		 path );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = -ENOENT;
+
+		goto on_error;
+	}
+	file_info->fh         = (uint64_t) directory;
+	file_info->keep_cache = 1;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Reads a directory
+ * The entries are provided with offsets so large directories are read in multiple calls
+ * and the stat values of the sub file entries come from the directory cache
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+#if defined( HAVE_LIBFUSE3 )
+int mount_fuse_readdir(
+     const char *path,
+     void *buffer,
+     fuse_fill_dir_t filler,
+     off_t offset,
+     struct fuse_file_info *file_info,
+     enum fuse_readdir_flags flags )
+#else
+int mount_fuse_readdir(
+     const char *path,
+     void *buffer,
+     fuse_fill_dir_t filler,
+     off_t offset,
+     struct fuse_file_info *file_info )
+#endif
+{
+#if defined( HAVE_LIBFUSE3 )
+	struct stat stat_info;
+#endif
+
+	libcerror_error_t *error                     = NULL;
+	libfsrefs_file_entry_stat_t *file_entry_stat = NULL;
+	mount_directory_t *directory                 = NULL;
+	const char *name                             = NULL;
+	static char *function                        = "mount_fuse_readdir";
+	struct stat *entry_stat_info                 = NULL;
+	off_t entry_index                            = 0;
+	int number_of_sub_file_entries               = 0;
+	int result                                   = 0;
+	int sub_file_entry_index                     = 0;
+
+#if defined( HAVE_LIBFUSE3 )
+	enum fuse_fill_dir_flags fill_flags          = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( filler == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filler.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info - missing file handle.",
+		 function );
+
+		result = -EBADF;
+
+		goto on_error;
+	}
+	directory = (mount_directory_t *) file_info->fh;
+
+#if defined( HAVE_LIBFUSE3 )
+	/* Pass the stat values so that the kernel does not need a separate lookup per entry
+	 */
+	if( ( flags & FUSE_READDIR_PLUS ) != 0 )
+	{
+		fill_flags      = FUSE_FILL_DIR_PLUS;
+		entry_stat_info = &stat_info;
+	}
+#endif
+	if( mount_directory_get_number_of_sub_file_entries(
+	     directory,
+	     &number_of_sub_file_entries,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	for( entry_index = offset;
+	     entry_index < (off_t) ( number_of_sub_file_entries + MOUNT_FUSE_NUMBER_OF_SELF_ENTRIES );
+	     entry_index++ )
+	{
+		if( entry_index < MOUNT_FUSE_NUMBER_OF_SELF_ENTRIES )
+		{
+			if( entry_index == 0 )
+			{
+				name = ".";
+			}
+			else
+			{
+				name = "..";
+			}
+#if defined( HAVE_LIBFUSE3 )
+			result = filler(
+			          buffer,
+			          name,
+			          NULL,
+			          entry_index + 1,
+			          0 );
+#else
+			result = filler(
+			          buffer,
+			          name,
+			          NULL,
+			          entry_index + 1 );
+#endif
+		}
+		else
+		{
+			sub_file_entry_index = (int) ( entry_index - MOUNT_FUSE_NUMBER_OF_SELF_ENTRIES );
+
+			if( mount_directory_get_sub_file_entry_stat_by_index(
+			     directory,
+			     sub_file_entry_index,
+			     &file_entry_stat,
+			     &name,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d stat.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			/* Skip sub file entries with a name that cannot be converted to UTF-8
+			 */
+			if( name == NULL )
+			{
+				continue;
+			}
+			if( entry_stat_info != NULL )
+			{
+				if( mount_fuse_set_stat_info(
+				     entry_stat_info,
+				     file_entry_stat,
+				     &error ) != 1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set stat info.",
+					 function );
+
+					result = -EIO;
+
+					goto on_error;
+				}
+			}
+#if defined( HAVE_LIBFUSE3 )
+			result = filler(
+			          buffer,
+			          name,
+			          entry_stat_info,
+			          entry_index + 1,
+			          fill_flags );
+#else
+			result = filler(
+			          buffer,
+			          name,
+			          entry_stat_info,
+			          entry_index + 1 );
+#endif
+		}
+		/* The buffer is full, the remaining entries are read in a next call
+		 */
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Releases a directory
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_releasedir(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_releasedir";
+	int result               = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	/* The directory is owned by the file system
+	 */
+	file_info->fh = (uint64_t) NULL;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Retrieves the file stat info
+ * The stat values are served from the directory cache without creating a file entry
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+#if defined( HAVE_LIBFUSE3 )
+int mount_fuse_getattr(
+     const char *path,
+     struct stat *stat_info,
+     struct fuse_file_info *file_info FSREFSTOOLS_ATTRIBUTE_UNUSED )
+#else
+int mount_fuse_getattr(
+     const char *path,
+     struct stat *stat_info )
+#endif
+{
+	libfsrefs_file_entry_stat_t file_entry_stat;
+
+	libcerror_error_t *error     = NULL;
+	mount_handle_t *mount_handle = NULL;
+	static char *function        = "mount_fuse_getattr";
+	size_t path_length           = 0;
+	int result                   = 0;
+
+#if defined( HAVE_LIBFUSE3 )
+	FSREFSTOOLS_UNREFERENCED_PARAMETER( file_info )
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+
+	path_length = narrow_string_length(
+	               path );
+
+	result = mount_file_system_get_stat_by_path(
+	          mount_handle->file_system,
+	          path,
+	          path_length,
+	          &file_entry_stat,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stat for path: %s.",
+		 function,
+		 path );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = -ENOENT;
+
+		goto on_error;
+	}
+	if( mount_fuse_set_stat_info(
+	     stat_info,
+	     &file_entry_stat,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Initializes the file system connection
+ * Since the volume is read-only the kernel is allowed to cache data, names and attributes
+ * and to issue read requests asynchronously
+ * Returns the private data
+ */
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_info,
+       struct fuse_config *configuration )
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_info )
+#endif
+{
+#if defined( FUSE_CAP_ASYNC_READ )
+	if( connection_info != NULL )
+	{
+		if( ( connection_info->capable & FUSE_CAP_ASYNC_READ ) != 0 )
+		{
+			connection_info->want |= FUSE_CAP_ASYNC_READ;
+		}
+	}
+#endif
+#if defined( HAVE_LIBFUSE3 )
+	if( configuration != NULL )
+	{
+		configuration->kernel_cache     = 1;
+		configuration->entry_timeout    = (double) MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->attr_timeout     = (double) MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->negative_timeout = (double) MOUNT_FUSE_CACHE_TIMEOUT;
+	}
+#endif
+	return( fuse_get_context()->private_data );
+}
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) */
+
@@ -0,0 +1,594 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libuna.h"
+#include "output_buffer.h"
+
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     FILE *stream,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * data_size );
+
+	if( ( *output_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->stream    = stream;
+	( *output_buffer )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Data that was not flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 ( *output_buffer )->data );
+
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_flush(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_flush";
+	size_t write_count    = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->data_offset == 0 )
+	{
+		return( 1 );
+	}
+	write_count = file_stream_write(
+	               output_buffer->stream,
+	               output_buffer->data,
+	               output_buffer->data_offset );
+
+	if( write_count != output_buffer->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_offset = 0;
+
+	return( 1 );
+}
+
+/* Appends data to the output buffer
+ * The buffered data is flushed when the data does not fit and data that is
+ * larger than the buffer is written directly
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_data(
+     output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_data";
+	size_t write_count    = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( output_buffer->data_size - output_buffer->data_offset ) )
+	{
+		if( output_buffer_flush(
+		     output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size >= output_buffer->data_size )
+		{
+			write_count = file_stream_write(
+			               output_buffer->stream,
+			               data,
+			               data_size );
+
+			if( write_count != data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( memory_copy(
+	     &( output_buffer->data[ output_buffer->data_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_offset += data_size;
+
+	return( 1 );
+}
+
+/* Appends a narrow string to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-8 string to the output buffer
+ * Control characters are replaced by \x##, surrogate and undefined Unicode characters
+ * by \u#### or \U######## and special characters are prefixed by the escape character
+ * Unescaped characters are appended in runs so that plain ASCII names are copied at once
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_escaped_utf8_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const char *special_characters,
+     uint8_t escape_character,
+     libcerror_error_t **error )
+{
+	char escaped_character_string[ 16 ];
+
+	static char *function                        = "output_buffer_append_escaped_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t special_characters_length             = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_next_index                = 0;
+	size_t utf8_string_run_index                 = 0;
+	int print_count                              = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( special_characters != NULL )
+	{
+		special_characters_length = narrow_string_length(
+		                             special_characters );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		unicode_character      = utf8_string[ utf8_string_index ];
+		utf8_string_next_index = utf8_string_index + 1;
+		print_count            = 0;
+
+		if( unicode_character < 0x80 )
+		{
+			if( ( unicode_character > 0x1f )
+			 && ( unicode_character != 0x7f ) )
+			{
+				if( ( special_characters_length == 0 )
+				 || ( narrow_string_search_character(
+				       special_characters,
+				       (char) unicode_character,
+				       special_characters_length ) == NULL ) )
+				{
+					utf8_string_index = utf8_string_next_index;
+
+					continue;
+				}
+				escaped_character_string[ 0 ] = (char) escape_character;
+				escaped_character_string[ 1 ] = (char) unicode_character;
+
+				print_count = 2;
+			}
+		}
+		else
+		{
+			/* Using RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
+			 */
+			utf8_string_next_index = utf8_string_index;
+
+			if( libuna_unicode_character_copy_from_utf8_rfc2279(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_next_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( ( unicode_character < 0x0000d800UL )
+			  ||  ( unicode_character > 0x0000dfffUL ) )
+			 && ( ( unicode_character < 0x0000fdd0UL )
+			  ||  ( unicode_character > 0x0000fddfUL ) )
+			 && ( ( unicode_character & 0x0000ffffUL ) < 0x0000fffeUL )
+			 && ( unicode_character <= 0x0010fffeUL )
+			 && ( unicode_character > 0x9f ) )
+			{
+				utf8_string_index = utf8_string_next_index;
+
+				continue;
+			}
+		}
+		if( print_count == 0 )
+		{
+			/* Replace:
+			 *   Control characters ([U+0-U+1f, U+7f-U+9f]) by \x##
+			 *   Unicode surrogate characters ([U+d800-U+dfff]) by \u####
+			 *   Undefined Unicode characters ([U+fdd0-U+fddf, U+fffe-U+ffff]) by \u####
+			 *   Other undefined Unicode characters by \U########
+			 */
+			if( unicode_character <= 0x9f )
+			{
+				print_count = narrow_string_snprintf(
+				               escaped_character_string,
+				               16,
+				               "\\x%02" PRIx32 "",
+				               unicode_character );
+			}
+			else if( unicode_character <= 0x0000ffffUL )
+			{
+				print_count = narrow_string_snprintf(
+				               escaped_character_string,
+				               16,
+				               "\\u%04" PRIx32 "",
+				               unicode_character );
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               escaped_character_string,
+				               16,
+				               "\\U%08" PRIx32 "",
+				               unicode_character );
+			}
+			if( ( print_count < 0 )
+			 || ( print_count > 16 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy escaped Unicode character to string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( utf8_string_index > utf8_string_run_index )
+		{
+			if( output_buffer_append_data(
+			     output_buffer,
+			     &( utf8_string[ utf8_string_run_index ] ),
+			     utf8_string_index - utf8_string_run_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) escaped_character_string,
+		     (size_t) print_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append escaped character.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string_index     = utf8_string_next_index;
+		utf8_string_run_index = utf8_string_next_index;
+	}
+	if( utf8_string_index > utf8_string_run_index )
+	{
+		if( output_buffer_append_data(
+		     output_buffer,
+		     &( utf8_string[ utf8_string_run_index ] ),
+		     utf8_string_index - utf8_string_run_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
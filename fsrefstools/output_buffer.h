@@ -0,0 +1,98 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_BUFFER_H )
+#define _OUTPUT_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of an output buffer
+ */
+#define OUTPUT_BUFFER_DEFAULT_SIZE	( 1024 * 1024 )
+
+typedef struct output_buffer output_buffer_t;
+
+struct output_buffer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+};
+
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     FILE *stream,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_flush(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_append_data(
+     output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_buffer_append_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     libcerror_error_t **error );
+
+int output_buffer_append_escaped_utf8_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const char *special_characters,
+     uint8_t escape_character,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_BUFFER_H ) */
+
@@ -0,0 +1,880 @@
+/*
+ * Record writer
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+#include "output_buffer.h"
+#include "record_writer.h"
+
+/* The names of the values of a record in the order they are written
+ */
+static const char *record_writer_value_names[ 8 ] = {
+	"identifier",
+	"parent_identifier",
+	"creation_time",
+	"modification_time",
+	"access_time",
+	"entry_modification_time",
+	"size",
+	"file_attribute_flags" };
+
+/* Creates a record writer
+ * Make sure the value record_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_initialize(
+     record_writer_t **record_writer,
+     FILE *stream,
+     int format,
+     libcerror_error_t **error )
+{
+	static char *function = "record_writer_initialize";
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != RECORD_WRITER_FORMAT_BINARY )
+	 && ( format != RECORD_WRITER_FORMAT_CSV )
+	 && ( format != RECORD_WRITER_FORMAT_JSONL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*record_writer = memory_allocate_structure(
+	                  record_writer_t );
+
+	if( *record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_writer,
+	     0,
+	     sizeof( record_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_initialize(
+	     &( ( *record_writer )->output_buffer ),
+	     stream,
+	     OUTPUT_BUFFER_DEFAULT_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_writer )->format = format;
+
+	return( 1 );
+
+on_error:
+	if( *record_writer != NULL )
+	{
+		memory_free(
+		 *record_writer );
+
+		*record_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record writer
+ * Records that were not flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_free(
+     record_writer_t **record_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_writer_free";
+	int result            = 1;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_writer != NULL )
+	{
+		if( output_buffer_free(
+		     &( ( *record_writer )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *record_writer );
+
+		*record_writer = NULL;
+	}
+	return( result );
+}
+
+/* Copies a narrow string into a string buffer
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_copy_string(
+     const char *source_string,
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "record_writer_copy_string";
+	size_t safe_string_index   = 0;
+	size_t source_string_index = 0;
+
+	if( source_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	while( source_string[ source_string_index ] != 0 )
+	{
+		if( safe_string_index >= string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		string[ safe_string_index++ ] = (uint8_t) source_string[ source_string_index++ ];
+	}
+	*string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Copies a 64-bit value into a string buffer as a decimal string
+ * The digits are determined directly instead of using a locale dependent
+ * format function since this is done for every value of every record
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_copy_decimal_string(
+     uint64_t value,
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libcerror_error_t **error )
+{
+	uint8_t digits[ 20 ];
+
+	static char *function    = "record_writer_copy_decimal_string";
+	size_t safe_string_index = 0;
+	int number_of_digits     = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	do
+	{
+		digits[ number_of_digits++ ] = (uint8_t) '0' + (uint8_t) ( value % 10 );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( ( safe_string_index > string_size )
+	 || ( (size_t) number_of_digits > ( string_size - safe_string_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_digits > 0 )
+	{
+		string[ safe_string_index++ ] = digits[ --number_of_digits ];
+	}
+	*string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Appends a name to the output buffer
+ * The name is escaped according to the format, in JSON Lines the quote,
+ * backslash and control characters are escaped and in CSV the quote is doubled
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_append_name(
+     record_writer_t *record_writer,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	uint8_t escaped_character[ 6 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "record_writer_append_name";
+	size_t escaped_character_size  = 0;
+	size_t name_index              = 0;
+	size_t run_start_index         = 0;
+	uint8_t byte_value             = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		byte_value             = name[ name_index ];
+		escaped_character_size = 0;
+
+		if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+		{
+			if( ( byte_value == (uint8_t) '"' )
+			 || ( byte_value == (uint8_t) '\\' ) )
+			{
+				escaped_character[ 0 ] = (uint8_t) '\\';
+				escaped_character[ 1 ] = byte_value;
+				escaped_character_size = 2;
+			}
+			else if( byte_value < 0x20 )
+			{
+				escaped_character[ 0 ] = (uint8_t) '\\';
+				escaped_character[ 1 ] = (uint8_t) 'u';
+				escaped_character[ 2 ] = (uint8_t) '0';
+				escaped_character[ 3 ] = (uint8_t) '0';
+				escaped_character[ 4 ] = (uint8_t) hexadecimal_digits[ byte_value >> 4 ];
+				escaped_character[ 5 ] = (uint8_t) hexadecimal_digits[ byte_value & 0x0f ];
+				escaped_character_size = 6;
+			}
+		}
+		else if( byte_value == (uint8_t) '"' )
+		{
+			escaped_character[ 0 ] = (uint8_t) '"';
+			escaped_character[ 1 ] = (uint8_t) '"';
+			escaped_character_size = 2;
+		}
+		if( escaped_character_size == 0 )
+		{
+			continue;
+		}
+		if( name_index > run_start_index )
+		{
+			if( output_buffer_append_data(
+			     record_writer->output_buffer,
+			     &( name[ run_start_index ] ),
+			     name_index - run_start_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( output_buffer_append_data(
+		     record_writer->output_buffer,
+		     escaped_character,
+		     escaped_character_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append escaped character.",
+			 function );
+
+			return( -1 );
+		}
+		run_start_index = name_index + 1;
+	}
+	if( name_length > run_start_index )
+	{
+		if( output_buffer_append_data(
+		     record_writer->output_buffer,
+		     &( name[ run_start_index ] ),
+		     name_length - run_start_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the header of the record stream
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_header(
+     record_writer_t *record_writer,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 256 ];
+
+	static char *function   = "record_writer_write_header";
+	size_t header_data_size = 0;
+	int value_index         = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_BINARY )
+	{
+		if( memory_copy(
+		     header_data,
+		     RECORD_WRITER_BINARY_SIGNATURE,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( header_data[ 8 ] ),
+		 RECORD_WRITER_BINARY_FORMAT_VERSION );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( header_data[ 12 ] ),
+		 RECORD_WRITER_BINARY_RECORD_HEADER_SIZE );
+
+		header_data_size = RECORD_WRITER_BINARY_HEADER_SIZE;
+	}
+	else if( record_writer->format == RECORD_WRITER_FORMAT_CSV )
+	{
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			if( record_writer_copy_string(
+			     record_writer_value_names[ value_index ],
+			     header_data,
+			     256,
+			     &header_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value name: %d.",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+			header_data[ header_data_size++ ] = (uint8_t) ',';
+		}
+		if( record_writer_copy_string(
+		     "name\n",
+		     header_data,
+		     256,
+		     &header_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy name value name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( header_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( output_buffer_append_data(
+	     record_writer->output_buffer,
+	     header_data,
+	     header_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a file entry record
+ * The values preceding the name are formatted in a single record buffer
+ * that is appended to the output buffer at once
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_file_entry(
+     record_writer_t *record_writer,
+     uint64_t parent_identifier,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	uint8_t record_data[ 512 ];
+	uint64_t values[ 8 ];
+
+	const char *record_suffix = NULL;
+	static char *function     = "record_writer_write_file_entry";
+	size_t record_data_size   = 0;
+	int value_index           = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	values[ 0 ] = file_entry_stat->object_identifier;
+	values[ 1 ] = parent_identifier;
+	values[ 2 ] = file_entry_stat->creation_time;
+	values[ 3 ] = file_entry_stat->modification_time;
+	values[ 4 ] = file_entry_stat->access_time;
+	values[ 5 ] = file_entry_stat->entry_modification_time;
+	values[ 6 ] = (uint64_t) file_entry_stat->size;
+	values[ 7 ] = (uint64_t) file_entry_stat->file_attribute_flags;
+
+	if( record_writer->format == RECORD_WRITER_FORMAT_BINARY )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( record_data[ 0 ] ),
+		 (uint32_t) ( RECORD_WRITER_BINARY_RECORD_HEADER_SIZE + name_length ) );
+
+		for( value_index = 0;
+		     value_index < 7;
+		     value_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( record_data[ 4 + ( value_index * 8 ) ] ),
+			 values[ value_index ] );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( record_data[ 60 ] ),
+		 file_entry_stat->file_attribute_flags );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_data[ 64 ] ),
+		 (uint16_t) name_length );
+
+		record_data_size = RECORD_WRITER_BINARY_RECORD_HEADER_SIZE;
+	}
+	else
+	{
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+			{
+				record_data[ record_data_size++ ] = ( value_index == 0 ) ? (uint8_t) '{' : (uint8_t) ',';
+				record_data[ record_data_size++ ] = (uint8_t) '"';
+
+				if( record_writer_copy_string(
+				     record_writer_value_names[ value_index ],
+				     record_data,
+				     512,
+				     &record_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value name: %d.",
+					 function,
+					 value_index );
+
+					return( -1 );
+				}
+				record_data[ record_data_size++ ] = (uint8_t) '"';
+				record_data[ record_data_size++ ] = (uint8_t) ':';
+			}
+			if( record_writer_copy_decimal_string(
+			     values[ value_index ],
+			     record_data,
+			     512,
+			     &record_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value: %d.",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+			if( record_writer->format == RECORD_WRITER_FORMAT_CSV )
+			{
+				record_data[ record_data_size++ ] = (uint8_t) ',';
+			}
+		}
+		if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+		{
+			if( record_writer_copy_string(
+			     ",\"name\":\"",
+			     record_data,
+			     512,
+			     &record_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy name value name.",
+				 function );
+
+				return( -1 );
+			}
+			record_suffix = "\"}\n";
+		}
+		else
+		{
+			record_data[ record_data_size++ ] = (uint8_t) '"';
+
+			record_suffix = "\"\n";
+		}
+	}
+	if( output_buffer_append_data(
+	     record_writer->output_buffer,
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_BINARY )
+	{
+		if( name_length > 0 )
+		{
+			if( output_buffer_append_data(
+			     record_writer->output_buffer,
+			     name,
+			     name_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		if( record_writer_append_name(
+		     record_writer,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name.",
+			 function );
+
+			return( -1 );
+		}
+		if( output_buffer_append_string(
+		     record_writer->output_buffer,
+		     record_suffix,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the buffered records to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_flush(
+     record_writer_t *record_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_writer_flush";
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_flush(
+	     record_writer->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
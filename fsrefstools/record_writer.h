@@ -0,0 +1,133 @@
+/*
+ * Record writer
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_WRITER_H )
+#define _RECORD_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+#include "output_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The binary record stream starts with a 16-byte header:
+ *   0 - 8  signature "FSREFSRC"
+ *   8 - 4  format version (1)
+ *  12 - 4  size of the record header (66)
+ *
+ * Followed by the records, each record consists of a 66-byte header
+ * followed by the UTF-8 encoded name without end of string character:
+ *   0 - 4  size of the record including the name
+ *   4 - 8  object identifier
+ *  12 - 8  parent object identifier
+ *  20 - 8  creation date and time (FILETIME)
+ *  28 - 8  modification date and time (FILETIME)
+ *  36 - 8  access date and time (FILETIME)
+ *  44 - 8  entry modification date and time (FILETIME)
+ *  52 - 8  size
+ *  60 - 4  file attribute flags
+ *  64 - 2  size of the name
+ *
+ * All values are stored in little-endian
+ */
+#define RECORD_WRITER_BINARY_SIGNATURE		"FSREFSRC"
+#define RECORD_WRITER_BINARY_FORMAT_VERSION	1
+#define RECORD_WRITER_BINARY_HEADER_SIZE	16
+#define RECORD_WRITER_BINARY_RECORD_HEADER_SIZE	66
+
+enum RECORD_WRITER_FORMATS
+{
+	RECORD_WRITER_FORMAT_BINARY		= (int) 'b',
+	RECORD_WRITER_FORMAT_CSV		= (int) 'c',
+	RECORD_WRITER_FORMAT_JSONL		= (int) 'j'
+};
+
+typedef struct record_writer record_writer_t;
+
+struct record_writer
+{
+	/* The output buffer
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The format
+	 */
+	int format;
+};
+
+int record_writer_initialize(
+     record_writer_t **record_writer,
+     FILE *stream,
+     int format,
+     libcerror_error_t **error );
+
+int record_writer_free(
+     record_writer_t **record_writer,
+     libcerror_error_t **error );
+
+int record_writer_copy_string(
+     const char *source_string,
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libcerror_error_t **error );
+
+int record_writer_copy_decimal_string(
+     uint64_t value,
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libcerror_error_t **error );
+
+int record_writer_append_name(
+     record_writer_t *record_writer,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int record_writer_write_header(
+     record_writer_t *record_writer,
+     libcerror_error_t **error );
+
+int record_writer_write_file_entry(
+     record_writer_t *record_writer,
+     uint64_t parent_identifier,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int record_writer_flush(
+     record_writer_t *record_writer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_WRITER_H ) */
+
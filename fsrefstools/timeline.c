@@ -0,0 +1,1519 @@
+/*
+ * Timeline
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+#include "output_buffer.h"
+#include "timeline.h"
+
+/* The size of the name of an event is padded to a multitude of 8 bytes
+ * to keep the events in the run data aligned
+ */
+#define timeline_event_get_size( name_size ) \
+	( sizeof( timeline_event_t ) + ( ( (size_t) ( name_size ) + 7 ) & ~( (size_t) 7 ) ) )
+
+#define timeline_event_get_name( event ) \
+	( (uint8_t *) &( ( event )[ 1 ] ) )
+
+/* The number of days before the start of each month in a non-leap year
+ */
+static const int timeline_days_before_month[ 13 ] = {
+	0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 };
+
+/* Creates a timeline
+ * Make sure the value timeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_initialize(
+     timeline_t **timeline,
+     size_t run_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_initialize";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run_data_size < ( 2 * sizeof( timeline_event_t ) ) )
+	 || ( run_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( ( run_data_size / sizeof( timeline_event_t ) ) > (size_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*timeline = memory_allocate_structure(
+	             timeline_t );
+
+	if( *timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *timeline,
+	     0,
+	     sizeof( timeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline.",
+		 function );
+
+		memory_free(
+		 *timeline );
+
+		*timeline = NULL;
+
+		return( -1 );
+	}
+	/* The run data size is a multitude of 8 bytes to keep the events aligned
+	 */
+	run_data_size &= ~( (size_t) 7 );
+
+	( *timeline )->run_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * run_data_size );
+
+	if( ( *timeline )->run_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create run data.",
+		 function );
+
+		goto on_error;
+	}
+	( *timeline )->run_data_size                = run_data_size;
+	( *timeline )->maximum_number_of_run_events = (int) ( run_data_size / sizeof( timeline_event_t ) );
+
+	( *timeline )->run_events = (timeline_event_t **) memory_allocate(
+	                                                   sizeof( timeline_event_t * ) * ( *timeline )->maximum_number_of_run_events );
+
+	if( ( *timeline )->run_events == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create run events.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *timeline != NULL )
+	{
+		if( ( *timeline )->run_data != NULL )
+		{
+			memory_free(
+			 ( *timeline )->run_data );
+		}
+		memory_free(
+		 *timeline );
+
+		*timeline = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a timeline
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_free(
+     timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_free";
+	int result            = 1;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		if( timeline_close_runs(
+		     *timeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close runs.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *timeline )->run_events );
+
+		memory_free(
+		 ( *timeline )->run_data );
+
+		memory_free(
+		 *timeline );
+
+		*timeline = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the bodyfile and mactime mode string of the file attribute flags
+ * Returns a pointer to a static string
+ */
+const char *timeline_get_mode_string(
+             uint32_t file_attribute_flags )
+{
+	if( ( file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY ) != 0 )
+	{
+		if( ( file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_READ_ONLY ) != 0 )
+		{
+			return( "d/dr-xr-xr-x" );
+		}
+		return( "d/drwxrwxrwx" );
+	}
+	if( ( file_attribute_flags & LIBFSREFS_FILE_ATTRIBUTE_FLAG_READ_ONLY ) != 0 )
+	{
+		return( "r/rr-xr-xr-x" );
+	}
+	return( "r/rrwxrwxrwx" );
+}
+
+/* Copies a FILETIME value to an ISO 8601 date and time string in UTC
+ * The string has the format: YYYY-MM-DDThh:mm:ss.#######Z
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_copy_filetime_to_date_time_string(
+     uint64_t filetime,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "timeline_copy_filetime_to_date_time_string";
+	uint64_t number_of_days = 0;
+	uint64_t seconds        = 0;
+	uint32_t fraction       = 0;
+	int day_of_year         = 0;
+	int is_leap_year        = 0;
+	int month               = 0;
+	int number_of_cycles    = 0;
+	int print_count         = 0;
+	int year                = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size < 32 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	fraction       = (uint32_t) ( filetime % 10000000 );
+	seconds        = filetime / 10000000;
+	number_of_days = seconds / 86400;
+	seconds       %= 86400;
+
+	/* The FILETIME epoch 1601-01-01 is the start of a 400 year Gregorian cycle
+	 */
+	year            = 1601 + (int) ( ( number_of_days / 146097 ) * 400 );
+	number_of_days %= 146097;
+
+	number_of_cycles = (int) ( number_of_days / 36524 );
+
+	if( number_of_cycles == 4 )
+	{
+		number_of_cycles = 3;
+	}
+	year           += number_of_cycles * 100;
+	number_of_days -= (uint64_t) number_of_cycles * 36524;
+
+	year            += (int) ( ( number_of_days / 1461 ) * 4 );
+	number_of_days %= 1461;
+
+	number_of_cycles = (int) ( number_of_days / 365 );
+
+	if( number_of_cycles == 4 )
+	{
+		number_of_cycles = 3;
+	}
+	year        += number_of_cycles;
+	day_of_year  = (int) ( number_of_days - ( (uint64_t) number_of_cycles * 365 ) );
+
+	if( ( ( year % 4 ) == 0 )
+	 && ( ( ( year % 100 ) != 0 )
+	  ||  ( ( year % 400 ) == 0 ) ) )
+	{
+		is_leap_year = 1;
+	}
+	for( month = 1;
+	     month < 12;
+	     month++ )
+	{
+		if( day_of_year < ( timeline_days_before_month[ month ] + ( ( month >= 2 ) ? is_leap_year : 0 ) ) )
+		{
+			break;
+		}
+	}
+	day_of_year -= timeline_days_before_month[ month - 1 ] + ( ( month > 2 ) ? is_leap_year : 0 );
+
+	print_count = narrow_string_snprintf(
+	               string,
+	               string_size,
+	               "%04d-%02d-%02dT%02d:%02d:%02d.%07" PRIu32 "Z",
+	               year,
+	               month,
+	               day_of_year + 1,
+	               (int) ( seconds / 3600 ),
+	               (int) ( ( seconds / 60 ) % 60 ),
+	               (int) ( seconds % 60 ),
+	               fraction );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a FILETIME value to a POSIX timestamp string with a fraction of 100th nano seconds
+ * A FILETIME value of 0 is copied as 0
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_copy_filetime_to_posix_time_string(
+     uint64_t filetime,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_copy_filetime_to_posix_time_string";
+	int64_t posix_time    = 0;
+	int print_count       = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size < 32 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == 0 )
+	{
+		string[ 0 ] = '0';
+		string[ 1 ] = 0;
+
+		return( 1 );
+	}
+	/* The FILETIME epoch is 1601-01-01, the POSIX epoch is 1970-01-01
+	 */
+	posix_time = (int64_t) filetime - (int64_t) 116444736000000000LL;
+
+	if( posix_time < 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               string,
+		               string_size,
+		               "-%" PRIi64 ".%07" PRIi64 "",
+		               -posix_time / 10000000,
+		               -posix_time % 10000000 );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               string,
+		               string_size,
+		               "%" PRIi64 ".%07" PRIi64 "",
+		               posix_time / 10000000,
+		               posix_time % 10000000 );
+	}
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares two events
+ * Events are ordered by timestamp, name and MACB flags
+ * Returns -1 if the first event is less than the second, 0 if equal or 1 if greater
+ */
+int timeline_compare_events(
+     const void *first_event,
+     const void *second_event )
+{
+	const timeline_event_t *first  = NULL;
+	const timeline_event_t *second = NULL;
+	uint32_t name_size             = 0;
+	int result                     = 0;
+
+	first  = *( (const timeline_event_t * const *) first_event );
+	second = *( (const timeline_event_t * const *) second_event );
+
+	if( first->timestamp < second->timestamp )
+	{
+		return( -1 );
+	}
+	else if( first->timestamp > second->timestamp )
+	{
+		return( 1 );
+	}
+	name_size = first->name_size;
+
+	if( name_size > second->name_size )
+	{
+		name_size = second->name_size;
+	}
+	result = memory_compare(
+	          &( first[ 1 ] ),
+	          &( second[ 1 ] ),
+	          (size_t) name_size );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first->name_size < second->name_size )
+	{
+		return( -1 );
+	}
+	else if( first->name_size > second->name_size )
+	{
+		return( 1 );
+	}
+	if( first->macb_flags < second->macb_flags )
+	{
+		return( -1 );
+	}
+	else if( first->macb_flags > second->macb_flags )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Appends an event to the run
+ * The run is sorted and written to a temporary file when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_append_event(
+     timeline_t *timeline,
+     uint64_t timestamp,
+     uint8_t macb_flags,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	timeline_event_t *event = NULL;
+	static char *function   = "timeline_append_event";
+	size_t event_size       = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( timeline->run_data_size - sizeof( timeline_event_t ) - 7 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	event_size = timeline_event_get_size(
+	              name_length );
+
+	if( ( event_size > ( timeline->run_data_size - timeline->run_data_offset ) )
+	 || ( timeline->number_of_run_events >= timeline->maximum_number_of_run_events ) )
+	{
+		if( timeline_flush_run(
+		     timeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush run.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	event = (timeline_event_t *) &( timeline->run_data[ timeline->run_data_offset ] );
+
+	if( memory_set(
+	     event,
+	     0,
+	     event_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event.",
+		 function );
+
+		return( -1 );
+	}
+	event->timestamp            = timestamp;
+	event->size                 = (uint64_t) file_entry_stat->size;
+	event->identifier           = file_entry_stat->object_identifier;
+	event->file_attribute_flags = file_entry_stat->file_attribute_flags;
+	event->name_size            = (uint32_t) name_length;
+	event->macb_flags           = macb_flags;
+
+	if( name_length > 0 )
+	{
+		if( memory_copy(
+		     timeline_event_get_name( event ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	timeline->run_events[ timeline->number_of_run_events ] = event;
+
+	timeline->number_of_run_events += 1;
+	timeline->run_data_offset      += event_size;
+
+	if( event_size > timeline->maximum_event_size )
+	{
+		timeline->maximum_event_size = event_size;
+	}
+	return( 1 );
+}
+
+/* Appends the events of a file entry
+ * Timestamps that are not set are skipped and equal timestamps are combined into a single event
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_append_file_entry(
+     timeline_t *timeline,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	uint64_t timestamps[ 4 ];
+
+	static const uint8_t macb_flags[ 4 ] = {
+		TIMELINE_MACB_FLAG_MODIFICATION,
+		TIMELINE_MACB_FLAG_ACCESS,
+		TIMELINE_MACB_FLAG_CHANGE,
+		TIMELINE_MACB_FLAG_BIRTH };
+
+	static char *function        = "timeline_append_file_entry";
+	uint8_t event_macb_flags     = 0;
+	int compare_timestamp_index  = 0;
+	int timestamp_index          = 0;
+
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	timestamps[ 0 ] = file_entry_stat->modification_time;
+	timestamps[ 1 ] = file_entry_stat->access_time;
+	timestamps[ 2 ] = file_entry_stat->entry_modification_time;
+	timestamps[ 3 ] = file_entry_stat->creation_time;
+
+	for( timestamp_index = 0;
+	     timestamp_index < 4;
+	     timestamp_index++ )
+	{
+		if( timestamps[ timestamp_index ] == 0 )
+		{
+			continue;
+		}
+		for( compare_timestamp_index = 0;
+		     compare_timestamp_index < timestamp_index;
+		     compare_timestamp_index++ )
+		{
+			if( timestamps[ compare_timestamp_index ] == timestamps[ timestamp_index ] )
+			{
+				break;
+			}
+		}
+		if( compare_timestamp_index < timestamp_index )
+		{
+			continue;
+		}
+		event_macb_flags = macb_flags[ timestamp_index ];
+
+		for( compare_timestamp_index = timestamp_index + 1;
+		     compare_timestamp_index < 4;
+		     compare_timestamp_index++ )
+		{
+			if( timestamps[ compare_timestamp_index ] == timestamps[ timestamp_index ] )
+			{
+				event_macb_flags |= macb_flags[ compare_timestamp_index ];
+			}
+		}
+		if( timeline_append_event(
+		     timeline,
+		     timestamps[ timestamp_index ],
+		     event_macb_flags,
+		     file_entry_stat,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Closes the temporary files of the runs
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_close_runs(
+     timeline_t *timeline,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_close_runs";
+	int result            = 1;
+	int run_index         = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	for( run_index = 0;
+	     run_index < timeline->number_of_runs;
+	     run_index++ )
+	{
+		if( timeline->run_streams[ run_index ] != NULL )
+		{
+			if( file_stream_close(
+			     timeline->run_streams[ run_index ] ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close run: %d stream.",
+				 function,
+				 run_index );
+
+				result = -1;
+			}
+			timeline->run_streams[ run_index ] = NULL;
+		}
+	}
+	timeline->number_of_runs = 0;
+
+	return( result );
+}
+
+/* Sorts the events of the run and writes them to a temporary file
+ * When the maximum number of runs is reached the existing runs are merged first
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_flush_run(
+     timeline_t *timeline,
+     libcerror_error_t **error )
+{
+	timeline_event_t *event = NULL;
+	FILE *run_stream        = NULL;
+	static char *function   = "timeline_flush_run";
+	size_t event_size       = 0;
+	size_t write_count      = 0;
+	int event_index         = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline->number_of_run_events == 0 )
+	{
+		return( 1 );
+	}
+	if( timeline->number_of_runs >= TIMELINE_MAXIMUM_NUMBER_OF_RUNS )
+	{
+		run_stream = tmpfile();
+
+		if( run_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create merged run stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( timeline_merge_runs(
+		     timeline,
+		     run_stream,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to merge runs.",
+			 function );
+
+			goto on_error;
+		}
+		if( timeline_close_runs(
+		     timeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close runs.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_stream_seek_offset(
+		     run_stream,
+		     0,
+		     SEEK_SET ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek start of merged run stream.",
+			 function );
+
+			goto on_error;
+		}
+		timeline->run_streams[ 0 ] = run_stream;
+		timeline->number_of_runs   = 1;
+
+		run_stream = NULL;
+	}
+	qsort(
+	 timeline->run_events,
+	 (size_t) timeline->number_of_run_events,
+	 sizeof( timeline_event_t * ),
+	 &timeline_compare_events );
+
+	run_stream = tmpfile();
+
+	if( run_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create run stream.",
+		 function );
+
+		goto on_error;
+	}
+	for( event_index = 0;
+	     event_index < timeline->number_of_run_events;
+	     event_index++ )
+	{
+		event      = timeline->run_events[ event_index ];
+		event_size = timeline_event_get_size(
+		              event->name_size );
+
+		write_count = file_stream_write(
+		               run_stream,
+		               event,
+		               event_size );
+
+		if( write_count != event_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event: %d.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_seek_offset(
+	     run_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of run stream.",
+		 function );
+
+		goto on_error;
+	}
+	timeline->run_streams[ timeline->number_of_runs ] = run_stream;
+
+	timeline->number_of_runs      += 1;
+	timeline->number_of_run_events = 0;
+	timeline->run_data_offset      = 0;
+
+	return( 1 );
+
+on_error:
+	if( run_stream != NULL )
+	{
+		file_stream_close(
+		 run_stream );
+	}
+	return( -1 );
+}
+
+/* Reads an event from a run stream
+ * Returns 1 if successful, 0 if no more events are available or -1 on error
+ */
+int timeline_read_event(
+     FILE *stream,
+     timeline_event_t *event,
+     size_t event_size,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_read_event";
+	size_t name_size      = 0;
+	size_t read_count     = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( event == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( event_size < sizeof( timeline_event_t ) )
+	 || ( event_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = file_stream_read(
+	              stream,
+	              event,
+	              sizeof( timeline_event_t ) );
+
+	if( ( read_count == 0 )
+	 && ( file_stream_at_end(
+	       stream ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( read_count != sizeof( timeline_event_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read event.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = timeline_event_get_size(
+	             event->name_size ) - sizeof( timeline_event_t );
+
+	if( name_size > ( event_size - sizeof( timeline_event_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event - name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > 0 )
+	{
+		read_count = file_stream_read(
+		              stream,
+		              timeline_event_get_name( event ),
+		              name_size );
+
+		if( read_count != name_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read event name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes an event to the output buffer as a mactime CSV line
+ * Format: Date,Size,Type,Mode,UID,GID,Meta,File Name
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_write_event(
+     timeline_event_t *event,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	char date_time_string[ 32 ];
+	char line[ 128 ];
+	char macb_string[ 5 ];
+
+	static char *function = "timeline_write_event";
+	int print_count       = 0;
+
+	if( event == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_copy_filetime_to_date_time_string(
+	     event->timestamp,
+	     date_time_string,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy timestamp to date and time string.",
+		 function );
+
+		return( -1 );
+	}
+	macb_string[ 0 ] = ( ( event->macb_flags & TIMELINE_MACB_FLAG_MODIFICATION ) != 0 ) ? 'm' : '.';
+	macb_string[ 1 ] = ( ( event->macb_flags & TIMELINE_MACB_FLAG_ACCESS ) != 0 ) ? 'a' : '.';
+	macb_string[ 2 ] = ( ( event->macb_flags & TIMELINE_MACB_FLAG_CHANGE ) != 0 ) ? 'c' : '.';
+	macb_string[ 3 ] = ( ( event->macb_flags & TIMELINE_MACB_FLAG_BIRTH ) != 0 ) ? 'b' : '.';
+	macb_string[ 4 ] = 0;
+
+	print_count = narrow_string_snprintf(
+	               line,
+	               128,
+	               "%s,%" PRIu64 ",%s,%s,0,0,%" PRIu64 ",\"",
+	               date_time_string,
+	               event->size,
+	               macb_string,
+	               timeline_get_mode_string(
+	                event->file_attribute_flags ),
+	               event->identifier );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 128 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set line.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) line,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append line.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_escaped_utf8_string(
+	     output_buffer,
+	     timeline_event_get_name( event ),
+	     (size_t) event->name_size,
+	     "\"",
+	     (uint8_t) '"',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_string(
+	     output_buffer,
+	     "\"\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of line.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Merges the sorted runs
+ * The events are either written to a run stream or to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_merge_runs(
+     timeline_t *timeline,
+     FILE *run_stream,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	timeline_event_t *events[ TIMELINE_MAXIMUM_NUMBER_OF_RUNS ];
+
+	static char *function = "timeline_merge_runs";
+	size_t event_size     = 0;
+	size_t write_count    = 0;
+	int result            = 0;
+	int run_index         = 0;
+	int smallest_index    = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run_stream == NULL )
+	 && ( output_buffer == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run stream and output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     events,
+	     0,
+	     sizeof( timeline_event_t * ) * TIMELINE_MAXIMUM_NUMBER_OF_RUNS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear events.",
+		 function );
+
+		return( -1 );
+	}
+	for( run_index = 0;
+	     run_index < timeline->number_of_runs;
+	     run_index++ )
+	{
+		events[ run_index ] = (timeline_event_t *) memory_allocate(
+		                                            timeline->maximum_event_size );
+
+		if( events[ run_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create event: %d.",
+			 function,
+			 run_index );
+
+			goto on_error;
+		}
+		result = timeline_read_event(
+		          timeline->run_streams[ run_index ],
+		          events[ run_index ],
+		          timeline->maximum_event_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read event from run: %d.",
+			 function,
+			 run_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			memory_free(
+			 events[ run_index ] );
+
+			events[ run_index ] = NULL;
+		}
+	}
+	do
+	{
+		smallest_index = -1;
+
+		for( run_index = 0;
+		     run_index < timeline->number_of_runs;
+		     run_index++ )
+		{
+			if( events[ run_index ] == NULL )
+			{
+				continue;
+			}
+			if( ( smallest_index == -1 )
+			 || ( timeline_compare_events(
+			       &( events[ run_index ] ),
+			       &( events[ smallest_index ] ) ) < 0 ) )
+			{
+				smallest_index = run_index;
+			}
+		}
+		if( smallest_index == -1 )
+		{
+			break;
+		}
+		if( run_stream != NULL )
+		{
+			event_size = timeline_event_get_size(
+			              events[ smallest_index ]->name_size );
+
+			write_count = file_stream_write(
+			               run_stream,
+			               events[ smallest_index ],
+			               event_size );
+
+			if( write_count != event_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write event.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( timeline_write_event(
+		          events[ smallest_index ],
+		          output_buffer,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event.",
+			 function );
+
+			goto on_error;
+		}
+		result = timeline_read_event(
+		          timeline->run_streams[ smallest_index ],
+		          events[ smallest_index ],
+		          timeline->maximum_event_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read event from run: %d.",
+			 function,
+			 smallest_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			memory_free(
+			 events[ smallest_index ] );
+
+			events[ smallest_index ] = NULL;
+		}
+	}
+	while( smallest_index != -1 );
+
+	return( 1 );
+
+on_error:
+	for( run_index = 0;
+	     run_index < timeline->number_of_runs;
+	     run_index++ )
+	{
+		if( events[ run_index ] != NULL )
+		{
+			memory_free(
+			 events[ run_index ] );
+		}
+	}
+	return( -1 );
+}
+
+/* Writes the timeline sorted by timestamp to the output buffer
+ * The events are merged from the runs written to temporary files, if any
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_write(
+     timeline_t *timeline,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_write";
+	int event_index       = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_string(
+	     output_buffer,
+	     "Date,Size,Type,Mode,UID,GID,Meta,File Name\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append header.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline->number_of_runs == 0 )
+	{
+		/* All events fit in memory
+		 */
+		qsort(
+		 timeline->run_events,
+		 (size_t) timeline->number_of_run_events,
+		 sizeof( timeline_event_t * ),
+		 &timeline_compare_events );
+
+		for( event_index = 0;
+		     event_index < timeline->number_of_run_events;
+		     event_index++ )
+		{
+			if( timeline_write_event(
+			     timeline->run_events[ event_index ],
+			     output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write event: %d.",
+				 function,
+				 event_index );
+
+				return( -1 );
+			}
+		}
+		timeline->number_of_run_events = 0;
+		timeline->run_data_offset      = 0;
+	}
+	else
+	{
+		if( timeline_flush_run(
+		     timeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush run.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_merge_runs(
+		     timeline,
+		     NULL,
+		     output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to merge runs.",
+			 function );
+
+			return( -1 );
+		}
+		if( timeline_close_runs(
+		     timeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_buffer_flush(
+	     output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,215 @@
+/*
+ * Timeline
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TIMELINE_H )
+#define _TIMELINE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefstools_libcerror.h"
+#include "fsrefstools_libfsrefs.h"
+#include "output_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of the run data, this is the amount of events
+ * that is sorted in memory before the run is written to a temporary file
+ */
+#define TIMELINE_DEFAULT_RUN_DATA_SIZE		( 64 * 1024 * 1024 )
+
+/* The maximum number of runs that are merged at once
+ */
+#define TIMELINE_MAXIMUM_NUMBER_OF_RUNS		64
+
+enum TIMELINE_MACB_FLAGS
+{
+	TIMELINE_MACB_FLAG_MODIFICATION		= 0x01,
+	TIMELINE_MACB_FLAG_ACCESS		= 0x02,
+	TIMELINE_MACB_FLAG_CHANGE		= 0x04,
+	TIMELINE_MACB_FLAG_BIRTH		= 0x08
+};
+
+typedef struct timeline_event timeline_event_t;
+
+/* The timeline event
+ * The name is stored directly after the event, padded to a multitude of 8 bytes
+ */
+struct timeline_event
+{
+	/* The date and time
+	 * Contains a FILETIME
+	 */
+	uint64_t timestamp;
+
+	/* The size
+	 */
+	uint64_t size;
+
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The name size
+	 * Contains the size of the UTF-8 encoded name without end of string character
+	 */
+	uint32_t name_size;
+
+	/* The MACB flags
+	 */
+	uint8_t macb_flags;
+
+	/* Padding
+	 */
+	uint8_t padding[ 7 ];
+};
+
+typedef struct timeline timeline_t;
+
+struct timeline
+{
+	/* The run data
+	 * Contains the events of the run that is being collected
+	 */
+	uint8_t *run_data;
+
+	/* The run data size
+	 */
+	size_t run_data_size;
+
+	/* The run data offset
+	 */
+	size_t run_data_offset;
+
+	/* The run events
+	 * Contains references to the events in the run data
+	 */
+	timeline_event_t **run_events;
+
+	/* The number of run events
+	 */
+	int number_of_run_events;
+
+	/* The maximum number of run events
+	 */
+	int maximum_number_of_run_events;
+
+	/* The run streams
+	 * Contains the sorted runs that were written to temporary files
+	 */
+	FILE *run_streams[ TIMELINE_MAXIMUM_NUMBER_OF_RUNS ];
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The size of the largest event
+	 */
+	size_t maximum_event_size;
+};
+
+int timeline_initialize(
+     timeline_t **timeline,
+     size_t run_data_size,
+     libcerror_error_t **error );
+
+int timeline_free(
+     timeline_t **timeline,
+     libcerror_error_t **error );
+
+const char *timeline_get_mode_string(
+             uint32_t file_attribute_flags );
+
+int timeline_copy_filetime_to_date_time_string(
+     uint64_t filetime,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int timeline_copy_filetime_to_posix_time_string(
+     uint64_t filetime,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int timeline_compare_events(
+     const void *first_event,
+     const void *second_event );
+
+int timeline_append_event(
+     timeline_t *timeline,
+     uint64_t timestamp,
+     uint8_t macb_flags,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int timeline_append_file_entry(
+     timeline_t *timeline,
+     const libfsrefs_file_entry_stat_t *file_entry_stat,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int timeline_close_runs(
+     timeline_t *timeline,
+     libcerror_error_t **error );
+
+int timeline_flush_run(
+     timeline_t *timeline,
+     libcerror_error_t **error );
+
+int timeline_read_event(
+     FILE *stream,
+     timeline_event_t *event,
+     size_t event_size,
+     libcerror_error_t **error );
+
+int timeline_write_event(
+     timeline_event_t *event,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int timeline_merge_runs(
+     timeline_t *timeline,
+     FILE *run_stream,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int timeline_write(
+     timeline_t *timeline,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TIMELINE_H ) */
+
@@ -0,0 +1,155 @@
+/*
+ * The volume index file definition
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSREFS_VOLUME_INDEX_H )
+#define _FSREFS_VOLUME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The volume index file is not part of ReFS, it is written by libfsrefs
+ * All values are stored in little-endian. The file header is followed by
+ * the objects table, the records table and the record data. The tables
+ * consist of fixed size entries that are 8-byte aligned, the objects are
+ * stored in order of object identifier
+ */
+typedef struct fsrefs_volume_index_file_header fsrefs_volume_index_file_header_t;
+
+struct fsrefs_volume_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "FSREFSIX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The file header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_size[ 4 ];
+
+	/* The volume serial number
+	 * Consists of 8 bytes
+	 */
+	uint8_t volume_serial_number[ 8 ];
+
+	/* The checkpoint sequence number
+	 * Consists of 8 bytes
+	 */
+	uint8_t checkpoint_sequence_number[ 8 ];
+
+	/* The number of objects
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_objects[ 4 ];
+
+	/* The number of records
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_records[ 4 ];
+
+	/* The objects table offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t objects_offset[ 8 ];
+
+	/* The records table offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t records_offset[ 8 ];
+
+	/* The record data offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t record_data_offset[ 8 ];
+
+	/* The record data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t record_data_size[ 8 ];
+};
+
+typedef struct fsrefs_volume_index_object fsrefs_volume_index_object_t;
+
+struct fsrefs_volume_index_object
+{
+	/* The (directory) object identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t object_identifier[ 8 ];
+
+	/* The parent (directory) object identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t parent_object_identifier[ 8 ];
+
+	/* The index of the first record in the records table
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_record_index[ 4 ];
+
+	/* The number of records
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_records[ 4 ];
+};
+
+typedef struct fsrefs_volume_index_record fsrefs_volume_index_record_t;
+
+struct fsrefs_volume_index_record
+{
+	/* The offset of the key data relative to the start of the record data
+	 * The value data directly follows the key data
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_offset[ 8 ];
+
+	/* The key data size
+	 * Consists of 2 bytes
+	 */
+	uint8_t key_data_size[ 2 ];
+
+	/* The value data size
+	 * Consists of 2 bytes
+	 */
+	uint8_t value_data_size[ 2 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSREFS_VOLUME_INDEX_H ) */
+
@@ -25,6 +25,7 @@
 #include <windows.h>
 #endif
 
+#include "libfsrefs_memory_budget.h"
 #include "libfsrefs_unused.h"
 
 /* Define HAVE_LOCAL_LIBFSREFS for local use of libfsrefs
@@ -46,8 +47,6 @@ BOOL WINAPI DllMain(
              DWORD fdwReason,
              LPVOID lpvReserved )
 {
-	LIBFSREFS_UNREFERENCED_PARAMETER( lpvReserved )
-
 	switch( fdwReason )
 	{
 		case DLL_PROCESS_ATTACH:
@@ -62,6 +61,13 @@ BOOL WINAPI DllMain(
 			break;
 
 		case DLL_PROCESS_DETACH:
+			/* When the process is terminating its memory is released regardless
+			 */
+			if( lpvReserved == NULL )
+			{
+				libfsrefs_memory_budget_free_process_memory_budget(
+				 NULL );
+			}
 			break;
 	}
 	return( TRUE );
@@ -78,6 +84,21 @@ int libfsrefs_is_dll(
 	return( 1 );
 }
 
+#elif defined( __GNUC__ ) && !defined( WINAPI )
+
+/* LCOV_EXCL_START */
+
+/* Frees the process-wide state when the library is unloaded
+ */
+static void __attribute__((destructor)) libfsrefs_finalize(
+             void )
+{
+	libfsrefs_memory_budget_free_process_memory_budget(
+	 NULL );
+}
+
+/* LCOV_EXCL_STOP */
+
 #endif /* defined( WINAPI ) && defined( HAVE_DLLMAIN ) */
 
 #endif /* !defined( HAVE_LOCAL_LIBFSREFS ) */
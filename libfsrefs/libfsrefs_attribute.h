@@ -0,0 +1,107 @@
+/*
+ * Attribute functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_ATTRIBUTE_H )
+#define _LIBFSREFS_ATTRIBUTE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_attribute_values.h"
+#include "libfsrefs_extern.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_internal_attribute libfsrefs_internal_attribute_t;
+
+struct libfsrefs_internal_attribute
+{
+	/* The attribute values
+	 */
+	libfsrefs_attribute_values_t *attribute_values;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsrefs_attribute_initialize(
+     libfsrefs_attribute_t **attribute,
+     libfsrefs_attribute_values_t *attribute_values,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_free(
+     libfsrefs_attribute_t **attribute,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_get_type(
+     libfsrefs_attribute_t *attribute,
+     uint32_t *type,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_get_utf8_name_size(
+     libfsrefs_attribute_t *attribute,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_get_utf8_name(
+     libfsrefs_attribute_t *attribute,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_get_utf16_name_size(
+     libfsrefs_attribute_t *attribute,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_get_utf16_name(
+     libfsrefs_attribute_t *attribute,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_attribute_get_resident_data(
+     libfsrefs_attribute_t *attribute,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_ATTRIBUTE_H ) */
+
@@ -27,6 +27,7 @@
 #include "libfsrefs_attribute_values.h"
 #include "libfsrefs_data_run.h"
 #include "libfsrefs_debug.h"
+#include "libfsrefs_definitions.h"
 #include "libfsrefs_libcdata.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_libcnotify.h"
@@ -34,6 +35,7 @@
 #include "libfsrefs_libuna.h"
 #include "libfsrefs_ministore_node.h"
 #include "libfsrefs_node_record.h"
+#include "libfsrefs_statistics.h"
 
 #include "fsrefs_directory_object.h"
 
@@ -231,6 +233,7 @@ int libfsrefs_attribute_values_read_non_resident(
 	     io_handle,
 	     data,
 	     data_size,
+	     LIBFSREFS_NODE_TYPE_FILE_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -262,7 +265,7 @@ int libfsrefs_attribute_values_read_non_resident(
 		 "%s: invalid non-resident attribute ministore node - missing header data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( node->header_data_size != sizeof( fsrefs_attribute_non_resident_t ) )
 	{
@@ -275,6 +278,10 @@ int libfsrefs_attribute_values_read_non_resident(
 
 		goto on_error;
 	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_attribute_non_resident_t *) node->header_data )->data_size,
+	 attribute_values->data_size );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -302,13 +309,10 @@ int libfsrefs_attribute_values_read_non_resident(
 		 function,
 		 value_64bit );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_attribute_non_resident_t *) node->header_data )->data_size,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: data size\t\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 attribute_values->data_size );
 
 		byte_stream_copy_to_uint64_little_endian(
 		 ( (fsrefs_attribute_non_resident_t *) node->header_data )->valid_data_size,
@@ -376,6 +380,11 @@ int libfsrefs_attribute_values_read_non_resident(
 
 			goto on_error;
 		}
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 LIBFSREFS_NODE_TYPE_FILE_VALUES,
+		 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+		 1 );
 		if( libfsrefs_data_run_read_data(
 		     data_run,
 		     io_handle,
@@ -648,6 +657,11 @@ int libfsrefs_attribute_values_read_resident(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	attribute_values->is_resident        = 1;
+	attribute_values->resident_data      = &( data[ inline_data_offset ] );
+	attribute_values->resident_data_size = (size_t) inline_data_size;
+	attribute_values->data_size          = (size64_t) inline_data_size;
+
 	return( 1 );
 }
 
@@ -1045,3 +1059,132 @@ int libfsrefs_attribute_values_get_utf16_name(
 	return( 1 );
 }
 
+/* Retrieves the attribute type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_attribute_values_get_attribute_type(
+     libfsrefs_attribute_values_t *attribute_values,
+     uint32_t *attribute_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_attribute_values_get_attribute_type";
+
+	if( attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute type.",
+		 function );
+
+		return( -1 );
+	}
+	*attribute_type = attribute_values->attribute_type;
+
+	return( 1 );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_attribute_values_get_data_size(
+     libfsrefs_attribute_values_t *attribute_values,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_attribute_values_get_data_size";
+
+	if( attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = attribute_values->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the resident data
+ * The resident data is not copied and references the data the attribute values were read from
+ * Returns 1 if successful, 0 if the attribute is not resident or -1 on error
+ */
+int libfsrefs_attribute_values_get_resident_data(
+     libfsrefs_attribute_values_t *attribute_values,
+     const uint8_t **resident_data,
+     size_t *resident_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_attribute_values_get_resident_data";
+
+	if( attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( resident_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resident data.",
+		 function );
+
+		return( -1 );
+	}
+	if( resident_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resident data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_values->is_resident == 0 )
+	{
+		return( 0 );
+	}
+	*resident_data      = attribute_values->resident_data;
+	*resident_data_size = attribute_values->resident_data_size;
+
+	return( 1 );
+}
+
@@ -50,6 +50,23 @@ struct libfsrefs_attribute_values
 	 */
 	size_t name_data_size;
 
+	/* Value to indicate the attribute is resident
+	 */
+	uint8_t is_resident;
+
+	/* The resident data
+	 * This references the data the attribute values were read from
+	 */
+	const uint8_t *resident_data;
+
+	/* The resident data size
+	 */
+	size_t resident_data_size;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
 	/* The data runs array
 	 */
 	libcdata_array_t *data_runs_array;
@@ -104,6 +121,22 @@ int libfsrefs_attribute_values_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libfsrefs_attribute_values_get_attribute_type(
+     libfsrefs_attribute_values_t *attribute_values,
+     uint32_t *attribute_type,
+     libcerror_error_t **error );
+
+int libfsrefs_attribute_values_get_data_size(
+     libfsrefs_attribute_values_t *attribute_values,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+int libfsrefs_attribute_values_get_resident_data(
+     libfsrefs_attribute_values_t *attribute_values,
+     const uint8_t **resident_data,
+     size_t *resident_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
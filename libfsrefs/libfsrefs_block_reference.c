@@ -135,6 +135,7 @@ int libfsrefs_block_reference_free(
 }
 
 /* Reads a block reference
+ * The format version specific read function is bound to the IO handle when the format version is set
  * Returns 1 if successful or -1 on error
  */
 int libfsrefs_block_reference_read_data(
@@ -144,12 +145,52 @@ int libfsrefs_block_reference_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function        = "libfsrefs_block_reference_read_data";
-	size_t block_reference_size  = 0;
+	static char *function = "libfsrefs_block_reference_read_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->read_block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu8 ".%" PRIu8 ".",
+		 function,
+		 io_handle->major_format_version,
+		 io_handle->minor_format_version );
+
+		return( -1 );
+	}
+	return( io_handle->read_block_reference(
+	         block_reference,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+/* Reads a format version 1 block reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_block_reference_read_data_v1(
+     libfsrefs_block_reference_t *block_reference,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsrefs_block_reference_read_data_v1";
 	uint8_t checksum_type        = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	size_t data_offset           = 0;
 	uint16_t value_16bit         = 0;
 	uint8_t checksum_data_offset = 0;
 	uint16_t checksum_data_size  = 0;
@@ -166,35 +207,151 @@ int libfsrefs_block_reference_read_data(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->major_format_version == 1 )
+	if( ( data_size < sizeof( fsrefs_metadata_block_reference_v1_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
-		block_reference_size = sizeof( fsrefs_metadata_block_reference_v1_t );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	else if( io_handle->major_format_version == 3 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		block_reference_size = sizeof( fsrefs_metadata_block_reference_v3_t );
+		libcnotify_printf(
+		 "%s: block reference data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( fsrefs_metadata_block_reference_v1_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
-	else
+#endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_reference_v1_t *) data )->block_number,
+	 block_reference->block_numbers[ 0 ] );
+
+	checksum_type = ( (fsrefs_metadata_block_reference_v1_t *) data )->checksum_type;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		checksum_data_offset = ( (fsrefs_metadata_block_reference_v1_t *) data )->checksum_data_offset;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsrefs_metadata_block_reference_v1_t *) data )->checksum_data_size,
+		 checksum_data_size );
+
+		libcnotify_printf(
+		 "%s: block number\t\t\t: %" PRIu64 "\n",
+		 function,
+		 block_reference->block_numbers[ 0 ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsrefs_metadata_block_reference_v1_t *) data )->unknown1,
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 value_16bit );
+
+		libcnotify_printf(
+		 "%s: checksum type\t\t\t: %" PRIu8 "\n",
+		 function,
+		 checksum_type );
+
+		libcnotify_printf(
+		 "%s: checksum data offset\t\t: %" PRIu8 "\n",
+		 function,
+		 checksum_data_offset );
+
+		libcnotify_printf(
+		 "%s: checksum data size\t\t\t: %" PRIu16 "\n",
+		 function,
+		 checksum_data_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsrefs_metadata_block_reference_v1_t *) data )->unknown2,
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: unknown2\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 value_16bit );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( checksum_type != 1 )
+	 && ( checksum_type != 2 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported format version: %" PRIu8 ".%" PRIu8 ".",
+		 "%s: unsupported checksum type: %" PRIu8 ".",
 		 function,
-		 io_handle->major_format_version,
-		 io_handle->minor_format_version );
+		 checksum_type );
+
+		return( -1 );
+	}
+/* TODO validate checksum data offset */
+/* TODO validate checksum data size */
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: checksum data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( data[ 8 + checksum_data_offset ] ),
+		 checksum_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads a format version 3 block reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_block_reference_read_data_v3(
+     libfsrefs_block_reference_t *block_reference,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsrefs_block_reference_read_data_v3";
+	uint8_t checksum_type        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t value_16bit         = 0;
+	uint8_t checksum_data_offset = 0;
+	uint16_t checksum_data_size  = 0;
+#endif
+
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
 
 		return( -1 );
 	}
@@ -209,7 +366,7 @@ int libfsrefs_block_reference_read_data(
 
 		return( -1 );
 	}
-	if( ( data_size < block_reference_size )
+	if( ( data_size < sizeof( fsrefs_metadata_block_reference_v3_t ) )
 	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
@@ -229,98 +386,60 @@ int libfsrefs_block_reference_read_data(
 		 function );
 		libcnotify_print_data(
 		 data,
-		 block_reference_size,
+		 sizeof( fsrefs_metadata_block_reference_v3_t ),
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	if( io_handle->major_format_version == 1 )
-	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_reference_v1_t *) data )->block_number,
-		 block_reference->block_numbers[ 0 ] );
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number1,
+	 block_reference->block_numbers[ 0 ] );
 
-		checksum_type = ( (fsrefs_metadata_block_reference_v1_t *) data )->checksum_type;
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number2,
+	 block_reference->block_numbers[ 1 ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number3,
+	 block_reference->block_numbers[ 2 ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number4,
+	 block_reference->block_numbers[ 3 ] );
+
+	checksum_type = ( (fsrefs_metadata_block_reference_v3_t *) data )->checksum_type;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-		checksum_data_offset = ( (fsrefs_metadata_block_reference_v1_t *) data )->checksum_data_offset;
+	if( libcnotify_verbose != 0 )
+	{
+		checksum_data_offset = ( (fsrefs_metadata_block_reference_v3_t *) data )->checksum_data_offset;
 
 		byte_stream_copy_to_uint16_little_endian(
-		 ( (fsrefs_metadata_block_reference_v1_t *) data )->checksum_data_size,
+		 ( (fsrefs_metadata_block_reference_v3_t *) data )->checksum_data_size,
 		 checksum_data_size );
-#endif
-	}
-	else if( io_handle->major_format_version == 3 )
-	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number1,
+
+		libcnotify_printf(
+		 "%s: block number1\t\t\t: %" PRIu64 "\n",
+		 function,
 		 block_reference->block_numbers[ 0 ] );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number2,
+		libcnotify_printf(
+		 "%s: block number2\t\t\t: %" PRIu64 "\n",
+		 function,
 		 block_reference->block_numbers[ 1 ] );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number3,
+		libcnotify_printf(
+		 "%s: block number3\t\t\t: %" PRIu64 "\n",
+		 function,
 		 block_reference->block_numbers[ 2 ] );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_reference_v3_t *) data )->block_number4,
+		libcnotify_printf(
+		 "%s: block number4\t\t\t: %" PRIu64 "\n",
+		 function,
 		 block_reference->block_numbers[ 3 ] );
 
-		checksum_type = ( (fsrefs_metadata_block_reference_v3_t *) data )->checksum_type;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		checksum_data_offset = ( (fsrefs_metadata_block_reference_v3_t *) data )->checksum_data_offset;
-
 		byte_stream_copy_to_uint16_little_endian(
-		 ( (fsrefs_metadata_block_reference_v3_t *) data )->checksum_data_size,
-		 checksum_data_size );
-#endif
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( io_handle->major_format_version == 1 )
-		{
-			libcnotify_printf(
-			 "%s: block number\t\t\t: %" PRIu64 "\n",
-			 function,
-			 block_reference->block_numbers[ 0 ] );
-		}
-		else if( io_handle->major_format_version == 3 )
-		{
-			libcnotify_printf(
-			 "%s: block number1\t\t\t: %" PRIu64 "\n",
-			 function,
-			 block_reference->block_numbers[ 0 ] );
-
-			libcnotify_printf(
-			 "%s: block number2\t\t\t: %" PRIu64 "\n",
-			 function,
-			 block_reference->block_numbers[ 1 ] );
-
-			libcnotify_printf(
-			 "%s: block number3\t\t\t: %" PRIu64 "\n",
-			 function,
-			 block_reference->block_numbers[ 2 ] );
-
-			libcnotify_printf(
-			 "%s: block number4\t\t\t: %" PRIu64 "\n",
-			 function,
-			 block_reference->block_numbers[ 3 ] );
-		}
-		if( io_handle->major_format_version == 1 )
-		{
-			byte_stream_copy_to_uint16_little_endian(
-			 ( (fsrefs_metadata_block_reference_v1_t *) data )->unknown1,
-			 value_16bit );
-		}
-		else if( io_handle->major_format_version == 3 )
-		{
-			byte_stream_copy_to_uint16_little_endian(
-			 ( (fsrefs_metadata_block_reference_v3_t *) data )->unknown1,
-			 value_16bit );
-		}
+		 ( (fsrefs_metadata_block_reference_v3_t *) data )->unknown1,
+		 value_16bit );
 		libcnotify_printf(
 		 "%s: unknown1\t\t\t\t: 0x%04" PRIx16 "\n",
 		 function,
@@ -341,18 +460,9 @@ int libfsrefs_block_reference_read_data(
 		 function,
 		 checksum_data_size );
 
-		if( io_handle->major_format_version == 1 )
-		{
-			byte_stream_copy_to_uint16_little_endian(
-			 ( (fsrefs_metadata_block_reference_v1_t *) data )->unknown2,
-			 value_16bit );
-		}
-		else if( io_handle->major_format_version == 3 )
-		{
-			byte_stream_copy_to_uint16_little_endian(
-			 ( (fsrefs_metadata_block_reference_v3_t *) data )->unknown2,
-			 value_16bit );
-		}
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsrefs_metadata_block_reference_v3_t *) data )->unknown2,
+		 value_16bit );
 		libcnotify_printf(
 		 "%s: unknown2\t\t\t\t: 0x%04" PRIx16 "\n",
 		 function,
@@ -379,36 +489,13 @@ int libfsrefs_block_reference_read_data(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( io_handle->major_format_version == 1 )
-		{
-			data_offset = 8 + checksum_data_offset;
-		}
-		else if( io_handle->major_format_version == 3 )
-		{
-			data_offset = 32 + checksum_data_offset;
-		}
 		libcnotify_printf(
 		 "%s: checksum data:\n",
 		 function );
 		libcnotify_print_data(
-		 &( data[ data_offset ] ),
+		 &( data[ 32 + checksum_data_offset ] ),
 		 checksum_data_size,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-/* TODO
-		data_offset += checksum_data_size;
-
-		if( data_offset < data_size )
-		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( data[ data_offset ] ),
-			 data_size - data_offset,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-*/
 	}
 #endif
 	return( 1 );
@@ -64,6 +64,18 @@ int libfsrefs_block_reference_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsrefs_block_reference_read_data_v1(
+     libfsrefs_block_reference_t *block_reference,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsrefs_block_reference_read_data_v3(
+     libfsrefs_block_reference_t *block_reference,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
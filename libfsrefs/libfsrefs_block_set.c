@@ -0,0 +1,388 @@
+/*
+ * Block set functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_block_set.h"
+#include "libfsrefs_libcerror.h"
+
+/* Retrieves the index of the first slot to probe for a slot value
+ * Uses Fibonacci hashing so that block offsets, which are multitudes of the metadata
+ * block size, are spread over all the slots
+ */
+#define libfsrefs_block_set_get_slot_index( slot_value, slot_index_bits ) \
+	(int) ( ( (uint64_t) ( slot_value ) * 0x9e3779b97f4a7c15UL ) >> ( 64 - ( slot_index_bits ) ) )
+
+/* Creates a block set
+ * Make sure the value block_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_block_set_initialize(
+     libfsrefs_block_set_t **block_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_block_set_initialize";
+
+	if( block_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*block_set = memory_allocate_structure(
+	              libfsrefs_block_set_t );
+
+	if( *block_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_set,
+	     0,
+	     sizeof( libfsrefs_block_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *block_set != NULL )
+	{
+		memory_free(
+		 *block_set );
+
+		*block_set = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_block_set_free(
+     libfsrefs_block_set_t **block_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_block_set_free";
+
+	if( block_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_set != NULL )
+	{
+		if( ( *block_set )->slots != NULL )
+		{
+			memory_free(
+			 ( *block_set )->slots );
+		}
+		memory_free(
+		 *block_set );
+
+		*block_set = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the slots of a block set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_block_set_resize(
+     libfsrefs_block_set_t *block_set,
+     uint8_t slot_index_bits,
+     libcerror_error_t **error )
+{
+	uint64_t *slots       = NULL;
+	static char *function = "libfsrefs_block_set_resize";
+	size_t slots_size     = 0;
+	int number_of_slots   = 0;
+	int slot_index        = 0;
+	int old_slot_index    = 0;
+
+	if( block_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index_bits == 0 )
+	 || ( slot_index_bits > 30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_slots = (int) 1 << slot_index_bits;
+
+	if( number_of_slots <= block_set->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid slot index bits value too small.",
+		 function );
+
+		return( -1 );
+	}
+	slots_size = sizeof( uint64_t ) * (size_t) number_of_slots;
+
+	if( slots_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid slots size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (uint64_t *) memory_allocate(
+	                      slots_size );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     slots_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	if( block_set->slots != NULL )
+	{
+		for( old_slot_index = 0;
+		     old_slot_index < block_set->number_of_slots;
+		     old_slot_index++ )
+		{
+			if( block_set->slots[ old_slot_index ] == 0 )
+			{
+				continue;
+			}
+			slot_index = libfsrefs_block_set_get_slot_index(
+			              block_set->slots[ old_slot_index ],
+			              slot_index_bits );
+
+			while( slots[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+			}
+			slots[ slot_index ] = block_set->slots[ old_slot_index ];
+		}
+		memory_free(
+		 block_set->slots );
+	}
+	block_set->slots           = slots;
+	block_set->number_of_slots = number_of_slots;
+	block_set->slot_index_bits = slot_index_bits;
+
+	return( 1 );
+}
+
+/* Inserts a block into the block set
+ * The slots are allocated on the first insert and are resized when more than 3/4 of them are used
+ * Returns 1 if successful, 0 if the block already was in the set or -1 on error
+ */
+int libfsrefs_block_set_insert(
+     libfsrefs_block_set_t *block_set,
+     off64_t block_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsrefs_block_set_insert";
+	uint64_t slot_value     = 0;
+	uint8_t slot_index_bits = 0;
+	int slot_index          = 0;
+
+	if( block_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_offset < 0 )
+	 || ( block_offset == INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) block_set->number_of_blocks + 1 ) * 4 > (size_t) block_set->number_of_slots * 3 )
+	{
+		if( block_set->slot_index_bits == 0 )
+		{
+			slot_index_bits = 6;
+		}
+		else
+		{
+			slot_index_bits = block_set->slot_index_bits + 1;
+		}
+		if( libfsrefs_block_set_resize(
+		     block_set,
+		     slot_index_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	slot_value = (uint64_t) block_offset + 1;
+
+	slot_index = libfsrefs_block_set_get_slot_index(
+	              slot_value,
+	              block_set->slot_index_bits );
+
+	while( block_set->slots[ slot_index ] != 0 )
+	{
+		if( block_set->slots[ slot_index ] == slot_value )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & ( block_set->number_of_slots - 1 );
+	}
+	block_set->slots[ slot_index ] = slot_value;
+
+	block_set->number_of_blocks += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_block_set_get_number_of_blocks(
+     libfsrefs_block_set_t *block_set,
+     int *number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_block_set_get_number_of_blocks";
+
+	if( block_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_blocks = block_set->number_of_blocks;
+
+	return( 1 );
+}
+
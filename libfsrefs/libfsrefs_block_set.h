@@ -0,0 +1,85 @@
+/*
+ * Block set functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_BLOCK_SET_H )
+#define _LIBFSREFS_BLOCK_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_block_set libfsrefs_block_set_t;
+
+struct libfsrefs_block_set
+{
+	/* The slots
+	 * Contains the block offset + 1 of every block in the set, where 0 represents an empty slot
+	 */
+	uint64_t *slots;
+
+	/* The number of slots
+	 * This is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of bits of the slot index
+	 */
+	uint8_t slot_index_bits;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+};
+
+int libfsrefs_block_set_initialize(
+     libfsrefs_block_set_t **block_set,
+     libcerror_error_t **error );
+
+int libfsrefs_block_set_free(
+     libfsrefs_block_set_t **block_set,
+     libcerror_error_t **error );
+
+int libfsrefs_block_set_resize(
+     libfsrefs_block_set_t *block_set,
+     uint8_t slot_index_bits,
+     libcerror_error_t **error );
+
+int libfsrefs_block_set_insert(
+     libfsrefs_block_set_t *block_set,
+     off64_t block_offset,
+     libcerror_error_t **error );
+
+int libfsrefs_block_set_get_number_of_blocks(
+     libfsrefs_block_set_t *block_set,
+     int *number_of_blocks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_BLOCK_SET_H ) */
+
@@ -942,6 +942,43 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the sequence number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_checkpoint_get_sequence_number(
+     libfsrefs_checkpoint_t *checkpoint,
+     uint64_t *sequence_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_checkpoint_get_sequence_number";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	*sequence_number = checkpoint->sequence_number;
+
+	return( 1 );
+}
+
 /* Retrieves the number of ministore tree block references
  * Returns 1 if successful or -1 on error
  */
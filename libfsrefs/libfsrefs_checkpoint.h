@@ -70,6 +70,11 @@ int libfsrefs_checkpoint_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsrefs_checkpoint_get_sequence_number(
+     libfsrefs_checkpoint_t *checkpoint,
+     uint64_t *sequence_number,
+     libcerror_error_t **error );
+
 int libfsrefs_checkpoint_get_number_of_ministore_tree_block_references(
      libfsrefs_checkpoint_t *checkpoint,
      int *number_of_block_references,
@@ -0,0 +1,645 @@
+/*
+ * Data block stream functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_data_block_stream.h"
+#include "libfsrefs_data_run.h"
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_io_handle.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcdata.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
+#include "libfsrefs_statistics.h"
+#include "libfsrefs_unused.h"
+
+/* Creates a data block stream from data runs
+ * The gaps between the data runs are mapped as sparse segments
+ * The logical block number, start block number and number of blocks of a data run
+ * are in units of the metadata block size, not the cluster block size, which in
+ * format version 1 is 16 KiB regardless of the cluster block size
+ * In format version 3 the start block number is a virtual block number, only data runs
+ * that are stored within the first container are supported, since their block numbers
+ * do not need to be translated using the container tree
+ * Make sure the value data_block_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_data_block_stream_initialize_from_data_runs(
+     libfdata_stream_t **data_block_stream,
+     libfsrefs_io_handle_t *io_handle,
+     libcdata_array_t *data_runs_array,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libfdata_stream_t *safe_data_block_stream = NULL;
+	libfsrefs_data_run_t *data_run            = NULL;
+	static char *function                     = "libfsrefs_data_block_stream_initialize_from_data_runs";
+	size64_t mapped_size                      = 0;
+	size64_t sparse_size                      = 0;
+	uint64_t logical_block_number             = 0;
+	uint64_t maximum_number_of_blocks         = 0;
+	int data_run_index                        = 0;
+	int number_of_data_runs                   = 0;
+	int segment_index                         = 0;
+
+	if( data_block_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->metadata_block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - metadata block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_blocks = (uint64_t) INT64_MAX / io_handle->metadata_block_size;
+
+	if( libcdata_array_get_number_of_entries(
+	     data_runs_array,
+	     &number_of_data_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data runs.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_stream_initialize(
+	     &safe_data_block_stream,
+	     (intptr_t *) io_handle,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsrefs_data_block_stream_read_segment_data,
+	     NULL,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsrefs_data_block_stream_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block stream.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_run_index = 0;
+	     data_run_index < number_of_data_runs;
+	     data_run_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     data_runs_array,
+		     data_run_index,
+		     (intptr_t **) &data_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data run: %d.",
+			 function,
+			 data_run_index );
+
+			goto on_error;
+		}
+		if( data_run == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data run: %d.",
+			 function,
+			 data_run_index );
+
+			goto on_error;
+		}
+		if( ( data_run->logical_block_number < logical_block_number )
+		 || ( data_run->logical_block_number > maximum_number_of_blocks )
+		 || ( data_run->number_of_blocks > ( maximum_number_of_blocks - data_run->logical_block_number ) )
+		 || ( data_run->start_block_number > maximum_number_of_blocks ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data run: %d - logical block number value out of bounds.",
+			 function,
+			 data_run_index );
+
+			goto on_error;
+		}
+		if( data_run->number_of_blocks == 0 )
+		{
+			continue;
+		}
+		if( ( io_handle->major_format_version == 3 )
+		 && ( io_handle->container_size != 0 )
+		 && ( data_run->start_block_number != 0 )
+		 && ( ( data_run->start_block_number >= io_handle->container_size )
+		  ||  ( data_run->number_of_blocks > ( io_handle->container_size - data_run->start_block_number ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data run: %d - start block number: %" PRIu64 " requires container translation.",
+			 function,
+			 data_run_index,
+			 data_run->start_block_number );
+
+			goto on_error;
+		}
+		/* Gaps between data runs and data runs without a physical location
+		 * are holes that are read as zero bytes without I/O
+		 */
+		sparse_size += (size64_t) ( data_run->logical_block_number - logical_block_number ) * io_handle->metadata_block_size;
+
+		if( data_run->start_block_number == 0 )
+		{
+			sparse_size += (size64_t) data_run->number_of_blocks * io_handle->metadata_block_size;
+		}
+		else
+		{
+			if( sparse_size > 0 )
+			{
+				if( libfdata_stream_append_segment(
+				     safe_data_block_stream,
+				     &segment_index,
+				     0,
+				     0,
+				     sparse_size,
+				     LIBFDATA_RANGE_FLAG_IS_SPARSE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append sparse segment.",
+					 function );
+
+					goto on_error;
+				}
+				sparse_size = 0;
+			}
+			if( libfdata_stream_append_segment(
+			     safe_data_block_stream,
+			     &segment_index,
+			     0,
+			     (off64_t) ( data_run->start_block_number * io_handle->metadata_block_size ),
+			     (size64_t) data_run->number_of_blocks * io_handle->metadata_block_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data run: %d segment.",
+				 function,
+				 data_run_index );
+
+				goto on_error;
+			}
+		}
+		logical_block_number = data_run->logical_block_number + data_run->number_of_blocks;
+	}
+	mapped_size = (size64_t) logical_block_number * io_handle->metadata_block_size;
+
+	/* The data after the last data run is a hole up to the data size
+	 */
+	if( data_size > mapped_size )
+	{
+		sparse_size += data_size - mapped_size;
+	}
+	if( sparse_size > 0 )
+	{
+		if( libfdata_stream_append_segment(
+		     safe_data_block_stream,
+		     &segment_index,
+		     0,
+		     0,
+		     sparse_size,
+		     LIBFDATA_RANGE_FLAG_IS_SPARSE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sparse segment.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfdata_stream_set_mapped_size(
+	     safe_data_block_stream,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set mapped size of data block stream.",
+		 function );
+
+		goto on_error;
+	}
+	*data_block_stream = safe_data_block_stream;
+
+	return( 1 );
+
+on_error:
+	if( safe_data_block_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &safe_data_block_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads segment data into a buffer
+ * Sparse segments are filled with zero bytes without reading from the file IO handle
+ * Callback function for the data block stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsrefs_data_block_stream_read_segment_data(
+         libfsrefs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index LIBFSREFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags LIBFSREFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function    = "libfsrefs_data_block_stream_read_segment_data";
+	off64_t segment_offset   = 0;
+	ssize_t read_count       = 0;
+	uint64_t start_timestamp = 0;
+
+	LIBFSREFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSREFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		if( memory_set(
+		     segment_data,
+		     0,
+		     segment_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) segment_data_size );
+	}
+	if( libbfio_handle_get_offset(
+	     file_io_handle,
+	     &segment_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to retrieve current offset of segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              segment_data,
+	              segment_data_size,
+	              error );
+
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 LIBFSREFS_NODE_TYPE_DATA,
+	 LIBFSREFS_STATISTICS_VALUE_READ_TIME,
+	 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 LIBFSREFS_NODE_TYPE_DATA,
+	 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_READS,
+	 1 );
+
+	if( read_count > 0 )
+	{
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 LIBFSREFS_NODE_TYPE_DATA,
+		 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+		 (uint64_t) read_count );
+	}
+	if( read_count != (ssize_t) segment_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 segment_index,
+		 segment_offset,
+		 segment_offset );
+
+		return( -1 );
+	}
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_DATA_READ,
+	 LIBFSREFS_NODE_TYPE_DATA,
+	 segment_offset,
+	 (size64_t) read_count,
+	 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+	return( read_count );
+}
+
+/* Seeks a certain segment offset
+ * Callback function for the data block stream
+ * Returns the offset or -1 on error
+ */
+off64_t libfsrefs_data_block_stream_seek_segment_offset(
+         libfsrefs_io_handle_t *io_handle LIBFSREFS_ATTRIBUTE_UNUSED,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index LIBFSREFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_data_block_stream_seek_segment_offset";
+
+	LIBFSREFS_UNREFERENCED_PARAMETER( io_handle )
+	LIBFSREFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_offset = libbfio_handle_seek_offset(
+	                  file_io_handle,
+	                  segment_offset,
+	                  SEEK_SET,
+	                  error );
+
+	if( segment_offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	return( segment_offset );
+}
+
+/* Retrieves the offset of the next data or sparse range at or after the offset
+ * The data after the last segment up to the data size is considered sparse
+ * Returns 1 if successful, 0 if no such range was found or -1 on error
+ */
+int libfsrefs_data_block_stream_get_next_range_offset(
+     libfdata_stream_t *data_block_stream,
+     size64_t data_size,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsrefs_data_block_stream_get_next_range_offset";
+	size64_t segment_size     = 0;
+	off64_t segment_end       = 0;
+	off64_t segment_offset    = 0;
+	off64_t segment_start     = 0;
+	uint32_t segment_flags    = 0;
+	uint8_t segment_is_sparse = 0;
+	int number_of_segments    = 0;
+	int segment_file_index    = 0;
+	int segment_index         = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= data_size )
+	{
+		return( 0 );
+	}
+	if( libfdata_stream_get_number_of_segments(
+	     data_block_stream,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( (size64_t) segment_start >= data_size )
+		{
+			break;
+		}
+		if( libfdata_stream_get_segment_by_index(
+		     data_block_stream,
+		     segment_index,
+		     &segment_file_index,
+		     &segment_offset,
+		     &segment_size,
+		     &segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( segment_size > ( data_size - (size64_t) segment_start ) )
+		{
+			segment_size = data_size - (size64_t) segment_start;
+		}
+		segment_end       = segment_start + (off64_t) segment_size;
+		segment_is_sparse = (uint8_t) ( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 );
+
+		if( ( segment_end > offset )
+		 && ( segment_is_sparse == is_sparse ) )
+		{
+			if( segment_start > offset )
+			{
+				*range_offset = segment_start;
+			}
+			else
+			{
+				*range_offset = offset;
+			}
+			return( 1 );
+		}
+		segment_start = segment_end;
+	}
+	if( is_sparse != 0 )
+	{
+		if( segment_start > offset )
+		{
+			*range_offset = segment_start;
+		}
+		else
+		{
+			*range_offset = offset;
+		}
+		return( 1 );
+	}
+	return( 0 );
+}
+
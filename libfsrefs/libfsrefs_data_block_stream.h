@@ -0,0 +1,77 @@
+/*
+ * Data block stream functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_DATA_BLOCK_STREAM_H )
+#define _LIBFSREFS_DATA_BLOCK_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_io_handle.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcdata.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfsrefs_data_block_stream_initialize_from_data_runs(
+     libfdata_stream_t **data_block_stream,
+     libfsrefs_io_handle_t *io_handle,
+     libcdata_array_t *data_runs_array,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+ssize_t libfsrefs_data_block_stream_read_segment_data(
+         libfsrefs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libfsrefs_data_block_stream_seek_segment_offset(
+         libfsrefs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
+int libfsrefs_data_block_stream_get_next_range_offset(
+     libfdata_stream_t *data_block_stream,
+     size64_t data_size,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_DATA_BLOCK_STREAM_H ) */
+
@@ -206,32 +206,35 @@ int libfsrefs_data_run_read_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_data_run_t *) data )->logical_offset,
+	 data_run->logical_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_data_run_t *) data )->size,
+	 data_run->number_of_blocks );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_data_run_t *) data )->physical_offset,
+	 data_run->start_block_number );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_data_run_t *) data )->logical_offset,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: logical offset\t\t\t\t: 0x%08" PRIx64 "\n",
 		 function,
-		 value_64bit );
+		 data_run->logical_block_number );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_data_run_t *) data )->size,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: size\t\t\t\t\t: %" PRIu64 " blocks\n",
 		 function,
-		 value_64bit );
+		 data_run->number_of_blocks );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_data_run_t *) data )->physical_offset,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: physical offset\t\t\t\t: 0x%08" PRIx64 "\n",
 		 function,
-		 value_64bit );
+		 data_run->start_block_number );
 
 		byte_stream_copy_to_uint64_little_endian(
 		 ( (fsrefs_data_run_t *) data )->unknown1,
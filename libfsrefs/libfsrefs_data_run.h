@@ -36,6 +36,10 @@ typedef struct libfsrefs_data_run libfsrefs_data_run_t;
 
 struct libfsrefs_data_run
 {
+	/* The logical block number
+	 */
+	uint64_t logical_block_number;
+
 	/* The start block number
 	 */
 	uint64_t start_block_number;
@@ -26,6 +26,7 @@
 
 #include "libfsrefs_attribute_values.h"
 #include "libfsrefs_debug.h"
+#include "libfsrefs_definitions.h"
 #include "libfsrefs_directory_entry.h"
 #include "libfsrefs_libcdata.h"
 #include "libfsrefs_libcerror.h"
@@ -33,7 +34,9 @@
 #include "libfsrefs_libfdatetime.h"
 #include "libfsrefs_libuna.h"
 #include "libfsrefs_ministore_node.h"
+#include "libfsrefs_name.h"
 #include "libfsrefs_node_record.h"
+#include "libfsrefs_statistics.h"
 
 #include "fsrefs_directory_object.h"
 
@@ -171,6 +174,11 @@ int libfsrefs_directory_entry_free(
 			memory_free(
 			 ( *directory_entry )->name_data );
 		}
+		if( ( *directory_entry )->file_values_data != NULL )
+		{
+			memory_free(
+			 ( *directory_entry )->file_values_data );
+		}
 		memory_free(
 		 *directory_entry );
 
@@ -179,6 +187,182 @@ int libfsrefs_directory_entry_free(
 	return( result );
 }
 
+/* Clones a directory entry
+ * The attributes are not cloned, these are read from the file values data on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_entry_clone(
+     libfsrefs_directory_entry_t **destination_directory_entry,
+     libfsrefs_directory_entry_t *source_directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_entry_clone";
+	size_t name_data_size = 0;
+
+	if( destination_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_directory_entry == NULL )
+	{
+		*destination_directory_entry = NULL;
+
+		return( 1 );
+	}
+	if( libfsrefs_directory_entry_initialize(
+	     destination_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_directory_entry )->object_identifier       = source_directory_entry->object_identifier;
+	( *destination_directory_entry )->entry_type              = source_directory_entry->entry_type;
+	( *destination_directory_entry )->creation_time           = source_directory_entry->creation_time;
+	( *destination_directory_entry )->modification_time       = source_directory_entry->modification_time;
+	( *destination_directory_entry )->access_time             = source_directory_entry->access_time;
+	( *destination_directory_entry )->entry_modification_time = source_directory_entry->entry_modification_time;
+	( *destination_directory_entry )->file_attribute_flags    = source_directory_entry->file_attribute_flags;
+	( *destination_directory_entry )->data_size               = source_directory_entry->data_size;
+
+	if( source_directory_entry->name_data != NULL )
+	{
+		/* The name data and UTF-8 encoded name share a single allocation
+		 */
+		name_data_size = source_directory_entry->name_data_size;
+
+		if( source_directory_entry->utf8_name != NULL )
+		{
+			name_data_size += source_directory_entry->utf8_name_size;
+		}
+		if( ( name_data_size == 0 )
+		 || ( name_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source directory entry - name data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_directory_entry )->name_data = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * name_data_size );
+
+		if( ( *destination_directory_entry )->name_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination name data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_directory_entry )->name_data,
+		     source_directory_entry->name_data,
+		     name_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name data.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_directory_entry )->name_data_size = source_directory_entry->name_data_size;
+
+		if( source_directory_entry->utf8_name != NULL )
+		{
+			( *destination_directory_entry )->utf8_name      = &( ( ( *destination_directory_entry )->name_data )[ source_directory_entry->name_data_size ] );
+			( *destination_directory_entry )->utf8_name_size = source_directory_entry->utf8_name_size;
+		}
+	}
+	if( source_directory_entry->file_values_data != NULL )
+	{
+		if( ( source_directory_entry->file_values_data_size == 0 )
+		 || ( source_directory_entry->file_values_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source directory entry - file values data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_directory_entry )->file_values_data = (uint8_t *) memory_allocate(
+		                                                                  sizeof( uint8_t ) * source_directory_entry->file_values_data_size );
+
+		if( ( *destination_directory_entry )->file_values_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination file values data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_directory_entry )->file_values_data,
+		     source_directory_entry->file_values_data,
+		     source_directory_entry->file_values_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file values data.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_directory_entry )->file_values_data_size = source_directory_entry->file_values_data_size;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_directory_entry != NULL )
+	{
+		libfsrefs_directory_entry_free(
+		 destination_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the directory entry directory values
  * Returns 1 if successful or -1 on error
  */
@@ -395,17 +579,13 @@ int libfsrefs_directory_entry_read_file_values(
      size_t data_size,
      libcerror_error_t **error )
 {
-	libfsrefs_attribute_values_t *attribute_values = NULL;
-	libfsrefs_ministore_node_t *node               = NULL;
-	libfsrefs_node_record_t *node_record           = NULL;
-	static char *function                          = "libfsrefs_directory_entry_read_file_values";
-	int entry_index                                = 0;
-	int number_of_records                          = 0;
-	int record_index                               = 0;
+	libfsrefs_ministore_node_t *node = NULL;
+	static char *function            = "libfsrefs_directory_entry_read_file_values";
+	int number_of_records            = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit                           = 0;
-	uint32_t value_32bit                           = 0;
+	uint64_t value_64bit             = 0;
+	uint32_t value_32bit             = 0;
 #endif
 
 	if( directory_entry == NULL )
@@ -419,6 +599,40 @@ int libfsrefs_directory_entry_read_file_values(
 
 		return( -1 );
 	}
+	if( directory_entry->file_values_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry - file values data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfsrefs_ministore_node_initialize(
 	     &node,
 	     error ) != 1 )
@@ -437,6 +651,7 @@ int libfsrefs_directory_entry_read_file_values(
 	     io_handle,
 	     data,
 	     data_size,
+	     LIBFSREFS_NODE_TYPE_FILE_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -501,6 +716,10 @@ int libfsrefs_directory_entry_read_file_values(
 	 ( (fsrefs_file_values_t *) node->header_data )->file_attribute_flags,
 	 directory_entry->file_attribute_flags );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_file_values_t *) node->header_data )->data_size,
+	 directory_entry->data_size );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -695,6 +914,166 @@ int libfsrefs_directory_entry_read_file_values(
 
 		goto on_error;
 	}
+	if( libfsrefs_ministore_node_free(
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file values ministore node.",
+		 function );
+
+		goto on_error;
+	}
+	/* The attribute records are read on first use, since listing a directory
+	 * only requires the values stored in the file values header
+	 */
+	directory_entry->file_values_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * data_size );
+
+	if( directory_entry->file_values_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file values data.",
+		 function );
+
+		goto on_error;
+	}
+	directory_entry->file_values_data_size = data_size;
+
+	if( memory_copy(
+	     directory_entry->file_values_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file values data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry->file_values_data != NULL )
+	{
+		memory_free(
+		 directory_entry->file_values_data );
+
+		directory_entry->file_values_data = NULL;
+	}
+	directory_entry->file_values_data_size = 0;
+
+	if( node != NULL )
+	{
+		libfsrefs_ministore_node_free(
+		 &node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the directory entry attributes
+ * The attributes are read from the file values data on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_entry_read_attributes(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_attribute_values_t *attribute_values = NULL;
+	libfsrefs_ministore_node_t *node               = NULL;
+	libfsrefs_node_record_t *node_record           = NULL;
+	static char *function                          = "libfsrefs_directory_entry_read_attributes";
+	int entry_index                                = 0;
+	int number_of_records                          = 0;
+	int record_index                               = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->attributes_read != 0 )
+	{
+		return( 1 );
+	}
+	if( directory_entry->file_values_data == NULL )
+	{
+		directory_entry->attributes_read = 1;
+
+		return( 1 );
+	}
+	if( libfsrefs_ministore_node_initialize(
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file values ministore node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_ministore_node_read_data(
+	     node,
+	     io_handle,
+	     directory_entry->file_values_data,
+	     directory_entry->file_values_data_size,
+	     LIBFSREFS_NODE_TYPE_FILE_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file values ministore node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_ministore_node_get_number_of_records(
+	     node,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
 	for( record_index = 0;
 	     record_index < number_of_records;
 	     record_index++ )
@@ -729,6 +1108,11 @@ int libfsrefs_directory_entry_read_file_values(
 
 			goto on_error;
 		}
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 LIBFSREFS_NODE_TYPE_FILE_VALUES,
+		 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+		 1 );
 		if( libfsrefs_attribute_values_read_node_record(
 		     attribute_values,
 		     io_handle,
@@ -776,6 +1160,8 @@ int libfsrefs_directory_entry_read_file_values(
 
 		goto on_error;
 	}
+	directory_entry->attributes_read = 1;
+
 	return( 1 );
 
 on_error:
@@ -810,6 +1196,7 @@ int libfsrefs_directory_entry_read_node_record(
 {
 	static char *function = "libfsrefs_directory_entry_read_node_record";
 	size_t name_data_size = 0;
+	size_t utf8_name_size = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint16_t value_16bit  = 0;
@@ -888,8 +1275,27 @@ int libfsrefs_directory_entry_read_node_record(
 
 	name_data_size = node_record->key_data_size - 4;
 
+	/* The name is converted to UTF-8 once, since the size-then-copy
+	 * calling pattern would otherwise convert it on every call.
+	 * A name that cannot be converted does not fail the directory, instead
+	 * it is converted when retrieved, which fails for this entry only
+	 */
+	if( libfsrefs_name_get_utf8_string_size_from_utf16_stream(
+	     &( node_record->key_data[ 4 ] ),
+	     name_data_size,
+	     &utf8_name_size,
+	     NULL ) != 1 )
+	{
+		utf8_name_size = 0;
+	}
+	else if( utf8_name_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - name_data_size ) )
+	{
+		utf8_name_size = 0;
+	}
+	/* The name data and UTF-8 encoded name share a single allocation
+	 */
 	directory_entry->name_data = (uint8_t *) memory_allocate(
-	                                          sizeof( uint8_t ) * name_data_size );
+	                                          sizeof( uint8_t ) * ( name_data_size + utf8_name_size ) );
 
 	if( directory_entry->name_data == NULL )
 	{
@@ -918,6 +1324,22 @@ int libfsrefs_directory_entry_read_node_record(
 
 		goto on_error;
 	}
+	if( utf8_name_size > 0 )
+	{
+		directory_entry->utf8_name      = &( directory_entry->name_data[ name_data_size ] );
+		directory_entry->utf8_name_size = utf8_name_size;
+
+		if( libfsrefs_name_copy_utf8_string_from_utf16_stream(
+		     directory_entry->utf8_name,
+		     directory_entry->utf8_name_size,
+		     directory_entry->name_data,
+		     directory_entry->name_data_size,
+		     NULL ) != 1 )
+		{
+			directory_entry->utf8_name      = NULL;
+			directory_entry->utf8_name_size = 0;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1004,11 +1426,8 @@ on_error:
 		directory_entry->name_data = NULL;
 	}
 	directory_entry->name_data_size = 0;
-
-	libcdata_array_empty(
-	 directory_entry->attributes_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_attribute_values_free,
-	 NULL );
+	directory_entry->utf8_name      = NULL;
+	directory_entry->utf8_name_size = 0;
 
 	return( -1 );
 }
@@ -1073,12 +1492,27 @@ int libfsrefs_directory_entry_get_utf8_name_size(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     directory_entry->name_data,
-	     directory_entry->name_data_size,
-	     LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( directory_entry->utf8_name != NULL )
+	{
+		if( utf8_string_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_size = directory_entry->utf8_name_size;
+	}
+	else if( libuna_utf8_string_size_from_utf16_stream(
+	          directory_entry->name_data,
+	          directory_entry->name_data_size,
+	          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	          utf8_string_size,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1116,13 +1550,52 @@ int libfsrefs_directory_entry_get_utf8_name(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     directory_entry->name_data,
-	     directory_entry->name_data_size,
-	     LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
-	     error ) != 1 )
+	if( directory_entry->utf8_name != NULL )
+	{
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_size < directory_entry->utf8_name_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     directory_entry->utf8_name,
+		     directory_entry->utf8_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libuna_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size,
+	          directory_entry->name_data,
+	          directory_entry->name_data_size,
+	          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1407,3 +1880,196 @@ int libfsrefs_directory_entry_get_file_attribute_flags(
 	return( 1 );
 }
 
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_entry_get_data_size(
+     libfsrefs_directory_entry_t *directory_entry,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_entry_get_data_size";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = directory_entry->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of attributes
+ * The attributes are read on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_entry_get_number_of_attributes(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_io_handle_t *io_handle,
+     int *number_of_attributes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_entry_get_number_of_attributes";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_directory_entry_read_attributes(
+	     directory_entry,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory_entry->attributes_array,
+	     number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from attributes array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific attribute values
+ * The attributes are read on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_entry_get_attribute_values_by_index(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_io_handle_t *io_handle,
+     int attribute_index,
+     libfsrefs_attribute_values_t **attribute_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_entry_get_attribute_values_by_index";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_directory_entry_read_attributes(
+	     directory_entry,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     directory_entry->attributes_array,
+	     attribute_index,
+	     (intptr_t **) attribute_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values: %d from array.",
+		 function,
+		 attribute_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the stat values
+ * This function does not set the name offset and size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_entry_get_stat(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_file_entry_stat_t *file_entry_stat,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_entry_get_stat";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_stat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stat.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_stat->object_identifier       = directory_entry->object_identifier;
+	file_entry_stat->creation_time           = directory_entry->creation_time;
+	file_entry_stat->modification_time       = directory_entry->modification_time;
+	file_entry_stat->access_time             = directory_entry->access_time;
+	file_entry_stat->entry_modification_time = directory_entry->entry_modification_time;
+	file_entry_stat->size                    = directory_entry->data_size;
+	file_entry_stat->file_attribute_flags    = directory_entry->file_attribute_flags;
+	file_entry_stat->entry_type              = directory_entry->entry_type;
+
+	return( 1 );
+}
+
@@ -25,10 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsrefs_attribute_values.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libcdata.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_node_record.h"
+#include "libfsrefs_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -54,6 +56,15 @@ struct libfsrefs_directory_entry
 	 */
 	size_t name_data_size;
 
+	/* The UTF-8 encoded name
+	 * This is stored in the same buffer as the name data
+	 */
+	uint8_t *utf8_name;
+
+	/* The UTF-8 encoded name size
+	 */
+	size_t utf8_name_size;
+
 	/* The creation time
 	 */
 	uint64_t creation_time;
@@ -74,6 +85,23 @@ struct libfsrefs_directory_entry
 	 */
 	uint32_t file_attribute_flags;
 
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The file values data
+	 * The attributes are read from this data on first use
+	 */
+	uint8_t *file_values_data;
+
+	/* The file values data size
+	 */
+	size_t file_values_data_size;
+
+	/* Value to indicate the attributes were read
+	 */
+	uint8_t attributes_read;
+
 	/* The attributes array
 	 */
 	libcdata_array_t *attributes_array;
@@ -87,6 +115,11 @@ int libfsrefs_directory_entry_free(
      libfsrefs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsrefs_directory_entry_clone(
+     libfsrefs_directory_entry_t **destination_directory_entry,
+     libfsrefs_directory_entry_t *source_directory_entry,
+     libcerror_error_t **error );
+
 int libfsrefs_directory_entry_read_directory_values(
      libfsrefs_directory_entry_t *directory_entry,
      const uint8_t *data,
@@ -100,6 +133,11 @@ int libfsrefs_directory_entry_read_file_values(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsrefs_directory_entry_read_attributes(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libfsrefs_directory_entry_read_node_record(
      libfsrefs_directory_entry_t *directory_entry,
      libfsrefs_io_handle_t *io_handle,
@@ -158,6 +196,29 @@ int libfsrefs_directory_entry_get_file_attribute_flags(
      uint32_t *file_attribute_flags,
      libcerror_error_t **error );
 
+int libfsrefs_directory_entry_get_data_size(
+     libfsrefs_directory_entry_t *directory_entry,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_entry_get_number_of_attributes(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_io_handle_t *io_handle,
+     int *number_of_attributes,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_entry_get_attribute_values_by_index(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_io_handle_t *io_handle,
+     int attribute_index,
+     libfsrefs_attribute_values_t **attribute_values,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_entry_get_stat(
+     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_file_entry_stat_t *file_entry_stat,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,17 +24,22 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libfsrefs_block_descriptor.h"
 #include "libfsrefs_block_reference.h"
-#include "libfsrefs_block_tree.h"
-#include "libfsrefs_block_tree_node.h"
+#include "libfsrefs_block_set.h"
+#include "libfsrefs_definitions.h"
 #include "libfsrefs_directory_entry.h"
 #include "libfsrefs_directory_object.h"
+#include "libfsrefs_filter.h"
+#include "libfsrefs_io_handle.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_libcnotify.h"
 #include "libfsrefs_ministore_node.h"
 #include "libfsrefs_node_record.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_statistics.h"
+#include "libfsrefs_volume_index.h"
+
+#include "fsrefs_directory_object.h"
 
 /* Creates a directory object
  * Make sure the value directory_object is referencing, is set to NULL
@@ -126,17 +131,15 @@ int libfsrefs_directory_object_initialize(
 
 		return( -1 );
 	}
-	if( libfsrefs_block_tree_initialize(
-	     &( ( *directory_object )->node_block_tree ),
-	     io_handle->volume_size,
-	     io_handle->metadata_block_size,
+	if( libfsrefs_block_set_initialize(
+	     &( ( *directory_object )->node_block_set ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create node block tree.",
+		 "%s: unable to create node block set.",
 		 function );
 
 		goto on_error;
@@ -155,6 +158,23 @@ int libfsrefs_directory_object_initialize(
 
 		goto on_error;
 	}
+	if( io_handle->memory_budget != NULL )
+	{
+		if( libfsrefs_memory_budget_add_reference(
+		     io_handle->memory_budget,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to memory budget.",
+			 function );
+
+			goto on_error;
+		}
+		( *directory_object )->memory_budget = io_handle->memory_budget;
+	}
 	( *directory_object )->object_identifier = object_identifier;
 	( *directory_object )->objects_tree      = objects_tree;
 
@@ -163,11 +183,17 @@ int libfsrefs_directory_object_initialize(
 on_error:
 	if( *directory_object != NULL )
 	{
-		if( ( *directory_object )->node_block_tree != NULL )
+		if( ( *directory_object )->directory_entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *directory_object )->directory_entries_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *directory_object )->node_block_set != NULL )
 		{
-			libfsrefs_block_tree_free(
-			 &( ( *directory_object )->node_block_tree ),
-			 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_block_reference_free,
+			libfsrefs_block_set_free(
+			 &( ( *directory_object )->node_block_set ),
 			 NULL );
 		}
 		memory_free(
@@ -201,8 +227,49 @@ int libfsrefs_directory_object_free(
 	}
 	if( *directory_object != NULL )
 	{
-		/* The objects_tree reference is freed elsewhere
+		/* The objects_tree and filter references are freed elsewhere
 		 */
+		if( ( *directory_object )->memory_budget != NULL )
+		{
+			if( ( *directory_object )->memory_size != 0 )
+			{
+				if( libfsrefs_memory_budget_release(
+				     ( *directory_object )->memory_budget,
+				     ( *directory_object )->memory_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release memory size from memory budget.",
+					 function );
+
+					result = -1;
+				}
+			}
+			/* The directory object holds a reference to the memory budget
+			 * since it can outlive the volume
+			 */
+			if( libfsrefs_memory_budget_free(
+			     &( ( *directory_object )->memory_budget ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory budget.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *directory_object )->sub_directory_identifiers != NULL )
+		{
+			memory_free(
+			 ( *directory_object )->sub_directory_identifiers );
+		}
 		if( libcdata_array_free(
 		     &( ( *directory_object )->directory_entries_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_directory_entry_free,
@@ -217,31 +284,17 @@ int libfsrefs_directory_object_free(
 
 			result = -1;
 		}
-		if( libfsrefs_block_tree_free(
-		     &( ( *directory_object )->node_block_tree ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_block_reference_free,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free node block tree.",
-			 function );
-
-			result = -1;
-		}
-		if( ( *directory_object )->root_node != NULL )
+		if( ( *directory_object )->node_block_set != NULL )
 		{
-			if( libfsrefs_ministore_node_free(
-			     &( ( *directory_object )->root_node ),
+			if( libfsrefs_block_set_free(
+			     &( ( *directory_object )->node_block_set ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free root node.",
+				 "%s: unable to free node block set.",
 				 function );
 
 				result = -1;
@@ -261,17 +314,13 @@ int libfsrefs_directory_object_free(
  */
 int libfsrefs_directory_object_check_if_node_block_first_read(
      libfsrefs_directory_object_t *directory_object,
-     libfsrefs_block_tree_t *node_block_tree,
+     libfsrefs_block_set_t *node_block_set,
      uint64_t block_number,
      off64_t block_offset,
      libcerror_error_t **error )
 {
-	libfsrefs_block_descriptor_t *existing_block_descriptor = NULL;
-	libfsrefs_block_descriptor_t *new_block_descriptor      = NULL;
-	libfsrefs_block_tree_node_t *leaf_block_tree_node       = NULL;
-	static char *function                                   = "libfsrefs_directory_object_check_if_node_block_first_read";
-	int leaf_value_index                                    = 0;
-	int result                                              = 0;
+	static char *function = "libfsrefs_directory_object_check_if_node_block_first_read";
+	int result            = 0;
 
 	if( directory_object == NULL )
 	{
@@ -284,28 +333,9 @@ int libfsrefs_directory_object_check_if_node_block_first_read(
 
 		return( -1 );
 	}
-	if( libfsrefs_block_descriptor_initialize(
-	     &new_block_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block descriptor.",
-		 function );
-
-		goto on_error;
-	}
-	new_block_descriptor->block_number = block_number;
-
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          node_block_tree,
+	result = libfsrefs_block_set_insert(
+	          node_block_set,
 	          block_offset,
-	          new_block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
 	          error );
 
 	if( result == -1 )
@@ -314,10 +344,10 @@ int libfsrefs_directory_object_check_if_node_block_first_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert block descriptor in node block tree.",
+		 "%s: unable to insert block offset in node block set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result == 0 )
 	{
@@ -329,20 +359,92 @@ int libfsrefs_directory_object_check_if_node_block_first_read(
 		 function,
 		 block_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	new_block_descriptor = NULL;
-
 	return( 1 );
+}
 
-on_error:
-	if( new_block_descriptor != NULL )
+/* Appends a sub directory object identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_append_sub_directory_identifier(
+     libfsrefs_directory_object_t *directory_object,
+     uint64_t object_identifier,
+     libcerror_error_t **error )
+{
+	uint64_t *sub_directory_identifiers   = NULL;
+	static char *function                 = "libfsrefs_directory_object_append_sub_directory_identifier";
+	size_t sub_directory_identifiers_size = 0;
+	int number_of_allocated_identifiers   = 0;
+
+	if( directory_object == NULL )
 	{
-		libfsrefs_block_descriptor_free(
-		 &new_block_descriptor,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( directory_object->number_of_sub_directory_identifiers >= directory_object->number_of_allocated_sub_directory_identifiers )
+	{
+		if( directory_object->number_of_allocated_sub_directory_identifiers >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid directory object - number of allocated sub directory identifiers value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( directory_object->number_of_allocated_sub_directory_identifiers == 0 )
+		{
+			number_of_allocated_identifiers = 16;
+		}
+		else
+		{
+			number_of_allocated_identifiers = directory_object->number_of_allocated_sub_directory_identifiers * 2;
+		}
+		sub_directory_identifiers_size = sizeof( uint64_t ) * (size_t) number_of_allocated_identifiers;
+
+		if( sub_directory_identifiers_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid sub directory identifiers size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		sub_directory_identifiers = (uint64_t *) memory_reallocate(
+		                                          directory_object->sub_directory_identifiers,
+		                                          sub_directory_identifiers_size );
+
+		if( sub_directory_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize sub directory identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		directory_object->sub_directory_identifiers                     = sub_directory_identifiers;
+		directory_object->number_of_allocated_sub_directory_identifiers = number_of_allocated_identifiers;
+	}
+	directory_object->sub_directory_identifiers[ directory_object->number_of_sub_directory_identifiers ] = object_identifier;
+
+	directory_object->number_of_sub_directory_identifiers += 1;
+
+	return( 1 );
 }
 
 /* Reads an directory object
@@ -354,7 +456,14 @@ int libfsrefs_directory_object_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsrefs_directory_object_read";
+	libfsrefs_node_record_t node_record;
+
+	libfsrefs_ministore_node_t *root_node                = NULL;
+	libfsrefs_volume_index_object_t *volume_index_object = NULL;
+	static char *function                                = "libfsrefs_directory_object_read";
+	uint64_t start_timestamp                             = 0;
+	uint32_t record_index                                = 0;
+	int result                                           = 0;
 
 	if( directory_object == NULL )
 	{
@@ -367,72 +476,223 @@ int libfsrefs_directory_object_read(
 
 		return( -1 );
 	}
-	if( directory_object->root_node != NULL )
+	if( directory_object->is_read != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid directory object - root node value already set.",
+		 "%s: invalid directory object - already read.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsrefs_objects_tree_get_ministore_tree_by_identifier(
-	     directory_object->objects_tree,
-	     io_handle,
-	     file_io_handle,
-	     directory_object->object_identifier,
-	     &( directory_object->root_node ),
-	     error ) != 1 )
+	if( directory_object->node_block_set == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory object: 0x%08" PRIx64 " from objects tree.",
-		 function,
-		 directory_object->object_identifier );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory object - missing node block set.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( directory_object->root_node->node_type_flags & 0x02 ) == 0 )
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
+	/* When the directory object is available in the imported volume index
+	 * its records are read from the volume index instead of the objects tree
+	 */
+	if( directory_object->objects_tree->volume_index != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported directory object: 0x%08" PRIx64 " root node - missing is root (0x02) flag.",
-		 function,
-		 directory_object->object_identifier );
+		result = libfsrefs_volume_index_get_object_by_identifier(
+		          directory_object->objects_tree->volume_index,
+		          directory_object->object_identifier,
+		          &volume_index_object,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory object: 0x%08" PRIx64 " from volume index.",
+			 function,
+			 directory_object->object_identifier );
+
+			goto on_error;
+		}
 	}
-	if( libfsrefs_directory_object_read_node(
-	     directory_object,
-	     io_handle,
-	     file_io_handle,
-	     directory_object->root_node,
+	if( result != 0 )
+	{
+		for( record_index = 0;
+		     record_index < volume_index_object->number_of_records;
+		     record_index++ )
+		{
+			if( libfsrefs_volume_index_get_record_by_index(
+			     directory_object->objects_tree->volume_index,
+			     (int) ( volume_index_object->first_record_index + record_index ),
+			     &node_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory object: 0x%08" PRIx64 " record: %" PRIu32 " from volume index.",
+				 function,
+				 directory_object->object_identifier,
+				 record_index );
+
+				goto on_error;
+			}
+			if( libfsrefs_directory_object_read_node_record(
+			     directory_object,
+			     io_handle,
+			     &node_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory object: 0x%08" PRIx64 " record: %" PRIu32 ".",
+				 function,
+				 directory_object->object_identifier,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		if( libfsrefs_objects_tree_get_ministore_tree_by_identifier(
+		     directory_object->objects_tree,
+		     io_handle,
+		     file_io_handle,
+		     directory_object->object_identifier,
+		     LIBFSREFS_NODE_TYPE_DIRECTORY,
+		     &root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory object: 0x%08" PRIx64 " from objects tree.",
+			 function,
+			 directory_object->object_identifier );
+
+			goto on_error;
+		}
+		if( ( root_node->node_type_flags & 0x02 ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported directory object: 0x%08" PRIx64 " root node - missing is root (0x02) flag.",
+			 function,
+			 directory_object->object_identifier );
+
+			goto on_error;
+		}
+		if( libfsrefs_directory_object_read_node(
+		     directory_object,
+		     io_handle,
+		     file_io_handle,
+		     root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory object: 0x%08" PRIx64 " root node.",
+			 function,
+			 directory_object->object_identifier );
+
+			goto on_error;
+		}
+		libfsrefs_io_handle_trace_event(
+		 io_handle,
+		 LIBFSREFS_TRACE_EVENT_DIRECTORY_OBJECT_READ,
+		 LIBFSREFS_NODE_TYPE_DIRECTORY,
+		 root_node->block_offset,
+		 (size64_t) root_node->data_size,
+		 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+		/* The directory entries contain a copy of the data they need, hence the nodes
+		 * are not retained and only the directory entries are accounted for
+		 */
+		if( libfsrefs_ministore_node_free(
+		     &root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsrefs_block_set_free(
+	     &( directory_object->node_block_set ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read directory object: 0x%08" PRIx64 " root node.",
-		 function,
-		 directory_object->object_identifier );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free node block set.",
+		 function );
 
 		goto on_error;
 	}
+	directory_object->memory_size += sizeof( libfsrefs_directory_object_t )
+	                               + ( sizeof( uint64_t ) * directory_object->number_of_allocated_sub_directory_identifiers );
+
+	if( directory_object->memory_budget != NULL )
+	{
+		if( libfsrefs_memory_budget_allocate(
+		     directory_object->memory_budget,
+		     directory_object->memory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to allocate memory size from memory budget.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	directory_object->is_read = 1;
+
 	return( 1 );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsrefs_ministore_node_free(
+		 &root_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 directory_object->directory_entries_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_directory_entry_free,
 	 NULL );
 
+	directory_object->number_of_sub_directory_identifiers = 0;
+	directory_object->memory_size                         = 0;
+
 	return( -1 );
 }
 
@@ -447,12 +707,10 @@ int libfsrefs_directory_object_read_node(
      libcerror_error_t **error )
 {
 	libfsrefs_block_reference_t *block_reference = NULL;
-	libfsrefs_directory_entry_t *directory_entry = NULL;
 	libfsrefs_ministore_node_t *sub_node         = NULL;
 	libfsrefs_node_record_t *node_record         = NULL;
 	static char *function                        = "libfsrefs_directory_object_read_node";
 	uint16_t record_type                         = 0;
-	int entry_index                              = 0;
 	int number_of_records                        = 0;
 	int record_index                             = 0;
 
@@ -467,6 +725,17 @@ int libfsrefs_directory_object_read_node(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfsrefs_ministore_node_get_number_of_records(
 	     node,
 	     &number_of_records,
@@ -551,21 +820,8 @@ int libfsrefs_directory_object_read_node(
 #endif
 		if( ( node->node_type_flags & 0x01 ) == 0 )
 		{
-			if( libfsrefs_directory_entry_initialize(
-			     &directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory entry.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsrefs_directory_entry_read_node_record(
-			     directory_entry,
+			if( libfsrefs_directory_object_read_node_record(
+			     directory_object,
 			     io_handle,
 			     node_record,
 			     error ) != 1 )
@@ -574,28 +830,13 @@ int libfsrefs_directory_object_read_node(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory entry from record: %d.",
+				 "%s: unable to read directory object: 0x%08" PRIx64 " record: %d.",
 				 function,
+				 directory_object->object_identifier,
 				 record_index );
 
 				goto on_error;
 			}
-			if( libcdata_array_append_entry(
-			     directory_object->directory_entries_array,
-			     &entry_index,
-			     (intptr_t *) directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append directory entry to array.",
-				 function );
-
-				goto on_error;
-			}
-			directory_entry = NULL;
 		}
 		else
 		{
@@ -651,7 +892,7 @@ int libfsrefs_directory_object_read_node(
 			}
 			if( libfsrefs_directory_object_check_if_node_block_first_read(
 			     directory_object,
-			     directory_object->node_block_tree,
+			     directory_object->node_block_set,
 			     block_reference->block_numbers[ 0 ],
 			     block_reference->block_offsets[ 0 ],
 			     error ) != 1 )
@@ -686,6 +927,7 @@ int libfsrefs_directory_object_read_node(
 			     io_handle,
 			     file_io_handle,
 			     block_reference,
+			     LIBFSREFS_NODE_TYPE_DIRECTORY,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -764,17 +1006,203 @@ on_error:
 		 &block_reference,
 		 NULL );
 	}
+	libcdata_array_empty(
+	 directory_object->directory_entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_directory_entry_free,
+	 NULL );
+
+	directory_object->number_of_sub_directory_identifiers = 0;
+
+	return( -1 );
+}
+
+/* Reads an directory object leaf node record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_read_node_record(
+     libfsrefs_directory_object_t *directory_object,
+     libfsrefs_io_handle_t *io_handle,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_entry_t *directory_entry = NULL;
+	static char *function                        = "libfsrefs_directory_object_read_node_record";
+	uint64_t sub_directory_identifier            = 0;
+	uint16_t entry_type                          = 0;
+	int entry_index                              = 0;
+	int result                                   = 0;
+
+	if( directory_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record.",
+		 function );
+
+		return( -1 );
+	}
+	/* The volume index is exported regardless of the filter
+	 */
+	if( directory_object->export_volume_index != NULL )
+	{
+		if( libfsrefs_volume_index_append_record(
+		     directory_object->export_volume_index,
+		     node_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record to volume index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( node_record->key_data_size >= 4 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( node_record->key_data[ 2 ] ),
+		 entry_type );
+	}
+	/* The sub directories are determined from the record data
+	 * so that they remain available when the filter does not match
+	 */
+	if( ( entry_type == 2 )
+	 && ( node_record->value_data != NULL )
+	 && ( node_record->value_data_size == sizeof( fsrefs_directory_values_t ) ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_directory_values_t *) node_record->value_data )->object_identifier,
+		 sub_directory_identifier );
+
+		if( libfsrefs_directory_object_append_sub_directory_identifier(
+		     directory_object,
+		     sub_directory_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub directory identifier: 0x%08" PRIx64 ".",
+			 function,
+			 sub_directory_identifier );
+
+			goto on_error;
+		}
+	}
+	if( directory_object->filter != NULL )
+	{
+		result = libfsrefs_internal_filter_match_node_record(
+		          directory_object->filter,
+		          node_record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if record matches filter.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libfsrefs_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+	 1 );
+
+	if( libfsrefs_directory_entry_read_node_record(
+	     directory_entry,
+	     io_handle,
+	     node_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry from record.",
+		 function );
+
+		goto on_error;
+	}
+	directory_object->memory_size += sizeof( libfsrefs_directory_entry_t )
+	                               + directory_entry->name_data_size
+	                               + directory_entry->utf8_name_size
+	                               + directory_entry->file_values_data_size;
+
+	if( libcdata_array_append_entry(
+	     directory_object->directory_entries_array,
+	     &entry_index,
+	     (intptr_t *) directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory entry to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
 	if( directory_entry != NULL )
 	{
 		libfsrefs_directory_entry_free(
 		 &directory_entry,
 		 NULL );
 	}
-	libcdata_array_empty(
-	 directory_object->directory_entries_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_directory_entry_free,
-	 NULL );
-
 	return( -1 );
 }
 
@@ -799,13 +1227,13 @@ int libfsrefs_directory_object_get_number_of_directory_entries(
 
 		return( -1 );
 	}
-	if( directory_object->root_node == NULL )
+	if( directory_object->is_read == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid ministore node - missing root node.",
+		 "%s: invalid directory object - not read.",
 		 function );
 
 		return( -1 );
@@ -849,13 +1277,13 @@ int libfsrefs_directory_object_get_directory_entry_by_index(
 
 		return( -1 );
 	}
-	if( directory_object->root_node == NULL )
+	if( directory_object->is_read == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid ministore node - missing root node.",
+		 "%s: invalid directory object - not read.",
 		 function );
 
 		return( -1 );
@@ -25,13 +25,17 @@
 #include <common.h>
 #include <types.h>
 
-#include "libfsrefs_block_tree.h"
+#include "libfsrefs_block_set.h"
 #include "libfsrefs_directory_entry.h"
+#include "libfsrefs_filter.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libbfio.h"
 #include "libfsrefs_libcerror.h"
+#include "libfsrefs_memory_budget.h"
 #include "libfsrefs_ministore_node.h"
+#include "libfsrefs_node_record.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_volume_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -49,17 +53,62 @@ struct libfsrefs_directory_object
 	 */
 	libfsrefs_objects_tree_t *objects_tree;
 
-	/* Ministore root node
+	/* Value to indicate the directory object was read
 	 */
-	libfsrefs_ministore_node_t *root_node;
+	uint8_t is_read;
 
-	/* The (Ministore) node block tree
+	/* The (Ministore) node block set
+	 * Used to detect if a node block is read more than once, this is freed after read
 	 */
-	libfsrefs_block_tree_t *node_block_tree;
+	libfsrefs_block_set_t *node_block_set;
 
 	/* The directory entries array
 	 */
 	libcdata_array_t *directory_entries_array;
+
+	/* The filter
+	 * When set only directory entries that match the filter are read
+	 */
+	libfsrefs_internal_filter_t *filter;
+
+	/* The sub directory object identifiers
+	 * These contain the sub directories regardless of the filter
+	 */
+	uint64_t *sub_directory_identifiers;
+
+	/* The number of sub directory object identifiers
+	 */
+	int number_of_sub_directory_identifiers;
+
+	/* The number of allocated sub directory object identifiers
+	 */
+	int number_of_allocated_sub_directory_identifiers;
+
+	/* The volume index the directory entry records are exported to
+	 * When set all the directory entry records are appended to the current object of the volume index
+	 */
+	libfsrefs_volume_index_t *export_volume_index;
+
+	/* The memory budget
+	 */
+	libfsrefs_memory_budget_t *memory_budget;
+
+	/* The (estimated) memory size allocated from the memory budget
+	 */
+	size64_t memory_size;
+
+	/* The previous (less recently used) idle directory object in the directory object cache
+	 */
+	libfsrefs_directory_object_t *previous_idle_directory_object;
+
+	/* The next (more recently used) idle directory object in the directory object cache
+	 */
+	libfsrefs_directory_object_t *next_idle_directory_object;
+
+	/* Reference to the value that owns the directory object while it is idle
+	 * The value is set to NULL when the directory object is evicted
+	 */
+	libfsrefs_directory_object_t **idle_reference;
 };
 
 int libfsrefs_directory_object_initialize(
@@ -75,11 +124,16 @@ int libfsrefs_directory_object_free(
 
 int libfsrefs_directory_object_check_if_node_block_first_read(
      libfsrefs_directory_object_t *directory_object,
-     libfsrefs_block_tree_t *node_block_tree,
+     libfsrefs_block_set_t *node_block_set,
      uint64_t block_number,
      off64_t block_offset,
      libcerror_error_t **error );
 
+int libfsrefs_directory_object_append_sub_directory_identifier(
+     libfsrefs_directory_object_t *directory_object,
+     uint64_t object_identifier,
+     libcerror_error_t **error );
+
 int libfsrefs_directory_object_read(
      libfsrefs_directory_object_t *directory_object,
      libfsrefs_io_handle_t *io_handle,
@@ -93,6 +147,12 @@ int libfsrefs_directory_object_read_node(
      libfsrefs_ministore_node_t *node,
      libcerror_error_t **error );
 
+int libfsrefs_directory_object_read_node_record(
+     libfsrefs_directory_object_t *directory_object,
+     libfsrefs_io_handle_t *io_handle,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error );
+
 int libfsrefs_directory_object_get_number_of_directory_entries(
      libfsrefs_directory_object_t *directory_object,
      int *number_of_directory_entries,
@@ -0,0 +1,1038 @@
+/*
+ * Directory object cache functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_directory_object.h"
+#include "libfsrefs_directory_object_cache.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_memory_budget.h"
+#include "libfsrefs_static_mutex.h"
+
+/* The process-wide list of directory object caches
+ * This is used to evict idle directory objects of all volumes when a shared
+ * (process-wide) memory budget is exceeded
+ */
+static libfsrefs_directory_object_cache_t *libfsrefs_first_directory_object_cache = NULL;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+/* The mutex that guards the process-wide list of directory object caches
+ * It is grabbed before the mutex of a directory object cache
+ */
+static libfsrefs_static_mutex_t libfsrefs_directory_object_caches_mutex = LIBFSREFS_STATIC_MUTEX_INITIALIZER;
+
+#endif
+
+/* Creates a directory object cache
+ * Make sure the value directory_object_cache is referencing, is set to NULL
+ * If memory_budget is set the directory object cache holds a reference to it and
+ * is added to the process-wide list of directory object caches
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_initialize(
+     libfsrefs_directory_object_cache_t **directory_object_cache,
+     libfsrefs_memory_budget_t *memory_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_object_cache_initialize";
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_object_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory object cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_object_cache = memory_allocate_structure(
+	                           libfsrefs_directory_object_cache_t );
+
+	if( *directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory object cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_object_cache,
+	     0,
+	     sizeof( libfsrefs_directory_object_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory object cache.",
+		 function );
+
+		memory_free(
+		 *directory_object_cache );
+
+		*directory_object_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *directory_object_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *directory_object_cache )->number_of_references = 1;
+
+	if( memory_budget != NULL )
+	{
+		if( libfsrefs_memory_budget_add_reference(
+		     memory_budget,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to memory budget.",
+			 function );
+
+			goto on_error;
+		}
+		( *directory_object_cache )->memory_budget = memory_budget;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libfsrefs_static_mutex_grab(
+		     &libfsrefs_directory_object_caches_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab directory object caches mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		( *directory_object_cache )->next_directory_object_cache = libfsrefs_first_directory_object_cache;
+
+		if( libfsrefs_first_directory_object_cache != NULL )
+		{
+			libfsrefs_first_directory_object_cache->previous_directory_object_cache = *directory_object_cache;
+		}
+		libfsrefs_first_directory_object_cache = *directory_object_cache;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libfsrefs_static_mutex_release(
+		     &libfsrefs_directory_object_caches_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release directory object caches mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *directory_object_cache != NULL )
+	{
+		if( ( *directory_object_cache )->memory_budget != NULL )
+		{
+			libfsrefs_memory_budget_free(
+			 &( ( *directory_object_cache )->memory_budget ),
+			 NULL );
+		}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( ( *directory_object_cache )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *directory_object_cache )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *directory_object_cache );
+
+		*directory_object_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory object cache
+ * This frees a reference, the directory object cache is freed when the last reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_free(
+     libfsrefs_directory_object_cache_t **directory_object_cache,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_object_cache_t *safe_directory_object_cache = NULL;
+	static char *function                                           = "libfsrefs_directory_object_cache_free";
+	int number_of_references                                        = 0;
+	int result                                                      = 1;
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_object_cache != NULL )
+	{
+		safe_directory_object_cache = *directory_object_cache;
+		*directory_object_cache     = NULL;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     safe_directory_object_cache->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_directory_object_cache->number_of_references -= 1;
+
+		number_of_references = safe_directory_object_cache->number_of_references;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     safe_directory_object_cache->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			return( 1 );
+		}
+		/* The idle directory objects are owned and freed by the file entries,
+		 * which hold a reference to the directory object cache
+		 */
+		if( safe_directory_object_cache->memory_budget != NULL )
+		{
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+			if( libfsrefs_static_mutex_grab(
+			     &libfsrefs_directory_object_caches_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab directory object caches mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			if( safe_directory_object_cache->previous_directory_object_cache == NULL )
+			{
+				libfsrefs_first_directory_object_cache = safe_directory_object_cache->next_directory_object_cache;
+			}
+			else
+			{
+				safe_directory_object_cache->previous_directory_object_cache->next_directory_object_cache = safe_directory_object_cache->next_directory_object_cache;
+			}
+			if( safe_directory_object_cache->next_directory_object_cache != NULL )
+			{
+				safe_directory_object_cache->next_directory_object_cache->previous_directory_object_cache = safe_directory_object_cache->previous_directory_object_cache;
+			}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+			if( libfsrefs_static_mutex_release(
+			     &libfsrefs_directory_object_caches_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release directory object caches mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			if( libfsrefs_memory_budget_free(
+			     &( safe_directory_object_cache->memory_budget ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory budget.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( safe_directory_object_cache->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 safe_directory_object_cache );
+	}
+	return( result );
+}
+
+/* Adds a reference to the directory object cache
+ * Every reference must be freed with libfsrefs_directory_object_cache_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_add_reference(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_object_cache_add_reference";
+	int result            = 1;
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( directory_object_cache->number_of_references >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory object cache - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		directory_object_cache->number_of_references += 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of idle directory objects
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_get_number_of_idle_directory_objects(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     int *number_of_idle_directory_objects,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_object_cache_get_number_of_idle_directory_objects";
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_idle_directory_objects == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of idle directory objects.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_idle_directory_objects = directory_object_cache->number_of_idle_directory_objects;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Unlinks an idle directory object
+ * The caller is responsible for holding the mutex
+ */
+void libfsrefs_directory_object_cache_unlink_idle_directory_object(
+      libfsrefs_directory_object_cache_t *directory_object_cache,
+      libfsrefs_directory_object_t *directory_object )
+{
+	if( directory_object->previous_idle_directory_object == NULL )
+	{
+		directory_object_cache->first_idle_directory_object = directory_object->next_idle_directory_object;
+	}
+	else
+	{
+		directory_object->previous_idle_directory_object->next_idle_directory_object = directory_object->next_idle_directory_object;
+	}
+	if( directory_object->next_idle_directory_object == NULL )
+	{
+		directory_object_cache->last_idle_directory_object = directory_object->previous_idle_directory_object;
+	}
+	else
+	{
+		directory_object->next_idle_directory_object->previous_idle_directory_object = directory_object->previous_idle_directory_object;
+	}
+	directory_object->previous_idle_directory_object = NULL;
+	directory_object->next_idle_directory_object     = NULL;
+	directory_object->idle_reference                 = NULL;
+
+	directory_object_cache->number_of_idle_directory_objects -= 1;
+}
+
+/* Appends a directory object that is no longer in use as the most recently used idle directory object
+ * While idle the directory object can be evicted, in which case the value directory_object
+ * is referencing is set to NULL. The directory_object reference must remain valid while idle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_append_idle_directory_object(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     libfsrefs_directory_object_t **directory_object,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_object_t *safe_directory_object = NULL;
+	static char *function                               = "libfsrefs_directory_object_cache_append_idle_directory_object";
+	int result                                          = 1;
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object.",
+		 function );
+
+		return( -1 );
+	}
+	safe_directory_object = *directory_object;
+
+	if( safe_directory_object == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_directory_object->idle_reference != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory object - already idle.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		safe_directory_object->idle_reference                 = directory_object;
+		safe_directory_object->previous_idle_directory_object = directory_object_cache->last_idle_directory_object;
+		safe_directory_object->next_idle_directory_object     = NULL;
+
+		if( directory_object_cache->last_idle_directory_object == NULL )
+		{
+			directory_object_cache->first_idle_directory_object = safe_directory_object;
+		}
+		else
+		{
+			directory_object_cache->last_idle_directory_object->next_idle_directory_object = safe_directory_object;
+		}
+		directory_object_cache->last_idle_directory_object = safe_directory_object;
+
+		directory_object_cache->number_of_idle_directory_objects += 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes an idle directory object so that it can be used
+ * Returns 1 if successful, 0 if the directory object was evicted or not set or -1 on error
+ */
+int libfsrefs_directory_object_cache_remove_idle_directory_object(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     libfsrefs_directory_object_t **directory_object,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_directory_object_cache_remove_idle_directory_object";
+	int result            = 0;
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The value directory_object is referencing is set to NULL on eviction
+	 * hence it must be checked while holding the mutex
+	 */
+	if( *directory_object != NULL )
+	{
+		if( ( *directory_object )->idle_reference != NULL )
+		{
+			libfsrefs_directory_object_cache_unlink_idle_directory_object(
+			 directory_object_cache,
+			 *directory_object );
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Evicts the least recently used idle directory object
+ * Directory objects that are in use are never evicted
+ * Returns 1 if successful, 0 if there was no idle directory object or -1 on error
+ */
+int libfsrefs_directory_object_cache_evict_least_recently_used(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_object_t *directory_object = NULL;
+	static char *function                          = "libfsrefs_directory_object_cache_evict_least_recently_used";
+	int result                                     = 0;
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	directory_object = directory_object_cache->first_idle_directory_object;
+
+	if( directory_object != NULL )
+	{
+		/* Clear the reference of the owner before freeing the directory object
+		 */
+		*( directory_object->idle_reference ) = NULL;
+
+		libfsrefs_directory_object_cache_unlink_idle_directory_object(
+		 directory_object_cache,
+		 directory_object );
+
+		result = 1;
+
+		if( libfsrefs_directory_object_free(
+		     &directory_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory object.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     directory_object_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Evicts idle directory objects of every directory object cache whose memory budget
+ * allocates from memory_budget, while memory_budget is exceeded
+ * The least recently used idle directory object of each directory object cache is
+ * evicted in turn, so that the volumes share the (process-wide) memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_evict_process_wide(
+     libfsrefs_memory_budget_t *memory_budget,
+     int *number_of_evictions,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_object_cache_t *directory_object_cache = NULL;
+	static char *function                                      = "libfsrefs_directory_object_cache_evict_process_wide";
+	int number_of_evictions_in_pass                            = 0;
+	int result                                                 = 1;
+	int safe_number_of_evictions                               = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_directory_object_caches_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab directory object caches mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+		number_of_evictions_in_pass = 0;
+
+		for( directory_object_cache = libfsrefs_first_directory_object_cache;
+		     directory_object_cache != NULL;
+		     directory_object_cache = directory_object_cache->next_directory_object_cache )
+		{
+			if( directory_object_cache->memory_budget->parent_memory_budget != memory_budget )
+			{
+				continue;
+			}
+			result = libfsrefs_memory_budget_is_exceeded(
+			          memory_budget,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if memory budget is exceeded.",
+				 function );
+
+				break;
+			}
+			else if( result == 0 )
+			{
+				/* The memory budget is no longer exceeded
+				 */
+				break;
+			}
+			result = libfsrefs_directory_object_cache_evict_least_recently_used(
+			          directory_object_cache,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to evict least recently used idle directory object.",
+				 function );
+
+				break;
+			}
+			number_of_evictions_in_pass += result;
+
+			result = 1;
+		}
+		safe_number_of_evictions += number_of_evictions_in_pass;
+	}
+	while( ( result == 1 )
+	    && ( number_of_evictions_in_pass > 0 ) );
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_directory_object_caches_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release directory object caches mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	*number_of_evictions = safe_number_of_evictions;
+
+	return( 1 );
+}
+
+/* Evicts idle directory objects while the memory budget of the directory object cache is exceeded
+ * If the parent (process-wide) memory budget is exceeded the idle directory objects of other
+ * directory object caches are evicted as well
+ * Directory objects that are in use are never evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_directory_object_cache_evict(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     int *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsrefs_directory_object_cache_evict";
+	int result                   = 0;
+	int safe_number_of_evictions = 0;
+
+	if( directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_object_cache->memory_budget == NULL )
+	{
+		*number_of_evictions = 0;
+
+		return( 1 );
+	}
+	if( directory_object_cache->memory_budget->parent_memory_budget != NULL )
+	{
+		if( libfsrefs_directory_object_cache_evict_process_wide(
+		     directory_object_cache->memory_budget->parent_memory_budget,
+		     &safe_number_of_evictions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict idle directory objects process-wide.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	do
+	{
+		result = libfsrefs_memory_budget_is_exceeded(
+		          directory_object_cache->memory_budget,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if memory budget is exceeded.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libfsrefs_directory_object_cache_evict_least_recently_used(
+		          directory_object_cache,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict least recently used idle directory object.",
+			 function );
+
+			return( -1 );
+		}
+		safe_number_of_evictions += result;
+	}
+	while( result == 1 );
+
+	*number_of_evictions = safe_number_of_evictions;
+
+	return( 1 );
+}
+
@@ -0,0 +1,131 @@
+/*
+ * Directory object cache functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSREFS_DIRECTORY_OBJECT_CACHE_H )
+#define _LIBFSREFS_DIRECTORY_OBJECT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_memory_budget.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+struct libfsrefs_directory_object;
+
+typedef struct libfsrefs_directory_object_cache libfsrefs_directory_object_cache_t;
+
+struct libfsrefs_directory_object_cache
+{
+	/* The least recently used idle directory object
+	 */
+	struct libfsrefs_directory_object *first_idle_directory_object;
+
+	/* The most recently used idle directory object
+	 */
+	struct libfsrefs_directory_object *last_idle_directory_object;
+
+	/* The number of idle directory objects
+	 */
+	int number_of_idle_directory_objects;
+
+	/* The memory budget
+	 * The directory object cache holds a reference to the memory budget
+	 */
+	libfsrefs_memory_budget_t *memory_budget;
+
+	/* The number of references
+	 * The directory object cache is freed when the last reference is freed
+	 */
+	int number_of_references;
+
+	/* The previous directory object cache in the process-wide list of directory object caches
+	 */
+	libfsrefs_directory_object_cache_t *previous_directory_object_cache;
+
+	/* The next directory object cache in the process-wide list of directory object caches
+	 */
+	libfsrefs_directory_object_cache_t *next_directory_object_cache;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsrefs_directory_object_cache_initialize(
+     libfsrefs_directory_object_cache_t **directory_object_cache,
+     libfsrefs_memory_budget_t *memory_budget,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_free(
+     libfsrefs_directory_object_cache_t **directory_object_cache,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_add_reference(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_get_number_of_idle_directory_objects(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     int *number_of_idle_directory_objects,
+     libcerror_error_t **error );
+
+void libfsrefs_directory_object_cache_unlink_idle_directory_object(
+      libfsrefs_directory_object_cache_t *directory_object_cache,
+      struct libfsrefs_directory_object *directory_object );
+
+int libfsrefs_directory_object_cache_append_idle_directory_object(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     struct libfsrefs_directory_object **directory_object,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_remove_idle_directory_object(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     struct libfsrefs_directory_object **directory_object,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_evict_least_recently_used(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_evict_process_wide(
+     libfsrefs_memory_budget_t *memory_budget,
+     int *number_of_evictions,
+     libcerror_error_t **error );
+
+int libfsrefs_directory_object_cache_evict(
+     libfsrefs_directory_object_cache_t *directory_object_cache,
+     int *number_of_evictions,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_DIRECTORY_OBJECT_CACHE_H ) */
+
@@ -0,0 +1,726 @@
+/*
+ * Extent scheduler functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_extent_scheduler.h"
+#include "libfsrefs_io_handle.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
+#include "libfsrefs_statistics.h"
+
+/* Creates an extent scheduler
+ * Make sure the value extent_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_extent_scheduler_initialize(
+     libfsrefs_extent_scheduler_t **extent_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_extent_scheduler_initialize";
+
+	if( extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_scheduler = memory_allocate_structure(
+	                     libfsrefs_extent_scheduler_t );
+
+	if( *extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_scheduler,
+	     0,
+	     sizeof( libfsrefs_extent_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_scheduler != NULL )
+	{
+		memory_free(
+		 *extent_scheduler );
+
+		*extent_scheduler = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_extent_scheduler_free(
+     libfsrefs_extent_scheduler_t **extent_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_extent_scheduler_free";
+
+	if( extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_scheduler != NULL )
+	{
+		if( ( *extent_scheduler )->extents != NULL )
+		{
+			memory_free(
+			 ( *extent_scheduler )->extents );
+		}
+		memory_free(
+		 *extent_scheduler );
+
+		*extent_scheduler = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_extent_scheduler_append_extent(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     off64_t physical_offset,
+     size64_t size,
+     off64_t data_offset,
+     int file_entry_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_scheduled_extent_t *extents = NULL;
+	static char *function                 = "libfsrefs_extent_scheduler_append_extent";
+	size_t extents_size                   = 0;
+	int number_of_allocated_extents       = 0;
+
+	if( extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - physical_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_scheduler->number_of_extents >= extent_scheduler->number_of_allocated_extents )
+	{
+		if( extent_scheduler->number_of_allocated_extents >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid extent scheduler - number of allocated extents value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( extent_scheduler->number_of_allocated_extents == 0 )
+		{
+			number_of_allocated_extents = 64;
+		}
+		else
+		{
+			number_of_allocated_extents = extent_scheduler->number_of_allocated_extents * 2;
+		}
+		extents_size = sizeof( libfsrefs_scheduled_extent_t ) * (size_t) number_of_allocated_extents;
+
+		if( extents_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid extents size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		extents = (libfsrefs_scheduled_extent_t *) memory_reallocate(
+		                                            extent_scheduler->extents,
+		                                            extents_size );
+
+		if( extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		extent_scheduler->extents                     = extents;
+		extent_scheduler->number_of_allocated_extents = number_of_allocated_extents;
+	}
+	extents = &( extent_scheduler->extents[ extent_scheduler->number_of_extents ] );
+
+	extents->physical_offset  = physical_offset;
+	extents->size             = size;
+	extents->data_offset      = data_offset;
+	extents->file_entry_index = file_entry_index;
+
+	extent_scheduler->number_of_extents += 1;
+
+	return( 1 );
+}
+
+/* Appends the extents of a data block stream
+ * Sparse segments and data beyond the data size are not scheduled
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_extent_scheduler_append_data_block_stream(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     libfdata_stream_t *data_block_stream,
+     size64_t data_size,
+     int file_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsrefs_extent_scheduler_append_data_block_stream";
+	size64_t segment_size   = 0;
+	off64_t data_offset     = 0;
+	off64_t segment_offset  = 0;
+	uint32_t segment_flags  = 0;
+	int number_of_segments  = 0;
+	int segment_file_index  = 0;
+	int segment_index       = 0;
+
+	if( extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_number_of_segments(
+	     data_block_stream,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments from data block stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( (size64_t) data_offset >= data_size )
+		{
+			break;
+		}
+		if( libfdata_stream_get_segment_by_index(
+		     data_block_stream,
+		     segment_index,
+		     &segment_file_index,
+		     &segment_offset,
+		     &segment_size,
+		     &segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d from data block stream.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( segment_size > ( data_size - (size64_t) data_offset ) )
+		{
+			segment_size = data_size - (size64_t) data_offset;
+		}
+		if( ( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) == 0 )
+		 && ( segment_size > 0 ) )
+		{
+			if( libfsrefs_extent_scheduler_append_extent(
+			     extent_scheduler,
+			     segment_offset,
+			     segment_size,
+			     data_offset,
+			     file_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extent of segment: %d.",
+				 function,
+				 segment_index );
+
+				return( -1 );
+			}
+		}
+		data_offset += (off64_t) segment_size;
+	}
+	return( 1 );
+}
+
+/* Compares two scheduled extents by physical offset
+ * Extents with the same physical offset are ordered by file entry index and data offset
+ * Returns -1, 0 or 1 as required by qsort
+ */
+static int libfsrefs_scheduled_extent_compare(
+            const void *first_extent,
+            const void *second_extent )
+{
+	const libfsrefs_scheduled_extent_t *first  = (const libfsrefs_scheduled_extent_t *) first_extent;
+	const libfsrefs_scheduled_extent_t *second = (const libfsrefs_scheduled_extent_t *) second_extent;
+
+	if( first->physical_offset < second->physical_offset )
+	{
+		return( -1 );
+	}
+	if( first->physical_offset > second->physical_offset )
+	{
+		return( 1 );
+	}
+	if( first->file_entry_index < second->file_entry_index )
+	{
+		return( -1 );
+	}
+	if( first->file_entry_index > second->file_entry_index )
+	{
+		return( 1 );
+	}
+	if( first->data_offset < second->data_offset )
+	{
+		return( -1 );
+	}
+	if( first->data_offset > second->data_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the extents by physical offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_extent_scheduler_sort(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_extent_scheduler_sort";
+
+	if( extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_scheduler->number_of_extents > 1 )
+	{
+		qsort(
+		 extent_scheduler->extents,
+		 (size_t) extent_scheduler->number_of_extents,
+		 sizeof( libfsrefs_scheduled_extent_t ),
+		 &libfsrefs_scheduled_extent_compare );
+	}
+	return( 1 );
+}
+
+/* Reads the scheduled extents in physical order
+ * Adjacent and overlapping extents are merged into runs that are read sequentially,
+ * the data of each run is passed to the write data callback of the file entries it belongs to
+ * The extents must be sorted before calling this function
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_extent_scheduler_read(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     libfsrefs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int (*write_data)(
+            int file_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_scheduled_extent_t *extent = NULL;
+	uint8_t *read_buffer                 = NULL;
+	static char *function                = "libfsrefs_extent_scheduler_read";
+	size_t read_buffer_size              = 0;
+	size_t read_size                     = 0;
+	ssize_t read_count                   = 0;
+	uint64_t start_timestamp             = 0;
+	off64_t extent_end_offset            = 0;
+	off64_t overlap_end_offset           = 0;
+	off64_t overlap_start_offset         = 0;
+	off64_t read_end_offset              = 0;
+	off64_t read_offset                  = 0;
+	off64_t run_end_offset               = 0;
+	int extent_index                     = 0;
+	int first_active_extent_index        = 0;
+	int first_extent_index               = 0;
+	int last_extent_index                = 0;
+	int result                           = 1;
+
+	if( extent_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_scheduler->number_of_extents == 0 )
+	{
+		return( 1 );
+	}
+	read_buffer_size = LIBFSREFS_EXTENT_SCHEDULER_MAXIMUM_READ_SIZE;
+
+	read_buffer = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * read_buffer_size );
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	first_extent_index = 0;
+
+	while( first_extent_index < extent_scheduler->number_of_extents )
+	{
+		/* Merge the extents that are adjacent or overlap into a single run
+		 */
+		extent = &( extent_scheduler->extents[ first_extent_index ] );
+
+		read_offset    = extent->physical_offset;
+		run_end_offset = extent->physical_offset + (off64_t) extent->size;
+
+		for( last_extent_index = first_extent_index + 1;
+		     last_extent_index < extent_scheduler->number_of_extents;
+		     last_extent_index++ )
+		{
+			extent = &( extent_scheduler->extents[ last_extent_index ] );
+
+			if( extent->physical_offset > run_end_offset )
+			{
+				break;
+			}
+			extent_end_offset = extent->physical_offset + (off64_t) extent->size;
+
+			if( extent_end_offset > run_end_offset )
+			{
+				run_end_offset = extent_end_offset;
+			}
+		}
+		first_active_extent_index = first_extent_index;
+
+		while( read_offset < run_end_offset )
+		{
+			if( io_handle->abort != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			read_size = read_buffer_size;
+
+			if( (size64_t) read_size > (size64_t) ( run_end_offset - read_offset ) )
+			{
+				read_size = (size_t) ( run_end_offset - read_offset );
+			}
+			start_timestamp = libfsrefs_statistics_get_timestamp();
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              read_buffer,
+			              read_size,
+			              read_offset,
+			              error );
+
+			libfsrefs_statistics_add_value(
+			 &( io_handle->statistics ),
+			 LIBFSREFS_NODE_TYPE_DATA,
+			 LIBFSREFS_STATISTICS_VALUE_READ_TIME,
+			 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+			libfsrefs_statistics_add_value(
+			 &( io_handle->statistics ),
+			 LIBFSREFS_NODE_TYPE_DATA,
+			 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_READS,
+			 1 );
+
+			if( read_count > 0 )
+			{
+				libfsrefs_statistics_add_value(
+				 &( io_handle->statistics ),
+				 LIBFSREFS_NODE_TYPE_DATA,
+				 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+				 (uint64_t) read_count );
+			}
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 read_offset,
+				 read_offset );
+
+				goto on_error;
+			}
+			libfsrefs_io_handle_trace_event(
+			 io_handle,
+			 LIBFSREFS_TRACE_EVENT_DATA_READ,
+			 LIBFSREFS_NODE_TYPE_DATA,
+			 read_offset,
+			 (size64_t) read_count,
+			 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+			read_end_offset = read_offset + (off64_t) read_count;
+
+			/* Demultiplex the data read to the extents it overlaps with
+			 */
+			for( extent_index = first_active_extent_index;
+			     extent_index < last_extent_index;
+			     extent_index++ )
+			{
+				extent = &( extent_scheduler->extents[ extent_index ] );
+
+				if( extent->physical_offset >= read_end_offset )
+				{
+					break;
+				}
+				extent_end_offset = extent->physical_offset + (off64_t) extent->size;
+
+				if( extent_end_offset <= read_offset )
+				{
+					if( extent_index == first_active_extent_index )
+					{
+						first_active_extent_index++;
+					}
+					continue;
+				}
+				overlap_start_offset = extent->physical_offset;
+
+				if( overlap_start_offset < read_offset )
+				{
+					overlap_start_offset = read_offset;
+				}
+				overlap_end_offset = extent_end_offset;
+
+				if( overlap_end_offset > read_end_offset )
+				{
+					overlap_end_offset = read_end_offset;
+				}
+				if( write_data(
+				     extent->file_entry_index,
+				     extent->data_offset + ( overlap_start_offset - extent->physical_offset ),
+				     &( read_buffer[ overlap_start_offset - read_offset ] ),
+				     (size_t) ( overlap_end_offset - overlap_start_offset ),
+				     user_data ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write data of file entry: %d at offset: %" PRIi64 ".",
+					 function,
+					 extent->file_entry_index,
+					 extent->data_offset + ( overlap_start_offset - extent->physical_offset ) );
+
+					goto on_error;
+				}
+			}
+			read_offset = read_end_offset;
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		first_extent_index = last_extent_index;
+	}
+	memory_free(
+	 read_buffer );
+
+	return( result );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,120 @@
+/*
+ * Extent scheduler functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_EXTENT_SCHEDULER_H )
+#define _LIBFSREFS_EXTENT_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_io_handle.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_scheduled_extent libfsrefs_scheduled_extent_t;
+
+struct libfsrefs_scheduled_extent
+{
+	/* The physical offset
+	 */
+	off64_t physical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The (logical) data offset
+	 */
+	off64_t data_offset;
+
+	/* The file entry index
+	 */
+	int file_entry_index;
+};
+
+typedef struct libfsrefs_extent_scheduler libfsrefs_extent_scheduler_t;
+
+struct libfsrefs_extent_scheduler
+{
+	/* The extents
+	 */
+	libfsrefs_scheduled_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+};
+
+int libfsrefs_extent_scheduler_initialize(
+     libfsrefs_extent_scheduler_t **extent_scheduler,
+     libcerror_error_t **error );
+
+int libfsrefs_extent_scheduler_free(
+     libfsrefs_extent_scheduler_t **extent_scheduler,
+     libcerror_error_t **error );
+
+int libfsrefs_extent_scheduler_append_extent(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     off64_t physical_offset,
+     size64_t size,
+     off64_t data_offset,
+     int file_entry_index,
+     libcerror_error_t **error );
+
+int libfsrefs_extent_scheduler_append_data_block_stream(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     libfdata_stream_t *data_block_stream,
+     size64_t data_size,
+     int file_entry_index,
+     libcerror_error_t **error );
+
+int libfsrefs_extent_scheduler_sort(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     libcerror_error_t **error );
+
+int libfsrefs_extent_scheduler_read(
+     libfsrefs_extent_scheduler_t *extent_scheduler,
+     libfsrefs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int (*write_data)(
+            int file_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_EXTENT_SCHEDULER_H ) */
+
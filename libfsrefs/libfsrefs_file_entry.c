@@ -24,18 +24,28 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsrefs_attribute.h"
+#include "libfsrefs_attribute_values.h"
+#include "libfsrefs_data_block_stream.h"
+#include "libfsrefs_definitions.h"
 #include "libfsrefs_directory_entry.h"
 #include "libfsrefs_directory_object.h"
+#include "libfsrefs_directory_object_cache.h"
 #include "libfsrefs_file_entry.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libbfio.h"
 #include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
 #include "libfsrefs_libuna.h"
+#include "libfsrefs_memory_budget.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_parent_index.h"
+#include "libfsrefs_statistics.h"
 #include "libfsrefs_types.h"
 
 /* Creates file_entry
  * Make sure the value file_entry is referencing, is set to NULL
+ * The file_entry takes over management of directory_entry if successful
  * Returns 1 if successful or -1 on error
  */
 int libfsrefs_file_entry_initialize(
@@ -43,9 +53,11 @@ int libfsrefs_file_entry_initialize(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsrefs_objects_tree_t *objects_tree,
+     uint64_t object_identifier,
      libfsrefs_directory_entry_t *directory_entry,
      libcerror_error_t **error )
 {
+	libfsrefs_directory_object_t *directory_object       = NULL;
 	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                                = "libfsrefs_file_entry_initialize";
 
@@ -102,22 +114,67 @@ int libfsrefs_file_entry_initialize(
 
 		return( -1 );
 	}
-	if( libfsrefs_internal_file_entry_get_directory_object(
-	     internal_file_entry,
-	     io_handle,
-	     file_io_handle,
-	     objects_tree,
-	     directory_entry,
-	     error ) != 1 )
+	internal_file_entry->io_handle      = io_handle;
+	internal_file_entry->file_io_handle = file_io_handle;
+	internal_file_entry->objects_tree   = objects_tree;
+
+	if( ( io_handle != NULL )
+	 && ( io_handle->directory_object_cache != NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory object.",
-		 function );
+		if( libfsrefs_directory_object_cache_add_reference(
+		     io_handle->directory_object_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to directory object cache.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		internal_file_entry->directory_object_cache = io_handle->directory_object_cache;
+	}
+
+	if( directory_entry == NULL )
+	{
+		internal_file_entry->object_identifier = object_identifier;
+
+		/* The directory object of a file entry created from an object identifier
+		 * is read directly to validate the object identifier
+		 */
+		if( libfsrefs_internal_file_entry_get_directory_object(
+		     internal_file_entry,
+		     &directory_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( directory_entry->entry_type == 2 )
+	{
+		if( libfsrefs_directory_entry_get_object_identifier(
+		     directory_entry,
+		     &( internal_file_entry->object_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object identifier from directory entry.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
@@ -134,9 +191,19 @@ int libfsrefs_file_entry_initialize(
 		goto on_error;
 	}
 #endif
-	internal_file_entry->io_handle       = io_handle;
-	internal_file_entry->file_io_handle  = file_io_handle;
-	internal_file_entry->objects_tree    = objects_tree;
+	if( libfsrefs_internal_file_entry_release_directory_object(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release directory object.",
+		 function );
+
+		goto on_error;
+	}
 	internal_file_entry->directory_entry = directory_entry;
 
 	*file_entry = (libfsrefs_file_entry_t *) internal_file_entry;
@@ -146,6 +213,18 @@ int libfsrefs_file_entry_initialize(
 on_error:
 	if( internal_file_entry != NULL )
 	{
+		if( internal_file_entry->directory_object != NULL )
+		{
+			libfsrefs_directory_object_free(
+			 &( internal_file_entry->directory_object ),
+			 NULL );
+		}
+		if( internal_file_entry->directory_object_cache != NULL )
+		{
+			libfsrefs_directory_object_cache_free(
+			 &( internal_file_entry->directory_object_cache ),
+			 NULL );
+		}
 		memory_free(
 		 internal_file_entry );
 	}
@@ -194,6 +273,27 @@ int libfsrefs_file_entry_free(
 			result = -1;
 		}
 #endif
+		/* The directory object is removed from the directory object cache
+		 * so that it cannot be evicted while being freed. The IO handle is
+		 * not used since the file entry can be freed after the volume
+		 */
+		if( internal_file_entry->directory_object_cache != NULL )
+		{
+			if( libfsrefs_directory_object_cache_remove_idle_directory_object(
+			     internal_file_entry->directory_object_cache,
+			     &( internal_file_entry->directory_object ),
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove idle directory object from cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_file_entry->directory_object != NULL )
 		{
 			if( libfsrefs_directory_object_free(
@@ -210,6 +310,54 @@ int libfsrefs_file_entry_free(
 				result = -1;
 			}
 		}
+		if( internal_file_entry->directory_entry != NULL )
+		{
+			if( libfsrefs_directory_entry_free(
+			     &( internal_file_entry->directory_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file_entry->data_block_stream != NULL )
+		{
+			if( libfdata_stream_free(
+			     &( internal_file_entry->data_block_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file_entry->directory_object_cache != NULL )
+		{
+			if( libfsrefs_directory_object_cache_free(
+			     &( internal_file_entry->directory_object_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory object cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_file_entry );
 	}
@@ -217,18 +365,20 @@ int libfsrefs_file_entry_free(
 }
 
 /* Retrieves the directory object
+ * The directory object is read on demand, since an idle directory object is evicted
+ * when the memory budget is exceeded. The directory object is in use until
+ * libfsrefs_internal_file_entry_release_directory_object is called
+ * directory_object is set to NULL if the file entry is not a directory
  * Returns 1 if successful or -1 on error
  */
 int libfsrefs_internal_file_entry_get_directory_object(
      libfsrefs_internal_file_entry_t *internal_file_entry,
-     libfsrefs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfsrefs_objects_tree_t *objects_tree,
-     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_directory_object_t **directory_object,
      libcerror_error_t **error )
 {
-	static char *function      = "libfsrefs_internal_file_entry_get_directory_object";
-	uint64_t object_identifier = 0;
+	static char *function   = "libfsrefs_internal_file_entry_get_directory_object";
+	int number_of_evictions = 0;
+	int result              = 0;
 
 	if( internal_file_entry == NULL )
 	{
@@ -241,47 +391,100 @@ int libfsrefs_internal_file_entry_get_directory_object(
 
 		return( -1 );
 	}
-	if( internal_file_entry->directory_object != NULL )
+	if( internal_file_entry->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry - directory object already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	if( internal_file_entry->directory_object_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing directory object cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory object.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->object_identifier == 0 )
 	{
-		object_identifier = 0x00000600UL;
+		*directory_object = NULL;
+
+		return( 1 );
+	}
+	result = libfsrefs_directory_object_cache_remove_idle_directory_object(
+	          internal_file_entry->directory_object_cache,
+	          &( internal_file_entry->directory_object ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove idle directory object from cache.",
+		 function );
+
+		return( -1 );
 	}
-	else if ( directory_entry->entry_type != 2 )
+	else if( result != 0 )
 	{
+		libfsrefs_statistics_add_value(
+		 &( internal_file_entry->io_handle->statistics ),
+		 LIBFSREFS_NODE_TYPE_DIRECTORY,
+		 LIBFSREFS_STATISTICS_VALUE_CACHE_HITS,
+		 1 );
+
+		*directory_object = internal_file_entry->directory_object;
+
 		return( 1 );
 	}
-	else
+	/* Evict the least recently used idle directory objects before reading
+	 * another directory object
+	 */
+	if( libfsrefs_directory_object_cache_evict(
+	     internal_file_entry->directory_object_cache,
+	     &number_of_evictions,
+	     error ) != 1 )
 	{
-		if( libfsrefs_directory_entry_get_object_identifier(
-		     directory_entry,
-		     &object_identifier,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size object identifier from directory entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to evict idle directory objects from cache.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
+	libfsrefs_statistics_add_value(
+	 &( internal_file_entry->io_handle->statistics ),
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_EVICTIONS,
+	 (uint64_t) number_of_evictions );
 	if( libfsrefs_directory_object_initialize(
 	     &( internal_file_entry->directory_object ),
-	     io_handle,
-	     objects_tree,
-	     object_identifier,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->objects_tree,
+	     internal_file_entry->object_identifier,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -293,10 +496,16 @@ int libfsrefs_internal_file_entry_get_directory_object(
 
 		goto on_error;
 	}
+	libfsrefs_statistics_add_value(
+	 &( internal_file_entry->io_handle->statistics ),
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 LIBFSREFS_STATISTICS_VALUE_CACHE_MISSES,
+	 1 );
+
 	if( libfsrefs_directory_object_read(
 	     internal_file_entry->directory_object,
-	     io_handle,
-	     file_io_handle,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -305,10 +514,12 @@ int libfsrefs_internal_file_entry_get_directory_object(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read directory object: 0x%08" PRIx64 ".",
 		 function,
-		 object_identifier );
+		 internal_file_entry->object_identifier );
 
 		goto on_error;
 	}
+	*directory_object = internal_file_entry->directory_object;
+
 	return( 1 );
 
 on_error:
@@ -321,16 +532,72 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the creation date and time
+/* Releases the directory object after use
+ * The directory object becomes the most recently used idle directory object of
+ * the directory object cache, from which it is evicted when the memory budget is
+ * exceeded and another directory object is read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_internal_file_entry_release_directory_object(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_internal_file_entry_release_directory_object";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->directory_object == NULL )
+	{
+		return( 1 );
+	}
+	if( libfsrefs_directory_object_cache_append_idle_directory_object(
+	     internal_file_entry->directory_object_cache,
+	     &( internal_file_entry->directory_object ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append idle directory object to cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the object identifier
+ * Only directories have an object identifier
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsrefs_file_entry_get_creation_time(
+int libfsrefs_file_entry_get_object_identifier(
      libfsrefs_file_entry_t *file_entry,
-     uint64_t *filetime,
+     uint64_t *object_identifier,
      libcerror_error_t **error )
 {
 	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsrefs_file_entry_get_creation_time";
+	static char *function                                = "libfsrefs_file_entry_get_object_identifier";
 	int result                                           = 0;
 
 	if( file_entry == NULL )
@@ -346,6 +613,17 @@ int libfsrefs_file_entry_get_creation_time(
 	}
 	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
 
+	if( object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -361,24 +639,11 @@ int libfsrefs_file_entry_get_creation_time(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->directory_entry != NULL )
+	if( internal_file_entry->object_identifier != 0 )
 	{
-		result = libfsrefs_directory_entry_get_creation_time(
-		          internal_file_entry->directory_entry,
-		          filetime,
-		          error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve creation time from directory entry.",
-			 function );
+		*object_identifier = internal_file_entry->object_identifier;
 
-			result = -1;
-		}
+		result = 1;
 	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -398,16 +663,16 @@ int libfsrefs_file_entry_get_creation_time(
 	return( result );
 }
 
-/* Retrieves the (file) modification (last written) date and time
+/* Retrieves the creation date and time
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsrefs_file_entry_get_modification_time(
+int libfsrefs_file_entry_get_creation_time(
      libfsrefs_file_entry_t *file_entry,
      uint64_t *filetime,
      libcerror_error_t **error )
 {
 	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsrefs_file_entry_get_modification_time";
+	static char *function                                = "libfsrefs_file_entry_get_creation_time";
 	int result                                           = 0;
 
 	if( file_entry == NULL )
@@ -440,7 +705,7 @@ int libfsrefs_file_entry_get_modification_time(
 #endif
 	if( internal_file_entry->directory_entry != NULL )
 	{
-		result = libfsrefs_directory_entry_get_modification_time(
+		result = libfsrefs_directory_entry_get_creation_time(
 		          internal_file_entry->directory_entry,
 		          filetime,
 		          error );
@@ -451,7 +716,7 @@ int libfsrefs_file_entry_get_modification_time(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve modification time from directory entry.",
+			 "%s: unable to retrieve creation time from directory entry.",
 			 function );
 
 			result = -1;
@@ -475,16 +740,16 @@ int libfsrefs_file_entry_get_modification_time(
 	return( result );
 }
 
-/* Retrieves the access date and time
+/* Retrieves the (file) modification (last written) date and time
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsrefs_file_entry_get_access_time(
+int libfsrefs_file_entry_get_modification_time(
      libfsrefs_file_entry_t *file_entry,
      uint64_t *filetime,
      libcerror_error_t **error )
 {
 	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsrefs_file_entry_get_access_time";
+	static char *function                                = "libfsrefs_file_entry_get_modification_time";
 	int result                                           = 0;
 
 	if( file_entry == NULL )
@@ -517,7 +782,84 @@ int libfsrefs_file_entry_get_access_time(
 #endif
 	if( internal_file_entry->directory_entry != NULL )
 	{
-		result = libfsrefs_directory_entry_get_access_time(
+		result = libfsrefs_directory_entry_get_modification_time(
+		          internal_file_entry->directory_entry,
+		          filetime,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time from directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the access date and time
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_file_entry_get_access_time(
+     libfsrefs_file_entry_t *file_entry,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_access_time";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_entry != NULL )
+	{
+		result = libfsrefs_directory_entry_get_access_time(
 		          internal_file_entry->directory_entry,
 		          filetime,
 		          error );
@@ -1022,20 +1364,22 @@ int libfsrefs_file_entry_get_utf16_name(
 	return( result );
 }
 
-/* Retrieves the number of sub file entries
- * Returns 1 if successful or -1 on error
+/* Retrieves the values to look up the path in the parent index
+ * Directories are looked up by their object identifier, other file entries
+ * by the object identifier of their parent directory and their name
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsrefs_file_entry_get_number_of_sub_file_entries(
-     libfsrefs_file_entry_t *file_entry,
-     int *number_of_sub_file_entries,
+int libfsrefs_internal_file_entry_get_path_values(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     libfsrefs_parent_index_t **parent_index,
+     uint64_t *object_identifier,
+     const uint8_t **utf8_name,
+     size_t *utf8_name_size,
      libcerror_error_t **error )
 {
-	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsrefs_file_entry_get_number_of_sub_file_entries";
-	int result                                           = 1;
-	int safe_number_of_sub_file_entries                  = 0;
+	static char *function = "libfsrefs_internal_file_entry_get_path_values";
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1046,19 +1390,108 @@ int libfsrefs_file_entry_get_number_of_sub_file_entries(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
 
-	if( number_of_sub_file_entries == NULL )
+		return( -1 );
+	}
+	if( object_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of sub file entries.",
+		 "%s: invalid object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->objects_tree == NULL )
+	 || ( internal_file_entry->objects_tree->parent_index == NULL ) )
+	{
+		return( 0 );
+	}
+	if( internal_file_entry->object_identifier != 0 )
+	{
+		*object_identifier = internal_file_entry->object_identifier;
+		*utf8_name         = NULL;
+		*utf8_name_size    = 0;
+	}
+	else if( ( internal_file_entry->directory_entry != NULL )
+	      && ( internal_file_entry->directory_entry->utf8_name != NULL ) )
+	{
+		*object_identifier = internal_file_entry->parent_object_identifier;
+		*utf8_name         = internal_file_entry->directory_entry->utf8_name;
+		*utf8_name_size    = internal_file_entry->directory_entry->utf8_name_size;
+	}
+	else
+	{
+		return( 0 );
+	}
+	*parent_index = internal_file_entry->objects_tree->parent_index;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path
+ * The path is only available after the parent index of the volume was built
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_file_entry_get_utf8_path_size(
+     libfsrefs_file_entry_t *file_entry,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsrefs_parent_index_t *parent_index               = NULL;
+	const uint8_t *utf8_name                             = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_utf8_path_size";
+	size_t utf8_name_size                                = 0;
+	uint64_t object_identifier                           = 0;
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -1074,21 +1507,41 @@ int libfsrefs_file_entry_get_number_of_sub_file_entries(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->directory_object != NULL )
+	result = libfsrefs_internal_file_entry_get_path_values(
+	          internal_file_entry,
+	          &parent_index,
+	          &object_identifier,
+	          &utf8_name,
+	          &utf8_name_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libfsrefs_directory_object_get_number_of_directory_entries(
-		     internal_file_entry->directory_object,
-		     &safe_number_of_sub_file_entries,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path values.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		result = libfsrefs_parent_index_get_utf8_path_size(
+		          parent_index,
+		          object_identifier,
+		          utf8_name,
+		          utf8_name_size,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of directory entries from directory object.",
+			 "%s: unable to retrieve size of UTF-8 path from parent index.",
 			 function );
-
-			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
@@ -1106,26 +1559,27 @@ int libfsrefs_file_entry_get_number_of_sub_file_entries(
 		return( -1 );
 	}
 #endif
-	if( result == 1 )
-	{
-		*number_of_sub_file_entries = safe_number_of_sub_file_entries;
-	}
 	return( result );
 }
 
-/* Retrieves the sub file entry for the specific index
- * Returns 1 if successful or -1 on error
+/* Retrieves the UTF-8 encoded path
+ * The path is only available after the parent index of the volume was built
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsrefs_file_entry_get_sub_file_entry_by_index(
+int libfsrefs_file_entry_get_utf8_path(
      libfsrefs_file_entry_t *file_entry,
-     int sub_file_entry_index,
-     libfsrefs_file_entry_t **sub_file_entry,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfsrefs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsrefs_file_entry_get_sub_file_entry_by_index";
-	int result                                           = 1;
+	libfsrefs_parent_index_t *parent_index               = NULL;
+	const uint8_t *utf8_name                             = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_utf8_path";
+	size_t utf8_name_size                                = 0;
+	uint64_t object_identifier                           = 0;
+	int result                                           = 0;
 
 	if( file_entry == NULL )
 	{
@@ -1140,28 +1594,6 @@ int libfsrefs_file_entry_get_sub_file_entry_by_index(
 	}
 	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
 
-	if( sub_file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *sub_file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -1177,43 +1609,42 @@ int libfsrefs_file_entry_get_sub_file_entry_by_index(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->directory_object != NULL )
+	result = libfsrefs_internal_file_entry_get_path_values(
+	          internal_file_entry,
+	          &parent_index,
+	          &object_identifier,
+	          &utf8_name,
+	          &utf8_name_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libfsrefs_directory_object_get_directory_entry_by_index(
-		     internal_file_entry->directory_object,
-		     sub_file_entry_index,
-		     &sub_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry: %d from directory object.",
-			 function,
-			 sub_file_entry_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path values.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		result = libfsrefs_parent_index_get_utf8_path(
+		          parent_index,
+		          object_identifier,
+		          utf8_name,
+		          utf8_name_size,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
 
-			result = -1;
-		}
-		/* sub_file_entry takes over management of sub_directory_entry
-		 */
-		else if( libfsrefs_file_entry_initialize(
-		          sub_file_entry,
-		          internal_file_entry->io_handle,
-		          internal_file_entry->file_io_handle,
-		          internal_file_entry->objects_tree,
-		          sub_directory_entry,
-		          error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
-
-			result = -1;
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 path from parent index.",
+			 function );
 		}
 	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
@@ -1234,3 +1665,1971 @@ int libfsrefs_file_entry_get_sub_file_entry_by_index(
 	return( result );
 }
 
+/* Retrieves the number of sub file entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_number_of_sub_file_entries(
+     libfsrefs_file_entry_t *file_entry,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_object_t *directory_object       = NULL;
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_number_of_sub_file_entries";
+	int result                                           = 1;
+	int safe_number_of_sub_file_entries                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( number_of_sub_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_internal_file_entry_get_directory_object(
+	     internal_file_entry,
+	     &directory_object,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory object.",
+		 function );
+
+		result = -1;
+	}
+	else if( directory_object != NULL )
+	{
+		if( libfsrefs_directory_object_get_number_of_directory_entries(
+		     directory_object,
+		     &safe_number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory entries from directory object.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfsrefs_internal_file_entry_release_directory_object(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release directory object.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_sub_file_entries = safe_number_of_sub_file_entries;
+	}
+	return( result );
+}
+
+/* Retrieves the sub file entry for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_sub_file_entry_by_index(
+     libfsrefs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     libfsrefs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_entry_t *safe_sub_directory_entry = NULL;
+	libfsrefs_directory_entry_t *sub_directory_entry      = NULL;
+	libfsrefs_directory_object_t *directory_object        = NULL;
+	libfsrefs_internal_file_entry_t *internal_file_entry  = NULL;
+	static char *function                                 = "libfsrefs_file_entry_get_sub_file_entry_by_index";
+	int result                                            = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_internal_file_entry_get_directory_object(
+	     internal_file_entry,
+	     &directory_object,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory object.",
+		 function );
+
+		result = -1;
+	}
+	else if( directory_object != NULL )
+	{
+		if( libfsrefs_directory_object_get_directory_entry_by_index(
+		     directory_object,
+		     sub_file_entry_index,
+		     &sub_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry: %d from directory object.",
+			 function,
+			 sub_file_entry_index );
+
+			result = -1;
+		}
+		/* The sub file entry uses a copy of the directory entry, since the directory object
+		 * can be evicted when the memory budget is exceeded
+		 */
+		else if( libfsrefs_directory_entry_clone(
+		          &safe_sub_directory_entry,
+		          sub_directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			result = -1;
+		}
+		/* sub_file_entry takes over management of safe_sub_directory_entry
+		 */
+		else if( libfsrefs_file_entry_initialize(
+		          sub_file_entry,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->objects_tree,
+		          0,
+		          safe_sub_directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			libfsrefs_directory_entry_free(
+			 &safe_sub_directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+		else
+		{
+			( (libfsrefs_internal_file_entry_t *) *sub_file_entry )->parent_object_identifier = directory_object->object_identifier;
+		}
+	}
+	if( libfsrefs_internal_file_entry_release_directory_object(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release directory object.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the default data stream (nameless $DATA attribute)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_size(
+     libfsrefs_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_size";
+	size64_t safe_size                                   = 0;
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_entry != NULL )
+	{
+		if( libfsrefs_directory_entry_get_data_size(
+		     internal_file_entry->directory_entry,
+		     &safe_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size from directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*size = safe_size;
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded names of all sub file entries
+ * The size includes the end of string character of each name
+ * Names that cannot be converted to UTF-8 are not included
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_sub_file_entries_utf8_names_size(
+     libfsrefs_file_entry_t *file_entry,
+     size_t *utf8_names_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsrefs_directory_object_t *directory_object       = NULL;
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_sub_file_entries_utf8_names_size";
+	size_t safe_utf8_names_size                          = 0;
+	size_t utf8_name_size                                = 0;
+	int number_of_sub_file_entries                       = 0;
+	int result                                           = 1;
+	int sub_file_entry_index                             = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( utf8_names_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_internal_file_entry_get_directory_object(
+	     internal_file_entry,
+	     &directory_object,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory object.",
+		 function );
+
+		result = -1;
+	}
+	else if( directory_object != NULL )
+	{
+		if( libfsrefs_directory_object_get_number_of_directory_entries(
+		     directory_object,
+		     &number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory entries from directory object.",
+			 function );
+
+			result = -1;
+		}
+		for( sub_file_entry_index = 0;
+		     ( result == 1 ) && ( sub_file_entry_index < number_of_sub_file_entries );
+		     sub_file_entry_index++ )
+		{
+			if( libfsrefs_directory_object_get_directory_entry_by_index(
+			     directory_object,
+			     sub_file_entry_index,
+			     &sub_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d from directory object.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -1;
+			}
+			else
+			{
+				/* A name that cannot be converted does not fail the directory,
+				 * instead it is not included in the names size
+				 */
+				if( libfsrefs_directory_entry_get_utf8_name_size(
+				     sub_directory_entry,
+				     &utf8_name_size,
+				     NULL ) == 1 )
+				{
+					safe_utf8_names_size += utf8_name_size;
+				}
+			}
+		}
+	}
+	if( libfsrefs_internal_file_entry_release_directory_object(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release directory object.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*utf8_names_size = safe_utf8_names_size;
+	}
+	return( result );
+}
+
+/* Retrieves the stat values of all sub file entries
+ * This function retrieves the values of the entire directory with a single lock,
+ * instead of creating a sub file entry and calling its individual getters
+ * The UTF-8 encoded names are stored consecutively in the names buffer, each with
+ * an end of string character, and referenced by the name offset and size in the stat values
+ * The name size is 0 if the name of the sub file entry cannot be converted to UTF-8
+ * Use libfsrefs_file_entry_get_number_of_sub_file_entries and
+ * libfsrefs_file_entry_get_sub_file_entries_utf8_names_size to determine the sizes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_sub_file_entries_stat(
+     libfsrefs_file_entry_t *file_entry,
+     libfsrefs_file_entry_stat_t *file_entry_stats,
+     int number_of_file_entry_stats,
+     uint8_t *utf8_names,
+     size_t utf8_names_size,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsrefs_directory_object_t *directory_object       = NULL;
+	libfsrefs_file_entry_stat_t *file_entry_stat         = NULL;
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_sub_file_entries_stat";
+	size_t utf8_name_size                                = 0;
+	size_t utf8_names_offset                             = 0;
+	int result                                           = 1;
+	int safe_number_of_sub_file_entries                  = 0;
+	int sub_file_entry_index                             = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( file_entry_stats == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry stats.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entry_stats < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of file entry stats value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 names size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_internal_file_entry_get_directory_object(
+	     internal_file_entry,
+	     &directory_object,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory object.",
+		 function );
+
+		result = -1;
+	}
+	else if( directory_object != NULL )
+	{
+		if( libfsrefs_directory_object_get_number_of_directory_entries(
+		     directory_object,
+		     &safe_number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory entries from directory object.",
+			 function );
+
+			result = -1;
+		}
+		else if( safe_number_of_sub_file_entries > number_of_file_entry_stats )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid number of file entry stats value too small.",
+			 function );
+
+			result = -1;
+		}
+		for( sub_file_entry_index = 0;
+		     ( result == 1 ) && ( sub_file_entry_index < safe_number_of_sub_file_entries );
+		     sub_file_entry_index++ )
+		{
+			file_entry_stat = &( file_entry_stats[ sub_file_entry_index ] );
+
+			if( libfsrefs_directory_object_get_directory_entry_by_index(
+			     directory_object,
+			     sub_file_entry_index,
+			     &sub_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d from directory object.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -1;
+			}
+			else if( libfsrefs_directory_entry_get_stat(
+			          sub_directory_entry,
+			          file_entry_stat,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve stat values of directory entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -1;
+			}
+			else
+			{
+				/* A name that cannot be converted does not fail the directory,
+				 * instead the name size in the stat values of the entry is 0
+				 */
+				file_entry_stat->name_offset = utf8_names_offset;
+				file_entry_stat->name_size   = 0;
+
+				if( libfsrefs_directory_entry_get_utf8_name_size(
+				     sub_directory_entry,
+				     &utf8_name_size,
+				     NULL ) != 1 )
+				{
+					utf8_name_size = 0;
+				}
+				if( utf8_name_size > ( utf8_names_size - utf8_names_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid UTF-8 names size value too small.",
+					 function );
+
+					result = -1;
+				}
+				else if( ( utf8_name_size > 0 )
+				      && ( libfsrefs_directory_entry_get_utf8_name(
+				            sub_directory_entry,
+				            &( utf8_names[ utf8_names_offset ] ),
+				            utf8_name_size,
+				            NULL ) == 1 ) )
+				{
+					file_entry_stat->name_size = utf8_name_size;
+
+					utf8_names_offset += utf8_name_size;
+				}
+			}
+		}
+	}
+	if( libfsrefs_internal_file_entry_release_directory_object(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release directory object.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_sub_file_entries = safe_number_of_sub_file_entries;
+	}
+	return( result );
+}
+
+/* Retrieves the number of attributes
+ * The attributes are read on first use, which modifies the directory entry,
+ * hence the write lock is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_number_of_attributes(
+     libfsrefs_file_entry_t *file_entry,
+     int *number_of_attributes,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_number_of_attributes";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( number_of_attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_entry == NULL )
+	{
+		*number_of_attributes = 0;
+	}
+	else if( libfsrefs_directory_entry_get_number_of_attributes(
+	          internal_file_entry->directory_entry,
+	          internal_file_entry->io_handle,
+	          number_of_attributes,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes from directory entry.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the attribute for the specific index
+ * The attribute references the file entry and must be freed before the file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_attribute_by_index(
+     libfsrefs_file_entry_t *file_entry,
+     int attribute_index,
+     libfsrefs_attribute_t **attribute,
+     libcerror_error_t **error )
+{
+	libfsrefs_attribute_values_t *attribute_values       = NULL;
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_attribute_by_index";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attribute != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid attribute value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid attribute index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsrefs_directory_entry_get_attribute_values_by_index(
+	          internal_file_entry->directory_entry,
+	          internal_file_entry->io_handle,
+	          attribute_index,
+	          &attribute_values,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values: %d from directory entry.",
+		 function,
+		 attribute_index );
+
+		result = -1;
+	}
+	/* attribute references attribute_values, which remains managed by the directory entry
+	 */
+	else if( libfsrefs_attribute_initialize(
+	          attribute,
+	          attribute_values,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attribute: %d.",
+		 function,
+		 attribute_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determines the data stream
+ * The data stream is provided by the unnamed data attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_internal_file_entry_read_data_stream(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	libfsrefs_attribute_values_t *attribute_values = NULL;
+	static char *function                          = "libfsrefs_internal_file_entry_read_data_stream";
+	int attribute_index                            = 0;
+	int number_of_attributes                       = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->data_stream_read != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_file_entry->directory_entry != NULL )
+	{
+		if( libfsrefs_directory_entry_get_number_of_attributes(
+		     internal_file_entry->directory_entry,
+		     internal_file_entry->io_handle,
+		     &number_of_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes from directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
+		{
+			if( libfsrefs_directory_entry_get_attribute_values_by_index(
+			     internal_file_entry->directory_entry,
+			     internal_file_entry->io_handle,
+			     attribute_index,
+			     &attribute_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute values: %d from directory entry.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+			if( attribute_values == NULL )
+			{
+				continue;
+			}
+			if( attribute_values->attribute_type != LIBFSREFS_ATTRIBUTE_TYPE_DATA )
+			{
+				continue;
+			}
+			/* The name of the default data attribute is empty or an end-of-string character
+			 */
+			if( ( attribute_values->name_data_size < 2 )
+			 || ( ( attribute_values->name_data[ 0 ] == 0 )
+			  &&  ( attribute_values->name_data[ 1 ] == 0 ) ) )
+			{
+				internal_file_entry->data_attribute_values = attribute_values;
+
+				break;
+			}
+		}
+	}
+	if( internal_file_entry->data_attribute_values != NULL )
+	{
+		internal_file_entry->data_size = internal_file_entry->data_attribute_values->data_size;
+
+		if( internal_file_entry->data_attribute_values->is_resident == 0 )
+		{
+			if( libfsrefs_data_block_stream_initialize_from_data_runs(
+			     &( internal_file_entry->data_block_stream ),
+			     internal_file_entry->io_handle,
+			     internal_file_entry->data_attribute_values->data_runs_array,
+			     internal_file_entry->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data block stream.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	internal_file_entry->data_stream_read = 1;
+
+	return( 1 );
+
+on_error:
+	internal_file_entry->data_attribute_values = NULL;
+	internal_file_entry->data_size             = 0;
+
+	return( -1 );
+}
+
+/* Reads data at the current offset into a buffer
+ * Holes in the data stream are read as zero bytes
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsrefs_internal_file_entry_read_buffer(
+         libfsrefs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libfsrefs_internal_file_entry_read_buffer";
+	size64_t remaining_size = 0;
+	ssize_t read_count      = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file entry - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_internal_file_entry_read_data_stream(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_file_entry->current_offset >= internal_file_entry->data_size )
+	{
+		return( 0 );
+	}
+	remaining_size = internal_file_entry->data_size - (size64_t) internal_file_entry->current_offset;
+
+	if( (size64_t) buffer_size > remaining_size )
+	{
+		buffer_size = (size_t) remaining_size;
+	}
+	if( internal_file_entry->data_block_stream == NULL )
+	{
+		/* Resident data is read from the file values without I/O
+		 */
+		if( ( internal_file_entry->data_attribute_values == NULL )
+		 || ( internal_file_entry->data_attribute_values->resident_data == NULL )
+		 || ( internal_file_entry->data_size > (size64_t) internal_file_entry->data_attribute_values->resident_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file entry - missing resident data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_file_entry->data_attribute_values->resident_data[ internal_file_entry->current_offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy resident data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) buffer_size;
+	}
+	else
+	{
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              internal_file_entry->data_block_stream,
+		              (intptr_t *) internal_file_entry->file_io_handle,
+		              buffer,
+		              buffer_size,
+		              internal_file_entry->current_offset,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data block stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file_entry->current_offset += read_count;
+
+	return( read_count );
+}
+
+/* Reads data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsrefs_file_entry_read_buffer(
+         libfsrefs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_read_buffer";
+	ssize_t read_count                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfsrefs_internal_file_entry_read_buffer(
+	              internal_file_entry,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsrefs_file_entry_read_buffer_at_offset(
+         libfsrefs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_internal_file_entry_seek_offset(
+	     internal_file_entry,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libfsrefs_internal_file_entry_read_buffer(
+		              internal_file_entry,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Seeks a certain offset in the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsrefs_internal_file_entry_seek_offset(
+         libfsrefs_internal_file_entry_t *internal_file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_internal_file_entry_seek_offset";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_internal_file_entry_read_data_stream(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_file_entry->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_file_entry->data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset in the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsrefs_file_entry_seek_offset(
+         libfsrefs_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_seek_offset";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libfsrefs_internal_file_entry_seek_offset(
+	          internal_file_entry,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_file_entry_get_offset(
+     libfsrefs_file_entry_t *file_entry,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_get_offset";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_file_entry->current_offset;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the offset of the next data or hole range at or after the offset
+ * The end of the data is considered a hole
+ * Returns 1 if successful, 0 if no such range was found or -1 on error
+ */
+int libfsrefs_internal_file_entry_get_next_range_offset(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_internal_file_entry_get_next_range_offset";
+	int result            = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_internal_file_entry_read_data_stream(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_file_entry->data_size )
+	{
+		return( 0 );
+	}
+	if( internal_file_entry->data_block_stream == NULL )
+	{
+		/* Resident data contains no holes
+		 */
+		if( is_sparse != 0 )
+		{
+			*range_offset = (off64_t) internal_file_entry->data_size;
+		}
+		else
+		{
+			*range_offset = offset;
+		}
+		return( 1 );
+	}
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          internal_file_entry->data_block_stream,
+	          internal_file_entry->data_size,
+	          offset,
+	          is_sparse,
+	          range_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next range offset from data block stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Seeks the next data at or after the offset
+ * This is similar to lseek with SEEK_DATA and sets the current offset on success
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libfsrefs_file_entry_seek_data(
+     libfsrefs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_seek_data";
+	off64_t safe_data_offset                             = 0;
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsrefs_internal_file_entry_get_next_range_offset(
+	          internal_file_entry,
+	          offset,
+	          0,
+	          &safe_data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data offset.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		internal_file_entry->current_offset = safe_data_offset;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*data_offset = safe_data_offset;
+	}
+	return( result );
+}
+
+/* Seeks the next hole at or after the offset
+ * This is similar to lseek with SEEK_HOLE and sets the current offset on success
+ * The end of the data is considered a hole
+ * Returns 1 if successful, 0 if the offset is at or beyond the end of the data or -1 on error
+ */
+int libfsrefs_file_entry_seek_hole(
+     libfsrefs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsrefs_file_entry_seek_hole";
+	off64_t safe_hole_offset                             = 0;
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+
+	if( hole_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hole offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsrefs_internal_file_entry_get_next_range_offset(
+	          internal_file_entry,
+	          offset,
+	          1,
+	          &safe_hole_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next hole offset.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		internal_file_entry->current_offset = safe_hole_offset;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*hole_offset = safe_hole_offset;
+	}
+	return( result );
+}
+
@@ -25,14 +25,19 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsrefs_attribute.h"
+#include "libfsrefs_attribute_values.h"
 #include "libfsrefs_directory_entry.h"
 #include "libfsrefs_directory_object.h"
+#include "libfsrefs_directory_object_cache.h"
 #include "libfsrefs_extern.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libbfio.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_libcthreads.h"
+#include "libfsrefs_libfdata.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_parent_index.h"
 #include "libfsrefs_types.h"
 
 #if defined( __cplusplus )
@@ -59,14 +64,50 @@ struct libfsrefs_internal_file_entry
 	 */
 	libfsrefs_directory_entry_t *directory_entry;
 
+	/* The object identifier
+	 * Only directories have an object identifier
+	 */
+	uint64_t object_identifier;
+
 	/* The directory object
+	 * This is read on demand and evicted while idle when the memory budget is exceeded
 	 */
 	libfsrefs_directory_object_t *directory_object;
 
+	/* The directory object cache
+	 * The file entry holds a reference to the directory object cache
+	 * so that it can be freed after the volume
+	 */
+	libfsrefs_directory_object_cache_t *directory_object_cache;
+
+	/* The parent object identifier
+	 */
+	uint64_t parent_object_identifier;
+
 	/* The (file) entry type
 	 */
 	uint16_t entry_type;
 
+	/* Value to indicate the data stream was read
+	 */
+	uint8_t data_stream_read;
+
+	/* The data attribute values
+	 */
+	libfsrefs_attribute_values_t *data_attribute_values;
+
+	/* The data block stream
+	 */
+	libfdata_stream_t *data_block_stream;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -79,6 +120,7 @@ int libfsrefs_file_entry_initialize(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsrefs_objects_tree_t *objects_tree,
+     uint64_t object_identifier,
      libfsrefs_directory_entry_t *directory_entry,
      libcerror_error_t **error );
 
@@ -89,10 +131,17 @@ int libfsrefs_file_entry_free(
 
 int libfsrefs_internal_file_entry_get_directory_object(
      libfsrefs_internal_file_entry_t *internal_file_entry,
-     libfsrefs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfsrefs_objects_tree_t *objects_tree,
-     libfsrefs_directory_entry_t *directory_entry,
+     libfsrefs_directory_object_t **directory_object,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_file_entry_release_directory_object(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_object_identifier(
+     libfsrefs_file_entry_t *file_entry,
+     uint64_t *object_identifier,
      libcerror_error_t **error );
 
 LIBFSREFS_EXTERN \
@@ -151,6 +200,27 @@ int libfsrefs_file_entry_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libfsrefs_internal_file_entry_get_path_values(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     libfsrefs_parent_index_t **parent_index,
+     uint64_t *object_identifier,
+     const uint8_t **utf8_name,
+     size_t *utf8_name_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_utf8_path_size(
+     libfsrefs_file_entry_t *file_entry,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_utf8_path(
+     libfsrefs_file_entry_t *file_entry,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFSREFS_EXTERN \
 int libfsrefs_file_entry_get_number_of_sub_file_entries(
      libfsrefs_file_entry_t *file_entry,
@@ -170,6 +240,100 @@ int libfsrefs_file_entry_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_sub_file_entries_utf8_names_size(
+     libfsrefs_file_entry_t *file_entry,
+     size_t *utf8_names_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_sub_file_entries_stat(
+     libfsrefs_file_entry_t *file_entry,
+     libfsrefs_file_entry_stat_t *file_entry_stats,
+     int number_of_file_entry_stats,
+     uint8_t *utf8_names,
+     size_t utf8_names_size,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_number_of_attributes(
+     libfsrefs_file_entry_t *file_entry,
+     int *number_of_attributes,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_attribute_by_index(
+     libfsrefs_file_entry_t *file_entry,
+     int attribute_index,
+     libfsrefs_attribute_t **attribute,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_file_entry_read_data_stream(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+ssize_t libfsrefs_internal_file_entry_read_buffer(
+         libfsrefs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+ssize_t libfsrefs_file_entry_read_buffer(
+         libfsrefs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+ssize_t libfsrefs_file_entry_read_buffer_at_offset(
+         libfsrefs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+off64_t libfsrefs_internal_file_entry_seek_offset(
+         libfsrefs_internal_file_entry_t *internal_file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+off64_t libfsrefs_file_entry_seek_offset(
+         libfsrefs_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_get_offset(
+     libfsrefs_file_entry_t *file_entry,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_file_entry_get_next_range_offset(
+     libfsrefs_internal_file_entry_t *internal_file_entry,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_seek_data(
+     libfsrefs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_file_entry_seek_hole(
+     libfsrefs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
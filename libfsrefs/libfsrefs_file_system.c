@@ -25,6 +25,7 @@
 
 #include "libfsrefs_block_reference.h"
 #include "libfsrefs_checkpoint.h"
+#include "libfsrefs_definitions.h"
 #include "libfsrefs_file_system.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libcerror.h"
@@ -457,6 +458,7 @@ int libfsrefs_file_system_read_container_trees(
 	     io_handle,
 	     file_io_handle,
 	     7,
+	     LIBFSREFS_NODE_TYPE_CONTAINER,
 	     &root_node,
 	     error ) != 1 )
 	{
@@ -509,6 +511,7 @@ int libfsrefs_file_system_read_container_trees(
 	     io_handle,
 	     file_io_handle,
 	     8,
+	     LIBFSREFS_NODE_TYPE_CONTAINER,
 	     &root_node,
 	     error ) != 1 )
 	{
@@ -678,6 +681,7 @@ int libfsrefs_file_system_get_ministore_tree(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      int ministore_tree_index,
+     int node_type,
      libfsrefs_ministore_node_t **root_node,
      libcerror_error_t **error )
 {
@@ -758,6 +762,7 @@ int libfsrefs_file_system_get_ministore_tree(
 	     io_handle,
 	     file_io_handle,
 	     block_reference,
+	     node_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
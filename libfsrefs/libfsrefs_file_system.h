@@ -96,6 +96,7 @@ int libfsrefs_file_system_get_ministore_tree(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      int ministore_tree_index,
+     int node_type,
      libfsrefs_ministore_node_t **root_node,
      libcerror_error_t **error );
 
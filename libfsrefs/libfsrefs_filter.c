@@ -0,0 +1,827 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_filter.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libuna.h"
+#include "libfsrefs_node_record.h"
+#include "libfsrefs_types.h"
+
+#include "fsrefs_directory_object.h"
+#include "fsrefs_ministore_tree.h"
+
+/* Creates a filter
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_initialize(
+     libfsrefs_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t *internal_filter = NULL;
+	static char *function                        = "libfsrefs_filter_initialize";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = memory_allocate_structure(
+	                   libfsrefs_internal_filter_t );
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filter,
+	     0,
+	     sizeof( libfsrefs_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	*filter = (libfsrefs_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a filter
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_free(
+     libfsrefs_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t *internal_filter = NULL;
+	static char *function                        = "libfsrefs_filter_free";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		internal_filter = (libfsrefs_internal_filter_t *) *filter;
+		*filter         = NULL;
+
+		if( internal_filter->name_pattern != NULL )
+		{
+			memory_free(
+			 internal_filter->name_pattern );
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( 1 );
+}
+
+/* Sets the name pattern
+ * Any existing name pattern is replaced, an empty pattern removes the name pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_internal_filter_set_name_pattern(
+     libfsrefs_internal_filter_t *internal_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint16_t *name_pattern = NULL;
+	static char *function  = "libfsrefs_internal_filter_set_name_pattern";
+	size_t pattern_index   = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf16_string_length > 0 )
+	    && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length--;
+	}
+	if( utf16_string_length > 0 )
+	{
+		name_pattern = (uint16_t *) memory_allocate(
+		                             sizeof( uint16_t ) * utf16_string_length );
+
+		if( name_pattern == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name pattern.",
+			 function );
+
+			return( -1 );
+		}
+		for( pattern_index = 0;
+		     pattern_index < utf16_string_length;
+		     pattern_index++ )
+		{
+			name_pattern[ pattern_index ] = utf16_string[ pattern_index ];
+
+			if( ( name_pattern[ pattern_index ] >= (uint16_t) 'a' )
+			 && ( name_pattern[ pattern_index ] <= (uint16_t) 'z' ) )
+			{
+				name_pattern[ pattern_index ] -= (uint16_t) 'a' - (uint16_t) 'A';
+			}
+		}
+	}
+	if( internal_filter->name_pattern != NULL )
+	{
+		memory_free(
+		 internal_filter->name_pattern );
+	}
+	internal_filter->name_pattern        = name_pattern;
+	internal_filter->name_pattern_length = utf16_string_length;
+	internal_filter->has_name_pattern    = (uint8_t) ( utf16_string_length > 0 );
+
+	return( 1 );
+}
+
+/* Sets the name pattern from an UTF-8 encoded string
+ * The pattern supports the wildcards: '*' that matches zero or more characters
+ * and '?' that matches a single character. Matching is case-insensitive for ASCII characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_set_utf8_name_pattern(
+     libfsrefs_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t *internal_filter = NULL;
+	uint16_t *utf16_string                       = NULL;
+	static char *function                        = "libfsrefs_filter_set_utf8_name_pattern";
+	size_t utf16_string_size                     = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfsrefs_internal_filter_t *) filter;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == 0 )
+	{
+		if( internal_filter->name_pattern != NULL )
+		{
+			memory_free(
+			 internal_filter->name_pattern );
+
+			internal_filter->name_pattern = NULL;
+		}
+		internal_filter->name_pattern_length = 0;
+		internal_filter->has_name_pattern    = 0;
+
+		return( 1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_string = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * utf16_string_size );
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_internal_filter_set_name_pattern(
+	     internal_filter,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name pattern.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_string );
+
+	return( 1 );
+
+on_error:
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( -1 );
+}
+
+/* Sets the name pattern from an UTF-16 encoded string
+ * The pattern supports the wildcards: '*' that matches zero or more characters
+ * and '?' that matches a single character. Matching is case-insensitive for ASCII characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_set_utf16_name_pattern(
+     libfsrefs_filter_t *filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_filter_set_utf16_name_pattern";
+
+	if( libfsrefs_internal_filter_set_name_pattern(
+	     (libfsrefs_internal_filter_t *) filter,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the creation date and time range
+ * The range is inclusive and both values contain a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_set_creation_time_range(
+     libfsrefs_filter_t *filter,
+     uint64_t start_time,
+     uint64_t end_time,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t *internal_filter = NULL;
+	static char *function                        = "libfsrefs_filter_set_creation_time_range";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfsrefs_internal_filter_t *) filter;
+
+	if( start_time > end_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->creation_time_start     = start_time;
+	internal_filter->creation_time_end       = end_time;
+	internal_filter->has_creation_time_range = 1;
+
+	return( 1 );
+}
+
+/* Sets the modification date and time range
+ * The range is inclusive and both values contain a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_set_modification_time_range(
+     libfsrefs_filter_t *filter,
+     uint64_t start_time,
+     uint64_t end_time,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t *internal_filter = NULL;
+	static char *function                        = "libfsrefs_filter_set_modification_time_range";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfsrefs_internal_filter_t *) filter;
+
+	if( start_time > end_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->modification_time_start     = start_time;
+	internal_filter->modification_time_end       = end_time;
+	internal_filter->has_modification_time_range = 1;
+
+	return( 1 );
+}
+
+/* Sets the file attribute flags
+ * A file entry matches if all the required flags are set and none of the excluded flags
+ * Directories are considered to have the LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY flag set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_filter_set_file_attribute_flags(
+     libfsrefs_filter_t *filter,
+     uint32_t required_flags,
+     uint32_t excluded_flags,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t *internal_filter = NULL;
+	static char *function                        = "libfsrefs_filter_set_file_attribute_flags";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfsrefs_internal_filter_t *) filter;
+
+	if( ( required_flags & excluded_flags ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_CONFLICTING_VALUE,
+		 "%s: invalid excluded flags value conflicts with required flags.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->required_file_attribute_flags = required_flags;
+	internal_filter->excluded_file_attribute_flags = excluded_flags;
+
+	return( 1 );
+}
+
+/* Determines if an UTF-16 little-endian stream matches the name pattern
+ * The name is matched without conversion, the wildcard '?' matches a single UTF-16 code unit
+ * Returns 1 if the name matches, 0 if not or -1 on error
+ */
+int libfsrefs_internal_filter_match_name(
+     libfsrefs_internal_filter_t *internal_filter,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsrefs_internal_filter_match_name";
+	size_t name_index          = 0;
+	size_t name_length         = 0;
+	size_t pattern_index       = 0;
+	size_t star_name_index     = 0;
+	size_t star_pattern_index  = 0;
+	uint16_t name_character    = 0;
+	uint16_t pattern_character = 0;
+	uint8_t has_star           = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->has_name_pattern == 0 )
+	{
+		return( 1 );
+	}
+	name_length = utf16_stream_size / 2;
+
+	/* The pattern is matched with backtracking to the last '*' wildcard,
+	 * which requires no recursion and no additional memory
+	 */
+	while( name_index < name_length )
+	{
+		if( pattern_index < internal_filter->name_pattern_length )
+		{
+			pattern_character = internal_filter->name_pattern[ pattern_index ];
+
+			if( pattern_character == (uint16_t) '*' )
+			{
+				star_pattern_index = pattern_index;
+				star_name_index    = name_index;
+				has_star           = 1;
+
+				pattern_index++;
+
+				continue;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ name_index * 2 ] ),
+			 name_character );
+
+			if( ( name_character >= (uint16_t) 'a' )
+			 && ( name_character <= (uint16_t) 'z' ) )
+			{
+				name_character -= (uint16_t) 'a' - (uint16_t) 'A';
+			}
+			if( ( pattern_character == (uint16_t) '?' )
+			 || ( pattern_character == name_character ) )
+			{
+				pattern_index++;
+				name_index++;
+
+				continue;
+			}
+		}
+		if( has_star == 0 )
+		{
+			return( 0 );
+		}
+		star_name_index++;
+
+		pattern_index = star_pattern_index + 1;
+		name_index    = star_name_index;
+	}
+	while( ( pattern_index < internal_filter->name_pattern_length )
+	    && ( internal_filter->name_pattern[ pattern_index ] == (uint16_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	if( pattern_index < internal_filter->name_pattern_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if a directory node record matches the filter
+ * The values are read directly from the record data, which allows records
+ * to be skipped before any directory entry is created. Records of which the
+ * values cannot be determined are considered to match, their values are
+ * validated when the directory entry is read
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libfsrefs_internal_filter_match_node_record(
+     libfsrefs_internal_filter_t *internal_filter,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error )
+{
+	const uint8_t *values_data    = NULL;
+	static char *function         = "libfsrefs_internal_filter_match_node_record";
+	size_t values_data_offset     = 0;
+	uint64_t creation_time        = 0;
+	uint64_t modification_time    = 0;
+	uint32_t file_attribute_flags = 0;
+	uint32_t node_header_offset   = 0;
+	uint16_t entry_type           = 0;
+	int result                    = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_record->key_data == NULL )
+	 || ( node_record->key_data_size < 6 ) )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( node_record->key_data[ 2 ] ),
+	 entry_type );
+
+	result = libfsrefs_internal_filter_match_name(
+	          internal_filter,
+	          &( node_record->key_data[ 4 ] ),
+	          node_record->key_data_size - 4,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to match name.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_filter->has_creation_time_range == 0 )
+	 && ( internal_filter->has_modification_time_range == 0 )
+	 && ( internal_filter->required_file_attribute_flags == 0 )
+	 && ( internal_filter->excluded_file_attribute_flags == 0 ) )
+	{
+		return( 1 );
+	}
+	if( node_record->value_data == NULL )
+	{
+		return( 1 );
+	}
+	if( entry_type == 1 )
+	{
+		/* The file values are stored in the header data of an embedded ministore node
+		 */
+		if( node_record->value_data_size < 4 )
+		{
+			return( 1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 node_record->value_data,
+		 node_header_offset );
+
+		values_data_offset = 4 + sizeof( fsrefs_ministore_tree_header_t );
+
+		if( ( (size_t) node_header_offset != ( values_data_offset + sizeof( fsrefs_file_values_t ) ) )
+		 || ( (size_t) node_header_offset > node_record->value_data_size ) )
+		{
+			return( 1 );
+		}
+		values_data = &( node_record->value_data[ values_data_offset ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_file_values_t *) values_data )->creation_time,
+		 creation_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_file_values_t *) values_data )->modification_time,
+		 modification_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsrefs_file_values_t *) values_data )->file_attribute_flags,
+		 file_attribute_flags );
+	}
+	else if( entry_type == 2 )
+	{
+		if( node_record->value_data_size != sizeof( fsrefs_directory_values_t ) )
+		{
+			return( 1 );
+		}
+		values_data = node_record->value_data;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_directory_values_t *) values_data )->creation_time,
+		 creation_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_directory_values_t *) values_data )->modification_time,
+		 modification_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsrefs_directory_values_t *) values_data )->file_attribute_flags,
+		 file_attribute_flags );
+
+		file_attribute_flags |= LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY;
+	}
+	if( internal_filter->has_creation_time_range != 0 )
+	{
+		if( ( creation_time < internal_filter->creation_time_start )
+		 || ( creation_time > internal_filter->creation_time_end ) )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_filter->has_modification_time_range != 0 )
+	{
+		if( ( modification_time < internal_filter->modification_time_start )
+		 || ( modification_time > internal_filter->modification_time_end ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( file_attribute_flags & internal_filter->required_file_attribute_flags ) != internal_filter->required_file_attribute_flags )
+	{
+		return( 0 );
+	}
+	if( ( file_attribute_flags & internal_filter->excluded_file_attribute_flags ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
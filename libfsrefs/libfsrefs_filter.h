@@ -0,0 +1,159 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_FILTER_H )
+#define _LIBFSREFS_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_extern.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_node_record.h"
+#include "libfsrefs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_internal_filter libfsrefs_internal_filter_t;
+
+struct libfsrefs_internal_filter
+{
+	/* The name pattern
+	 * Contains UTF-16 characters, without end-of-string character, where
+	 * the ASCII lower case characters are converted to upper case
+	 */
+	uint16_t *name_pattern;
+
+	/* The name pattern length
+	 */
+	size_t name_pattern_length;
+
+	/* The creation date and time range start
+	 * Contains a FILETIME
+	 */
+	uint64_t creation_time_start;
+
+	/* The creation date and time range end
+	 * Contains a FILETIME
+	 */
+	uint64_t creation_time_end;
+
+	/* The modification date and time range start
+	 * Contains a FILETIME
+	 */
+	uint64_t modification_time_start;
+
+	/* The modification date and time range end
+	 * Contains a FILETIME
+	 */
+	uint64_t modification_time_end;
+
+	/* The file attribute flags that are required to be set
+	 */
+	uint32_t required_file_attribute_flags;
+
+	/* The file attribute flags that are required to be not set
+	 */
+	uint32_t excluded_file_attribute_flags;
+
+	/* Value to indicate the name pattern is set
+	 */
+	uint8_t has_name_pattern;
+
+	/* Value to indicate the creation date and time range is set
+	 */
+	uint8_t has_creation_time_range;
+
+	/* Value to indicate the modification date and time range is set
+	 */
+	uint8_t has_modification_time_range;
+};
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_initialize(
+     libfsrefs_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_free(
+     libfsrefs_filter_t **filter,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_filter_set_name_pattern(
+     libfsrefs_internal_filter_t *internal_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_set_utf8_name_pattern(
+     libfsrefs_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_set_utf16_name_pattern(
+     libfsrefs_filter_t *filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_set_creation_time_range(
+     libfsrefs_filter_t *filter,
+     uint64_t start_time,
+     uint64_t end_time,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_set_modification_time_range(
+     libfsrefs_filter_t *filter,
+     uint64_t start_time,
+     uint64_t end_time,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_filter_set_file_attribute_flags(
+     libfsrefs_filter_t *filter,
+     uint32_t required_flags,
+     uint32_t excluded_flags,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_filter_match_name(
+     libfsrefs_internal_filter_t *internal_filter,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_filter_match_node_record(
+     libfsrefs_internal_filter_t *internal_filter,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_FILTER_H ) */
+
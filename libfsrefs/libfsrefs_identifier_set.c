@@ -0,0 +1,385 @@
+/*
+ * Identifier set functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_identifier_set.h"
+#include "libfsrefs_libcerror.h"
+
+/* Retrieves the index of the first slot to probe for a slot value
+ * Uses Fibonacci hashing so that identifiers, which are mostly sequential,
+ * are spread over all the slots
+ */
+#define libfsrefs_identifier_set_get_slot_index( slot_value, slot_index_bits ) \
+	(int) ( ( (uint64_t) ( slot_value ) * 0x9e3779b97f4a7c15UL ) >> ( 64 - ( slot_index_bits ) ) )
+
+/* Creates a identifier set
+ * Make sure the value identifier_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_identifier_set_initialize(
+     libfsrefs_identifier_set_t **identifier_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_identifier_set_initialize";
+
+	if( identifier_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier_set = memory_allocate_structure(
+	              libfsrefs_identifier_set_t );
+
+	if( *identifier_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *identifier_set,
+	     0,
+	     sizeof( libfsrefs_identifier_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *identifier_set != NULL )
+	{
+		memory_free(
+		 *identifier_set );
+
+		*identifier_set = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a identifier set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_identifier_set_free(
+     libfsrefs_identifier_set_t **identifier_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_identifier_set_free";
+
+	if( identifier_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_set != NULL )
+	{
+		if( ( *identifier_set )->slots != NULL )
+		{
+			memory_free(
+			 ( *identifier_set )->slots );
+		}
+		memory_free(
+		 *identifier_set );
+
+		*identifier_set = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the slots of a identifier set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_identifier_set_resize(
+     libfsrefs_identifier_set_t *identifier_set,
+     uint8_t slot_index_bits,
+     libcerror_error_t **error )
+{
+	uint64_t *slots       = NULL;
+	static char *function = "libfsrefs_identifier_set_resize";
+	size_t slots_size     = 0;
+	int number_of_slots   = 0;
+	int slot_index        = 0;
+	int old_slot_index    = 0;
+
+	if( identifier_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index_bits == 0 )
+	 || ( slot_index_bits > 30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_slots = (int) 1 << slot_index_bits;
+
+	if( number_of_slots <= identifier_set->number_of_identifiers )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid slot index bits value too small.",
+		 function );
+
+		return( -1 );
+	}
+	slots_size = sizeof( uint64_t ) * (size_t) number_of_slots;
+
+	if( slots_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid slots size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (uint64_t *) memory_allocate(
+	                      slots_size );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     slots_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	if( identifier_set->slots != NULL )
+	{
+		for( old_slot_index = 0;
+		     old_slot_index < identifier_set->number_of_slots;
+		     old_slot_index++ )
+		{
+			if( identifier_set->slots[ old_slot_index ] == 0 )
+			{
+				continue;
+			}
+			slot_index = libfsrefs_identifier_set_get_slot_index(
+			              identifier_set->slots[ old_slot_index ],
+			              slot_index_bits );
+
+			while( slots[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+			}
+			slots[ slot_index ] = identifier_set->slots[ old_slot_index ];
+		}
+		memory_free(
+		 identifier_set->slots );
+	}
+	identifier_set->slots           = slots;
+	identifier_set->number_of_slots = number_of_slots;
+	identifier_set->slot_index_bits = slot_index_bits;
+
+	return( 1 );
+}
+
+/* Inserts an identifier into the identifier set
+ * The slots are allocated on the first insert and are resized when more than 3/4 of them are used
+ * Returns 1 if successful, 0 if the identifier already was in the set or -1 on error
+ */
+int libfsrefs_identifier_set_insert(
+     libfsrefs_identifier_set_t *identifier_set,
+     uint64_t identifier,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsrefs_identifier_set_insert";
+	uint8_t slot_index_bits = 0;
+	int slot_index          = 0;
+
+	if( identifier_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier set.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == 0 )
+	{
+		if( identifier_set->has_zero_identifier != 0 )
+		{
+			return( 0 );
+		}
+		identifier_set->has_zero_identifier = 1;
+
+		identifier_set->number_of_identifiers += 1;
+
+		return( 1 );
+	}
+	if( ( (size_t) identifier_set->number_of_identifiers + 1 ) * 4 > (size_t) identifier_set->number_of_slots * 3 )
+	{
+		if( identifier_set->slot_index_bits == 0 )
+		{
+			slot_index_bits = 6;
+		}
+		else
+		{
+			slot_index_bits = identifier_set->slot_index_bits + 1;
+		}
+		if( libfsrefs_identifier_set_resize(
+		     identifier_set,
+		     slot_index_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	slot_index = libfsrefs_identifier_set_get_slot_index(
+	              identifier,
+	              identifier_set->slot_index_bits );
+
+	while( identifier_set->slots[ slot_index ] != 0 )
+	{
+		if( identifier_set->slots[ slot_index ] == identifier )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & ( identifier_set->number_of_slots - 1 );
+	}
+	identifier_set->slots[ slot_index ] = identifier;
+
+	identifier_set->number_of_identifiers += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_identifier_set_get_number_of_identifiers(
+     libfsrefs_identifier_set_t *identifier_set,
+     int *number_of_identifiers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_identifier_set_get_number_of_identifiers";
+
+	if( identifier_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_identifiers = identifier_set->number_of_identifiers;
+
+	return( 1 );
+}
+
@@ -0,0 +1,90 @@
+/*
+ * Identifier set functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_IDENTIFIER_SET_H )
+#define _LIBFSREFS_IDENTIFIER_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_identifier_set libfsrefs_identifier_set_t;
+
+struct libfsrefs_identifier_set
+{
+	/* The slots
+	 * Contains the identifiers in the set, where 0 represents an empty slot
+	 */
+	uint64_t *slots;
+
+	/* The number of slots
+	 * This is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of bits of the slot index
+	 */
+	uint8_t slot_index_bits;
+
+	/* The number of identifiers
+	 */
+	int number_of_identifiers;
+
+	/* Value to indicate the identifier 0 is in the set
+	 * This identifier is not stored in the slots
+	 */
+	uint8_t has_zero_identifier;
+};
+
+int libfsrefs_identifier_set_initialize(
+     libfsrefs_identifier_set_t **identifier_set,
+     libcerror_error_t **error );
+
+int libfsrefs_identifier_set_free(
+     libfsrefs_identifier_set_t **identifier_set,
+     libcerror_error_t **error );
+
+int libfsrefs_identifier_set_resize(
+     libfsrefs_identifier_set_t *identifier_set,
+     uint8_t slot_index_bits,
+     libcerror_error_t **error );
+
+int libfsrefs_identifier_set_insert(
+     libfsrefs_identifier_set_t *identifier_set,
+     uint64_t identifier,
+     libcerror_error_t **error );
+
+int libfsrefs_identifier_set_get_number_of_identifiers(
+     libfsrefs_identifier_set_t *identifier_set,
+     int *number_of_identifiers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_IDENTIFIER_SET_H ) */
+
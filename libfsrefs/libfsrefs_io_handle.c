@@ -23,9 +23,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsrefs_block_reference.h"
+#include "libfsrefs_directory_object_cache.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libcerror.h"
+#include "libfsrefs_memory_budget.h"
+#include "libfsrefs_metadata_block_header.h"
 
+#include "fsrefs_metadata_block.h"
 #include "fsrefs_volume_header.h"
 
 const char fsrefs_volume_file_system_signature[ 8 ] = {
@@ -39,7 +44,8 @@ int libfsrefs_io_handle_initialize(
      libfsrefs_io_handle_t **io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsrefs_io_handle_initialize";
+	libfsrefs_memory_budget_t *process_memory_budget = NULL;
+	static char *function                            = "libfsrefs_io_handle_initialize";
 
 	if( io_handle == NULL )
 	{
@@ -91,11 +97,58 @@ int libfsrefs_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( libfsrefs_memory_budget_get_process_memory_budget(
+	     &process_memory_budget,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve process memory budget.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_memory_budget_initialize(
+	     &( ( *io_handle )->memory_budget ),
+	     process_memory_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory budget.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_directory_object_cache_initialize(
+	     &( ( *io_handle )->directory_object_cache ),
+	     ( *io_handle )->memory_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory object cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->memory_budget != NULL )
+		{
+			libfsrefs_memory_budget_free(
+			 &( ( *io_handle )->memory_budget ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -127,6 +180,32 @@ int libfsrefs_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libfsrefs_directory_object_cache_free(
+		     &( ( *io_handle )->directory_object_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory object cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsrefs_memory_budget_free(
+		     &( ( *io_handle )->memory_budget ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory budget.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -142,7 +221,18 @@ int libfsrefs_io_handle_clear(
      libfsrefs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsrefs_io_handle_clear";
+	void (*trace_callback)(
+	       int event_type,
+	       int node_type,
+	       off64_t offset,
+	       size64_t size,
+	       uint64_t duration,
+	       intptr_t *user_data ) = NULL;
+
+	libfsrefs_directory_object_cache_t *directory_object_cache = NULL;
+	libfsrefs_memory_budget_t *memory_budget                   = NULL;
+	static char *function                                      = "libfsrefs_io_handle_clear";
+	intptr_t *trace_user_data                                  = NULL;
 
 	if( io_handle == NULL )
 	{
@@ -155,6 +245,15 @@ int libfsrefs_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The trace callback is set by the caller and is retained, as are the memory budget
+	 * and the directory object cache since directory objects allocated from them can
+	 * outlive the volume being opened
+	 */
+	trace_callback         = io_handle->trace_callback;
+	trace_user_data        = io_handle->trace_user_data;
+	memory_budget          = io_handle->memory_budget;
+	directory_object_cache = io_handle->directory_object_cache;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -169,6 +268,129 @@ int libfsrefs_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->trace_callback         = trace_callback;
+	io_handle->trace_user_data        = trace_user_data;
+	io_handle->memory_budget          = memory_budget;
+	io_handle->directory_object_cache = directory_object_cache;
+
+	return( 1 );
+}
+
+/* Sets the format version
+ * This binds the format version specific layout values and read functions once,
+ * so that these do not need to be determined for every metadata block and record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_io_handle_set_format_version(
+     libfsrefs_io_handle_t *io_handle,
+     uint8_t major_format_version,
+     uint8_t minor_format_version,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_io_handle_set_format_version";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_format_version == 1 )
+	{
+		io_handle->metadata_block_header_size = sizeof( fsrefs_metadata_block_header_v1_t );
+		io_handle->block_reference_size       = sizeof( fsrefs_metadata_block_reference_v1_t );
+		io_handle->record_data_offset_mask    = 0xffffffffUL;
+		io_handle->read_metadata_block_header = &libfsrefs_metadata_block_header_read_data_v1;
+		io_handle->read_block_reference       = &libfsrefs_block_reference_read_data_v1;
+	}
+	else if( major_format_version == 3 )
+	{
+		io_handle->metadata_block_header_size = sizeof( fsrefs_metadata_block_header_v3_t );
+		io_handle->block_reference_size       = sizeof( fsrefs_metadata_block_reference_v3_t );
+		io_handle->record_data_offset_mask    = 0x0000ffffUL;
+		io_handle->read_metadata_block_header = &libfsrefs_metadata_block_header_read_data_v3;
+		io_handle->read_block_reference       = &libfsrefs_block_reference_read_data_v3;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu8 ".%" PRIu8 ".",
+		 function,
+		 major_format_version,
+		 minor_format_version );
+
+		return( -1 );
+	}
+	io_handle->major_format_version = major_format_version;
+	io_handle->minor_format_version = minor_format_version;
+
+	return( 1 );
+}
+
+/* Sets the trace callback function
+ * The callback is invoked for node reads, directory object reads, objects tree lookups and data reads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_io_handle_set_trace_callback(
+     libfsrefs_io_handle_t *io_handle,
+     void (*trace_callback)(
+            int event_type,
+            int node_type,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_io_handle_set_trace_callback";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->trace_callback  = trace_callback;
+	io_handle->trace_user_data = user_data;
+
 	return( 1 );
 }
 
+/* Signals a trace event to the trace callback function, if set
+ */
+void libfsrefs_io_handle_trace_event(
+      libfsrefs_io_handle_t *io_handle,
+      int event_type,
+      int node_type,
+      off64_t offset,
+      size64_t size,
+      uint64_t duration )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->trace_callback == NULL ) )
+	{
+		return;
+	}
+	io_handle->trace_callback(
+	 event_type,
+	 node_type,
+	 offset,
+	 size,
+	 duration,
+	 io_handle->trace_user_data );
+}
+
@@ -25,7 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsrefs_directory_object_cache.h"
 #include "libfsrefs_libcerror.h"
+#include "libfsrefs_memory_budget.h"
+#include "libfsrefs_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -33,6 +36,9 @@ extern "C" {
 
 extern const char fsrefs_volume_file_system_signature[ 8 ];
 
+struct libfsrefs_block_reference;
+struct libfsrefs_metadata_block_header;
+
 typedef struct libfsrefs_io_handle libfsrefs_io_handle_t;
 
 struct libfsrefs_io_handle
@@ -65,9 +71,69 @@ struct libfsrefs_io_handle
 	 */
 	size64_t container_size;
 
+	/* The metadata block header size
+	 * This value is set together with the format version
+	 */
+	size_t metadata_block_header_size;
+
+	/* The block reference size
+	 * This value is set together with the format version
+	 */
+	size_t block_reference_size;
+
+	/* The ministore node record data offset mask
+	 * This value is set together with the format version
+	 */
+	uint32_t record_data_offset_mask;
+
+	/* The format version specific read metadata block header function
+	 */
+	int (*read_metadata_block_header)(
+	       struct libfsrefs_metadata_block_header *metadata_block_header,
+	       const uint8_t *data,
+	       size_t data_size,
+	       libcerror_error_t **error );
+
+	/* The format version specific read block reference function
+	 */
+	int (*read_block_reference)(
+	       struct libfsrefs_block_reference *block_reference,
+	       const uint8_t *data,
+	       size_t data_size,
+	       libcerror_error_t **error );
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The statistics
+	 */
+	libfsrefs_statistics_t statistics;
+
+	/* The memory budget
+	 * This is reference counted since directory objects can outlive the IO handle
+	 */
+	libfsrefs_memory_budget_t *memory_budget;
+
+	/* The directory object cache
+	 * Contains the directory objects of file entries that are not in use
+	 * This is reference counted since file entries can outlive the IO handle
+	 */
+	libfsrefs_directory_object_cache_t *directory_object_cache;
+
+	/* The trace callback function
+	 */
+	void (*trace_callback)(
+	       int event_type,
+	       int node_type,
+	       off64_t offset,
+	       size64_t size,
+	       uint64_t duration,
+	       intptr_t *user_data );
+
+	/* The trace callback user data
+	 */
+	intptr_t *trace_user_data;
 };
 
 int libfsrefs_io_handle_initialize(
@@ -82,6 +148,32 @@ int libfsrefs_io_handle_clear(
      libfsrefs_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libfsrefs_io_handle_set_format_version(
+     libfsrefs_io_handle_t *io_handle,
+     uint8_t major_format_version,
+     uint8_t minor_format_version,
+     libcerror_error_t **error );
+
+int libfsrefs_io_handle_set_trace_callback(
+     libfsrefs_io_handle_t *io_handle,
+     void (*trace_callback)(
+            int event_type,
+            int node_type,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+void libfsrefs_io_handle_trace_event(
+      libfsrefs_io_handle_t *io_handle,
+      int event_type,
+      int node_type,
+      off64_t offset,
+      size64_t size,
+      uint64_t duration );
+
 #if defined( __cplusplus )
 }
 #endif
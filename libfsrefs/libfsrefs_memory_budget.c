@@ -0,0 +1,954 @@
+/*
+ * Memory budget functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_memory_budget.h"
+#include "libfsrefs_static_mutex.h"
+
+/* The process-wide memory budget
+ * This is created when the process-wide maximum size is first set and
+ * is freed when the library is unloaded
+ */
+static libfsrefs_memory_budget_t *libfsrefs_process_memory_budget = NULL;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+/* The mutex that guards the creation and freeing of the process-wide memory budget
+ * A separate mutex from the open pool is used since volumes opened by the open pool
+ * retrieve the process-wide memory budget
+ */
+static libfsrefs_static_mutex_t libfsrefs_process_memory_budget_mutex = LIBFSREFS_STATIC_MUTEX_INITIALIZER;
+
+#endif
+
+/* Creates a memory budget
+ * Make sure the value memory_budget is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_initialize(
+     libfsrefs_memory_budget_t **memory_budget,
+     libfsrefs_memory_budget_t *parent_memory_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_initialize";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_budget != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory budget value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_budget = memory_allocate_structure(
+	                  libfsrefs_memory_budget_t );
+
+	if( *memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory budget.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_budget,
+	     0,
+	     sizeof( libfsrefs_memory_budget_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory budget.",
+		 function );
+
+		memory_free(
+		 *memory_budget );
+
+		*memory_budget = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *memory_budget )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *memory_budget )->parent_memory_budget = parent_memory_budget;
+	( *memory_budget )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *memory_budget != NULL )
+	{
+		memory_free(
+		 *memory_budget );
+
+		*memory_budget = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory budget
+ * This frees a reference, the memory budget is freed when the last reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_free(
+     libfsrefs_memory_budget_t **memory_budget,
+     libcerror_error_t **error )
+{
+	libfsrefs_memory_budget_t *safe_memory_budget = NULL;
+	static char *function                         = "libfsrefs_memory_budget_free";
+	int number_of_references                      = 0;
+	int result                                    = 1;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_budget != NULL )
+	{
+		safe_memory_budget = *memory_budget;
+		*memory_budget     = NULL;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     safe_memory_budget->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_memory_budget->number_of_references -= 1;
+
+		number_of_references = safe_memory_budget->number_of_references;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     safe_memory_budget->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			return( 1 );
+		}
+		/* The parent_memory_budget reference is freed elsewhere
+		 */
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( safe_memory_budget->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 safe_memory_budget );
+	}
+	return( result );
+}
+
+/* Adds a reference to the memory budget
+ * Every reference must be freed with libfsrefs_memory_budget_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_add_reference(
+     libfsrefs_memory_budget_t *memory_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_add_reference";
+	int result            = 1;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_budget->number_of_references >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid memory budget - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		memory_budget->number_of_references += 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_get_maximum_size(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t *maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_get_maximum_size";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_size = memory_budget->maximum_size;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum size
+ * A value of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_set_maximum_size(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_set_maximum_size";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	memory_budget->maximum_size = maximum_size;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the current size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_get_current_size(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t *current_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_get_current_size";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*current_size = memory_budget->current_size;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Allocates a size from the memory budget and its parent
+ * The allocation is accounted even if the maximum size is exceeded, use
+ * libfsrefs_memory_budget_is_exceeded to determine if cached data should be released
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_allocate(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_allocate";
+	int result            = 1;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( size > ( (size64_t) UINT64_MAX - memory_budget->current_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		memory_budget->current_size += size;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( result == 1 )
+	 && ( memory_budget->parent_memory_budget != NULL ) )
+	{
+		if( libfsrefs_memory_budget_allocate(
+		     memory_budget->parent_memory_budget,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to allocate size from parent memory budget.",
+			 function );
+
+			libfsrefs_memory_budget_release(
+			 memory_budget,
+			 size,
+			 NULL );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Releases a size from the memory budget and its parent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_release(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_release";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( size > memory_budget->current_size )
+	{
+		memory_budget->current_size = 0;
+	}
+	else
+	{
+		memory_budget->current_size -= size;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_budget->parent_memory_budget != NULL )
+	{
+		if( libfsrefs_memory_budget_release(
+		     memory_budget->parent_memory_budget,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release size from parent memory budget.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the maximum size of the memory budget or its parent is exceeded
+ * Returns 1 if exceeded, 0 if not or -1 on error
+ */
+int libfsrefs_memory_budget_is_exceeded(
+     libfsrefs_memory_budget_t *memory_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_is_exceeded";
+	int result            = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( memory_budget->maximum_size != 0 )
+	 && ( memory_budget->current_size > memory_budget->maximum_size ) )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( result == 0 )
+	 && ( memory_budget->parent_memory_budget != NULL ) )
+	{
+		result = libfsrefs_memory_budget_is_exceeded(
+		          memory_budget->parent_memory_budget,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if parent memory budget is exceeded.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the process-wide memory budget
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_memory_budget_get_process_memory_budget(
+     libfsrefs_memory_budget_t **memory_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_get_process_memory_budget";
+	int result            = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_process_memory_budget_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab process memory budget mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_process_memory_budget != NULL )
+	{
+		*memory_budget = libfsrefs_process_memory_budget;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_process_memory_budget_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release process memory budget mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum size of the process-wide memory budget
+ * The process-wide memory budget is created on first use. Only volumes that
+ * are created after it was created allocate from the process-wide memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_set_process_maximum_size(
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_set_process_maximum_size";
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_process_memory_budget_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab process memory budget mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_process_memory_budget == NULL )
+	{
+		if( maximum_size == 0 )
+		{
+			goto on_success;
+		}
+		if( libfsrefs_memory_budget_initialize(
+		     &libfsrefs_process_memory_budget,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create process memory budget.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsrefs_memory_budget_set_maximum_size(
+	     libfsrefs_process_memory_budget,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set process memory budget maximum size.",
+		 function );
+
+		goto on_error;
+	}
+on_success:
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_process_memory_budget_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release process memory budget mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	libfsrefs_static_mutex_release(
+	 &libfsrefs_process_memory_budget_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Frees the process-wide memory budget
+ * This is called when the library is unloaded, after which no volume may
+ * reference the process-wide memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_memory_budget_free_process_memory_budget(
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_memory_budget_free_process_memory_budget";
+	int result            = 1;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_process_memory_budget_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab process memory budget mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_process_memory_budget != NULL )
+	{
+		if( libfsrefs_memory_budget_free(
+		     &libfsrefs_process_memory_budget,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free process memory budget.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_process_memory_budget_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release process memory budget mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
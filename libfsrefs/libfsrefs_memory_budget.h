@@ -0,0 +1,124 @@
+/*
+ * Memory budget functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSREFS_MEMORY_BUDGET_H )
+#define _LIBFSREFS_MEMORY_BUDGET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_memory_budget libfsrefs_memory_budget_t;
+
+struct libfsrefs_memory_budget
+{
+	/* The maximum size
+	 * A value of 0 represents no limit
+	 */
+	size64_t maximum_size;
+
+	/* The current size
+	 */
+	size64_t current_size;
+
+	/* The parent memory budget
+	 * Sizes allocated from the budget are also allocated from the parent
+	 */
+	libfsrefs_memory_budget_t *parent_memory_budget;
+
+	/* The number of references
+	 * The memory budget is freed when the last reference is freed
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsrefs_memory_budget_initialize(
+     libfsrefs_memory_budget_t **memory_budget,
+     libfsrefs_memory_budget_t *parent_memory_budget,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_free(
+     libfsrefs_memory_budget_t **memory_budget,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_add_reference(
+     libfsrefs_memory_budget_t *memory_budget,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_get_maximum_size(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t *maximum_size,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_set_maximum_size(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_get_current_size(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t *current_size,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_allocate(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_release(
+     libfsrefs_memory_budget_t *memory_budget,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_is_exceeded(
+     libfsrefs_memory_budget_t *memory_budget,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_get_process_memory_budget(
+     libfsrefs_memory_budget_t **memory_budget,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_set_process_maximum_size(
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int libfsrefs_memory_budget_free_process_memory_budget(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_MEMORY_BUDGET_H ) */
+
@@ -136,6 +136,7 @@ int libfsrefs_metadata_block_header_free(
 }
 
 /* Reads the metadata block header
+ * The format version specific read function is bound to the IO handle when the format version is set
  * Returns 1 if successful or -1 on error
  */
 int libfsrefs_metadata_block_header_read_data(
@@ -146,11 +147,51 @@ int libfsrefs_metadata_block_header_read_data(
      libcerror_error_t **error )
 {
 	static char *function = "libfsrefs_metadata_block_header_read_data";
-	size_t header_size    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->read_metadata_block_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu8 ".%" PRIu8 ".",
+		 function,
+		 io_handle->major_format_version,
+		 io_handle->minor_format_version );
+
+		return( -1 );
+	}
+	return( io_handle->read_metadata_block_header(
+	         metadata_block_header,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+/* Reads a format version 1 metadata block header
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_metadata_block_header_read_data_v1(
+     libfsrefs_metadata_block_header_t *metadata_block_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_metadata_block_header_read_data_v1";
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit  = 0;
-	uint32_t value_32bit  = 0;
 #endif
 
 	if( metadata_block_header == NULL )
@@ -164,35 +205,117 @@ int libfsrefs_metadata_block_header_read_data(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->major_format_version == 1 )
+	if( ( data_size < sizeof( fsrefs_metadata_block_header_v1_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
-		header_size = sizeof( fsrefs_metadata_block_header_v1_t );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: metadata block header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( fsrefs_metadata_block_header_v1_t ),
+		 0 );
 	}
-	else if( io_handle->major_format_version == 3 )
+#endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_header_v1_t *) data )->block_number,
+	 metadata_block_header->block_numbers[ 0 ] );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		header_size = sizeof( fsrefs_metadata_block_header_v3_t );
+		libcnotify_printf(
+		 "%s: block number\t\t\t: %" PRIu64 "\n",
+		 function,
+		 metadata_block_header->block_numbers[ 0 ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_metadata_block_header_v1_t *) data )->unknown1,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: sequence number\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "%s: object identifier\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsrefs_metadata_block_header_v1_t *) data )->object_identifier,
+		 16,
+		 0 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_metadata_block_header_v1_t *) data )->unknown1,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_metadata_block_header_v1_t *) data )->unknown2,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown2\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "\n" );
 	}
-	else
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads a format version 3 metadata block header
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_metadata_block_header_read_data_v3(
+     libfsrefs_metadata_block_header_t *metadata_block_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_metadata_block_header_read_data_v3";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+#endif
+
+	if( metadata_block_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported format version: %" PRIu8 ".%" PRIu8 ".",
-		 function,
-		 io_handle->major_format_version,
-		 io_handle->minor_format_version );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata block header.",
+		 function );
 
 		return( -1 );
 	}
@@ -207,7 +330,7 @@ int libfsrefs_metadata_block_header_read_data(
 
 		return( -1 );
 	}
-	if( ( data_size < header_size )
+	if( ( data_size < sizeof( fsrefs_metadata_block_header_v3_t ) )
 	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
@@ -227,182 +350,129 @@ int libfsrefs_metadata_block_header_read_data(
 		 function );
 		libcnotify_print_data(
 		 data,
-		 header_size,
+		 sizeof( fsrefs_metadata_block_header_v3_t ),
 		 0 );
 	}
 #endif
-	if( io_handle->major_format_version == 1 )
+	if( memory_copy(
+	     metadata_block_header->signature,
+	     ( (fsrefs_metadata_block_header_v3_t *) data )->signature,
+	     4 ) == NULL )
 	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_header_v1_t *) data )->block_number,
-		 metadata_block_header->block_numbers[ 0 ] );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
 	}
-	else if( io_handle->major_format_version == 3 )
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number1,
+	 metadata_block_header->block_numbers[ 0 ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number2,
+	 metadata_block_header->block_numbers[ 1 ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number3,
+	 metadata_block_header->block_numbers[ 2 ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number4,
+	 metadata_block_header->block_numbers[ 3 ] );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		if( memory_copy(
-		     metadata_block_header->signature,
-		     ( (fsrefs_metadata_block_header_v3_t *) data )->signature,
-		     4 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy signature.",
-			 function );
-
-			return( -1 );
-		}
+		libcnotify_printf(
+		 "%s: signature\t\t\t: %c%c%c%c\n",
+		 function,
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 0 ],
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 1 ],
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 2 ],
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 3 ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown1,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown2,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown2\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown3,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown3\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
 		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number1,
-		 metadata_block_header->block_numbers[ 0 ] );
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown4,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown4\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
 
 		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number2,
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown5,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown5\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "%s: block number1\t\t: %" PRIu64 "\n",
+		 function,
+		 metadata_block_header->block_numbers[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: block number2\t\t: %" PRIu64 "\n",
+		 function,
 		 metadata_block_header->block_numbers[ 1 ] );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number3,
+		libcnotify_printf(
+		 "%s: block number3\t\t: %" PRIu64 "\n",
+		 function,
 		 metadata_block_header->block_numbers[ 2 ] );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsrefs_metadata_block_header_v3_t *) data )->block_number4,
+		libcnotify_printf(
+		 "%s: block number4\t\t: %" PRIu64 "\n",
+		 function,
 		 metadata_block_header->block_numbers[ 3 ] );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( io_handle->major_format_version == 1 )
-		{
-			libcnotify_printf(
-			 "%s: block number\t\t\t: %" PRIu64 "\n",
-			 function,
-			 metadata_block_header->block_numbers[ 0 ] );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v1_t *) data )->unknown1,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: sequence number\t\t: %" PRIu64 "\n",
-			 function,
-			 value_64bit );
-
-			libcnotify_printf(
-			 "%s: object identifier\n",
-			 function );
-			libcnotify_print_data(
-			 ( (fsrefs_metadata_block_header_v1_t *) data )->object_identifier,
-			 16,
-			 0 );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v1_t *) data )->unknown1,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown1\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v1_t *) data )->unknown2,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown2\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-		else if( io_handle->major_format_version == 3 )
-		{
-			libcnotify_printf(
-			 "%s: signature\t\t\t: %c%c%c%c\n",
-			 function,
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 0 ],
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 1 ],
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 2 ],
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->signature[ 3 ] );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown1,
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: unknown1\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown2,
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: unknown2\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown3,
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: unknown3\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown4,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown4\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown5,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown5\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			libcnotify_printf(
-			 "%s: block number1\t\t: %" PRIu64 "\n",
-			 function,
-			 metadata_block_header->block_numbers[ 0 ] );
-
-			libcnotify_printf(
-			 "%s: block number2\t\t: %" PRIu64 "\n",
-			 function,
-			 metadata_block_header->block_numbers[ 1 ] );
-
-			libcnotify_printf(
-			 "%s: block number3\t\t: %" PRIu64 "\n",
-			 function,
-			 metadata_block_header->block_numbers[ 2 ] );
-
-			libcnotify_printf(
-			 "%s: block number4\t\t: %" PRIu64 "\n",
-			 function,
-			 metadata_block_header->block_numbers[ 3 ] );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown6,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown6\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown7,
-			 value_64bit );
-			libcnotify_printf(
-			 "%s: unknown7\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 value_64bit );
-
-			libcnotify_printf(
-			 "\n" );
-		}
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown6,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown6\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsrefs_metadata_block_header_v3_t *) data )->unknown7,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown7\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "\n" );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
@@ -447,15 +517,10 @@ int libfsrefs_metadata_block_header_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( io_handle->major_format_version == 1 )
-	{
-		read_size = sizeof( fsrefs_metadata_block_header_v1_t );
-	}
-	else if( io_handle->major_format_version == 3 )
-	{
-		read_size = sizeof( fsrefs_metadata_block_header_v3_t );
-	}
-	else
+	read_size = io_handle->metadata_block_header_size;
+
+	if( ( read_size == 0 )
+	 || ( read_size > sizeof( fsrefs_metadata_block_header_v3_t ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -61,6 +61,18 @@ int libfsrefs_metadata_block_header_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsrefs_metadata_block_header_read_data_v1(
+     libfsrefs_metadata_block_header_t *metadata_block_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsrefs_metadata_block_header_read_data_v3(
+     libfsrefs_metadata_block_header_t *metadata_block_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsrefs_metadata_block_header_read_file_io_handle(
      libfsrefs_metadata_block_header_t *metadata_block_header,
      libfsrefs_io_handle_t *io_handle,
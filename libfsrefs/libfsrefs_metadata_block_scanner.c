@@ -0,0 +1,612 @@
+/*
+ * Metadata block scanner functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_io_handle.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_metadata_block_header.h"
+#include "libfsrefs_metadata_block_scanner.h"
+#include "libfsrefs_statistics.h"
+
+#include "fsrefs_metadata_block.h"
+
+/* Creates a metadata block scanner
+ * Make sure the value metadata_block_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_metadata_block_scanner_initialize(
+     libfsrefs_metadata_block_scanner_t **metadata_block_scanner,
+     libfsrefs_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_metadata_block_scanner_initialize";
+	size_t header_size    = 0;
+
+	if( metadata_block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_block_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata block scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only format version 3 metadata blocks contain a signature
+	 */
+	if( io_handle->major_format_version != 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu8 ".%" PRIu8 ".",
+		 function,
+		 io_handle->major_format_version,
+		 io_handle->minor_format_version );
+
+		return( -1 );
+	}
+	header_size = sizeof( fsrefs_metadata_block_header_v3_t );
+
+	if( ( (size_t) io_handle->metadata_block_size < header_size )
+	 || ( (size_t) io_handle->metadata_block_size > (size_t) LIBFSREFS_METADATA_BLOCK_SCANNER_READ_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - metadata block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_block_scanner = memory_allocate_structure(
+	                           libfsrefs_metadata_block_scanner_t );
+
+	if( *metadata_block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata block scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_block_scanner,
+	     0,
+	     sizeof( libfsrefs_metadata_block_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata block scanner.",
+		 function );
+
+		memory_free(
+		 *metadata_block_scanner );
+
+		*metadata_block_scanner = NULL;
+
+		return( -1 );
+	}
+	if( libfsrefs_metadata_block_header_initialize(
+	     &( ( *metadata_block_scanner )->metadata_block_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata block header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The read buffer contains whole metadata blocks so that a block never spans two reads
+	 */
+	( *metadata_block_scanner )->read_buffer_size = ( LIBFSREFS_METADATA_BLOCK_SCANNER_READ_SIZE / io_handle->metadata_block_size )
+	                                              * io_handle->metadata_block_size;
+
+	( *metadata_block_scanner )->read_buffer = (uint8_t *) memory_allocate(
+	                                                        ( *metadata_block_scanner )->read_buffer_size );
+
+	if( ( *metadata_block_scanner )->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *metadata_block_scanner )->header_size = header_size;
+
+	return( 1 );
+
+on_error:
+	if( *metadata_block_scanner != NULL )
+	{
+		if( ( *metadata_block_scanner )->metadata_block_header != NULL )
+		{
+			libfsrefs_metadata_block_header_free(
+			 &( ( *metadata_block_scanner )->metadata_block_header ),
+			 NULL );
+		}
+		memory_free(
+		 *metadata_block_scanner );
+
+		*metadata_block_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata block scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_metadata_block_scanner_free(
+     libfsrefs_metadata_block_scanner_t **metadata_block_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_metadata_block_scanner_free";
+	int result            = 1;
+
+	if( metadata_block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_block_scanner != NULL )
+	{
+		if( ( *metadata_block_scanner )->read_buffer != NULL )
+		{
+			memory_free(
+			 ( *metadata_block_scanner )->read_buffer );
+		}
+		if( libfsrefs_metadata_block_header_free(
+		     &( ( *metadata_block_scanner )->metadata_block_header ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata block header.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *metadata_block_scanner );
+
+		*metadata_block_scanner = NULL;
+	}
+	return( result );
+}
+
+/* Scans data for metadata blocks
+ * The data is expected to start at a metadata block boundary, where data offset is
+ * the offset of the data relative to the start of the volume. Only the first 4 bytes
+ * of every metadata block are compared against the signature, the header is only
+ * read for blocks with a matching signature. The callback is called for every
+ * candidate block and should return 1 to continue the scan, 0 to stop the scan or
+ * -1 on error
+ * Returns 1 if successful, 0 if stopped or -1 on error
+ */
+int libfsrefs_metadata_block_scanner_scan_data(
+     libfsrefs_metadata_block_scanner_t *metadata_block_scanner,
+     libfsrefs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     int (*callback)(
+            off64_t block_offset,
+            uint64_t block_number,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsrefs_metadata_block_scanner_scan_data";
+	size_t block_data_offset = 0;
+	uint32_t signature       = 0;
+	int callback_result      = 0;
+
+	if( metadata_block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->metadata_block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing metadata block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( data_size - block_data_offset ) >= metadata_block_scanner->header_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ block_data_offset ] ),
+		 signature );
+
+		if( signature == LIBFSREFS_METADATA_BLOCK_SIGNATURE_V3 )
+		{
+			if( libfsrefs_metadata_block_header_read_data(
+			     metadata_block_scanner->metadata_block_header,
+			     io_handle,
+			     &( data[ block_data_offset ] ),
+			     metadata_block_scanner->header_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read metadata block header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 data_offset + (off64_t) block_data_offset,
+				 data_offset + (off64_t) block_data_offset );
+
+				return( -1 );
+			}
+			/* A block number of 0 refers to the volume header and is never used by a ministore node
+			 */
+			if( metadata_block_scanner->metadata_block_header->block_numbers[ 0 ] != 0 )
+			{
+				metadata_block_scanner->number_of_candidates += 1;
+
+				callback_result = callback(
+				                   data_offset + (off64_t) block_data_offset,
+				                   metadata_block_scanner->metadata_block_header->block_numbers[ 0 ],
+				                   user_data );
+
+				if( callback_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: callback failed for metadata block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 data_offset + (off64_t) block_data_offset,
+					 data_offset + (off64_t) block_data_offset );
+
+					return( -1 );
+				}
+				else if( callback_result == 0 )
+				{
+					return( 0 );
+				}
+			}
+		}
+		if( ( data_size - block_data_offset ) <= (size_t) io_handle->metadata_block_size )
+		{
+			break;
+		}
+		block_data_offset += io_handle->metadata_block_size;
+	}
+	return( 1 );
+}
+
+/* Scans a range of the volume for metadata blocks
+ * The start offset is rounded up to the next metadata block boundary. If size is 0
+ * the volume is scanned up to its end. The range is read sequentially in large
+ * reads of whole metadata blocks
+ * Returns 1 if successful, 0 if stopped or aborted or -1 on error
+ */
+int libfsrefs_metadata_block_scanner_scan_file_io_handle(
+     libfsrefs_metadata_block_scanner_t *metadata_block_scanner,
+     libfsrefs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t start_offset,
+     size64_t size,
+     int (*callback)(
+            off64_t block_offset,
+            uint64_t block_number,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsrefs_metadata_block_scanner_scan_file_io_handle";
+	size64_t end_offset      = 0;
+	size64_t read_offset     = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	uint64_t start_timestamp = 0;
+	int result               = 1;
+
+	if( metadata_block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_block_scanner->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metadata block scanner - missing read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->metadata_block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing metadata block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	end_offset = io_handle->volume_size;
+
+	if( ( size != 0 )
+	 && ( size <= ( (size64_t) INT64_MAX - (size64_t) start_offset ) ) )
+	{
+		if( ( end_offset == 0 )
+		 || ( ( (size64_t) start_offset + size ) < end_offset ) )
+		{
+			end_offset = (size64_t) start_offset + size;
+		}
+	}
+	read_offset = (size64_t) start_offset;
+
+	if( ( read_offset % io_handle->metadata_block_size ) != 0 )
+	{
+		read_offset += io_handle->metadata_block_size - ( read_offset % io_handle->metadata_block_size );
+	}
+	while( read_offset < end_offset )
+	{
+		if( io_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		read_size = metadata_block_scanner->read_buffer_size;
+
+		if( (size64_t) read_size > ( end_offset - read_offset ) )
+		{
+			read_size = (size_t) ( end_offset - read_offset );
+		}
+		start_timestamp = libfsrefs_statistics_get_timestamp();
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              metadata_block_scanner->read_buffer,
+		              read_size,
+		              (off64_t) read_offset,
+		              error );
+
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 LIBFSREFS_NODE_TYPE_UNKNOWN,
+		 LIBFSREFS_STATISTICS_VALUE_READ_TIME,
+		 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 LIBFSREFS_NODE_TYPE_UNKNOWN,
+		 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_READS,
+		 1 );
+
+		if( read_count > 0 )
+		{
+			libfsrefs_statistics_add_value(
+			 &( io_handle->statistics ),
+			 LIBFSREFS_NODE_TYPE_UNKNOWN,
+			 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+			 (uint64_t) read_count );
+		}
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			return( -1 );
+		}
+		result = libfsrefs_metadata_block_scanner_scan_data(
+		          metadata_block_scanner,
+		          io_handle,
+		          metadata_block_scanner->read_buffer,
+		          read_size,
+		          (off64_t) read_offset,
+		          callback,
+		          user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		read_offset += read_size;
+	}
+	return( result );
+}
+
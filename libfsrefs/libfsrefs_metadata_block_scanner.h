@@ -0,0 +1,104 @@
+/*
+ * Metadata block scanner functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_METADATA_BLOCK_SCANNER_H )
+#define _LIBFSREFS_METADATA_BLOCK_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_io_handle.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_metadata_block_header.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_metadata_block_scanner libfsrefs_metadata_block_scanner_t;
+
+struct libfsrefs_metadata_block_scanner
+{
+	/* The metadata block header
+	 * This is reused for every candidate block
+	 */
+	libfsrefs_metadata_block_header_t *metadata_block_header;
+
+	/* The metadata block header size
+	 */
+	size_t header_size;
+
+	/* The read buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The read buffer size
+	 * This is a multitude of the metadata block size
+	 */
+	size_t read_buffer_size;
+
+	/* The number of candidate blocks
+	 */
+	uint64_t number_of_candidates;
+};
+
+int libfsrefs_metadata_block_scanner_initialize(
+     libfsrefs_metadata_block_scanner_t **metadata_block_scanner,
+     libfsrefs_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libfsrefs_metadata_block_scanner_free(
+     libfsrefs_metadata_block_scanner_t **metadata_block_scanner,
+     libcerror_error_t **error );
+
+int libfsrefs_metadata_block_scanner_scan_data(
+     libfsrefs_metadata_block_scanner_t *metadata_block_scanner,
+     libfsrefs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     int (*callback)(
+            off64_t block_offset,
+            uint64_t block_number,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libfsrefs_metadata_block_scanner_scan_file_io_handle(
+     libfsrefs_metadata_block_scanner_t *metadata_block_scanner,
+     libfsrefs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t start_offset,
+     size64_t size,
+     int (*callback)(
+            off64_t block_offset,
+            uint64_t block_number,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_METADATA_BLOCK_SCANNER_H ) */
+
@@ -33,6 +33,7 @@
 #include "libfsrefs_ministore_node.h"
 #include "libfsrefs_node_header.h"
 #include "libfsrefs_node_record.h"
+#include "libfsrefs_statistics.h"
 #include "libfsrefs_tree_header.h"
 
 #include "fsrefs_metadata_block.h"
@@ -190,6 +191,7 @@ int libfsrefs_ministore_node_read_data(
      libfsrefs_io_handle_t *io_handle,
      const uint8_t *data,
      size_t data_size,
+     int node_type,
      libcerror_error_t **error )
 {
 	libfsrefs_node_header_t *node_header = NULL;
@@ -198,6 +200,7 @@ int libfsrefs_ministore_node_read_data(
 	static char *function                = "libfsrefs_ministore_node_read_data";
 	size_t data_offset                   = 0;
 	size_t record_offsets_data_offset    = 0;
+	uint64_t start_timestamp             = 0;
 	uint32_t node_header_offset          = 0;
 	uint32_t record_data_offset          = 0;
 	uint32_t record_data_size            = 0;
@@ -241,8 +244,7 @@ int libfsrefs_ministore_node_read_data(
 
 		return( -1 );
 	}
-	if( ( io_handle->major_format_version != 1 )
-	 && ( io_handle->major_format_version != 3 ) )
+	if( io_handle->record_data_offset_mask == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -278,6 +280,8 @@ int libfsrefs_ministore_node_read_data(
 
 		return( -1 );
 	}
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
 	byte_stream_copy_to_uint32_little_endian(
 	 data,
 	 node_header_offset );
@@ -524,10 +528,8 @@ int libfsrefs_ministore_node_read_data(
 			}
 		}
 #endif
-		if( io_handle->major_format_version == 3 )
-		{
-			record_data_offset &= 0x0000ffffUL;
-		}
+		record_data_offset &= io_handle->record_data_offset_mask;
+
 		if( ( record_data_offset < node_header->data_area_start_offset )
 		 || ( record_data_offset >= node_header->data_area_end_offset ) )
 		{
@@ -631,6 +633,24 @@ int libfsrefs_ministore_node_read_data(
 	ministore_node->data      = data;
 	ministore_node->data_size = data_size;
 
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 node_type,
+	 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_NODES,
+	 1 );
+
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 node_type,
+	 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_RECORDS,
+	 (uint64_t) record_offsets_index );
+
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 node_type,
+	 LIBFSREFS_STATISTICS_VALUE_PARSE_TIME,
+	 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
 	return( 1 );
 
 on_error:
@@ -662,6 +682,7 @@ int libfsrefs_ministore_node_read_file_io_handle(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsrefs_block_reference_t *block_reference,
+     int node_type,
      libcerror_error_t **error )
 {
 	libfsrefs_metadata_block_header_t *metadata_block_header = NULL;
@@ -669,6 +690,8 @@ int libfsrefs_ministore_node_read_file_io_handle(
 	size_t header_size                                       = 0;
 	size_t read_size                                         = 0;
 	ssize_t read_count                                       = 0;
+	uint64_t node_start_timestamp                            = 0;
+	uint64_t start_timestamp                                 = 0;
 	uint8_t block_number_index                               = 0;
 
 	if( ministore_node == NULL )
@@ -715,15 +738,9 @@ int libfsrefs_ministore_node_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( io_handle->major_format_version == 1 )
-	{
-		header_size = sizeof( fsrefs_metadata_block_header_v1_t );
-	}
-	else if( io_handle->major_format_version == 3 )
-	{
-		header_size = sizeof( fsrefs_metadata_block_header_v3_t );
-	}
-	else
+	header_size = io_handle->metadata_block_header_size;
+
+	if( header_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -768,6 +785,11 @@ int libfsrefs_ministore_node_read_file_io_handle(
 
 		goto on_error;
 	}
+	libfsrefs_statistics_add_value(
+	 &( io_handle->statistics ),
+	 node_type,
+	 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+	 1 );
 	if( memory_set(
 	     ministore_node->internal_data,
 	     0,
@@ -782,6 +804,18 @@ int libfsrefs_ministore_node_read_file_io_handle(
 
 		goto on_error;
 	}
+	ministore_node->block_offset = block_reference->block_offsets[ 0 ];
+
+	node_start_timestamp = libfsrefs_statistics_get_timestamp();
+
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_NODE_READ_START,
+	 node_type,
+	 ministore_node->block_offset,
+	 (size64_t) read_size,
+	 0 );
+
 	for( block_number_index = 0;
 	     block_number_index < 4;
 	     block_number_index++ )
@@ -790,6 +824,8 @@ int libfsrefs_ministore_node_read_file_io_handle(
 		{
 			break;
 		}
+		start_timestamp = libfsrefs_statistics_get_timestamp();
+
 		read_count = libbfio_handle_read_buffer_at_offset(
 		              file_io_handle,
 		              ministore_node->internal_data,
@@ -797,6 +833,26 @@ int libfsrefs_ministore_node_read_file_io_handle(
 		              block_reference->block_offsets[ block_number_index ],
 		              error );
 
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 node_type,
+		 LIBFSREFS_STATISTICS_VALUE_READ_TIME,
+		 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
+		libfsrefs_statistics_add_value(
+		 &( io_handle->statistics ),
+		 node_type,
+		 LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_READS,
+		 1 );
+
+		if( read_count > 0 )
+		{
+			libfsrefs_statistics_add_value(
+			 &( io_handle->statistics ),
+			 node_type,
+			 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+			 (uint64_t) read_count );
+		}
 		if( read_count != (ssize_t) io_handle->metadata_block_size )
 		{
 			libcerror_error_set(
@@ -878,6 +934,7 @@ int libfsrefs_ministore_node_read_file_io_handle(
 	     io_handle,
 	     &( ministore_node->internal_data[ header_size ] ),
 	     read_size - header_size,
+	     node_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -889,6 +946,14 @@ int libfsrefs_ministore_node_read_file_io_handle(
 
 		goto on_error;
 	}
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_NODE_READ_END,
+	 node_type,
+	 ministore_node->block_offset,
+	 (size64_t) read_size,
+	 libfsrefs_statistics_get_timestamp() - node_start_timestamp );
+
 	return( 1 );
 
 on_error:
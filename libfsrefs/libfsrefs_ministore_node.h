@@ -64,6 +64,10 @@ struct libfsrefs_ministore_node
 	 */
 	libcdata_array_t *records_array;
 
+	/* The block offset
+	 */
+	off64_t block_offset;
+
 	/* The node type flags
 	 */
 	uint8_t node_type_flags;
@@ -82,6 +86,7 @@ int libfsrefs_ministore_node_read_data(
      libfsrefs_io_handle_t *io_handle,
      const uint8_t *data,
      size_t data_size,
+     int node_type,
      libcerror_error_t **error );
 
 int libfsrefs_ministore_node_read_file_io_handle(
@@ -89,6 +94,7 @@ int libfsrefs_ministore_node_read_file_io_handle(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsrefs_block_reference_t *block_reference,
+     int node_type,
      libcerror_error_t **error );
 
 int libfsrefs_ministore_node_get_number_of_records(
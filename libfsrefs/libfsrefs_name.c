@@ -0,0 +1,268 @@
+/*
+ * Name functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libuna.h"
+#include "libfsrefs_name.h"
+
+/* Determines if an UTF-16 little-endian stream only contains ASCII characters
+ * The stream is checked 4 characters at a time, a character with a value of 0
+ * is not considered ASCII since libuna treats it as the end of string
+ * Returns 1 if the stream only contains ASCII characters, 0 if not or -1 on error
+ */
+int libfsrefs_name_utf16_stream_is_ascii(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_name_utf16_stream_is_ascii";
+	size_t stream_index   = 0;
+	uint64_t value_64bit  = 0;
+	uint16_t value_16bit  = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		return( 0 );
+	}
+	while( ( utf16_stream_size - stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_64bit );
+
+		/* Check if any of the 4 characters is 0x0080 or greater
+		 */
+		if( ( value_64bit & (uint64_t) 0xff80ff80ff80ff80UL ) != 0 )
+		{
+			return( 0 );
+		}
+		/* Check if any of the 4 characters is 0
+		 */
+		if( ( ( value_64bit - (uint64_t) 0x0001000100010001UL ) & ~value_64bit & (uint64_t) 0x8000800080008000UL ) != 0 )
+		{
+			return( 0 );
+		}
+		stream_index += 8;
+	}
+	while( stream_index < utf16_stream_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_16bit );
+
+		if( ( value_16bit == 0 )
+		 || ( value_16bit >= 0x0080 ) )
+		{
+			return( 0 );
+		}
+		stream_index += 2;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of an UTF-8 string of an UTF-16 little-endian stream
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_name_get_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_name_get_utf8_string_size_from_utf16_stream";
+	int result            = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          utf16_stream,
+	          utf16_stream_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if UTF-16 stream is ASCII.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*utf8_string_size = ( utf16_stream_size / 2 ) + 1;
+	}
+	else if( libuna_utf8_string_size_from_utf16_stream(
+	          utf16_stream,
+	          utf16_stream_size,
+	          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 little-endian stream
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_name_copy_utf8_string_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_name_copy_utf8_string_from_utf16_stream";
+	size_t stream_index   = 0;
+	size_t string_index   = 0;
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          utf16_stream,
+	          utf16_stream_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if UTF-16 stream is ASCII.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( utf8_string_size < ( ( utf16_stream_size / 2 ) + 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		/* Narrow the ASCII characters by taking the lower byte of every UTF-16 little-endian character
+		 */
+		while( stream_index < utf16_stream_size )
+		{
+			utf8_string[ string_index++ ] = utf16_stream[ stream_index ];
+
+			stream_index += 2;
+		}
+		utf8_string[ string_index ] = 0;
+	}
+	else if( libuna_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size,
+	          utf16_stream,
+	          utf16_stream_size,
+	          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
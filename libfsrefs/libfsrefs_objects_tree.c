@@ -25,11 +25,17 @@
 #include <types.h>
 
 #include "libfsrefs_block_reference.h"
+#include "libfsrefs_definitions.h"
 #include "libfsrefs_file_system.h"
+#include "libfsrefs_io_handle.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_ministore_node.h"
 #include "libfsrefs_node_record.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_parent_index.h"
+#include "libfsrefs_shared_extent_index.h"
+#include "libfsrefs_statistics.h"
+#include "libfsrefs_volume_index.h"
 
 /* Creates a objects tree
  * Make sure the value objects_tree is referencing, is set to NULL
@@ -164,6 +170,54 @@ int libfsrefs_objects_tree_free(
 				result = -1;
 			}
 		}
+		if( ( *objects_tree )->parent_index != NULL )
+		{
+			if( libfsrefs_parent_index_free(
+			     &( ( *objects_tree )->parent_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free parent index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *objects_tree )->shared_extent_index != NULL )
+		{
+			if( libfsrefs_shared_extent_index_free(
+			     &( ( *objects_tree )->shared_extent_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shared extent index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *objects_tree )->volume_index != NULL )
+		{
+			if( libfsrefs_volume_index_free(
+			     &( ( *objects_tree )->volume_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *objects_tree );
 
@@ -210,6 +264,7 @@ int libfsrefs_objects_tree_read(
 	     io_handle,
 	     file_io_handle,
 	     0,
+	     LIBFSREFS_NODE_TYPE_OBJECTS_TREE,
 	     &( objects_tree->root_node ),
 	     error ) != 1 )
 	{
@@ -264,6 +319,7 @@ int libfsrefs_objects_tree_get_ministore_tree_by_identifier(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t object_identifier,
+     int node_type,
      libfsrefs_ministore_node_t **root_node,
      libcerror_error_t **error )
 {
@@ -273,6 +329,8 @@ int libfsrefs_objects_tree_get_ministore_tree_by_identifier(
 	libfsrefs_ministore_node_t *safe_root_node   = NULL;
 	libfsrefs_node_record_t *node_record         = NULL;
 	static char *function                        = "libfsrefs_objects_tree_get_ministore_tree_by_identifier";
+	off64_t block_offset                         = 0;
+	uint64_t start_timestamp                     = 0;
 	int result                                   = 0;
 
 	if( objects_tree == NULL )
@@ -308,6 +366,8 @@ int libfsrefs_objects_tree_get_ministore_tree_by_identifier(
 
 		return( -1 );
 	}
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
 	byte_stream_copy_from_uint64_little_endian(
 	 &( key_data[ 8 ] ),
 	 object_identifier );
@@ -407,6 +467,7 @@ int libfsrefs_objects_tree_get_ministore_tree_by_identifier(
 		     io_handle,
 		     file_io_handle,
 		     block_reference,
+		     node_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -432,8 +493,18 @@ int libfsrefs_objects_tree_get_ministore_tree_by_identifier(
 
 			goto on_error;
 		}
+		block_offset = safe_root_node->block_offset;
+
 		*root_node = safe_root_node;
 	}
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_OBJECTS_TREE_LOOKUP,
+	 node_type,
+	 block_offset,
+	 (size64_t) io_handle->metadata_block_size,
+	 libfsrefs_statistics_get_timestamp() - start_timestamp );
+
 	return( result );
 
 on_error:
@@ -449,6 +520,58 @@ on_error:
 		 &block_reference,
 		 NULL );
 	}
-	return( 1 );
+	return( -1 );
+}
+
+/* Determines if the objects tree contains a specific object identifier
+ * This only searches the in-memory objects tree root node and does not read the ministore tree of the object
+ * Returns 1 if the objects tree contains the object identifier, 0 if not or -1 on error
+ */
+int libfsrefs_objects_tree_has_object_identifier(
+     libfsrefs_objects_tree_t *objects_tree,
+     uint64_t object_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 16 ]               = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	libfsrefs_node_record_t *node_record = NULL;
+	static char *function                = "libfsrefs_objects_tree_has_object_identifier";
+	int result                           = 0;
+
+	if( objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid objects tree.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( key_data[ 8 ] ),
+	 object_identifier );
+
+	result = libfsrefs_ministore_node_get_record_by_key(
+	          objects_tree->root_node,
+	          key_data,
+	          16,
+	          &node_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier: 0x%08" PRIx64 " from objects tree.",
+		 function,
+		 object_identifier );
+
+		return( -1 );
+	}
+	return( result );
 }
 
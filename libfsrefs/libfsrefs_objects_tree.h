@@ -31,6 +31,9 @@
 #include "libfsrefs_libbfio.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_ministore_node.h"
+#include "libfsrefs_parent_index.h"
+#include "libfsrefs_shared_extent_index.h"
+#include "libfsrefs_volume_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -47,6 +50,21 @@ struct libfsrefs_objects_tree
 	/* Ministore root node
 	 */
 	libfsrefs_ministore_node_t *root_node;
+
+	/* The parent index
+	 * This is only available after it was built
+	 */
+	libfsrefs_parent_index_t *parent_index;
+
+	/* The shared extent index
+	 * This is only available after it was built
+	 */
+	libfsrefs_shared_extent_index_t *shared_extent_index;
+
+	/* The volume index
+	 * This is only available after it was imported
+	 */
+	libfsrefs_volume_index_t *volume_index;
 };
 
 int libfsrefs_objects_tree_initialize(
@@ -69,9 +87,15 @@ int libfsrefs_objects_tree_get_ministore_tree_by_identifier(
      libfsrefs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t object_identifier,
+     int node_type,
      libfsrefs_ministore_node_t **root_node,
      libcerror_error_t **error );
 
+int libfsrefs_objects_tree_has_object_identifier(
+     libfsrefs_objects_tree_t *objects_tree,
+     uint64_t object_identifier,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
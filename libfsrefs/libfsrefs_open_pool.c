@@ -0,0 +1,383 @@
+/*
+ * Open pool functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_open_pool.h"
+#include "libfsrefs_open_request.h"
+#include "libfsrefs_static_mutex.h"
+#include "libfsrefs_unused.h"
+
+/* The number of threads of the process-wide open pool
+ */
+static int libfsrefs_open_pool_number_of_threads = LIBFSREFS_OPEN_POOL_DEFAULT_NUMBER_OF_THREADS;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+/* The thread pool of the process-wide open pool
+ * This is created when the first open request is pushed and
+ * is freed when the open pool is joined
+ */
+static libcthreads_thread_pool_t *libfsrefs_open_pool_thread_pool = NULL;
+
+/* The mutex that guards the creation, use and joining of the thread pool
+ * and changes to the number of threads
+ */
+static libfsrefs_static_mutex_t libfsrefs_open_pool_mutex = LIBFSREFS_STATIC_MUTEX_INITIALIZER;
+
+/* Processes an open request pushed onto the thread pool
+ * Callback function for libcthreads_thread_pool_create
+ * Returns 1
+ */
+int libfsrefs_open_pool_process_request(
+     libfsrefs_open_request_t *open_request,
+     void *arguments LIBFSREFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+
+	LIBFSREFS_UNREFERENCED_PARAMETER( arguments )
+
+	/* Errors of the open itself are passed to the open callback function,
+	 * an error here means the open request was invalid
+	 */
+	if( libfsrefs_open_request_process(
+	     open_request,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfsrefs_open_request_free(
+	 &open_request,
+	 NULL );
+
+	/* Always return 1 so the thread continues with the next open request
+	 */
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the number of threads of the process-wide open pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_pool_get_number_of_threads(
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_pool_get_number_of_threads";
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = libfsrefs_open_pool_number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads of the process-wide open pool
+ * The number of threads cannot be changed while the open pool is running
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_pool_set_number_of_threads(
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_pool_set_number_of_threads";
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFSREFS_OPEN_POOL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_open_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab open pool mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_open_pool_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid open pool - thread pool value already set.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	libfsrefs_open_pool_number_of_threads = number_of_threads;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_open_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release open pool mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+on_error:
+	libfsrefs_static_mutex_release(
+	 &libfsrefs_open_pool_mutex,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
+/* Pushes an open request onto the process-wide open pool
+ * The thread pool is created on first use. Without multi-thread support
+ * the open request is processed before this function returns
+ * The open pool takes over management of the open request if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_pool_push(
+     libfsrefs_open_request_t *open_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_pool_push";
+
+	if( open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_open_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab open pool mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_open_pool_thread_pool == NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &libfsrefs_open_pool_thread_pool,
+		     NULL,
+		     libfsrefs_open_pool_number_of_threads,
+		     LIBFSREFS_OPEN_POOL_MAXIMUM_NUMBER_OF_REQUESTS,
+		     (int (*)(intptr_t *, void *)) &libfsrefs_open_pool_process_request,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* This blocks while the maximum number of open requests are queued,
+	 * the mutex is held so that the thread pool cannot be joined meanwhile
+	 */
+	if( libcthreads_thread_pool_push(
+	     libfsrefs_open_pool_thread_pool,
+	     (intptr_t *) open_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push open request onto thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_open_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release open pool mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( libfsrefs_open_request_process(
+	     open_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process open request.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_open_request_free(
+	     &open_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free open request.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+on_error:
+	libfsrefs_static_mutex_release(
+	 &libfsrefs_open_pool_mutex,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
+/* Waits for all open requests pushed onto the process-wide open pool to complete
+ * The thread pool is detached while the mutex is held and is joined afterwards,
+ * hence the next open request that is pushed creates a new thread pool
+ * This function must not be called from an open callback function since the thread
+ * pool would wait for the thread that is joining it
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_pool_join(
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	static char *function                  = "libfsrefs_open_pool_join";
+	int result                             = 1;
+
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_open_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab open pool mutex.",
+		 function );
+
+		return( -1 );
+	}
+	thread_pool                     = libfsrefs_open_pool_thread_pool;
+	libfsrefs_open_pool_thread_pool = NULL;
+
+	if( libfsrefs_static_mutex_release(
+	     &libfsrefs_open_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release open pool mutex.",
+		 function );
+
+		/* The detached thread pool is joined regardless
+		 */
+		result = -1;
+	}
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+#else
+	LIBFSREFS_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+#endif
+}
+
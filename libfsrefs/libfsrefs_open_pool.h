@@ -0,0 +1,64 @@
+/*
+ * Open pool functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_OPEN_POOL_H )
+#define _LIBFSREFS_OPEN_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_open_request.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+int libfsrefs_open_pool_process_request(
+     libfsrefs_open_request_t *open_request,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsrefs_open_pool_get_number_of_threads(
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int libfsrefs_open_pool_set_number_of_threads(
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsrefs_open_pool_push(
+     libfsrefs_open_request_t *open_request,
+     libcerror_error_t **error );
+
+int libfsrefs_open_pool_join(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_OPEN_POOL_H ) */
+
@@ -0,0 +1,453 @@
+/*
+ * Open request functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_open_request.h"
+#include "libfsrefs_volume.h"
+
+/* Creates an open request
+ * Make sure the value open_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_request_initialize(
+     libfsrefs_open_request_t **open_request,
+     libfsrefs_volume_t *volume,
+     int access_flags,
+     void (*open_callback)(
+            libfsrefs_volume_t *volume,
+            int result,
+            libcerror_error_t *error,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_request_initialize";
+
+	if( open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *open_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid open request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open callback.",
+		 function );
+
+		return( -1 );
+	}
+	*open_request = memory_allocate_structure(
+	                 libfsrefs_open_request_t );
+
+	if( *open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *open_request,
+	     0,
+	     sizeof( libfsrefs_open_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open request.",
+		 function );
+
+		goto on_error;
+	}
+	( *open_request )->volume        = volume;
+	( *open_request )->access_flags  = access_flags;
+	( *open_request )->open_callback = open_callback;
+	( *open_request )->user_data     = user_data;
+
+	return( 1 );
+
+on_error:
+	if( *open_request != NULL )
+	{
+		memory_free(
+		 *open_request );
+
+		*open_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an open request
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_request_free(
+     libfsrefs_open_request_t **open_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_request_free";
+
+	if( open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *open_request != NULL )
+	{
+		/* The volume and user data are referenced and freed elsewhere
+		 */
+		if( ( *open_request )->filename != NULL )
+		{
+			memory_free(
+			 ( *open_request )->filename );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( ( *open_request )->wide_filename != NULL )
+		{
+			memory_free(
+			 ( *open_request )->wide_filename );
+		}
+#endif
+		memory_free(
+		 *open_request );
+
+		*open_request = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_request_set_filename(
+     libfsrefs_open_request_t *open_request,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_request_set_filename";
+
+	if( open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open request.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_request->filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid open request - filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	open_request->filename = narrow_string_allocate(
+	                          filename_length + 1 );
+
+	if( open_request->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     open_request->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 open_request->filename );
+
+		open_request->filename = NULL;
+
+		return( -1 );
+	}
+	( open_request->filename )[ filename_length ] = 0;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_request_set_filename_wide(
+     libfsrefs_open_request_t *open_request,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_open_request_set_filename_wide";
+
+	if( open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open request.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_request->wide_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid open request - wide filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	open_request->wide_filename = wide_string_allocate(
+	                               filename_length + 1 );
+
+	if( open_request->wide_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_copy(
+	     open_request->wide_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy wide filename.",
+		 function );
+
+		memory_free(
+		 open_request->wide_filename );
+
+		open_request->wide_filename = NULL;
+
+		return( -1 );
+	}
+	( open_request->wide_filename )[ filename_length ] = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Processes an open request
+ * Opens the volume and passes the result of the open to the open callback function.
+ * The error passed to the open callback function is freed after the callback returns
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_open_request_process(
+     libfsrefs_open_request_t *open_request,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *open_error = NULL;
+	static char *function         = "libfsrefs_open_request_process";
+	int result                    = 0;
+
+	if( open_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open request.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_request->open_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid open request - missing open callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_request->filename != NULL )
+	{
+		result = libfsrefs_volume_open(
+		          open_request->volume,
+		          open_request->filename,
+		          open_request->access_flags,
+		          &open_error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( open_request->wide_filename != NULL )
+	{
+		result = libfsrefs_volume_open_wide(
+		          open_request->volume,
+		          open_request->wide_filename,
+		          open_request->access_flags,
+		          &open_error );
+	}
+#endif
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid open request - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	open_request->open_callback(
+	 open_request->volume,
+	 result,
+	 open_error,
+	 open_request->user_data );
+
+	if( open_error != NULL )
+	{
+		libcerror_error_free(
+		 &open_error );
+	}
+	return( 1 );
+}
+
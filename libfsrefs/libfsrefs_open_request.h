@@ -0,0 +1,111 @@
+/*
+ * Open request functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_OPEN_REQUEST_H )
+#define _LIBFSREFS_OPEN_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_open_request libfsrefs_open_request_t;
+
+struct libfsrefs_open_request
+{
+	/* The volume
+	 */
+	libfsrefs_volume_t *volume;
+
+	/* The filename
+	 */
+	char *filename;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide filename
+	 */
+	wchar_t *wide_filename;
+#endif
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The open callback function
+	 */
+	void (*open_callback)(
+	       libfsrefs_volume_t *volume,
+	       int result,
+	       libcerror_error_t *error,
+	       intptr_t *user_data );
+
+	/* The open callback user data
+	 */
+	intptr_t *user_data;
+};
+
+int libfsrefs_open_request_initialize(
+     libfsrefs_open_request_t **open_request,
+     libfsrefs_volume_t *volume,
+     int access_flags,
+     void (*open_callback)(
+            libfsrefs_volume_t *volume,
+            int result,
+            libcerror_error_t *error,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libfsrefs_open_request_free(
+     libfsrefs_open_request_t **open_request,
+     libcerror_error_t **error );
+
+int libfsrefs_open_request_set_filename(
+     libfsrefs_open_request_t *open_request,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libfsrefs_open_request_set_filename_wide(
+     libfsrefs_open_request_t *open_request,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libfsrefs_open_request_process(
+     libfsrefs_open_request_t *open_request,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_OPEN_REQUEST_H ) */
+
@@ -0,0 +1,786 @@
+/*
+ * Parent index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_parent_index.h"
+
+/* Creates a parent index
+ * Make sure the value parent_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_parent_index_initialize(
+     libfsrefs_parent_index_t **parent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_parent_index_initialize";
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parent_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parent index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*parent_index = memory_allocate_structure(
+	                 libfsrefs_parent_index_t );
+
+	if( *parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parent index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *parent_index,
+	     0,
+	     sizeof( libfsrefs_parent_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parent index.",
+		 function );
+
+		goto on_error;
+	}
+	( *parent_index )->is_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( *parent_index != NULL )
+	{
+		memory_free(
+		 *parent_index );
+
+		*parent_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a parent index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_parent_index_free(
+     libfsrefs_parent_index_t **parent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_parent_index_free";
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parent_index != NULL )
+	{
+		if( ( *parent_index )->names_data != NULL )
+		{
+			memory_free(
+			 ( *parent_index )->names_data );
+		}
+		if( ( *parent_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *parent_index )->entries );
+		}
+		memory_free(
+		 *parent_index );
+
+		*parent_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * The UTF-8 encoded name is stored in the names data of the parent index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_parent_index_append_entry(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     uint64_t parent_object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_parent_index_entry_t *entries = NULL;
+	uint8_t *names_data                     = NULL;
+	static char *function                   = "libfsrefs_parent_index_append_entry";
+	size_t allocated_names_data_size        = 0;
+	size_t entries_size                     = 0;
+	int number_of_allocated_entries         = 0;
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size > (size_t) LIBFSREFS_PARENT_INDEX_MAXIMUM_NAME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_name_size > 0 )
+	 && ( utf8_name[ utf8_name_size - 1 ] == 0 ) )
+	{
+		utf8_name_size -= 1;
+	}
+	if( parent_index->names_data_size > (size_t) ( UINT32_MAX - utf8_name_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid parent index - names data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_index->number_of_entries >= parent_index->number_of_allocated_entries )
+	{
+		if( parent_index->number_of_allocated_entries >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid parent index - number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 256;
+		}
+		else
+		{
+			number_of_allocated_entries = parent_index->number_of_allocated_entries * 2;
+		}
+		entries_size = sizeof( libfsrefs_parent_index_entry_t ) * (size_t) number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsrefs_parent_index_entry_t *) memory_reallocate(
+		                                              parent_index->entries,
+		                                              entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		parent_index->entries                     = entries;
+		parent_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( utf8_name_size > ( parent_index->allocated_names_data_size - parent_index->names_data_size ) )
+	{
+		if( parent_index->allocated_names_data_size == 0 )
+		{
+			allocated_names_data_size = 16 * 1024;
+		}
+		else
+		{
+			allocated_names_data_size = parent_index->allocated_names_data_size;
+		}
+		while( allocated_names_data_size < ( parent_index->names_data_size + utf8_name_size ) )
+		{
+			allocated_names_data_size *= 2;
+		}
+		if( allocated_names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid names data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		names_data = (uint8_t *) memory_reallocate(
+		                          parent_index->names_data,
+		                          allocated_names_data_size );
+
+		if( names_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		parent_index->names_data                = names_data;
+		parent_index->allocated_names_data_size = allocated_names_data_size;
+	}
+	if( utf8_name_size > 0 )
+	{
+		if( memory_copy(
+		     &( parent_index->names_data[ parent_index->names_data_size ] ),
+		     utf8_name,
+		     utf8_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entries = &( parent_index->entries[ parent_index->number_of_entries ] );
+
+	entries->object_identifier        = object_identifier;
+	entries->parent_object_identifier = parent_object_identifier;
+	entries->name_offset              = (uint32_t) parent_index->names_data_size;
+	entries->name_size                = (uint32_t) utf8_name_size;
+
+	if( ( parent_index->number_of_entries > 0 )
+	 && ( object_identifier < parent_index->entries[ parent_index->number_of_entries - 1 ].object_identifier ) )
+	{
+		parent_index->is_sorted = 0;
+	}
+	parent_index->names_data_size   += utf8_name_size;
+	parent_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_parent_index_get_entry_by_index(
+     libfsrefs_parent_index_t *parent_index,
+     int entry_index,
+     libfsrefs_parent_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_parent_index_get_entry_by_index";
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= parent_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( parent_index->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Compares two parent index entries by object identifier
+ * Returns -1, 0 or 1 as required by qsort
+ */
+static int libfsrefs_parent_index_entry_compare(
+            const void *first_entry,
+            const void *second_entry )
+{
+	const libfsrefs_parent_index_entry_t *first  = (const libfsrefs_parent_index_entry_t *) first_entry;
+	const libfsrefs_parent_index_entry_t *second = (const libfsrefs_parent_index_entry_t *) second_entry;
+
+	if( first->object_identifier < second->object_identifier )
+	{
+		return( -1 );
+	}
+	if( first->object_identifier > second->object_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the entries by object identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_parent_index_sort(
+     libfsrefs_parent_index_t *parent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_parent_index_sort";
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_index->is_sorted == 0 )
+	 && ( parent_index->number_of_entries > 1 ) )
+	{
+		qsort(
+		 parent_index->entries,
+		 (size_t) parent_index->number_of_entries,
+		 sizeof( libfsrefs_parent_index_entry_t ),
+		 &libfsrefs_parent_index_entry_compare );
+	}
+	parent_index->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific object identifier
+ * The entries must be sorted before calling this function
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_parent_index_get_entry_by_identifier(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     libfsrefs_parent_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_parent_index_get_entry_by_identifier";
+	int first_index       = 0;
+	int last_index        = 0;
+	int middle_index      = 0;
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_index->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parent index - entries are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	last_index = parent_index->number_of_entries;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+		if( parent_index->entries[ middle_index ].object_identifier < object_identifier )
+		{
+			first_index = middle_index + 1;
+		}
+		else if( parent_index->entries[ middle_index ].object_identifier > object_identifier )
+		{
+			last_index = middle_index;
+		}
+		else
+		{
+			*entry = &( parent_index->entries[ middle_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a specific object identifier
+ * If a UTF-8 encoded name is provided it is appended as the last path segment
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_parent_index_get_utf8_path_size(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_parent_index_entry_t *entry = NULL;
+	static char *function                 = "libfsrefs_parent_index_get_utf8_path_size";
+	size_t safe_utf8_string_size          = 1;
+	int depth                             = 0;
+	int result                            = 0;
+
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name != NULL )
+	{
+		if( ( utf8_name_size > 0 )
+		 && ( utf8_name[ utf8_name_size - 1 ] == 0 ) )
+		{
+			utf8_name_size -= 1;
+		}
+		safe_utf8_string_size += 1 + utf8_name_size;
+	}
+	while( object_identifier != LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY )
+	{
+		if( depth >= LIBFSREFS_PARENT_INDEX_MAXIMUM_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid depth value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfsrefs_parent_index_get_entry_by_identifier(
+		          parent_index,
+		          object_identifier,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: 0x%08" PRIx64 ".",
+			 function,
+			 object_identifier );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		safe_utf8_string_size += 1 + entry->name_size;
+
+		object_identifier = entry->parent_object_identifier;
+
+		depth++;
+	}
+	if( safe_utf8_string_size == 1 )
+	{
+		safe_utf8_string_size = 2;
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific object identifier
+ * If a UTF-8 encoded name is provided it is appended as the last path segment
+ * The path segments are separated by a backslash and the path starts with a backslash
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_parent_index_get_utf8_path(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_parent_index_entry_t *entry = NULL;
+	static char *function                 = "libfsrefs_parent_index_get_utf8_path";
+	size_t path_size                      = 0;
+	size_t string_index                   = 0;
+	int result                            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          object_identifier,
+	          utf8_name,
+	          utf8_name_size,
+	          &path_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 path size.",
+			 function );
+		}
+		return( result );
+	}
+	if( utf8_string_size < path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path is filled from the end towards the start
+	 */
+	string_index = path_size - 1;
+
+	utf8_string[ string_index ] = 0;
+
+	if( utf8_name != NULL )
+	{
+		if( ( utf8_name_size > 0 )
+		 && ( utf8_name[ utf8_name_size - 1 ] == 0 ) )
+		{
+			utf8_name_size -= 1;
+		}
+		string_index -= utf8_name_size;
+
+		if( utf8_name_size > 0 )
+		{
+			if( memory_copy(
+			     &( utf8_string[ string_index ] ),
+			     utf8_name,
+			     utf8_name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 name.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		string_index -= 1;
+
+		utf8_string[ string_index ] = (uint8_t) '\\';
+	}
+	/* The size check above guarantees the depth and the entries are valid
+	 */
+	while( object_identifier != LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY )
+	{
+		if( libfsrefs_parent_index_get_entry_by_identifier(
+		     parent_index,
+		     object_identifier,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: 0x%08" PRIx64 ".",
+			 function,
+			 object_identifier );
+
+			return( -1 );
+		}
+		string_index -= entry->name_size;
+
+		if( entry->name_size > 0 )
+		{
+			if( memory_copy(
+			     &( utf8_string[ string_index ] ),
+			     &( parent_index->names_data[ entry->name_offset ] ),
+			     (size_t) entry->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 name.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		string_index -= 1;
+
+		utf8_string[ string_index ] = (uint8_t) '\\';
+
+		object_identifier = entry->parent_object_identifier;
+	}
+	if( string_index > 0 )
+	{
+		utf8_string[ 0 ] = (uint8_t) '\\';
+	}
+	return( 1 );
+}
+
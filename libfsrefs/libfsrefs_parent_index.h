@@ -0,0 +1,143 @@
+/*
+ * Parent index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_PARENT_INDEX_H )
+#define _LIBFSREFS_PARENT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_parent_index_entry libfsrefs_parent_index_entry_t;
+
+struct libfsrefs_parent_index_entry
+{
+	/* The object identifier
+	 */
+	uint64_t object_identifier;
+
+	/* The parent object identifier
+	 */
+	uint64_t parent_object_identifier;
+
+	/* The offset of the UTF-8 encoded name in the names data
+	 */
+	uint32_t name_offset;
+
+	/* The UTF-8 encoded name size, without the end-of-string character
+	 */
+	uint32_t name_size;
+};
+
+typedef struct libfsrefs_parent_index libfsrefs_parent_index_t;
+
+struct libfsrefs_parent_index
+{
+	/* The entries
+	 */
+	libfsrefs_parent_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The names data
+	 * This contains the UTF-8 encoded names of all the entries, without end-of-string characters
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* Value to indicate the entries are sorted by object identifier
+	 */
+	uint8_t is_sorted;
+};
+
+int libfsrefs_parent_index_initialize(
+     libfsrefs_parent_index_t **parent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_free(
+     libfsrefs_parent_index_t **parent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_append_entry(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     uint64_t parent_object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_get_entry_by_index(
+     libfsrefs_parent_index_t *parent_index,
+     int entry_index,
+     libfsrefs_parent_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_sort(
+     libfsrefs_parent_index_t *parent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_get_entry_by_identifier(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     libfsrefs_parent_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_get_utf8_path_size(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libfsrefs_parent_index_get_utf8_path(
+     libfsrefs_parent_index_t *parent_index,
+     uint64_t object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_PARENT_INDEX_H ) */
+
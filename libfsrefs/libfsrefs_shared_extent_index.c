@@ -0,0 +1,931 @@
+/*
+ * Shared extent index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_extent_scheduler.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
+#include "libfsrefs_shared_extent_index.h"
+
+/* Creates a shared extent index
+ * Make sure the value shared_extent_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_initialize(
+     libfsrefs_shared_extent_index_t **shared_extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_shared_extent_index_initialize";
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_extent_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared extent index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_extent_index = memory_allocate_structure(
+	                        libfsrefs_shared_extent_index_t );
+
+	if( *shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared extent index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *shared_extent_index,
+	     0,
+	     sizeof( libfsrefs_shared_extent_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared extent index.",
+		 function );
+
+		memory_free(
+		 *shared_extent_index );
+
+		*shared_extent_index = NULL;
+
+		return( -1 );
+	}
+	if( libfsrefs_extent_scheduler_initialize(
+	     &( ( *shared_extent_index )->references ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create references.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *shared_extent_index != NULL )
+	{
+		memory_free(
+		 *shared_extent_index );
+
+		*shared_extent_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a shared extent index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_free(
+     libfsrefs_shared_extent_index_t **shared_extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_shared_extent_index_free";
+	int result            = 1;
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_extent_index != NULL )
+	{
+		if( libfsrefs_extent_scheduler_free(
+		     &( ( *shared_extent_index )->references ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free references.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *shared_extent_index )->shared_extents != NULL )
+		{
+			memory_free(
+			 ( *shared_extent_index )->shared_extents );
+		}
+		if( ( *shared_extent_index )->names_data != NULL )
+		{
+			memory_free(
+			 ( *shared_extent_index )->names_data );
+		}
+		if( ( *shared_extent_index )->files != NULL )
+		{
+			memory_free(
+			 ( *shared_extent_index )->files );
+		}
+		memory_free(
+		 *shared_extent_index );
+
+		*shared_extent_index = NULL;
+	}
+	return( result );
+}
+
+/* Appends a file
+ * The UTF-8 encoded name is stored in the names data of the shared extent index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_append_file(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     uint64_t parent_object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     int *file_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_shared_extent_file_t *files = NULL;
+	uint8_t *names_data                   = NULL;
+	static char *function                 = "libfsrefs_shared_extent_index_append_file";
+	size_t allocated_names_data_size      = 0;
+	size_t files_size                     = 0;
+	int number_of_allocated_files         = 0;
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared extent index - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size > (size_t) LIBFSREFS_PARENT_INDEX_MAXIMUM_NAME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_name_size > 0 )
+	 && ( utf8_name[ utf8_name_size - 1 ] == 0 ) )
+	{
+		utf8_name_size -= 1;
+	}
+	if( shared_extent_index->names_data_size > (size_t) ( UINT32_MAX - utf8_name_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid shared extent index - names data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index->number_of_files >= shared_extent_index->number_of_allocated_files )
+	{
+		if( shared_extent_index->number_of_allocated_files >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid shared extent index - number of allocated files value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( shared_extent_index->number_of_allocated_files == 0 )
+		{
+			number_of_allocated_files = 256;
+		}
+		else
+		{
+			number_of_allocated_files = shared_extent_index->number_of_allocated_files * 2;
+		}
+		files_size = sizeof( libfsrefs_shared_extent_file_t ) * (size_t) number_of_allocated_files;
+
+		if( files_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid files size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		files = (libfsrefs_shared_extent_file_t *) memory_reallocate(
+		                                            shared_extent_index->files,
+		                                            files_size );
+
+		if( files == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize files.",
+			 function );
+
+			return( -1 );
+		}
+		shared_extent_index->files                     = files;
+		shared_extent_index->number_of_allocated_files = number_of_allocated_files;
+	}
+	if( utf8_name_size > ( shared_extent_index->allocated_names_data_size - shared_extent_index->names_data_size ) )
+	{
+		if( shared_extent_index->allocated_names_data_size == 0 )
+		{
+			allocated_names_data_size = 16 * 1024;
+		}
+		else
+		{
+			allocated_names_data_size = shared_extent_index->allocated_names_data_size;
+		}
+		while( allocated_names_data_size < ( shared_extent_index->names_data_size + utf8_name_size ) )
+		{
+			allocated_names_data_size *= 2;
+		}
+		if( allocated_names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid names data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		names_data = (uint8_t *) memory_reallocate(
+		                          shared_extent_index->names_data,
+		                          allocated_names_data_size );
+
+		if( names_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		shared_extent_index->names_data                = names_data;
+		shared_extent_index->allocated_names_data_size = allocated_names_data_size;
+	}
+	if( utf8_name_size > 0 )
+	{
+		if( memory_copy(
+		     &( shared_extent_index->names_data[ shared_extent_index->names_data_size ] ),
+		     utf8_name,
+		     utf8_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	files = &( shared_extent_index->files[ shared_extent_index->number_of_files ] );
+
+	files->parent_object_identifier = parent_object_identifier;
+	files->name_offset              = (uint32_t) shared_extent_index->names_data_size;
+	files->name_size                = (uint32_t) utf8_name_size;
+
+	*file_index = shared_extent_index->number_of_files;
+
+	shared_extent_index->names_data_size += utf8_name_size;
+	shared_extent_index->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Appends the extents of the data block stream of a specific file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_append_data_block_stream(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     int file_index,
+     libfdata_stream_t *data_block_stream,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_shared_extent_index_append_data_block_stream";
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared extent index - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( file_index >= shared_extent_index->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_extent_scheduler_append_data_block_stream(
+	     shared_extent_index->references,
+	     data_block_stream,
+	     data_size,
+	     file_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data block stream of file: %d.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a shared extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_append_shared_extent(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     off64_t physical_offset,
+     size64_t size,
+     int first_reference_index,
+     int number_of_references,
+     libcerror_error_t **error )
+{
+	libfsrefs_shared_extent_t *shared_extents = NULL;
+	static char *function                     = "libfsrefs_shared_extent_index_append_shared_extent";
+	size_t shared_extents_size                = 0;
+	int number_of_allocated_shared_extents    = 0;
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_reference_index < 0 )
+	 || ( number_of_references < 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index->number_of_shared_extents >= shared_extent_index->number_of_allocated_shared_extents )
+	{
+		if( shared_extent_index->number_of_allocated_shared_extents >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid shared extent index - number of allocated shared extents value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( shared_extent_index->number_of_allocated_shared_extents == 0 )
+		{
+			number_of_allocated_shared_extents = 64;
+		}
+		else
+		{
+			number_of_allocated_shared_extents = shared_extent_index->number_of_allocated_shared_extents * 2;
+		}
+		shared_extents_size = sizeof( libfsrefs_shared_extent_t ) * (size_t) number_of_allocated_shared_extents;
+
+		if( shared_extents_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid shared extents size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		shared_extents = (libfsrefs_shared_extent_t *) memory_reallocate(
+		                                                shared_extent_index->shared_extents,
+		                                                shared_extents_size );
+
+		if( shared_extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize shared extents.",
+			 function );
+
+			return( -1 );
+		}
+		shared_extent_index->shared_extents                     = shared_extents;
+		shared_extent_index->number_of_allocated_shared_extents = number_of_allocated_shared_extents;
+	}
+	shared_extents = &( shared_extent_index->shared_extents[ shared_extent_index->number_of_shared_extents ] );
+
+	shared_extents->physical_offset       = physical_offset;
+	shared_extents->size                  = size;
+	shared_extents->first_reference_index = first_reference_index;
+	shared_extents->number_of_references  = number_of_references;
+
+	shared_extent_index->number_of_shared_extents += 1;
+
+	return( 1 );
+}
+
+/* Finalizes the shared extent index
+ * The references are sorted by physical offset and grouped into clusters of
+ * overlapping physical ranges. A cluster that is referenced more than once is
+ * a shared extent. The references that are not part of a shared extent are
+ * discarded so that the references of a shared extent are stored consecutively.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_finalize(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_scheduled_extent_t *extents = NULL;
+	static char *function                 = "libfsrefs_shared_extent_index_finalize";
+	off64_t cluster_end_offset            = 0;
+	off64_t extent_end_offset             = 0;
+	int cluster_start_index               = 0;
+	int extent_index                      = 0;
+	int number_of_extents                 = 0;
+	int number_of_references              = 0;
+	int reference_index                   = 0;
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared extent index - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_extent_scheduler_sort(
+	     shared_extent_index->references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort references.",
+		 function );
+
+		return( -1 );
+	}
+	extents           = shared_extent_index->references->extents;
+	number_of_extents = shared_extent_index->references->number_of_extents;
+
+	while( extent_index < number_of_extents )
+	{
+		cluster_start_index = extent_index;
+		cluster_end_offset  = extents[ extent_index ].physical_offset + (off64_t) extents[ extent_index ].size;
+
+		for( extent_index += 1;
+		     extent_index < number_of_extents;
+		     extent_index++ )
+		{
+			if( extents[ extent_index ].physical_offset >= cluster_end_offset )
+			{
+				break;
+			}
+			extent_end_offset = extents[ extent_index ].physical_offset + (off64_t) extents[ extent_index ].size;
+
+			if( extent_end_offset > cluster_end_offset )
+			{
+				cluster_end_offset = extent_end_offset;
+			}
+		}
+		number_of_references = extent_index - cluster_start_index;
+
+		if( number_of_references < 2 )
+		{
+			continue;
+		}
+		if( libfsrefs_shared_extent_index_append_shared_extent(
+		     shared_extent_index,
+		     extents[ cluster_start_index ].physical_offset,
+		     (size64_t) ( cluster_end_offset - extents[ cluster_start_index ].physical_offset ),
+		     reference_index,
+		     number_of_references,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append shared extent.",
+			 function );
+
+			return( -1 );
+		}
+		/* The references are compacted in place, the write index never exceeds the read index
+		 */
+		while( cluster_start_index < extent_index )
+		{
+			if( reference_index != cluster_start_index )
+			{
+				extents[ reference_index ] = extents[ cluster_start_index ];
+			}
+			reference_index++;
+			cluster_start_index++;
+		}
+	}
+	shared_extent_index->references->number_of_extents = reference_index;
+	shared_extent_index->is_finalized                  = 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific shared extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_get_shared_extent_by_index(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     int shared_extent_index_value,
+     libfsrefs_shared_extent_t **shared_extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_shared_extent_index_get_shared_extent_by_index";
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shared_extent_index_value < 0 )
+	 || ( shared_extent_index_value >= shared_extent_index->number_of_shared_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_extent = &( shared_extent_index->shared_extents[ shared_extent_index_value ] );
+
+	return( 1 );
+}
+
+/* Retrieves the index of the shared extent that contains a specific physical offset
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     off64_t physical_offset,
+     int *shared_extent_index_value,
+     libcerror_error_t **error )
+{
+	libfsrefs_shared_extent_t *shared_extent = NULL;
+	static char *function                    = "libfsrefs_shared_extent_index_get_shared_extent_index_by_offset";
+	int first_index                          = 0;
+	int last_index                           = 0;
+	int middle_index                         = 0;
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index value.",
+		 function );
+
+		return( -1 );
+	}
+	last_index = shared_extent_index->number_of_shared_extents;
+
+	while( first_index < last_index )
+	{
+		middle_index  = first_index + ( ( last_index - first_index ) / 2 );
+		shared_extent = &( shared_extent_index->shared_extents[ middle_index ] );
+
+		if( physical_offset < shared_extent->physical_offset )
+		{
+			last_index = middle_index;
+		}
+		else if( (size64_t) ( physical_offset - shared_extent->physical_offset ) >= shared_extent->size )
+		{
+			first_index = middle_index + 1;
+		}
+		else
+		{
+			*shared_extent_index_value = middle_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific reference of a specific shared extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_shared_extent_index_get_reference(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     int shared_extent_index_value,
+     int reference_index,
+     libfsrefs_scheduled_extent_t **reference,
+     libfsrefs_shared_extent_file_t **file,
+     libcerror_error_t **error )
+{
+	libfsrefs_scheduled_extent_t *safe_reference = NULL;
+	libfsrefs_shared_extent_t *shared_extent     = NULL;
+	static char *function                        = "libfsrefs_shared_extent_index_get_reference";
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_shared_extent_index_get_shared_extent_by_index(
+	     shared_extent_index,
+	     shared_extent_index_value,
+	     &shared_extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shared extent: %d.",
+		 function,
+		 shared_extent_index_value );
+
+		return( -1 );
+	}
+	if( ( reference_index < 0 )
+	 || ( reference_index >= shared_extent->number_of_references ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid reference index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	reference_index += shared_extent->first_reference_index;
+
+	if( reference_index >= shared_extent_index->references->number_of_extents )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared extent: %d - reference index value out of bounds.",
+		 function,
+		 shared_extent_index_value );
+
+		return( -1 );
+	}
+	safe_reference = &( shared_extent_index->references->extents[ reference_index ] );
+
+	if( ( safe_reference->file_entry_index < 0 )
+	 || ( safe_reference->file_entry_index >= shared_extent_index->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid reference - file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*reference = safe_reference;
+	*file      = &( shared_extent_index->files[ safe_reference->file_entry_index ] );
+
+	return( 1 );
+}
+
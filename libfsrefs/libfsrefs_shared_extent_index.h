@@ -0,0 +1,188 @@
+/*
+ * Shared extent index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_SHARED_EXTENT_INDEX_H )
+#define _LIBFSREFS_SHARED_EXTENT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_extent_scheduler.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_shared_extent_file libfsrefs_shared_extent_file_t;
+
+struct libfsrefs_shared_extent_file
+{
+	/* The parent object identifier
+	 */
+	uint64_t parent_object_identifier;
+
+	/* The offset of the UTF-8 encoded name in the names data
+	 */
+	uint32_t name_offset;
+
+	/* The UTF-8 encoded name size, without the end-of-string character
+	 */
+	uint32_t name_size;
+};
+
+typedef struct libfsrefs_shared_extent libfsrefs_shared_extent_t;
+
+struct libfsrefs_shared_extent
+{
+	/* The physical offset
+	 */
+	off64_t physical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The index of the first reference
+	 */
+	int first_reference_index;
+
+	/* The number of references
+	 */
+	int number_of_references;
+};
+
+typedef struct libfsrefs_shared_extent_index libfsrefs_shared_extent_index_t;
+
+struct libfsrefs_shared_extent_index
+{
+	/* The references
+	 * Contains an extent per allocated segment of the data stream of the files,
+	 * where file_entry_index refers to the files. After the index is finalized
+	 * only the extents that are part of a shared extent remain
+	 */
+	libfsrefs_extent_scheduler_t *references;
+
+	/* The files
+	 */
+	libfsrefs_shared_extent_file_t *files;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of allocated files
+	 */
+	int number_of_allocated_files;
+
+	/* The names data
+	 * This contains the UTF-8 encoded names of all the files, without end-of-string characters
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The shared extents
+	 * These are sorted by physical offset and do not overlap
+	 */
+	libfsrefs_shared_extent_t *shared_extents;
+
+	/* The number of shared extents
+	 */
+	int number_of_shared_extents;
+
+	/* The number of allocated shared extents
+	 */
+	int number_of_allocated_shared_extents;
+
+	/* Value to indicate the index was finalized
+	 */
+	uint8_t is_finalized;
+};
+
+int libfsrefs_shared_extent_index_initialize(
+     libfsrefs_shared_extent_index_t **shared_extent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_free(
+     libfsrefs_shared_extent_index_t **shared_extent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_append_file(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     uint64_t parent_object_identifier,
+     const uint8_t *utf8_name,
+     size_t utf8_name_size,
+     int *file_index,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_append_data_block_stream(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     int file_index,
+     libfdata_stream_t *data_block_stream,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_append_shared_extent(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     off64_t physical_offset,
+     size64_t size,
+     int first_reference_index,
+     int number_of_references,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_finalize(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_get_shared_extent_by_index(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     int shared_extent_index_value,
+     libfsrefs_shared_extent_t **shared_extent,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     off64_t physical_offset,
+     int *shared_extent_index_value,
+     libcerror_error_t **error );
+
+int libfsrefs_shared_extent_index_get_reference(
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     int shared_extent_index_value,
+     int reference_index,
+     libfsrefs_scheduled_extent_t **reference,
+     libfsrefs_shared_extent_file_t **file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_SHARED_EXTENT_INDEX_H ) */
+
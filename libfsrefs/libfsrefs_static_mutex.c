@@ -0,0 +1,134 @@
+/*
+ * Statically initialized mutex functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+#include "libfsrefs_static_mutex.h"
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+/* Grabs a statically initialized mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_static_mutex_grab(
+     libfsrefs_static_mutex_t *static_mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_static_mutex_grab";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( static_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid static mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	while( InterlockedCompareExchange(
+	        &( static_mutex->lock_value ),
+	        1,
+	        0 ) != 0 )
+	{
+		Sleep(
+		 0 );
+	}
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_mutex_lock(
+	                  &( static_mutex->mutex ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 pthread_result,
+		 "%s: unable to lock mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a statically initialized mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_static_mutex_release(
+     libfsrefs_static_mutex_t *static_mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_static_mutex_release";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( static_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid static mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	InterlockedExchange(
+	 &( static_mutex->lock_value ),
+	 0 );
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_mutex_unlock(
+	                  &( static_mutex->mutex ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 pthread_result,
+		 "%s: unable to unlock mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,94 @@
+/*
+ * Statically initialized mutex functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSREFS_STATIC_MUTEX_H )
+#define _LIBFSREFS_STATIC_MUTEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcthreads.h"
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+
+#endif
+
+#endif /* defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+/* A statically initialized mutex guards process-wide state that is created on first use,
+ * for which a libcthreads mutex cannot be used since it must be created itself
+ */
+typedef struct libfsrefs_static_mutex libfsrefs_static_mutex_t;
+
+struct libfsrefs_static_mutex
+{
+#if defined( WINAPI )
+	/* The lock value, where 0 represents released and 1 grabbed
+	 * A spin lock is used since SRW locks are not available before Windows Vista
+	 */
+	LONG volatile lock_value;
+
+#elif defined( HAVE_PTHREAD_H )
+	/* The mutex
+	 */
+	pthread_mutex_t mutex;
+
+#endif
+};
+
+#if defined( WINAPI )
+#define LIBFSREFS_STATIC_MUTEX_INITIALIZER	{ 0 }
+
+#elif defined( HAVE_PTHREAD_H )
+#define LIBFSREFS_STATIC_MUTEX_INITIALIZER	{ PTHREAD_MUTEX_INITIALIZER }
+
+#endif
+
+int libfsrefs_static_mutex_grab(
+     libfsrefs_static_mutex_t *static_mutex,
+     libcerror_error_t **error );
+
+int libfsrefs_static_mutex_release(
+     libfsrefs_static_mutex_t *static_mutex,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_STATIC_MUTEX_H ) */
+
@@ -0,0 +1,323 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_static_mutex.h"
+#include "libfsrefs_statistics.h"
+
+/* The statistics are updated by concurrent readers that share the IO handle.
+ * Relaxed atomic operations are used since the values are independent counters
+ * that do not order other memory accesses.
+ */
+#if defined( WINAPI ) && defined( _WIN64 )
+#define libfsrefs_statistics_atomic_add( value, amount ) \
+	InterlockedExchangeAdd64( (LONG64 volatile *) value, (LONG64) amount )
+
+#define libfsrefs_statistics_atomic_load( value ) \
+	(uint64_t) InterlockedCompareExchange64( (LONG64 volatile *) value, 0, 0 )
+
+#define libfsrefs_statistics_atomic_store( value, new_value ) \
+	InterlockedExchange64( (LONG64 volatile *) value, (LONG64) new_value )
+
+#elif defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) )
+#define libfsrefs_statistics_atomic_add( value, amount ) \
+	__atomic_fetch_add( value, amount, __ATOMIC_RELAXED )
+
+#define libfsrefs_statistics_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_RELAXED )
+
+#define libfsrefs_statistics_atomic_store( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELAXED )
+
+#elif defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+
+/* Without 64-bit atomic operations, such as on 32-bit Windows XP targets,
+ * the values are guarded by a process-wide mutex
+ */
+static libfsrefs_static_mutex_t libfsrefs_statistics_mutex = LIBFSREFS_STATIC_MUTEX_INITIALIZER;
+
+#define libfsrefs_statistics_atomic_add( value, amount ) \
+	libfsrefs_statistics_locked_add( value, amount )
+
+#define libfsrefs_statistics_atomic_load( value ) \
+	libfsrefs_statistics_locked_load( value )
+
+#define libfsrefs_statistics_atomic_store( value, new_value ) \
+	libfsrefs_statistics_locked_store( value, new_value )
+
+/* Adds an amount to a value while holding the statistics mutex
+ * The value is not changed if the mutex cannot be grabbed
+ */
+static void libfsrefs_statistics_locked_add(
+             uint64_t *value,
+             uint64_t amount )
+{
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_statistics_mutex,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	*value += amount;
+
+	libfsrefs_static_mutex_release(
+	 &libfsrefs_statistics_mutex,
+	 NULL );
+}
+
+/* Retrieves a value while holding the statistics mutex
+ * Returns the value or 0 if the mutex cannot be grabbed
+ */
+static uint64_t libfsrefs_statistics_locked_load(
+                 uint64_t *value )
+{
+	uint64_t safe_value = 0;
+
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_statistics_mutex,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	safe_value = *value;
+
+	libfsrefs_static_mutex_release(
+	 &libfsrefs_statistics_mutex,
+	 NULL );
+
+	return( safe_value );
+}
+
+/* Sets a value while holding the statistics mutex
+ * The value is not changed if the mutex cannot be grabbed
+ */
+static void libfsrefs_statistics_locked_store(
+             uint64_t *value,
+             uint64_t new_value )
+{
+	if( libfsrefs_static_mutex_grab(
+	     &libfsrefs_statistics_mutex,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	*value = new_value;
+
+	libfsrefs_static_mutex_release(
+	 &libfsrefs_statistics_mutex,
+	 NULL );
+}
+
+#else
+
+/* Without multi-thread support there are no concurrent readers
+ */
+#define libfsrefs_statistics_atomic_add( value, amount ) \
+	*value += amount
+
+#define libfsrefs_statistics_atomic_load( value ) \
+	*value
+
+#define libfsrefs_statistics_atomic_store( value, new_value ) \
+	*value = new_value
+
+#endif
+
+/* Adds an amount to a specific statistics value
+ * This function is called on the read paths and therefore does not report errors,
+ * invalid node types and statistics values are ignored
+ */
+void libfsrefs_statistics_add_value(
+      libfsrefs_statistics_t *statistics,
+      int node_type,
+      int statistics_value,
+      uint64_t amount )
+{
+	if( statistics == NULL )
+	{
+		return;
+	}
+	if( ( node_type < 0 )
+	 || ( node_type >= LIBFSREFS_NUMBER_OF_NODE_TYPES ) )
+	{
+		return;
+	}
+	if( ( statistics_value < 0 )
+	 || ( statistics_value >= LIBFSREFS_NUMBER_OF_STATISTICS_VALUES ) )
+	{
+		return;
+	}
+	libfsrefs_statistics_atomic_add(
+	 &( statistics->values[ node_type ][ statistics_value ] ),
+	 amount );
+}
+
+/* Retrieves a specific statistics value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_statistics_get_value(
+     libfsrefs_statistics_t *statistics,
+     int node_type,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_statistics_get_value";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_type < 0 )
+	 || ( node_type >= LIBFSREFS_NUMBER_OF_NODE_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported node type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( statistics_value < 0 )
+	 || ( statistics_value >= LIBFSREFS_NUMBER_OF_STATISTICS_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	*value = libfsrefs_statistics_atomic_load(
+	          &( statistics->values[ node_type ][ statistics_value ] ) );
+
+	return( 1 );
+}
+
+/* Clears the statistics
+ * The values are cleared one at a time since concurrent readers can update them
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_statistics_clear(
+     libfsrefs_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_statistics_clear";
+	int node_type         = 0;
+	int statistics_value  = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_type = 0;
+	     node_type < LIBFSREFS_NUMBER_OF_NODE_TYPES;
+	     node_type++ )
+	{
+		for( statistics_value = 0;
+		     statistics_value < LIBFSREFS_NUMBER_OF_STATISTICS_VALUES;
+		     statistics_value++ )
+		{
+			libfsrefs_statistics_atomic_store(
+			 &( statistics->values[ node_type ][ statistics_value ] ),
+			 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a monotonic timestamp in nano seconds
+ * Returns the timestamp or 0 if not supported
+ */
+uint64_t libfsrefs_statistics_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	      + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
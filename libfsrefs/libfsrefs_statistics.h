@@ -0,0 +1,69 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_STATISTICS_H )
+#define _LIBFSREFS_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsrefs_statistics libfsrefs_statistics_t;
+
+struct libfsrefs_statistics
+{
+	/* The values per node type
+	 */
+	uint64_t values[ LIBFSREFS_NUMBER_OF_NODE_TYPES ][ LIBFSREFS_NUMBER_OF_STATISTICS_VALUES ];
+};
+
+void libfsrefs_statistics_add_value(
+      libfsrefs_statistics_t *statistics,
+      int node_type,
+      int statistics_value,
+      uint64_t amount );
+
+int libfsrefs_statistics_get_value(
+     libfsrefs_statistics_t *statistics,
+     int node_type,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libfsrefs_statistics_clear(
+     libfsrefs_statistics_t *statistics,
+     libcerror_error_t **error );
+
+uint64_t libfsrefs_statistics_get_timestamp(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_STATISTICS_H ) */
+
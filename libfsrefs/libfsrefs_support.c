@@ -31,6 +31,8 @@
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_libclocale.h"
 #include "libfsrefs_libcnotify.h"
+#include "libfsrefs_memory_budget.h"
+#include "libfsrefs_open_pool.h"
 #include "libfsrefs_support.h"
 
 #if !defined( HAVE_LOCAL_LIBFSREFS )
@@ -105,6 +107,228 @@ int libfsrefs_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBFSREFS ) */
 
+/* Retrieves the process-wide memory limit
+ * A value of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_get_memory_limit(
+     size64_t *memory_limit,
+     libcerror_error_t **error )
+{
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	static char *function                    = "libfsrefs_get_memory_limit";
+	int result                               = 0;
+
+	if( memory_limit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory limit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &memory_budget,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve process memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*memory_limit = 0;
+	}
+	else if( libfsrefs_memory_budget_get_maximum_size(
+	          memory_budget,
+	          memory_limit,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum size from process memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the process-wide memory limit
+ * The memory limit applies to the directory objects cached by volumes. Only volumes that are
+ * created after the first call with a non-zero memory limit are bounded, volumes created
+ * before that remain unbounded. When the memory limit is exceeded the least recently used
+ * directory objects that are not in use are freed from each of the bounded volumes in turn.
+ * A value of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_set_memory_limit(
+     size64_t memory_limit,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_set_memory_limit";
+
+	if( libfsrefs_memory_budget_set_process_maximum_size(
+	     memory_limit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum size of process memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the process-wide (estimated) memory usage of the cached directory objects
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_get_memory_usage(
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	static char *function                    = "libfsrefs_get_memory_usage";
+	int result                               = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &memory_budget,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve process memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*memory_usage = 0;
+	}
+	else if( libfsrefs_memory_budget_get_current_size(
+	          memory_budget,
+	          memory_usage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current size from process memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of threads used to open volumes asynchronously
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_get_number_of_open_threads(
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_get_number_of_open_threads";
+
+	if( libfsrefs_open_pool_get_number_of_threads(
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of threads from open pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the number of threads used to open volumes asynchronously
+ * The number of threads cannot be changed while asynchronous opens are pending
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_set_number_of_open_threads(
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_set_number_of_open_threads";
+
+	if( libfsrefs_open_pool_set_number_of_threads(
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads of open pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for all asynchronous opens to complete
+ * This function must not be called from an open callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_wait_for_open_requests(
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_wait_for_open_requests";
+
+	if( libfsrefs_open_pool_join(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join open pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Determines if a file contains a REFS volume signature
  * Returns 1 if true, 0 if not or -1 on error
  */
@@ -55,6 +55,35 @@ int libfsrefs_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBFSREFS ) */
 
+LIBFSREFS_EXTERN \
+int libfsrefs_get_memory_limit(
+     size64_t *memory_limit,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_set_memory_limit(
+     size64_t memory_limit,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_get_memory_usage(
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_get_number_of_open_threads(
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_set_number_of_open_threads(
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_wait_for_open_requests(
+     libcerror_error_t **error );
+
 LIBFSREFS_EXTERN \
 int libfsrefs_check_volume_signature(
      const char *filename,
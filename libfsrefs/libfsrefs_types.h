@@ -34,15 +34,71 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfsrefs_attribute {}	libfsrefs_attribute_t;
 typedef struct libfsrefs_file_entry {}	libfsrefs_file_entry_t;
+typedef struct libfsrefs_filter {}		libfsrefs_filter_t;
 typedef struct libfsrefs_volume {}	libfsrefs_volume_t;
 
 #else
+typedef intptr_t libfsrefs_attribute_t;
 typedef intptr_t libfsrefs_file_entry_t;
+typedef intptr_t libfsrefs_filter_t;
 typedef intptr_t libfsrefs_volume_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The file entry stat values
+ */
+typedef struct libfsrefs_file_entry_stat libfsrefs_file_entry_stat_t;
+
+struct libfsrefs_file_entry_stat
+{
+	/* The object identifier
+	 */
+	uint64_t object_identifier;
+
+	/* The creation date and time
+	 * Contains a FILETIME
+	 */
+	uint64_t creation_time;
+
+	/* The (file) modification date and time
+	 * Contains a FILETIME
+	 */
+	uint64_t modification_time;
+
+	/* The access date and time
+	 * Contains a FILETIME
+	 */
+	uint64_t access_time;
+
+	/* The (file system) entry modification date and time
+	 * Contains a FILETIME
+	 */
+	uint64_t entry_modification_time;
+
+	/* The size of the default data stream
+	 */
+	size64_t size;
+
+	/* The offset of the UTF-8 encoded name in the names buffer
+	 */
+	size_t name_offset;
+
+	/* The size of the UTF-8 encoded name including the end of string character
+	 * 0 if the name cannot be converted to UTF-8
+	 */
+	size_t name_size;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The (file) entry type
+	 */
+	uint16_t entry_type;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFSREFS ) */
 
 #endif /* !defined( _LIBFSREFS_INTERNAL_TYPES_H ) */
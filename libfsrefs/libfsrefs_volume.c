@@ -28,21 +28,35 @@
 #include "libfsrefs_block_descriptor.h"
 #include "libfsrefs_debug.h"
 #include "libfsrefs_definitions.h"
+#include "libfsrefs_directory_entry.h"
+#include "libfsrefs_directory_object.h"
+#include "libfsrefs_extent_scheduler.h"
 #include "libfsrefs_file_entry.h"
 #include "libfsrefs_file_system.h"
+#include "libfsrefs_filter.h"
+#include "libfsrefs_identifier_set.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcdata.h"
 #include "libfsrefs_libcerror.h"
 #include "libfsrefs_libcnotify.h"
 #include "libfsrefs_libcthreads.h"
 #include "libfsrefs_libfcache.h"
 #include "libfsrefs_libfdata.h"
 #include "libfsrefs_libuna.h"
+#include "libfsrefs_memory_budget.h"
+#include "libfsrefs_metadata_block_scanner.h"
 #include "libfsrefs_ministore_node.h"
 #include "libfsrefs_node_record.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_open_pool.h"
+#include "libfsrefs_open_request.h"
+#include "libfsrefs_parent_index.h"
+#include "libfsrefs_shared_extent_index.h"
+#include "libfsrefs_statistics.h"
 #include "libfsrefs_volume.h"
 #include "libfsrefs_volume_header.h"
+#include "libfsrefs_volume_index.h"
 
 /* Creates a volume
  * Make sure the value volume is referencing, is set to NULL
@@ -610,6 +624,260 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Opens a volume asynchronously
+ * The volume is opened by a thread of the process-wide open pool, after which
+ * the open callback function is called with the result of the open
+ * The open callback function must not open volumes asynchronously or wait for
+ * the open pool, since the thread that calls it is part of the open pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_open_async(
+     libfsrefs_volume_t *volume,
+     const char *filename,
+     int access_flags,
+     void (*open_callback)(
+            libfsrefs_volume_t *volume,
+            int result,
+            libcerror_error_t *error,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_open_request_t *open_request = NULL;
+	static char *function                  = "libfsrefs_volume_open_async";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSREFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSREFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSREFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_open_request_initialize(
+	     &open_request,
+	     volume,
+	     access_flags,
+	     open_callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create open request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_open_request_set_filename(
+	     open_request,
+	     filename,
+	     narrow_string_length(
+	      filename ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in open request.",
+		 function );
+
+		goto on_error;
+	}
+	/* The open pool takes over management of the open request
+	 */
+	if( libfsrefs_open_pool_push(
+	     open_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push open request onto open pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( open_request != NULL )
+	{
+		libfsrefs_open_request_free(
+		 &open_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a volume asynchronously
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_open_async_wide(
+     libfsrefs_volume_t *volume,
+     const wchar_t *filename,
+     int access_flags,
+     void (*open_callback)(
+            libfsrefs_volume_t *volume,
+            int result,
+            libcerror_error_t *error,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_open_request_t *open_request = NULL;
+	static char *function                  = "libfsrefs_volume_open_async_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSREFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSREFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSREFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_open_request_initialize(
+	     &open_request,
+	     volume,
+	     access_flags,
+	     open_callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create open request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_open_request_set_filename_wide(
+	     open_request,
+	     filename,
+	     wide_string_length(
+	      filename ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in open request.",
+		 function );
+
+		goto on_error;
+	}
+	/* The open pool takes over management of the open request
+	 */
+	if( libfsrefs_open_pool_push(
+	     open_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push open request onto open pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( open_request != NULL )
+	{
+		libfsrefs_open_request_free(
+		 &open_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Opens a volume using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
@@ -1088,13 +1356,26 @@ int libfsrefs_internal_volume_open_read(
 
 		goto on_error;
 	}
-	internal_volume->io_handle->bytes_per_sector     = internal_volume->volume_header->bytes_per_sector;
-	internal_volume->io_handle->volume_size          = internal_volume->volume_header->volume_size;
-	internal_volume->io_handle->major_format_version = internal_volume->volume_header->major_format_version;
-	internal_volume->io_handle->minor_format_version = internal_volume->volume_header->minor_format_version;
-	internal_volume->io_handle->cluster_block_size   = internal_volume->volume_header->cluster_block_size;
-	internal_volume->io_handle->metadata_block_size  = internal_volume->volume_header->metadata_block_size;
-	internal_volume->io_handle->container_size       = internal_volume->volume_header->container_size;
+	if( libfsrefs_io_handle_set_format_version(
+	     internal_volume->io_handle,
+	     internal_volume->volume_header->major_format_version,
+	     internal_volume->volume_header->minor_format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format version in IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->io_handle->bytes_per_sector    = internal_volume->volume_header->bytes_per_sector;
+	internal_volume->io_handle->volume_size         = internal_volume->volume_header->volume_size;
+	internal_volume->io_handle->cluster_block_size  = internal_volume->volume_header->cluster_block_size;
+	internal_volume->io_handle->metadata_block_size = internal_volume->volume_header->metadata_block_size;
+	internal_volume->io_handle->container_size      = internal_volume->volume_header->container_size;
 
 	if( libfsrefs_file_system_initialize(
 	     &( internal_volume->file_system ),
@@ -1256,6 +1537,7 @@ int libfsrefs_internal_volume_open_read(
 	     internal_volume->io_handle,
 	     file_io_handle,
 	     (uint64_t) 0x00000500UL,
+	     LIBFSREFS_NODE_TYPE_UNKNOWN,
 	     &( internal_volume->volume_information_object ),
 	     error ) != 1 )
 	{
@@ -2078,16 +2360,19 @@ int libfsrefs_volume_get_serial_number(
 	return( result );
 }
 
-/* Retrieves the root directory file entry
+/* Retrieves the checkpoint sequence number
+ * The sequence number of the checkpoint the volume metadata was read from
+ * changes whenever the file system is modified. Together with the serial number
+ * it identifies a specific state of the volume.
  * Returns 1 if successful or -1 on error
  */
-int libfsrefs_volume_get_root_directory(
+int libfsrefs_volume_get_checkpoint_sequence_number(
      libfsrefs_volume_t *volume,
-     libfsrefs_file_entry_t **file_entry,
+     uint64_t *sequence_number,
      libcerror_error_t **error )
 {
 	libfsrefs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsrefs_volume_get_root_directory";
+	static char *function                        = "libfsrefs_volume_get_checkpoint_sequence_number";
 	int result                                   = 1;
 
 	if( volume == NULL )
@@ -2103,59 +2388,4024 @@ int libfsrefs_volume_get_root_directory(
 	}
 	internal_volume = (libfsrefs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+#endif
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	else if( libfsrefs_checkpoint_get_sequence_number(
+	          internal_volume->file_system->checkpoint,
+	          sequence_number,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint sequence number.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	if( libfsrefs_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->objects_tree,
-	     NULL,
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root directory file entry.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		result = -1;
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific statistics value
+ * The statistics are maintained per node type, such as the objects tree or
+ * directory nodes, and are cleared when the volume is closed.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_get_statistics(
+     libfsrefs_volume_t *volume,
+     int node_type,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_get_statistics";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_statistics_get_value(
+	     &( internal_volume->io_handle->statistics ),
+	     node_type,
+	     statistics_value,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics value.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Clears the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_clear_statistics(
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_clear_statistics";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_statistics_clear(
+	     &( internal_volume->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the memory limit
+ * A value of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_get_memory_limit(
+     libfsrefs_volume_t *volume,
+     size64_t *memory_limit,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_get_memory_limit";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_memory_budget_get_maximum_size(
+	     internal_volume->io_handle->memory_budget,
+	     memory_limit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum size from memory budget.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the memory limit
+ * The memory limit applies to the directory objects cached by the file entries of the volume.
+ * When the memory limit is exceeded the least recently used directory objects that
+ * are not in use are freed before another directory object is read, and read again
+ * on demand. A value of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_set_memory_limit(
+     libfsrefs_volume_t *volume,
+     size64_t memory_limit,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_set_memory_limit";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_memory_budget_set_maximum_size(
+	     internal_volume->io_handle->memory_budget,
+	     memory_limit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum size of memory budget.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the (estimated) memory usage of the cached directory objects
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_get_memory_usage(
+     libfsrefs_volume_t *volume,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_get_memory_usage";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_memory_budget_get_current_size(
+	     internal_volume->io_handle->memory_budget,
+	     memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current size from memory budget.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the trace callback function
+ * The callback receives the event type, node type, offset, size and duration in nanoseconds
+ * of node reads, directory object reads, objects tree lookups and data reads
+ * Setting the callback to NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_set_trace_callback(
+     libfsrefs_volume_t *volume,
+     void (*trace_callback)(
+            int event_type,
+            int node_type,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_set_trace_callback";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_io_handle_set_trace_callback(
+	     internal_volume->io_handle,
+	     trace_callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callback in IO handle.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_get_root_directory(
+     libfsrefs_volume_t *volume,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_get_root_directory";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->objects_tree,
+	     LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create root directory file entry.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry of a specific object identifier
+ * The object identifier is looked up in the objects tree, without walking the directory hierarchy
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsrefs_volume_get_file_entry_by_identifier(
+     libfsrefs_volume_t *volume,
+     uint64_t object_identifier,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume         = NULL;
+	libfsrefs_volume_index_object_t *volume_index_object = NULL;
+	static char *function                                = "libfsrefs_volume_get_file_entry_by_identifier";
+	int result                                           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing objects tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The directories in the imported volume index are not looked up in the objects tree
+	 */
+	if( internal_volume->objects_tree->volume_index != NULL )
+	{
+		result = libfsrefs_volume_index_get_object_by_identifier(
+		          internal_volume->objects_tree->volume_index,
+		          object_identifier,
+		          &volume_index_object,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if volume index contains identifier: 0x%08" PRIx64 ".",
+			 function,
+			 object_identifier );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libfsrefs_objects_tree_has_object_identifier(
+		          internal_volume->objects_tree,
+		          object_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if objects tree contains identifier: 0x%08" PRIx64 ".",
+			 function,
+			 object_identifier );
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsrefs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->objects_tree,
+		     object_identifier,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry: 0x%08" PRIx64 ".",
+			 function,
+			 object_identifier );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the parent index
+ * The directory hierarchy is walked breadth first, the entries of the parent index
+ * are used as the queue of directories that remain to be read. A directory that is
+ * referenced more than once is only indexed with its first parent
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_internal_volume_read_parent_index(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_parent_index_t *parent_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_entry_t *directory_entry       = NULL;
+	libfsrefs_directory_object_t *directory_object     = NULL;
+	libfsrefs_identifier_set_t *visited_directories    = NULL;
+	libfsrefs_parent_index_entry_t *parent_index_entry = NULL;
+	const uint8_t *utf8_name                           = NULL;
+	static char *function                              = "libfsrefs_internal_volume_read_parent_index";
+	size_t utf8_name_size                              = 0;
+	uint64_t directory_object_identifier               = 0;
+	int directory_entry_index                          = 0;
+	int number_of_directory_entries                    = 0;
+	int parent_index_entry_index                       = 0;
+	int result                                         = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The visited directories are keyed by object identifier and prevent a directory
+	 * from being queued more than once, such as in a corrupted directory hierarchy
+	 * that contains a cycle
+	 */
+	if( libfsrefs_identifier_set_initialize(
+	     &visited_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	directory_object_identifier = LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY;
+
+	if( libfsrefs_identifier_set_insert(
+	     visited_directories,
+	     directory_object_identifier,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert root directory into visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			libfsrefs_identifier_set_free(
+			 &visited_directories,
+			 NULL );
+
+			return( 0 );
+		}
+		if( libfsrefs_directory_object_initialize(
+		     &directory_object,
+		     internal_volume->io_handle,
+		     internal_volume->objects_tree,
+		     directory_object_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory object: 0x%08" PRIx64 ".",
+			 function,
+			 directory_object_identifier );
+
+			goto on_error;
+		}
+		if( libfsrefs_directory_object_read(
+		     directory_object,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory object: 0x%08" PRIx64 ".",
+			 function,
+			 directory_object_identifier );
+
+			goto on_error;
+		}
+		if( libfsrefs_directory_object_get_number_of_directory_entries(
+		     directory_object,
+		     &number_of_directory_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( directory_entry_index = 0;
+		     directory_entry_index < number_of_directory_entries;
+		     directory_entry_index++ )
+		{
+			if( libfsrefs_directory_object_get_directory_entry_by_index(
+			     directory_object,
+			     directory_entry_index,
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				goto on_error;
+			}
+			if( directory_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing directory entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				goto on_error;
+			}
+			if( directory_entry->entry_type != 2 )
+			{
+				continue;
+			}
+			result = libfsrefs_identifier_set_insert(
+			          visited_directories,
+			          directory_entry->object_identifier,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert directory: 0x%08" PRIx64 " into visited directories set.",
+				 function,
+				 directory_entry->object_identifier );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* The directory was already queued
+				 */
+				continue;
+			}
+			utf8_name      = directory_entry->utf8_name;
+			utf8_name_size = directory_entry->utf8_name_size;
+
+			if( utf8_name == NULL )
+			{
+				utf8_name      = (const uint8_t *) "";
+				utf8_name_size = 0;
+			}
+			if( libfsrefs_parent_index_append_entry(
+			     parent_index,
+			     directory_entry->object_identifier,
+			     directory_object_identifier,
+			     utf8_name,
+			     utf8_name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory: 0x%08" PRIx64 " to parent index.",
+				 function,
+				 directory_entry->object_identifier );
+
+				goto on_error;
+			}
+		}
+		if( libfsrefs_directory_object_free(
+		     &directory_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory object.",
+			 function );
+
+			goto on_error;
+		}
+		if( parent_index_entry_index >= parent_index->number_of_entries )
+		{
+			break;
+		}
+		if( libfsrefs_parent_index_get_entry_by_index(
+		     parent_index,
+		     parent_index_entry_index,
+		     &parent_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent index entry: %d.",
+			 function,
+			 parent_index_entry_index );
+
+			goto on_error;
+		}
+		directory_object_identifier = parent_index_entry->object_identifier;
+
+		parent_index_entry_index++;
+	}
+	while( parent_index_entry_index <= parent_index->number_of_entries );
+
+	if( libfsrefs_parent_index_sort(
+	     parent_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort parent index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_identifier_set_free(
+	     &visited_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_object != NULL )
+	{
+		libfsrefs_directory_object_free(
+		 &directory_object,
+		 NULL );
+	}
+	if( visited_directories != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &visited_directories,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the parent index
+ * The parent index maps the object identifier of every directory to its parent directory
+ * and name, which allows the path of a file entry to be determined without walking the
+ * directory hierarchy. The index is built once, further calls have no effect
+ * This function should be called before file entries are used from multiple threads
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_volume_build_parent_index(
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_parent_index_t *parent_index       = NULL;
+	static char *function                        = "libfsrefs_volume_build_parent_index";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing objects tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->objects_tree->parent_index == NULL )
+	{
+		if( libfsrefs_parent_index_initialize(
+		     &parent_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create parent index.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = libfsrefs_internal_volume_read_parent_index(
+			          internal_volume,
+			          parent_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read parent index.",
+				 function );
+			}
+			if( result == 1 )
+			{
+				internal_volume->objects_tree->parent_index = parent_index;
+			}
+			else
+			{
+				libfsrefs_parent_index_free(
+				 &parent_index,
+				 NULL );
+			}
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the volume index
+ * The directory hierarchy is walked breadth first, the objects of the volume index
+ * are used as the queue of directories that remain to be read. A directory that is
+ * referenced more than once is only indexed with its first parent
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_internal_volume_read_volume_index(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_volume_index_t *volume_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_object_t *directory_object       = NULL;
+	libfsrefs_identifier_set_t *visited_directories      = NULL;
+	libfsrefs_volume_index_object_t *volume_index_object = NULL;
+	static char *function                                = "libfsrefs_internal_volume_read_volume_index";
+	uint64_t directory_object_identifier                 = 0;
+	int object_index                                     = 0;
+	int result                                           = 0;
+	int sub_directory_index                              = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_identifier_set_initialize(
+	     &visited_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_identifier_set_insert(
+	     visited_directories,
+	     LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert root directory into visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_index_append_object(
+	     volume_index,
+	     LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root directory to volume index.",
+		 function );
+
+		goto on_error;
+	}
+	for( object_index = 0;
+	     object_index < volume_index->number_of_objects;
+	     object_index++ )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			libfsrefs_identifier_set_free(
+			 &visited_directories,
+			 NULL );
+
+			return( 0 );
+		}
+		if( libfsrefs_volume_index_get_object_by_index(
+		     volume_index,
+		     object_index,
+		     &volume_index_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume index object: %d.",
+			 function,
+			 object_index );
+
+			goto on_error;
+		}
+		directory_object_identifier = volume_index_object->object_identifier;
+
+		if( libfsrefs_volume_index_set_current_object(
+		     volume_index,
+		     object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set current volume index object: %d.",
+			 function,
+			 object_index );
+
+			goto on_error;
+		}
+		if( libfsrefs_directory_object_initialize(
+		     &directory_object,
+		     internal_volume->io_handle,
+		     internal_volume->objects_tree,
+		     directory_object_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory object: 0x%08" PRIx64 ".",
+			 function,
+			 directory_object_identifier );
+
+			goto on_error;
+		}
+		directory_object->export_volume_index = volume_index;
+
+		if( libfsrefs_directory_object_read(
+		     directory_object,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory object: 0x%08" PRIx64 ".",
+			 function,
+			 directory_object_identifier );
+
+			goto on_error;
+		}
+		for( sub_directory_index = 0;
+		     sub_directory_index < directory_object->number_of_sub_directory_identifiers;
+		     sub_directory_index++ )
+		{
+			result = libfsrefs_identifier_set_insert(
+			          visited_directories,
+			          directory_object->sub_directory_identifiers[ sub_directory_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert directory: 0x%08" PRIx64 " into visited directories set.",
+				 function,
+				 directory_object->sub_directory_identifiers[ sub_directory_index ] );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* The directory was already queued
+				 */
+				continue;
+			}
+			if( libfsrefs_volume_index_append_object(
+			     volume_index,
+			     directory_object->sub_directory_identifiers[ sub_directory_index ],
+			     directory_object_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory: 0x%08" PRIx64 " to volume index.",
+				 function,
+				 directory_object->sub_directory_identifiers[ sub_directory_index ] );
+
+				goto on_error;
+			}
+		}
+		if( libfsrefs_directory_object_free(
+		     &directory_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsrefs_volume_index_sort(
+	     volume_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort volume index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_identifier_set_free(
+	     &visited_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_object != NULL )
+	{
+		libfsrefs_directory_object_free(
+		 &directory_object,
+		 NULL );
+	}
+	if( visited_directories != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &visited_directories,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the volume index using a Basic File IO (bfio) handle
+ * The volume index contains the directory entry records of every directory in
+ * the directory hierarchy, including the data runs of the files, and is keyed
+ * by the volume serial number and checkpoint sequence number. The file IO handle
+ * is opened for writing if it is not open
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_volume_export_index_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_volume_index_t *volume_index       = NULL;
+	static char *function                        = "libfsrefs_volume_export_index_file_io_handle";
+	uint8_t file_io_handle_opened_in_library     = 0;
+	int file_io_handle_is_open                   = 0;
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing objects tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_index_initialize(
+	     &volume_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_volume_header_get_volume_serial_number(
+	     internal_volume->volume_header,
+	     &( volume_index->volume_serial_number ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume serial number.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsrefs_checkpoint_get_sequence_number(
+	          internal_volume->file_system->checkpoint,
+	          &( volume_index->checkpoint_sequence_number ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint sequence number.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsrefs_internal_volume_read_volume_index(
+		          internal_volume,
+		          volume_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume index.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+
+		return( result );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfsrefs_volume_index_write_file_io_handle(
+	     volume_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write volume index.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsrefs_volume_index_free(
+	     &volume_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Imports the volume index using a Basic File IO (bfio) handle
+ * The directories in the volume index are read from the volume index instead
+ * of the objects tree. The volume index is only used if its volume serial number
+ * and checkpoint sequence number match those of the volume. The file IO handle
+ * is opened for reading if it is not open
+ * This function should be called before file entries are used
+ * Returns 1 if successful, 0 if the volume index does not match the volume or -1 on error
+ */
+int libfsrefs_volume_import_index_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_volume_index_t *volume_index       = NULL;
+	static char *function                        = "libfsrefs_volume_import_index_file_io_handle";
+	uint64_t sequence_number                     = 0;
+	uint64_t serial_number                       = 0;
+	uint8_t file_io_handle_opened_in_library     = 0;
+	int file_io_handle_is_open                   = 0;
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing objects tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_index_initialize(
+	     &volume_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume index.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfsrefs_volume_index_read_file_io_handle(
+	     volume_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume index.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( internal_volume->objects_tree->volume_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - volume index value already set.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsrefs_volume_header_get_volume_serial_number(
+	          internal_volume->volume_header,
+	          &serial_number,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume serial number.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsrefs_checkpoint_get_sequence_number(
+	          internal_volume->file_system->checkpoint,
+	          &sequence_number,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint sequence number.",
+		 function );
+
+		result = -1;
+	}
+	/* A volume index of another volume or of a previous state of the volume is stale
+	 */
+	else if( ( volume_index->volume_serial_number != serial_number )
+	      || ( volume_index->checkpoint_sequence_number != sequence_number ) )
+	{
+		result = 0;
+	}
+	else
+	{
+		internal_volume->objects_tree->volume_index = volume_index;
+
+		volume_index = NULL;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( volume_index != NULL )
+	{
+		if( libfsrefs_volume_index_free(
+		     &volume_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks the file entries in the directory hierarchy
+ * The directory hierarchy is walked depth first, sub directories are walked
+ * regardless if they match the filter. A directory that is referenced more than
+ * once is only walked the first time
+ * Returns 1 if successful, 0 if stopped or aborted or -1 on error
+ */
+int libfsrefs_internal_volume_walk_file_entries(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_internal_filter_t *internal_filter,
+     int (*callback)(
+            libfsrefs_file_entry_t *file_entry,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_directory_entry_t *directory_entry    = NULL;
+	libfsrefs_directory_object_t *directory_object  = NULL;
+	libfsrefs_file_entry_t *file_entry              = NULL;
+	libfsrefs_identifier_set_t *visited_directories = NULL;
+	uint64_t *directory_identifiers                 = NULL;
+	uint64_t *reallocated_directory_identifiers     = NULL;
+	static char *function                           = "libfsrefs_internal_volume_walk_file_entries";
+	size_t directory_identifiers_size               = 0;
+	uint64_t directory_object_identifier            = 0;
+	uint64_t sub_directory_identifier               = 0;
+	int callback_result                             = 0;
+	int directory_entry_index                       = 0;
+	int identifier_index                            = 0;
+	int insert_result                               = 0;
+	int number_of_allocated_directory_identifiers   = 0;
+	int number_of_directory_entries                 = 0;
+	int number_of_directory_identifiers             = 0;
+	int result                                      = 1;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocated_directory_identifiers = 256;
+
+	directory_identifiers = (uint64_t *) memory_allocate(
+	                                      sizeof( uint64_t ) * number_of_allocated_directory_identifiers );
+
+	if( directory_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The visited directories are keyed by object identifier and prevent a directory
+	 * from being walked more than once, such as in a corrupted directory hierarchy
+	 * that contains a cycle
+	 */
+	if( libfsrefs_identifier_set_initialize(
+	     &visited_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_identifier_set_insert(
+	     visited_directories,
+	     LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert root directory into visited directories set.",
+		 function );
+
+		goto on_error;
+	}
+	directory_identifiers[ 0 ] = LIBFSREFS_OBJECT_IDENTIFIER_ROOT_DIRECTORY;
+
+	number_of_directory_identifiers = 1;
+
+	while( number_of_directory_identifiers > 0 )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		number_of_directory_identifiers--;
+
+		directory_object_identifier = directory_identifiers[ number_of_directory_identifiers ];
+
+		if( libfsrefs_directory_object_initialize(
+		     &directory_object,
+		     internal_volume->io_handle,
+		     internal_volume->objects_tree,
+		     directory_object_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory object: 0x%08" PRIx64 ".",
+			 function,
+			 directory_object_identifier );
+
+			goto on_error;
+		}
+		directory_object->filter = internal_filter;
+
+		if( libfsrefs_directory_object_read(
+		     directory_object,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory object: 0x%08" PRIx64 ".",
+			 function,
+			 directory_object_identifier );
+
+			goto on_error;
+		}
+		if( libfsrefs_directory_object_get_number_of_directory_entries(
+		     directory_object,
+		     &number_of_directory_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( directory_entry_index = 0;
+		     directory_entry_index < number_of_directory_entries;
+		     directory_entry_index++ )
+		{
+			if( libfsrefs_directory_object_get_directory_entry_by_index(
+			     directory_object,
+			     directory_entry_index,
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				goto on_error;
+			}
+			if( libfsrefs_file_entry_initialize(
+			     &file_entry,
+			     internal_volume->io_handle,
+			     internal_volume->file_io_handle,
+			     internal_volume->objects_tree,
+			     0,
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				goto on_error;
+			}
+			/* The file entry took over management of the directory entry
+			 */
+			if( libcdata_array_set_entry_by_index(
+			     directory_object->directory_entries_array,
+			     directory_entry_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set directory entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				( (libfsrefs_internal_file_entry_t *) file_entry )->directory_entry = NULL;
+
+				goto on_error;
+			}
+			( (libfsrefs_internal_file_entry_t *) file_entry )->parent_object_identifier = directory_object_identifier;
+
+			callback_result = callback(
+			                   file_entry,
+			                   user_data );
+
+			if( libfsrefs_file_entry_free(
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				goto on_error;
+			}
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback failed for file entry: %d.",
+				 function,
+				 directory_entry_index );
+
+				goto on_error;
+			}
+			else if( callback_result == 0 )
+			{
+				result = 0;
+
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		if( directory_object->number_of_sub_directory_identifiers > ( number_of_allocated_directory_identifiers - number_of_directory_identifiers ) )
+		{
+			while( directory_object->number_of_sub_directory_identifiers > ( number_of_allocated_directory_identifiers - number_of_directory_identifiers ) )
+			{
+				if( number_of_allocated_directory_identifiers >= ( INT_MAX / 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid number of allocated directory identifiers value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				number_of_allocated_directory_identifiers *= 2;
+			}
+			directory_identifiers_size = sizeof( uint64_t ) * (size_t) number_of_allocated_directory_identifiers;
+
+			if( directory_identifiers_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid directory identifiers size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocated_directory_identifiers = (uint64_t *) memory_reallocate(
+			                                                  directory_identifiers,
+			                                                  directory_identifiers_size );
+
+			if( reallocated_directory_identifiers == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize directory identifiers.",
+				 function );
+
+				goto on_error;
+			}
+			directory_identifiers = reallocated_directory_identifiers;
+		}
+		/* The sub directories are pushed in reverse order so that they are walked in stored order
+		 */
+		for( identifier_index = directory_object->number_of_sub_directory_identifiers - 1;
+		     identifier_index >= 0;
+		     identifier_index-- )
+		{
+			sub_directory_identifier = directory_object->sub_directory_identifiers[ identifier_index ];
+
+			insert_result = libfsrefs_identifier_set_insert(
+			                 visited_directories,
+			                 sub_directory_identifier,
+			                 error );
+
+			if( insert_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert directory: 0x%08" PRIx64 " into visited directories set.",
+				 function,
+				 sub_directory_identifier );
+
+				goto on_error;
+			}
+			else if( insert_result != 0 )
+			{
+				directory_identifiers[ number_of_directory_identifiers++ ] = sub_directory_identifier;
+			}
+		}
+		if( libfsrefs_directory_object_free(
+		     &directory_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( directory_object != NULL )
+	{
+		if( libfsrefs_directory_object_free(
+		     &directory_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 directory_identifiers );
+
+	if( libfsrefs_identifier_set_free(
+	     &visited_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free visited directories set.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( directory_object != NULL )
+	{
+		libfsrefs_directory_object_free(
+		 &directory_object,
+		 NULL );
+	}
+	if( directory_identifiers != NULL )
+	{
+		memory_free(
+		 directory_identifiers );
+	}
+	if( visited_directories != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &visited_directories,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks the file entries in the directory hierarchy
+ * The callback is called for every file entry that matches the filter, where the filter
+ * is evaluated on the directory records before the corresponding file entries are created.
+ * If filter is NULL every file entry is passed. The file entry passed to the callback is
+ * only valid during the callback. The callback should return 1 to continue the walk,
+ * 0 to stop the walk or -1 on error. The callback should not call volume functions
+ * Returns 1 if successful, 0 if stopped or aborted or -1 on error
+ */
+int libfsrefs_volume_walk_file_entries(
+     libfsrefs_volume_t *volume,
+     libfsrefs_filter_t *filter,
+     int (*callback)(
+            libfsrefs_file_entry_t *file_entry,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_walk_file_entries";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing objects tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsrefs_internal_volume_walk_file_entries(
+	          internal_volume,
+	          (libfsrefs_internal_filter_t *) filter,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk file entries.",
+		 function );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends the data block stream of a file entry to the shared extent index
+ * This function is used as the callback of libfsrefs_internal_volume_walk_file_entries
+ * where user_data refers to the shared extent index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_internal_volume_append_shared_extent_file_entry(
+     libfsrefs_file_entry_t *file_entry,
+     intptr_t *user_data )
+{
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	const uint8_t *utf8_name                             = NULL;
+	size_t utf8_name_size                                = 0;
+	int file_index                                       = 0;
+
+	if( ( file_entry == NULL )
+	 || ( user_data == NULL ) )
+	{
+		return( -1 );
+	}
+	internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entry;
+	shared_extent_index = (libfsrefs_shared_extent_index_t *) user_data;
+
+	if( ( internal_file_entry->directory_entry == NULL )
+	 || ( internal_file_entry->directory_entry->entry_type != 1 ) )
+	{
+		return( 1 );
+	}
+	if( libfsrefs_internal_file_entry_read_data_stream(
+	     internal_file_entry,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	/* Resident data does not occupy clusters of its own
+	 */
+	if( internal_file_entry->data_block_stream == NULL )
+	{
+		return( 1 );
+	}
+	utf8_name      = internal_file_entry->directory_entry->utf8_name;
+	utf8_name_size = internal_file_entry->directory_entry->utf8_name_size;
+
+	if( utf8_name == NULL )
+	{
+		utf8_name      = (const uint8_t *) "";
+		utf8_name_size = 0;
+	}
+	if( libfsrefs_shared_extent_index_append_file(
+	     shared_extent_index,
+	     internal_file_entry->parent_object_identifier,
+	     utf8_name,
+	     utf8_name_size,
+	     &file_index,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsrefs_shared_extent_index_append_data_block_stream(
+	     shared_extent_index,
+	     file_index,
+	     internal_file_entry->data_block_stream,
+	     internal_file_entry->data_size,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the shared extent index
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_internal_volume_read_shared_extent_index(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_filter_t internal_filter;
+
+	static char *function = "libfsrefs_internal_volume_read_shared_extent_index";
+	int result            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &internal_filter,
+	     0,
+	     sizeof( libfsrefs_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		return( -1 );
+	}
+	/* Directories have no data stream, filtering them out prevents their file entries from being created
+	 */
+	internal_filter.excluded_file_attribute_flags = LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY;
+
+	result = libfsrefs_internal_volume_walk_file_entries(
+	          internal_volume,
+	          &internal_filter,
+	          &libfsrefs_internal_volume_append_shared_extent_file_entry,
+	          (intptr_t *) shared_extent_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk file entries.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsrefs_shared_extent_index_finalize(
+	     shared_extent_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the shared extent index
+ * Files on a ReFS volume can share clusters due to block cloning. The shared extent
+ * index maps every physical range that is referenced more than once to the files that
+ * reference it, which allows the data of a shared range to be read or hashed once.
+ * A shared extent is a maximal range of overlapping references, hence references of
+ * a shared extent can cover only part of it. The index is built once, further calls
+ * have no effect
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_volume_build_shared_extent_index(
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume         = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	static char *function                                = "libfsrefs_volume_build_shared_extent_index";
+	int result                                           = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->objects_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing objects tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->objects_tree->shared_extent_index == NULL )
+	{
+		if( libfsrefs_shared_extent_index_initialize(
+		     &shared_extent_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shared extent index.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = libfsrefs_internal_volume_read_shared_extent_index(
+			          internal_volume,
+			          shared_extent_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read shared extent index.",
+				 function );
+			}
+			if( result == 1 )
+			{
+				internal_volume->objects_tree->shared_extent_index = shared_extent_index;
+			}
+			else
+			{
+				libfsrefs_shared_extent_index_free(
+				 &shared_extent_index,
+				 NULL );
+			}
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of shared extents
+ * Returns 1 if successful, 0 if the shared extent index was not built or -1 on error
+ */
+int libfsrefs_volume_get_number_of_shared_extents(
+     libfsrefs_volume_t *volume,
+     int *number_of_shared_extents,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_get_number_of_shared_extents";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( number_of_shared_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of shared extents.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_volume->objects_tree != NULL )
+	 && ( internal_volume->objects_tree->shared_extent_index != NULL ) )
+	{
+		*number_of_shared_extents = internal_volume->objects_tree->shared_extent_index->number_of_shared_extents;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific shared extent
+ * Returns 1 if successful, 0 if the shared extent index was not built or -1 on error
+ */
+int libfsrefs_volume_get_shared_extent_by_index(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     off64_t *physical_offset,
+     size64_t *size,
+     int *number_of_references,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_shared_extent_t *shared_extent     = NULL;
+	static char *function                        = "libfsrefs_volume_get_shared_extent_by_index";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( physical_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_volume->objects_tree != NULL )
+	 && ( internal_volume->objects_tree->shared_extent_index != NULL ) )
+	{
+		result = libfsrefs_shared_extent_index_get_shared_extent_by_index(
+		          internal_volume->objects_tree->shared_extent_index,
+		          shared_extent_index,
+		          &shared_extent,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve shared extent: %d.",
+			 function,
+			 shared_extent_index );
+
+			result = -1;
+		}
+		else
+		{
+			*physical_offset      = shared_extent->physical_offset;
+			*size                 = shared_extent->size;
+			*number_of_references = shared_extent->number_of_references;
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index of the shared extent that contains a specific physical offset
+ * Returns 1 if successful, 0 if no such shared extent or the shared extent index was not built or -1 on error
+ */
+int libfsrefs_volume_get_shared_extent_index_by_offset(
+     libfsrefs_volume_t *volume,
+     off64_t physical_offset,
+     int *shared_extent_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsrefs_volume_get_shared_extent_index_by_offset";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( shared_extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared extent index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_volume->objects_tree != NULL )
+	 && ( internal_volume->objects_tree->shared_extent_index != NULL ) )
+	{
+		result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+		          internal_volume->objects_tree->shared_extent_index,
+		          physical_offset,
+		          shared_extent_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve shared extent index of offset: %" PRIi64 ".",
+			 function,
+			 physical_offset );
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific reference of a specific shared extent
+ * Returns 1 if successful, 0 if the shared extent index was not built or -1 on error
+ */
+int libfsrefs_internal_volume_get_shared_extent_reference(
+     libfsrefs_internal_volume_t *internal_volume,
+     int shared_extent_index,
+     int reference_index,
+     libfsrefs_scheduled_extent_t **reference,
+     libfsrefs_shared_extent_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_internal_volume_get_shared_extent_reference";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_volume->objects_tree == NULL )
+	 || ( internal_volume->objects_tree->shared_extent_index == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libfsrefs_shared_extent_index_get_reference(
+	     internal_volume->objects_tree->shared_extent_index,
+	     shared_extent_index,
+	     reference_index,
+	     reference,
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve reference: %d of shared extent: %d.",
+		 function,
+		 reference_index,
+		 shared_extent_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific reference of a specific shared extent
+ * The reference is the part of the data stream of a file, at data offset, that is stored
+ * at the physical range of physical offset and size
+ * Returns 1 if successful, 0 if the shared extent index was not built or -1 on error
+ */
+int libfsrefs_volume_get_shared_extent_reference_by_index(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     int reference_index,
+     uint64_t *parent_object_identifier,
+     off64_t *data_offset,
+     off64_t *physical_offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_scheduled_extent_t *reference      = NULL;
+	libfsrefs_shared_extent_file_t *file         = NULL;
+	static char *function                        = "libfsrefs_volume_get_shared_extent_reference_by_index";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( parent_object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsrefs_internal_volume_get_shared_extent_reference(
+	          internal_volume,
+	          shared_extent_index,
+	          reference_index,
+	          &reference,
+	          &file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shared extent reference.",
+		 function );
+	}
+	else if( result == 1 )
+	{
+		*parent_object_identifier = file->parent_object_identifier;
+		*data_offset              = reference->data_offset;
+		*physical_offset          = reference->physical_offset;
+		*size                     = reference->size;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of the file of a specific reference of a specific shared extent
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the shared extent index was not built or -1 on error
+ */
+int libfsrefs_volume_get_shared_extent_reference_utf8_name_size(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     int reference_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_scheduled_extent_t *reference      = NULL;
+	libfsrefs_shared_extent_file_t *file         = NULL;
+	static char *function                        = "libfsrefs_volume_get_shared_extent_reference_utf8_name_size";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsrefs_internal_volume_get_shared_extent_reference(
+	          internal_volume,
+	          shared_extent_index,
+	          reference_index,
+	          &reference,
+	          &file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shared extent reference.",
+		 function );
+	}
+	else if( result == 1 )
+	{
+		*utf8_string_size = (size_t) file->name_size + 1;
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name of the file of a specific reference of a specific shared extent
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the shared extent index was not built or -1 on error
+ */
+int libfsrefs_volume_get_shared_extent_reference_utf8_name(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     int reference_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume = NULL;
+	libfsrefs_scheduled_extent_t *reference      = NULL;
+	libfsrefs_shared_extent_file_t *file         = NULL;
+	static char *function                        = "libfsrefs_volume_get_shared_extent_reference_utf8_name";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsrefs_internal_volume_get_shared_extent_reference(
+	          internal_volume,
+	          shared_extent_index,
+	          reference_index,
+	          &reference,
+	          &file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shared extent reference.",
+		 function );
+	}
+	else if( result == 1 )
+	{
+		if( utf8_string_size < ( (size_t) file->name_size + 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			if( file->name_size > 0 )
+			{
+				if( memory_copy(
+				     utf8_string,
+				     &( internal_volume->objects_tree->shared_extent_index->names_data[ file->name_offset ] ),
+				     (size_t) file->name_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 name.",
+					 function );
+
+					result = -1;
+				}
+			}
+			if( result == 1 )
+			{
+				utf8_string[ file->name_size ] = 0;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the data of multiple file entries in physical order
+ * The extents of all file entries are sorted by physical offset, adjacent extents are merged
+ * and read sequentially. The data is passed to the write data callback per file entry,
+ * where file_entry_index is the index of the file entry in the file entries array.
+ * Resident data is passed before any extent is read, sparse ranges are not passed
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libfsrefs_volume_read_file_entries_data(
+     libfsrefs_volume_t *volume,
+     libfsrefs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int (*write_data)(
+            int file_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_extent_scheduler_t *extent_scheduler       = NULL;
+	libfsrefs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsrefs_internal_volume_t *internal_volume         = NULL;
+	static char *function                                = "libfsrefs_volume_read_file_entries_data";
+	int file_entry_index                                 = 0;
+	int result                                           = 1;
+
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	int file_entry_result                                = 0;
+#endif
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of file entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_extent_scheduler_initialize(
+	     &extent_scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent scheduler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		libfsrefs_extent_scheduler_free(
+		 &extent_scheduler,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	for( file_entry_index = 0;
+	     ( result == 1 ) && ( file_entry_index < number_of_file_entries );
+	     file_entry_index++ )
+	{
+		internal_file_entry = (libfsrefs_internal_file_entry_t *) file_entries[ file_entry_index ];
+
+		if( internal_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			result = -1;
+
+			break;
+		}
+		if( internal_file_entry->file_io_handle != internal_volume->file_io_handle )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid file entry: %d - not part of volume.",
+			 function,
+			 file_entry_index );
+
+			result = -1;
+
+			break;
+		}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+#endif
+		if( libfsrefs_internal_file_entry_read_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine data stream of file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			result = -1;
+		}
+		else if( internal_file_entry->data_block_stream != NULL )
+		{
+			if( libfsrefs_extent_scheduler_append_data_block_stream(
+			     extent_scheduler,
+			     internal_file_entry->data_block_stream,
+			     internal_file_entry->data_size,
+			     file_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extents of file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				result = -1;
+			}
+		}
+		else if( ( internal_file_entry->data_size > 0 )
+		      && ( internal_file_entry->data_attribute_values != NULL ) )
+		{
+			/* Resident data is passed without I/O
+			 */
+			if( ( internal_file_entry->data_attribute_values->resident_data == NULL )
+			 || ( internal_file_entry->data_size > (size64_t) internal_file_entry->data_attribute_values->resident_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid file entry: %d - missing resident data.",
+				 function,
+				 file_entry_index );
+
+				result = -1;
+			}
+			else if( write_data(
+			          file_entry_index,
+			          0,
+			          internal_file_entry->data_attribute_values->resident_data,
+			          (size_t) internal_file_entry->data_size,
+			          user_data ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write resident data of file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+		file_entry_result = libcthreads_read_write_lock_release_for_write(
+		                     internal_file_entry->read_write_lock,
+		                     error );
+
+		if( file_entry_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+	if( result == 1 )
+	{
+		if( libfsrefs_extent_scheduler_sort(
+		     extent_scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort extents.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libfsrefs_extent_scheduler_read(
+		          extent_scheduler,
+		          internal_volume->io_handle,
+		          internal_volume->file_io_handle,
+		          write_data,
+		          user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extents.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( libfsrefs_extent_scheduler_free(
+	     &extent_scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extent scheduler.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Scans the volume for metadata blocks
+ * The volume is read sequentially, from start offset up to start offset + size, in large
+ * reads and every metadata block with a valid metadata block header is passed to the callback,
+ * regardless if it is referenced by the current checkpoint. This allows ministore nodes that
+ * are no longer in use to be recovered. The start offset is rounded up to the next metadata
+ * block boundary. If size is 0 the volume is scanned up to its end. Separate ranges can be
+ * scanned concurrently using separate volumes. The callback should return 1 to continue the
+ * scan, 0 to stop the scan or -1 on error. The callback should not call volume functions
+ * Only format version 3 is supported
+ * Returns 1 if successful, 0 if stopped or aborted or -1 on error
+ */
+int libfsrefs_volume_scan_metadata_blocks(
+     libfsrefs_volume_t *volume,
+     off64_t start_offset,
+     size64_t size,
+     int (*callback)(
+            off64_t block_offset,
+            uint64_t block_number,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsrefs_internal_volume_t *internal_volume               = NULL;
+	libfsrefs_metadata_block_scanner_t *metadata_block_scanner = NULL;
+	static char *function                                      = "libfsrefs_volume_scan_metadata_blocks";
+	int result                                                 = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsrefs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsrefs_metadata_block_scanner_initialize(
+	     &metadata_block_scanner,
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata block scanner.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+		          metadata_block_scanner,
+		          internal_volume->io_handle,
+		          internal_volume->file_io_handle,
+		          start_offset,
+		          size,
+		          callback,
+		          user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan metadata blocks.",
+			 function );
+		}
+		if( libfsrefs_metadata_block_scanner_free(
+		     &metadata_block_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata block scanner.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBFSREFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -27,6 +27,7 @@
 
 #include "libfsrefs_extern.h"
 #include "libfsrefs_file_system.h"
+#include "libfsrefs_filter.h"
 #include "libfsrefs_io_handle.h"
 #include "libfsrefs_libbfio.h"
 #include "libfsrefs_libcerror.h"
@@ -36,8 +37,11 @@
 #include "libfsrefs_ministore_node.h"
 #include "libfsrefs_node_record.h"
 #include "libfsrefs_objects_tree.h"
+#include "libfsrefs_parent_index.h"
+#include "libfsrefs_shared_extent_index.h"
 #include "libfsrefs_types.h"
 #include "libfsrefs_volume_header.h"
+#include "libfsrefs_volume_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -123,6 +127,36 @@ int libfsrefs_volume_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_open_async(
+     libfsrefs_volume_t *volume,
+     const char *filename,
+     int access_flags,
+     void (*open_callback)(
+            libfsrefs_volume_t *volume,
+            int result,
+            libcerror_error_t *error,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_open_async_wide(
+     libfsrefs_volume_t *volume,
+     const wchar_t *filename,
+     int access_flags,
+     void (*open_callback)(
+            libfsrefs_volume_t *volume,
+            int result,
+            libcerror_error_t *error,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBFSREFS_EXTERN \
 int libfsrefs_volume_open_file_io_handle(
      libfsrefs_volume_t *volume,
@@ -195,12 +229,213 @@ int libfsrefs_volume_get_serial_number(
      uint64_t *serial_number,
      libcerror_error_t **error );
 
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_checkpoint_sequence_number(
+     libfsrefs_volume_t *volume,
+     uint64_t *sequence_number,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_statistics(
+     libfsrefs_volume_t *volume,
+     int node_type,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_clear_statistics(
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_memory_limit(
+     libfsrefs_volume_t *volume,
+     size64_t *memory_limit,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_set_memory_limit(
+     libfsrefs_volume_t *volume,
+     size64_t memory_limit,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_memory_usage(
+     libfsrefs_volume_t *volume,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_set_trace_callback(
+     libfsrefs_volume_t *volume,
+     void (*trace_callback)(
+            int event_type,
+            int node_type,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
 LIBFSREFS_EXTERN \
 int libfsrefs_volume_get_root_directory(
      libfsrefs_volume_t *volume,
      libfsrefs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_file_entry_by_identifier(
+     libfsrefs_volume_t *volume,
+     uint64_t object_identifier,
+     libfsrefs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_volume_read_parent_index(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_parent_index_t *parent_index,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_build_parent_index(
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_volume_read_volume_index(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_volume_index_t *volume_index,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_export_index_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_import_index_file_io_handle(
+     libfsrefs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_volume_walk_file_entries(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_internal_filter_t *internal_filter,
+     int (*callback)(
+            libfsrefs_file_entry_t *file_entry,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_walk_file_entries(
+     libfsrefs_volume_t *volume,
+     libfsrefs_filter_t *filter,
+     int (*callback)(
+            libfsrefs_file_entry_t *file_entry,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_volume_append_shared_extent_file_entry(
+     libfsrefs_file_entry_t *file_entry,
+     intptr_t *user_data );
+
+int libfsrefs_internal_volume_read_shared_extent_index(
+     libfsrefs_internal_volume_t *internal_volume,
+     libfsrefs_shared_extent_index_t *shared_extent_index,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_build_shared_extent_index(
+     libfsrefs_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_number_of_shared_extents(
+     libfsrefs_volume_t *volume,
+     int *number_of_shared_extents,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_shared_extent_by_index(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     off64_t *physical_offset,
+     size64_t *size,
+     int *number_of_references,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_shared_extent_index_by_offset(
+     libfsrefs_volume_t *volume,
+     off64_t physical_offset,
+     int *shared_extent_index,
+     libcerror_error_t **error );
+
+int libfsrefs_internal_volume_get_shared_extent_reference(
+     libfsrefs_internal_volume_t *internal_volume,
+     int shared_extent_index,
+     int reference_index,
+     libfsrefs_scheduled_extent_t **reference,
+     libfsrefs_shared_extent_file_t **file,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_shared_extent_reference_by_index(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     int reference_index,
+     uint64_t *parent_object_identifier,
+     off64_t *data_offset,
+     off64_t *physical_offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_shared_extent_reference_utf8_name_size(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     int reference_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_get_shared_extent_reference_utf8_name(
+     libfsrefs_volume_t *volume,
+     int shared_extent_index,
+     int reference_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_read_file_entries_data(
+     libfsrefs_volume_t *volume,
+     libfsrefs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int (*write_data)(
+            int file_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBFSREFS_EXTERN \
+int libfsrefs_volume_scan_metadata_blocks(
+     libfsrefs_volume_t *volume,
+     off64_t start_offset,
+     size64_t size,
+     int (*callback)(
+            off64_t block_offset,
+            uint64_t block_number,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1698 @@
+/*
+ * Volume index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsrefs_definitions.h"
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_libcnotify.h"
+#include "libfsrefs_node_record.h"
+#include "libfsrefs_volume_index.h"
+
+#include "fsrefs_volume_index.h"
+
+const char fsrefs_volume_index_file_signature[ 8 ] = {
+	'F', 'S', 'R', 'E', 'F', 'S', 'I', 'X' };
+
+/* Creates a volume index
+ * Make sure the value volume_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_initialize(
+     libfsrefs_volume_index_t **volume_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_volume_index_initialize";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_index = memory_allocate_structure(
+	                 libfsrefs_volume_index_t );
+
+	if( *volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create volume index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *volume_index,
+	     0,
+	     sizeof( libfsrefs_volume_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume index.",
+		 function );
+
+		goto on_error;
+	}
+	( *volume_index )->current_object_index = -1;
+	( *volume_index )->is_sorted            = 1;
+
+	return( 1 );
+
+on_error:
+	if( *volume_index != NULL )
+	{
+		memory_free(
+		 *volume_index );
+
+		*volume_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a volume index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_free(
+     libfsrefs_volume_index_t **volume_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_volume_index_free";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_index != NULL )
+	{
+		if( ( *volume_index )->record_data != NULL )
+		{
+			memory_free(
+			 ( *volume_index )->record_data );
+		}
+		if( ( *volume_index )->records != NULL )
+		{
+			memory_free(
+			 ( *volume_index )->records );
+		}
+		if( ( *volume_index )->objects != NULL )
+		{
+			memory_free(
+			 ( *volume_index )->objects );
+		}
+		memory_free(
+		 *volume_index );
+
+		*volume_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an object
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_append_object(
+     libfsrefs_volume_index_t *volume_index,
+     uint64_t object_identifier,
+     uint64_t parent_object_identifier,
+     libcerror_error_t **error )
+{
+	libfsrefs_volume_index_object_t *objects = NULL;
+	static char *function                    = "libfsrefs_volume_index_append_object";
+	size_t objects_size                      = 0;
+	int number_of_allocated_objects          = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index->number_of_objects >= volume_index->number_of_allocated_objects )
+	{
+		if( volume_index->number_of_allocated_objects >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid volume index - number of allocated objects value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( volume_index->number_of_allocated_objects == 0 )
+		{
+			number_of_allocated_objects = 256;
+		}
+		else
+		{
+			number_of_allocated_objects = volume_index->number_of_allocated_objects * 2;
+		}
+		objects_size = sizeof( libfsrefs_volume_index_object_t ) * (size_t) number_of_allocated_objects;
+
+		if( objects_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid objects size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		objects = (libfsrefs_volume_index_object_t *) memory_reallocate(
+		                                               volume_index->objects,
+		                                               objects_size );
+
+		if( objects == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize objects.",
+			 function );
+
+			return( -1 );
+		}
+		volume_index->objects                     = objects;
+		volume_index->number_of_allocated_objects = number_of_allocated_objects;
+	}
+	objects = &( volume_index->objects[ volume_index->number_of_objects ] );
+
+	objects->object_identifier        = object_identifier;
+	objects->parent_object_identifier = parent_object_identifier;
+	objects->first_record_index       = 0;
+	objects->number_of_records        = 0;
+
+	if( ( volume_index->number_of_objects > 0 )
+	 && ( object_identifier < volume_index->objects[ volume_index->number_of_objects - 1 ].object_identifier ) )
+	{
+		volume_index->is_sorted = 0;
+	}
+	volume_index->number_of_objects += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific object
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_get_object_by_index(
+     libfsrefs_volume_index_t *volume_index,
+     int object_index,
+     libfsrefs_volume_index_object_t **object,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_volume_index_get_object_by_index";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( object_index < 0 )
+	 || ( object_index >= volume_index->number_of_objects ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object.",
+		 function );
+
+		return( -1 );
+	}
+	*object = &( volume_index->objects[ object_index ] );
+
+	return( 1 );
+}
+
+/* Sets the current object
+ * The records that are appended after this call are the records of the current object
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_set_current_object(
+     libfsrefs_volume_index_t *volume_index,
+     int object_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_volume_index_set_current_object";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( object_index < 0 )
+	 || ( object_index >= volume_index->number_of_objects ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	volume_index->objects[ object_index ].first_record_index = (uint32_t) volume_index->number_of_records;
+	volume_index->objects[ object_index ].number_of_records  = 0;
+
+	volume_index->current_object_index = object_index;
+
+	return( 1 );
+}
+
+/* Appends a record to the current object
+ * The key and value data of the record are copied into the record data of the volume index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_append_record(
+     libfsrefs_volume_index_t *volume_index,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error )
+{
+	libfsrefs_volume_index_record_t *records = NULL;
+	uint8_t *record_data                     = NULL;
+	static char *function                    = "libfsrefs_volume_index_append_record";
+	size_t allocated_record_data_size        = 0;
+	size_t data_size                         = 0;
+	size_t records_size                      = 0;
+	int number_of_allocated_records          = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index->current_object_index < 0 )
+	 || ( volume_index->current_object_index >= volume_index->number_of_objects ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index - current object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_record->key_data == NULL )
+	 && ( node_record->key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record - missing key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_record->value_data == NULL )
+	 && ( node_record->value_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data of every record is 8-byte aligned
+	 */
+	data_size = (size_t) node_record->key_data_size + (size_t) node_record->value_data_size;
+	data_size = ( data_size + 7 ) & ~( (size_t) 7 );
+
+	if( volume_index->number_of_records >= volume_index->number_of_allocated_records )
+	{
+		if( volume_index->number_of_allocated_records >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid volume index - number of allocated records value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( volume_index->number_of_allocated_records == 0 )
+		{
+			number_of_allocated_records = 1024;
+		}
+		else
+		{
+			number_of_allocated_records = volume_index->number_of_allocated_records * 2;
+		}
+		records_size = sizeof( libfsrefs_volume_index_record_t ) * (size_t) number_of_allocated_records;
+
+		if( records_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid records size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		records = (libfsrefs_volume_index_record_t *) memory_reallocate(
+		                                               volume_index->records,
+		                                               records_size );
+
+		if( records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			return( -1 );
+		}
+		volume_index->records                     = records;
+		volume_index->number_of_allocated_records = number_of_allocated_records;
+	}
+	if( data_size > ( volume_index->allocated_record_data_size - volume_index->record_data_size ) )
+	{
+		if( volume_index->allocated_record_data_size == 0 )
+		{
+			allocated_record_data_size = 64 * 1024;
+		}
+		else
+		{
+			allocated_record_data_size = volume_index->allocated_record_data_size;
+		}
+		while( allocated_record_data_size < ( volume_index->record_data_size + data_size ) )
+		{
+			allocated_record_data_size *= 2;
+		}
+		if( allocated_record_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid record data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		record_data = (uint8_t *) memory_reallocate(
+		                           volume_index->record_data,
+		                           allocated_record_data_size );
+
+		if( record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record data.",
+			 function );
+
+			return( -1 );
+		}
+		volume_index->record_data                = record_data;
+		volume_index->allocated_record_data_size = allocated_record_data_size;
+	}
+	record_data = &( volume_index->record_data[ volume_index->record_data_size ] );
+
+	if( memory_set(
+	     record_data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_record->key_data_size > 0 )
+	{
+		if( memory_copy(
+		     record_data,
+		     node_record->key_data,
+		     (size_t) node_record->key_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( node_record->value_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( record_data[ node_record->key_data_size ] ),
+		     node_record->value_data,
+		     (size_t) node_record->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	records = &( volume_index->records[ volume_index->number_of_records ] );
+
+	records->data_offset     = (uint64_t) volume_index->record_data_size;
+	records->key_data_size   = node_record->key_data_size;
+	records->value_data_size = node_record->value_data_size;
+
+	volume_index->objects[ volume_index->current_object_index ].number_of_records += 1;
+
+	volume_index->record_data_size  += data_size;
+	volume_index->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Compares two volume index objects by object identifier
+ * Returns -1, 0 or 1 as required by qsort
+ */
+static int libfsrefs_volume_index_object_compare(
+            const void *first_object,
+            const void *second_object )
+{
+	const libfsrefs_volume_index_object_t *first  = (const libfsrefs_volume_index_object_t *) first_object;
+	const libfsrefs_volume_index_object_t *second = (const libfsrefs_volume_index_object_t *) second_object;
+
+	if( first->object_identifier < second->object_identifier )
+	{
+		return( -1 );
+	}
+	if( first->object_identifier > second->object_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the objects by object identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_sort(
+     libfsrefs_volume_index_t *volume_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_volume_index_sort";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index->is_sorted == 0 )
+	 && ( volume_index->number_of_objects > 1 ) )
+	{
+		qsort(
+		 volume_index->objects,
+		 (size_t) volume_index->number_of_objects,
+		 sizeof( libfsrefs_volume_index_object_t ),
+		 &libfsrefs_volume_index_object_compare );
+	}
+	/* The object indexes are no longer valid after the sort
+	 */
+	volume_index->current_object_index = -1;
+	volume_index->is_sorted            = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the object of a specific object identifier
+ * The objects must be sorted before calling this function
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsrefs_volume_index_get_object_by_identifier(
+     libfsrefs_volume_index_t *volume_index,
+     uint64_t object_identifier,
+     libfsrefs_volume_index_object_t **object,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsrefs_volume_index_get_object_by_identifier";
+	int first_index       = 0;
+	int last_index        = 0;
+	int middle_index      = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index - objects are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	if( object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object.",
+		 function );
+
+		return( -1 );
+	}
+	last_index = volume_index->number_of_objects;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+		if( volume_index->objects[ middle_index ].object_identifier < object_identifier )
+		{
+			first_index = middle_index + 1;
+		}
+		else if( volume_index->objects[ middle_index ].object_identifier > object_identifier )
+		{
+			last_index = middle_index;
+		}
+		else
+		{
+			*object = &( volume_index->objects[ middle_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific record
+ * The key and value data of the node record reference the record data of the volume index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_get_record_by_index(
+     libfsrefs_volume_index_t *volume_index,
+     int record_index,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error )
+{
+	libfsrefs_volume_index_record_t *record = NULL;
+	static char *function                   = "libfsrefs_volume_index_get_record_by_index";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= volume_index->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node record.",
+		 function );
+
+		return( -1 );
+	}
+	record = &( volume_index->records[ record_index ] );
+
+	/* The record data ranges are validated when the records are appended or read
+	 */
+	node_record->size            = (uint32_t) record->key_data_size + (uint32_t) record->value_data_size;
+	node_record->flags           = 0;
+	node_record->key_data        = &( volume_index->record_data[ record->data_offset ] );
+	node_record->key_data_size   = record->key_data_size;
+	node_record->value_data      = NULL;
+	node_record->value_data_size = 0;
+
+	if( record->value_data_size > 0 )
+	{
+		node_record->value_data      = &( volume_index->record_data[ record->data_offset + record->key_data_size ] );
+		node_record->value_data_size = record->value_data_size;
+	}
+	return( 1 );
+}
+
+/* Reads the volume index from a volume index file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_read_file_io_handle(
+     libfsrefs_volume_index_t *volume_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	fsrefs_volume_index_file_header_t file_header;
+
+	fsrefs_volume_index_object_t *object_data = NULL;
+	fsrefs_volume_index_record_t *record_data = NULL;
+	uint8_t *table_data                       = NULL;
+	static char *function                     = "libfsrefs_volume_index_read_file_io_handle";
+	size64_t file_size                        = 0;
+	size_t table_data_size                    = 0;
+	ssize_t read_count                        = 0;
+	uint64_t objects_offset                   = 0;
+	uint64_t record_data_offset               = 0;
+	uint64_t record_data_size                 = 0;
+	uint64_t records_offset                   = 0;
+	uint32_t file_header_size                 = 0;
+	uint32_t format_version                   = 0;
+	uint32_t number_of_objects                = 0;
+	uint32_t number_of_records                = 0;
+	int object_index                          = 0;
+	int record_index                          = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index->objects != NULL )
+	 || ( volume_index->records != NULL )
+	 || ( volume_index->record_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume index - already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume index file size.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( fsrefs_volume_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( fsrefs_volume_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume index file header data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: volume index file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &file_header,
+		 sizeof( fsrefs_volume_index_file_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     file_header.signature,
+	     fsrefs_volume_index_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported volume index file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.file_header_size,
+	 file_header_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.volume_serial_number,
+	 volume_index->volume_serial_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.checkpoint_sequence_number,
+	 volume_index->checkpoint_sequence_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_objects,
+	 number_of_objects );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_records,
+	 number_of_records );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.objects_offset,
+	 objects_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.records_offset,
+	 records_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.record_data_offset,
+	 record_data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.record_data_size,
+	 record_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: file header size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 file_header_size );
+
+		libcnotify_printf(
+		 "%s: volume serial number\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 volume_index->volume_serial_number );
+
+		libcnotify_printf(
+		 "%s: checkpoint sequence number\t: %" PRIu64 "\n",
+		 function,
+		 volume_index->checkpoint_sequence_number );
+
+		libcnotify_printf(
+		 "%s: number of objects\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_objects );
+
+		libcnotify_printf(
+		 "%s: number of records\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_records );
+
+		libcnotify_printf(
+		 "%s: objects offset\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 objects_offset );
+
+		libcnotify_printf(
+		 "%s: records offset\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 records_offset );
+
+		libcnotify_printf(
+		 "%s: record data offset\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 record_data_offset );
+
+		libcnotify_printf(
+		 "%s: record data size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 record_data_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( format_version != LIBFSREFS_VOLUME_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported volume index file format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( file_header_size != (uint32_t) sizeof( fsrefs_volume_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported volume index file header size: %" PRIu32 ".",
+		 function,
+		 file_header_size );
+
+		goto on_error;
+	}
+	if( ( number_of_objects > (uint32_t) ( INT_MAX / 2 ) )
+	 || ( (size_t) number_of_objects > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsrefs_volume_index_object_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of objects value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_records > (uint32_t) ( INT_MAX / 2 ) )
+	 || ( (size_t) number_of_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsrefs_volume_index_record_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( record_data_size == 0 )
+	 || ( record_data_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		if( ( record_data_size != 0 )
+		 || ( number_of_records != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The tables and the record data must be stored in the file
+	 */
+	if( ( objects_offset < (uint64_t) file_header_size )
+	 || ( objects_offset > file_size )
+	 || ( ( (uint64_t) number_of_objects * sizeof( fsrefs_volume_index_object_t ) ) > ( file_size - objects_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid objects offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( records_offset < (uint64_t) file_header_size )
+	 || ( records_offset > file_size )
+	 || ( ( (uint64_t) number_of_records * sizeof( fsrefs_volume_index_record_t ) ) > ( file_size - records_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( record_data_offset < (uint64_t) file_header_size )
+	 || ( record_data_offset > file_size )
+	 || ( record_data_size > ( file_size - record_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_objects > 0 )
+	{
+		table_data_size = sizeof( fsrefs_volume_index_object_t ) * (size_t) number_of_objects;
+
+		table_data = (uint8_t *) memory_allocate(
+		                          table_data_size );
+
+		if( table_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create objects table data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              table_data,
+		              table_data_size,
+		              (off64_t) objects_offset,
+		              error );
+
+		if( read_count != (ssize_t) table_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read objects table data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 objects_offset,
+			 objects_offset );
+
+			goto on_error;
+		}
+		volume_index->objects = (libfsrefs_volume_index_object_t *) memory_allocate(
+		                                                             sizeof( libfsrefs_volume_index_object_t ) * (size_t) number_of_objects );
+
+		if( volume_index->objects == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create objects.",
+			 function );
+
+			goto on_error;
+		}
+		volume_index->number_of_allocated_objects = (int) number_of_objects;
+
+		object_data = (fsrefs_volume_index_object_t *) table_data;
+
+		for( object_index = 0;
+		     object_index < (int) number_of_objects;
+		     object_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 object_data[ object_index ].object_identifier,
+			 volume_index->objects[ object_index ].object_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 object_data[ object_index ].parent_object_identifier,
+			 volume_index->objects[ object_index ].parent_object_identifier );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 object_data[ object_index ].first_record_index,
+			 volume_index->objects[ object_index ].first_record_index );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 object_data[ object_index ].number_of_records,
+			 volume_index->objects[ object_index ].number_of_records );
+
+			/* The objects are looked up with a binary search and must be stored
+			 * in order of object identifier without duplicates
+			 */
+			if( ( object_index > 0 )
+			 && ( volume_index->objects[ object_index ].object_identifier <= volume_index->objects[ object_index - 1 ].object_identifier ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid object: %d - object identifier out of order.",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+			if( ( volume_index->objects[ object_index ].first_record_index > number_of_records )
+			 || ( volume_index->objects[ object_index ].number_of_records > ( number_of_records - volume_index->objects[ object_index ].first_record_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid object: %d - records value out of bounds.",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 table_data );
+
+		table_data = NULL;
+	}
+	if( number_of_records > 0 )
+	{
+		table_data_size = sizeof( fsrefs_volume_index_record_t ) * (size_t) number_of_records;
+
+		table_data = (uint8_t *) memory_allocate(
+		                          table_data_size );
+
+		if( table_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records table data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              table_data,
+		              table_data_size,
+		              (off64_t) records_offset,
+		              error );
+
+		if( read_count != (ssize_t) table_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records table data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 records_offset,
+			 records_offset );
+
+			goto on_error;
+		}
+		volume_index->records = (libfsrefs_volume_index_record_t *) memory_allocate(
+		                                                             sizeof( libfsrefs_volume_index_record_t ) * (size_t) number_of_records );
+
+		if( volume_index->records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records.",
+			 function );
+
+			goto on_error;
+		}
+		volume_index->number_of_allocated_records = (int) number_of_records;
+
+		record_data = (fsrefs_volume_index_record_t *) table_data;
+
+		for( record_index = 0;
+		     record_index < (int) number_of_records;
+		     record_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 record_data[ record_index ].data_offset,
+			 volume_index->records[ record_index ].data_offset );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 record_data[ record_index ].key_data_size,
+			 volume_index->records[ record_index ].key_data_size );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 record_data[ record_index ].value_data_size,
+			 volume_index->records[ record_index ].value_data_size );
+
+			if( ( volume_index->records[ record_index ].data_offset > record_data_size )
+			 || ( ( (uint64_t) volume_index->records[ record_index ].key_data_size + (uint64_t) volume_index->records[ record_index ].value_data_size ) > ( record_data_size - volume_index->records[ record_index ].data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid record: %d - data value out of bounds.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 table_data );
+
+		table_data = NULL;
+	}
+	if( record_data_size > 0 )
+	{
+		volume_index->record_data = (uint8_t *) memory_allocate(
+		                                         (size_t) record_data_size );
+
+		if( volume_index->record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			goto on_error;
+		}
+		volume_index->allocated_record_data_size = (size_t) record_data_size;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              volume_index->record_data,
+		              (size_t) record_data_size,
+		              (off64_t) record_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) record_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_data_offset,
+			 record_data_offset );
+
+			goto on_error;
+		}
+	}
+	volume_index->number_of_objects    = (int) number_of_objects;
+	volume_index->number_of_records    = (int) number_of_records;
+	volume_index->record_data_size     = (size_t) record_data_size;
+	volume_index->current_object_index = -1;
+	volume_index->is_sorted            = 1;
+
+	return( 1 );
+
+on_error:
+	if( table_data != NULL )
+	{
+		memory_free(
+		 table_data );
+	}
+	if( volume_index->record_data != NULL )
+	{
+		memory_free(
+		 volume_index->record_data );
+
+		volume_index->record_data = NULL;
+	}
+	if( volume_index->records != NULL )
+	{
+		memory_free(
+		 volume_index->records );
+
+		volume_index->records = NULL;
+	}
+	if( volume_index->objects != NULL )
+	{
+		memory_free(
+		 volume_index->objects );
+
+		volume_index->objects = NULL;
+	}
+	volume_index->number_of_allocated_objects = 0;
+	volume_index->number_of_allocated_records = 0;
+	volume_index->allocated_record_data_size  = 0;
+
+	return( -1 );
+}
+
+/* Writes the volume index to a volume index file
+ * The objects must be sorted before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libfsrefs_volume_index_write_file_io_handle(
+     libfsrefs_volume_index_t *volume_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	fsrefs_volume_index_file_header_t file_header;
+
+	fsrefs_volume_index_object_t *object_data = NULL;
+	fsrefs_volume_index_record_t *record_data = NULL;
+	uint8_t *table_data                       = NULL;
+	static char *function                     = "libfsrefs_volume_index_write_file_io_handle";
+	size_t objects_table_size                 = 0;
+	size_t records_table_size                 = 0;
+	size_t table_data_size                    = 0;
+	ssize_t write_count                       = 0;
+	uint64_t objects_offset                   = 0;
+	uint64_t record_data_offset               = 0;
+	uint64_t records_offset                   = 0;
+	int object_index                          = 0;
+	int record_index                          = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index - objects are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	objects_table_size = sizeof( fsrefs_volume_index_object_t ) * (size_t) volume_index->number_of_objects;
+	records_table_size = sizeof( fsrefs_volume_index_record_t ) * (size_t) volume_index->number_of_records;
+
+	objects_offset     = (uint64_t) sizeof( fsrefs_volume_index_file_header_t );
+	records_offset     = objects_offset + objects_table_size;
+	record_data_offset = records_offset + records_table_size;
+
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( fsrefs_volume_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume index file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     fsrefs_volume_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy volume index file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 LIBFSREFS_VOLUME_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.file_header_size,
+	 (uint32_t) sizeof( fsrefs_volume_index_file_header_t ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.volume_serial_number,
+	 volume_index->volume_serial_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.checkpoint_sequence_number,
+	 volume_index->checkpoint_sequence_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_objects,
+	 (uint32_t) volume_index->number_of_objects );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_records,
+	 (uint32_t) volume_index->number_of_records );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.objects_offset,
+	 objects_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.records_offset,
+	 records_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.record_data_offset,
+	 record_data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.record_data_size,
+	 (uint64_t) volume_index->record_data_size );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( fsrefs_volume_index_file_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( fsrefs_volume_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write volume index file header data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	table_data_size = objects_table_size;
+
+	if( records_table_size > table_data_size )
+	{
+		table_data_size = records_table_size;
+	}
+	if( table_data_size > 0 )
+	{
+		if( table_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid table data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		table_data = (uint8_t *) memory_allocate(
+		                          table_data_size );
+
+		if( table_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create table data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     table_data,
+		     0,
+		     table_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear table data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( objects_table_size > 0 )
+	{
+		object_data = (fsrefs_volume_index_object_t *) table_data;
+
+		for( object_index = 0;
+		     object_index < volume_index->number_of_objects;
+		     object_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 object_data[ object_index ].object_identifier,
+			 volume_index->objects[ object_index ].object_identifier );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 object_data[ object_index ].parent_object_identifier,
+			 volume_index->objects[ object_index ].parent_object_identifier );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 object_data[ object_index ].first_record_index,
+			 volume_index->objects[ object_index ].first_record_index );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 object_data[ object_index ].number_of_records,
+			 volume_index->objects[ object_index ].number_of_records );
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               table_data,
+		               objects_table_size,
+		               (off64_t) objects_offset,
+		               error );
+
+		if( write_count != (ssize_t) objects_table_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write objects table data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 objects_offset,
+			 objects_offset );
+
+			goto on_error;
+		}
+	}
+	if( records_table_size > 0 )
+	{
+		record_data = (fsrefs_volume_index_record_t *) table_data;
+
+		for( record_index = 0;
+		     record_index < volume_index->number_of_records;
+		     record_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 record_data[ record_index ].data_offset,
+			 volume_index->records[ record_index ].data_offset );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 record_data[ record_index ].key_data_size,
+			 volume_index->records[ record_index ].key_data_size );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 record_data[ record_index ].value_data_size,
+			 volume_index->records[ record_index ].value_data_size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 record_data[ record_index ].padding,
+			 0 );
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               table_data,
+		               records_table_size,
+		               (off64_t) records_offset,
+		               error );
+
+		if( write_count != (ssize_t) records_table_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write records table data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 records_offset,
+			 records_offset );
+
+			goto on_error;
+		}
+	}
+	if( table_data != NULL )
+	{
+		memory_free(
+		 table_data );
+
+		table_data = NULL;
+	}
+	if( volume_index->record_data_size > 0 )
+	{
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               volume_index->record_data,
+		               volume_index->record_data_size,
+		               (off64_t) record_data_offset,
+		               error );
+
+		if( write_count != (ssize_t) volume_index->record_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_data_offset,
+			 record_data_offset );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( table_data != NULL )
+	{
+		memory_free(
+		 table_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,195 @@
+/*
+ * Volume index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSREFS_VOLUME_INDEX_H )
+#define _LIBFSREFS_VOLUME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsrefs_libbfio.h"
+#include "libfsrefs_libcerror.h"
+#include "libfsrefs_node_record.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const char fsrefs_volume_index_file_signature[ 8 ];
+
+typedef struct libfsrefs_volume_index_object libfsrefs_volume_index_object_t;
+
+struct libfsrefs_volume_index_object
+{
+	/* The (directory) object identifier
+	 */
+	uint64_t object_identifier;
+
+	/* The parent (directory) object identifier
+	 */
+	uint64_t parent_object_identifier;
+
+	/* The index of the first record
+	 */
+	uint32_t first_record_index;
+
+	/* The number of records
+	 */
+	uint32_t number_of_records;
+};
+
+typedef struct libfsrefs_volume_index_record libfsrefs_volume_index_record_t;
+
+struct libfsrefs_volume_index_record
+{
+	/* The offset of the key data in the record data, the value data directly follows the key data
+	 */
+	uint64_t data_offset;
+
+	/* The key data size
+	 */
+	uint16_t key_data_size;
+
+	/* The value data size
+	 */
+	uint16_t value_data_size;
+};
+
+typedef struct libfsrefs_volume_index libfsrefs_volume_index_t;
+
+struct libfsrefs_volume_index
+{
+	/* The volume serial number
+	 */
+	uint64_t volume_serial_number;
+
+	/* The checkpoint sequence number
+	 */
+	uint64_t checkpoint_sequence_number;
+
+	/* The objects
+	 */
+	libfsrefs_volume_index_object_t *objects;
+
+	/* The number of objects
+	 */
+	int number_of_objects;
+
+	/* The number of allocated objects
+	 */
+	int number_of_allocated_objects;
+
+	/* The records
+	 */
+	libfsrefs_volume_index_record_t *records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of allocated records
+	 */
+	int number_of_allocated_records;
+
+	/* The record data
+	 * This contains the key and value data of all the records
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The allocated record data size
+	 */
+	size_t allocated_record_data_size;
+
+	/* The index of the object records are appended to
+	 */
+	int current_object_index;
+
+	/* Value to indicate the objects are sorted by object identifier
+	 */
+	uint8_t is_sorted;
+};
+
+int libfsrefs_volume_index_initialize(
+     libfsrefs_volume_index_t **volume_index,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_free(
+     libfsrefs_volume_index_t **volume_index,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_append_object(
+     libfsrefs_volume_index_t *volume_index,
+     uint64_t object_identifier,
+     uint64_t parent_object_identifier,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_get_object_by_index(
+     libfsrefs_volume_index_t *volume_index,
+     int object_index,
+     libfsrefs_volume_index_object_t **object,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_set_current_object(
+     libfsrefs_volume_index_t *volume_index,
+     int object_index,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_append_record(
+     libfsrefs_volume_index_t *volume_index,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_sort(
+     libfsrefs_volume_index_t *volume_index,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_get_object_by_identifier(
+     libfsrefs_volume_index_t *volume_index,
+     uint64_t object_identifier,
+     libfsrefs_volume_index_object_t **object,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_get_record_by_index(
+     libfsrefs_volume_index_t *volume_index,
+     int record_index,
+     libfsrefs_node_record_t *node_record,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_read_file_io_handle(
+     libfsrefs_volume_index_t *volume_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsrefs_volume_index_write_file_io_handle(
+     libfsrefs_volume_index_t *volume_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSREFS_VOLUME_INDEX_H ) */
+
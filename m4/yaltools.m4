@@ -73,9 +73,11 @@ AC_DEFUN([AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE],
 
 dnl Function to detect if fsrefstools dependencies are available
 AC_DEFUN([AX_FSREFSTOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+  [AC_CHECK_HEADERS([signal.h sys/resource.h sys/signal.h sys/stat.h unistd.h])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  AC_CHECK_FUNCS([close getegid geteuid getopt getrusage setvbuf])
+
+  AC_CHECK_MEMBERS([struct stat.st_atim])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
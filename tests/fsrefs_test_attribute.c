@@ -0,0 +1,644 @@
+/*
+ * Library attribute type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_attribute.h"
+#include "../libfsrefs/libfsrefs_attribute_values.h"
+
+uint8_t fsrefs_test_attribute_resident_data1[ 72 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x6c, 0x6c,
+	0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x0a };
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_attribute_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_initialize(
+     libfsrefs_attribute_values_t *attribute_values )
+{
+	libcerror_error_t *error         = NULL;
+	libfsrefs_attribute_t *attribute = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_attribute_initialize(
+	          &attribute,
+	          attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute",
+	 attribute );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_attribute_free(
+	          &attribute,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "attribute",
+	 attribute );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_initialize(
+	          NULL,
+	          attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	attribute = (libfsrefs_attribute_t *) 0x12345678UL;
+
+	result = libfsrefs_attribute_initialize(
+	          &attribute,
+	          attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	attribute = NULL;
+
+	result = libfsrefs_attribute_initialize(
+	          &attribute,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_attribute_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_attribute_initialize(
+		          &attribute,
+		          attribute_values,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( attribute != NULL )
+			{
+				libfsrefs_attribute_free(
+				 &attribute,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "attribute",
+			 attribute );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_attribute_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_attribute_initialize(
+		          &attribute,
+		          attribute_values,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( attribute != NULL )
+			{
+				libfsrefs_attribute_free(
+				 &attribute,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "attribute",
+			 attribute );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute != NULL )
+	{
+		libfsrefs_attribute_free(
+		 &attribute,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_attribute_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_attribute_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_get_type(
+     libfsrefs_attribute_t *attribute )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_attribute_get_type(
+	          attribute,
+	          &type,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "type",
+	 type,
+	 (uint32_t) 0x00000080UL );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_get_type(
+	          attribute,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_attribute_get_resident_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_get_resident_data(
+     libfsrefs_attribute_t *attribute )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_attribute_get_resident_data(
+	          attribute,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( fsrefs_test_attribute_resident_data1[ 60 ] ) ),
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_get_resident_data(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_get_resident_data(
+	          attribute,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_attribute_t *attribute               = NULL;
+	libfsrefs_attribute_values_t *attribute_values = NULL;
+	int result                                     = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libfsrefs_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          fsrefs_test_attribute_resident_data1,
+	          72,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->attribute_type = 0x00000080UL;
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_attribute_initialize",
+	 fsrefs_test_attribute_initialize,
+	 attribute_values );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_attribute_free",
+	 fsrefs_test_attribute_free );
+
+	result = libfsrefs_attribute_initialize(
+	          &attribute,
+	          attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute",
+	 attribute );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Run tests
+	 */
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_attribute_get_type",
+	 fsrefs_test_attribute_get_type,
+	 attribute );
+
+	/* TODO add tests for libfsrefs_attribute_get_utf8_name_size */
+	/* TODO add tests for libfsrefs_attribute_get_utf8_name */
+	/* TODO add tests for libfsrefs_attribute_get_utf16_name_size */
+	/* TODO add tests for libfsrefs_attribute_get_utf16_name */
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_attribute_get_resident_data",
+	 fsrefs_test_attribute_get_resident_data,
+	 attribute );
+
+	/* Clean up
+	 */
+	result = libfsrefs_attribute_free(
+	          &attribute,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "attribute",
+	 attribute );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute != NULL )
+	{
+		libfsrefs_attribute_free(
+		 &attribute,
+		 NULL );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsrefs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
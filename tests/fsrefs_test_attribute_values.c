@@ -35,6 +35,13 @@
 
 #include "../libfsrefs/libfsrefs_attribute_values.h"
 
+uint8_t fsrefs_test_attribute_values_resident_data1[ 72 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x6c, 0x6c,
+	0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x0a };
+
 #if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
 
 /* Tests the libfsrefs_attribute_values_initialize function
@@ -270,6 +277,496 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsrefs_attribute_values_read_resident function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_values_read_resident(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_attribute_values_t *attribute_values = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          fsrefs_test_attribute_values_resident_data1,
+	          72,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "attribute_values->is_resident",
+	 attribute_values->is_resident,
+	 (uint8_t) 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "attribute_values->resident_data_size",
+	 attribute_values->resident_data_size,
+	 (size_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_values_read_resident(
+	          NULL,
+	          fsrefs_test_attribute_values_resident_data1,
+	          72,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          NULL,
+	          72,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          fsrefs_test_attribute_values_resident_data1,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with inline data size value out of bounds
+	 */
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          fsrefs_test_attribute_values_resident_data1,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsrefs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_attribute_values_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_values_get_data_size(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_attribute_values_t *attribute_values = NULL;
+	size64_t data_size                             = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          fsrefs_test_attribute_values_resident_data1,
+	          72,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_attribute_values_get_data_size(
+	          attribute_values,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) 12 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_values_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_values_get_data_size(
+	          attribute_values,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsrefs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_attribute_values_get_resident_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_attribute_values_get_resident_data(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_attribute_values_t *attribute_values = NULL;
+	const uint8_t *resident_data                   = NULL;
+	size_t resident_data_size                      = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a non-resident attribute
+	 */
+	result = libfsrefs_attribute_values_get_resident_data(
+	          attribute_values,
+	          &resident_data,
+	          &resident_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_attribute_values_read_resident(
+	          attribute_values,
+	          fsrefs_test_attribute_values_resident_data1,
+	          72,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_attribute_values_get_resident_data(
+	          attribute_values,
+	          &resident_data,
+	          &resident_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resident data is not copied
+	 */
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "resident_data",
+	 (int) ( resident_data == &( fsrefs_test_attribute_values_resident_data1[ 60 ] ) ),
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "resident_data_size",
+	 resident_data_size,
+	 (size_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_attribute_values_get_resident_data(
+	          NULL,
+	          &resident_data,
+	          &resident_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_values_get_resident_data(
+	          attribute_values,
+	          NULL,
+	          &resident_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_attribute_values_get_resident_data(
+	          attribute_values,
+	          &resident_data,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsrefs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 
 /* The main program
@@ -298,7 +795,11 @@ int main(
 	 fsrefs_test_attribute_values_free );
 
 	/* TODO add tests for libfsrefs_attribute_values_read_non_resident */
-	/* TODO add tests for libfsrefs_attribute_values_read_resident */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_attribute_values_read_resident",
+	 fsrefs_test_attribute_values_read_resident );
+
 	/* TODO add tests for libfsrefs_attribute_values_read_node_record */
 
 	/* TODO add tests for libfsrefs_attribute_values_get_utf8_name_size */
@@ -306,6 +807,16 @@ int main(
 	/* TODO add tests for libfsrefs_attribute_values_get_utf16_name_size */
 	/* TODO add tests for libfsrefs_attribute_values_get_utf16_name */
 
+	/* TODO add tests for libfsrefs_attribute_values_get_attribute_type */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_attribute_values_get_data_size",
+	 fsrefs_test_attribute_values_get_data_size );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_attribute_values_get_resident_data",
+	 fsrefs_test_attribute_values_get_resident_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -306,8 +306,22 @@ int fsrefs_test_block_reference_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_block_reference_initialize(
 	          &block_reference,
@@ -495,8 +509,22 @@ int fsrefs_test_block_reference_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 4096;
-	io_handle->major_format_version = 3;
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_block_reference_initialize(
 	          &block_reference,
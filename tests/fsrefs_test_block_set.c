@@ -1,5 +1,5 @@
 /*
- * Library block_tree functions testing program
+ * Library block_set type test program
  *
  * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -33,35 +33,30 @@
 #include "fsrefs_test_memory.h"
 #include "fsrefs_test_unused.h"
 
-#include "../libfsrefs/libfsrefs_block_descriptor.h"
-#include "../libfsrefs/libfsrefs_block_tree.h"
-#include "../libfsrefs/libfsrefs_block_tree_node.h"
-#include "../libfsrefs/libfsrefs_definitions.h"
+#include "../libfsrefs/libfsrefs_block_set.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
 
-/* Tests the libfsrefs_block_tree_initialize function
+/* Tests the libfsrefs_block_set_initialize function
  * Returns 1 if successful or 0 if not
  */
-int fsrefs_test_block_tree_initialize(
+int fsrefs_test_block_set_initialize(
      void )
 {
-	libcerror_error_t *error           = NULL;
-	libfsrefs_block_tree_t *block_tree = NULL;
-	int result                         = 0;
+	libcerror_error_t *error         = NULL;
+	libfsrefs_block_set_t *block_set = NULL;
+	int result                       = 0;
 
 #if defined( HAVE_FSREFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests    = 2;
-	int number_of_memset_fail_tests    = 1;
-	int test_number                    = 0;
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
 #endif
 
-	/* Test block_tree initialization
+	/* Test regular cases
 	 */
-	result = libfsrefs_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libfsrefs_block_set_initialize(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -70,16 +65,15 @@ int fsrefs_test_block_tree_initialize(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree",
-	 block_tree );
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsrefs_block_tree_free(
-	          &block_tree,
-	          NULL,
+	result = libfsrefs_block_set_free(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -88,8 +82,8 @@ int fsrefs_test_block_tree_initialize(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
-	 "block_tree",
-	 block_tree );
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -97,10 +91,8 @@ int fsrefs_test_block_tree_initialize(
 
 	/* Test error cases
 	 */
-	result = libfsrefs_block_tree_initialize(
+	result = libfsrefs_block_set_initialize(
 	          NULL,
-	          0x800000000UL,
-	          0x4000,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -115,15 +107,13 @@ int fsrefs_test_block_tree_initialize(
 	libcerror_error_free(
 	 &error );
 
-	block_tree = (libfsrefs_block_tree_t *) 0x12345678UL;
+	block_set = (libfsrefs_block_set_t *) 0x12345678UL;
 
-	result = libfsrefs_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libfsrefs_block_set_initialize(
+	          &block_set,
 	          &error );
 
-	block_tree = NULL;
+	block_set = NULL;
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -143,25 +133,22 @@ int fsrefs_test_block_tree_initialize(
 	     test_number < number_of_malloc_fail_tests;
 	     test_number++ )
 	{
-		/* Test libfsrefs_block_tree_initialize with malloc failing
+		/* Test libfsrefs_block_set_initialize with malloc failing
 		 */
 		fsrefs_test_malloc_attempts_before_fail = test_number;
 
-		result = libfsrefs_block_tree_initialize(
-		          &block_tree,
-		          0x800000000UL,
-		          0x4000,
+		result = libfsrefs_block_set_initialize(
+		          &block_set,
 		          &error );
 
 		if( fsrefs_test_malloc_attempts_before_fail != -1 )
 		{
 			fsrefs_test_malloc_attempts_before_fail = -1;
 
-			if( block_tree != NULL )
+			if( block_set != NULL )
 			{
-				libfsrefs_block_tree_free(
-				 &block_tree,
-				 NULL,
+				libfsrefs_block_set_free(
+				 &block_set,
 				 NULL );
 			}
 		}
@@ -173,8 +160,8 @@ int fsrefs_test_block_tree_initialize(
 			 -1 );
 
 			FSREFS_TEST_ASSERT_IS_NULL(
-			 "block_tree",
-			 block_tree );
+			 "block_set",
+			 block_set );
 
 			FSREFS_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -188,25 +175,22 @@ int fsrefs_test_block_tree_initialize(
 	     test_number < number_of_memset_fail_tests;
 	     test_number++ )
 	{
-		/* Test libfsrefs_block_tree_initialize with memset failing
+		/* Test libfsrefs_block_set_initialize with memset failing
 		 */
 		fsrefs_test_memset_attempts_before_fail = test_number;
 
-		result = libfsrefs_block_tree_initialize(
-		          &block_tree,
-		          0x800000000UL,
-		          0x4000,
+		result = libfsrefs_block_set_initialize(
+		          &block_set,
 		          &error );
 
 		if( fsrefs_test_memset_attempts_before_fail != -1 )
 		{
 			fsrefs_test_memset_attempts_before_fail = -1;
 
-			if( block_tree != NULL )
+			if( block_set != NULL )
 			{
-				libfsrefs_block_tree_free(
-				 &block_tree,
-				 NULL,
+				libfsrefs_block_set_free(
+				 &block_set,
 				 NULL );
 			}
 		}
@@ -218,8 +202,8 @@ int fsrefs_test_block_tree_initialize(
 			 -1 );
 
 			FSREFS_TEST_ASSERT_IS_NULL(
-			 "block_tree",
-			 block_tree );
+			 "block_set",
+			 block_set );
 
 			FSREFS_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -239,20 +223,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( block_tree != NULL )
+	if( block_set != NULL )
 	{
-		libfsrefs_block_tree_free(
-		 &block_tree,
-		 NULL,
+		libfsrefs_block_set_free(
+		 &block_set,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libfsrefs_block_tree_free function
+/* Tests the libfsrefs_block_set_free function
  * Returns 1 if successful or 0 if not
  */
-int fsrefs_test_block_tree_free(
+int fsrefs_test_block_set_free(
      void )
 {
 	libcerror_error_t *error = NULL;
@@ -260,8 +243,7 @@ int fsrefs_test_block_tree_free(
 
 	/* Test error cases
 	 */
-	result = libfsrefs_block_tree_free(
-	          NULL,
+	result = libfsrefs_block_set_free(
 	          NULL,
 	          &error );
 
@@ -288,24 +270,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsrefs_block_tree_get_block_descriptor_by_offset function
+/* Tests the libfsrefs_block_set_insert function
  * Returns 1 if successful or 0 if not
  */
-int fsrefs_test_block_tree_get_block_descriptor_by_offset(
+int fsrefs_test_block_set_insert(
      void )
 {
-	libcerror_error_t *error                      = NULL;
-	libfsrefs_block_descriptor_t *block_descriptor = NULL;
-	libfsrefs_block_tree_t *block_tree             = NULL;
-	off64_t block_offset                          = 0;
-	int result                                    = 0;
+	libcerror_error_t *error         = NULL;
+	libfsrefs_block_set_t *block_set = NULL;
+	off64_t block_offset             = 0;
+	int number_of_blocks             = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
-	result = libfsrefs_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libfsrefs_block_set_initialize(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -314,30 +294,66 @@ int fsrefs_test_block_tree_get_block_descriptor_by_offset(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree",
-	 block_tree );
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test regular cases
+	 * Insert enough blocks to resize the slots multiple times
 	 */
-	result = libfsrefs_block_tree_get_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          &block_descriptor,
-	          &block_offset,
+	for( block_offset = 0;
+	     block_offset < ( 1024 * 16384 );
+	     block_offset += 16384 )
+	{
+		result = libfsrefs_block_set_insert(
+		          block_set,
+		          block_offset,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( block_offset = 0;
+	     block_offset < ( 1024 * 16384 );
+	     block_offset += 16384 )
+	{
+		result = libfsrefs_block_set_insert(
+		          block_set,
+		          block_offset,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsrefs_block_set_get_number_of_blocks(
+	          block_set,
+	          &number_of_blocks,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	FSREFS_TEST_ASSERT_IS_NULL(
-	 "block_descriptor",
-	 block_descriptor );
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 1024 );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -345,11 +361,9 @@ int fsrefs_test_block_tree_get_block_descriptor_by_offset(
 
 	/* Test error cases
 	 */
-	result = libfsrefs_block_tree_get_block_descriptor_by_offset(
+	result = libfsrefs_block_set_insert(
 	          NULL,
 	          0,
-	          &block_descriptor,
-	          &block_offset,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -364,30 +378,9 @@ int fsrefs_test_block_tree_get_block_descriptor_by_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsrefs_block_tree_get_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          NULL,
-	          &block_offset,
-	          &error );
-
-	FSREFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfsrefs_block_tree_get_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          &block_descriptor,
-	          NULL,
+	result = libfsrefs_block_set_insert(
+	          block_set,
+	          -1,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -404,9 +397,8 @@ int fsrefs_test_block_tree_get_block_descriptor_by_offset(
 
 	/* Clean up
 	 */
-	result = libfsrefs_block_tree_free(
-	          &block_tree,
-	          NULL,
+	result = libfsrefs_block_set_free(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -415,8 +407,8 @@ int fsrefs_test_block_tree_get_block_descriptor_by_offset(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
-	 "block_tree",
-	 block_tree );
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -430,36 +422,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( block_tree != NULL )
+	if( block_set != NULL )
 	{
-		libfsrefs_block_tree_free(
-		 &block_tree,
-		 NULL,
+		libfsrefs_block_set_free(
+		 &block_set,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libfsrefs_block_tree_insert_block_descriptor_by_offset function
+/* Tests the libfsrefs_block_set_resize function
  * Returns 1 if successful or 0 if not
  */
-int fsrefs_test_block_tree_insert_block_descriptor_by_offset(
+int fsrefs_test_block_set_resize(
      void )
 {
-	libcerror_error_t *error                               = NULL;
-	libfsrefs_block_descriptor_t *block_descriptor          = NULL;
-	libfsrefs_block_descriptor_t *existing_block_descriptor = NULL;
-	libfsrefs_block_tree_t *block_tree                      = NULL;
-	libfsrefs_block_tree_node_t *leaf_block_tree_node       = NULL;
-	int leaf_value_index                                   = 0;
-	int result                                             = 0;
+	libcerror_error_t *error         = NULL;
+	libfsrefs_block_set_t *block_set = NULL;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
-	result = libfsrefs_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libfsrefs_block_set_initialize(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -468,15 +453,18 @@ int fsrefs_test_block_tree_insert_block_descriptor_by_offset(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree",
-	 block_tree );
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsrefs_block_descriptor_initialize(
-	          &block_descriptor,
+	/* Test regular cases
+	 */
+	result = libfsrefs_block_set_resize(
+	          block_set,
+	          8,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -484,129 +472,174 @@ int fsrefs_test_block_tree_insert_block_descriptor_by_offset(
 	 result,
 	 1 );
 
-	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "block_descriptor",
-	 block_descriptor );
-
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "block_set->number_of_slots",
+	 block_set->number_of_slots,
+	 256 );
+
+	/* Test error cases
 	 */
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
+	result = libfsrefs_block_set_resize(
+	          NULL,
+	          8,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FSREFS_TEST_ASSERT_EQUAL_INT(
-	 "leaf_value_index",
-	 leaf_value_index,
-	 0 );
+	 -1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "leaf_block_tree_node",
-	 leaf_block_tree_node );
-
-	FSREFS_TEST_ASSERT_IS_NULL(
-	 "existing_block_descriptor",
-	 existing_block_descriptor );
-
-	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_block_set_resize(
+	          block_set,
 	          0,
-	          NULL,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	FSREFS_TEST_ASSERT_EQUAL_INT(
-	 "leaf_value_index",
-	 leaf_value_index,
-	 0 );
+	 -1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "leaf_block_tree_node",
-	 leaf_block_tree_node );
+	 "error",
+	 error );
 
-	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "existing_block_descriptor",
-	 existing_block_descriptor );
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	/* Test libfsrefs_block_set_resize with malloc failing
+	 */
+	fsrefs_test_malloc_attempts_before_fail = 0;
+
+	result = libfsrefs_block_set_resize(
+	          block_set,
+	          9,
+	          &error );
+
+	if( fsrefs_test_malloc_attempts_before_fail != -1 )
+	{
+		fsrefs_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSREFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfsrefs_block_set_free(
+	          &block_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_set != NULL )
+	{
+		libfsrefs_block_set_free(
+		 &block_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_block_set_get_number_of_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_block_set_get_number_of_blocks(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsrefs_block_set_t *block_set = NULL;
+	int number_of_blocks             = 0;
+	int result                       = 0;
+
+	/* Initialize test
 	 */
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          NULL,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
+	result = libfsrefs_block_set_initialize(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_set",
+	 block_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          NULL,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
+	/* Test regular cases
+	 */
+	result = libfsrefs_block_set_get_number_of_blocks(
+	          block_set,
+	          &number_of_blocks,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
+	/* Test error cases
+	 */
+	result = libfsrefs_block_set_get_number_of_blocks(
 	          NULL,
-	          &existing_block_descriptor,
+	          &number_of_blocks,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -621,12 +654,8 @@ int fsrefs_test_block_tree_insert_block_descriptor_by_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsrefs_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
+	result = libfsrefs_block_set_get_number_of_blocks(
+	          block_set,
 	          NULL,
 	          &error );
 
@@ -644,26 +673,8 @@ int fsrefs_test_block_tree_insert_block_descriptor_by_offset(
 
 	/* Clean up
 	 */
-	result = libfsrefs_block_descriptor_free(
-	          &block_descriptor,
-	          &error );
-
-	FSREFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSREFS_TEST_ASSERT_IS_NULL(
-	 "block_descriptor",
-	 block_descriptor );
-
-	FSREFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfsrefs_block_tree_free(
-	          &block_tree,
-	          NULL,
+	result = libfsrefs_block_set_free(
+	          &block_set,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -672,8 +683,8 @@ int fsrefs_test_block_tree_insert_block_descriptor_by_offset(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
-	 "block_tree",
-	 block_tree );
+	 "block_set",
+	 block_set );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -687,17 +698,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( block_descriptor != NULL )
+	if( block_set != NULL )
 	{
-		libfsrefs_block_descriptor_free(
-		 &block_descriptor,
-		 NULL );
-	}
-	if( block_tree != NULL )
-	{
-		libfsrefs_block_tree_free(
-		 &block_tree,
-		 NULL,
+		libfsrefs_block_set_free(
+		 &block_set,
 		 NULL );
 	}
 	return( 0 );
@@ -723,20 +727,24 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
 
 	FSREFS_TEST_RUN(
-	 "libfsrefs_block_tree_initialize",
-	 fsrefs_test_block_tree_initialize );
+	 "libfsrefs_block_set_initialize",
+	 fsrefs_test_block_set_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_block_set_free",
+	 fsrefs_test_block_set_free );
 
 	FSREFS_TEST_RUN(
-	 "libfsrefs_block_tree_free",
-	 fsrefs_test_block_tree_free );
+	 "libfsrefs_block_set_resize",
+	 fsrefs_test_block_set_resize );
 
 	FSREFS_TEST_RUN(
-	 "libfsrefs_block_tree_get_block_descriptor_by_offset",
-	 fsrefs_test_block_tree_get_block_descriptor_by_offset );
+	 "libfsrefs_block_set_insert",
+	 fsrefs_test_block_set_insert );
 
 	FSREFS_TEST_RUN(
-	 "libfsrefs_block_tree_insert_block_descriptor_by_offset",
-	 fsrefs_test_block_tree_insert_block_descriptor_by_offset );
+	 "libfsrefs_block_set_get_number_of_blocks",
+	 fsrefs_test_block_set_get_number_of_blocks );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 
@@ -1584,8 +1584,22 @@ int fsrefs_test_checkpoint_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_checkpoint_initialize(
 	          &checkpoint,
@@ -1773,8 +1787,22 @@ int fsrefs_test_checkpoint_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 4096;
-	io_handle->major_format_version = 3;
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_checkpoint_initialize(
 	          &checkpoint,
@@ -1897,8 +1925,22 @@ int fsrefs_test_checkpoint_read_file_io_handle(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2161,8 +2203,22 @@ int fsrefs_test_checkpoint_read_file_io_handle(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 4096;
-	io_handle->major_format_version = 3;
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2304,6 +2360,84 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsrefs_checkpoint_get_sequence_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_checkpoint_get_sequence_number(
+     libfsrefs_checkpoint_t *checkpoint )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t sequence_number = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_checkpoint_get_sequence_number(
+	          checkpoint,
+	          &sequence_number,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "sequence_number",
+	 sequence_number,
+	 (uint64_t) 10 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_checkpoint_get_sequence_number(
+	          NULL,
+	          &sequence_number,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_checkpoint_get_sequence_number(
+	          checkpoint,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsrefs_checkpoint_get_number_of_ministore_tree_block_references function
  * Returns 1 if successful or 0 if not
  */
@@ -2438,8 +2572,22 @@ int main(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_checkpoint_initialize(
 	          &checkpoint,
@@ -2476,6 +2624,11 @@ int main(
 
 	/* Run tests
 	 */
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_checkpoint_get_sequence_number",
+	 fsrefs_test_checkpoint_get_sequence_number,
+	 checkpoint );
+
 	FSREFS_TEST_RUN_WITH_ARGS(
 	 "libfsrefs_checkpoint_get_number_of_ministore_tree_block_references",
 	 fsrefs_test_checkpoint_get_number_of_ministore_tree_block_references,
@@ -0,0 +1,1120 @@
+/*
+ * Library data block stream functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_data_block_stream.h"
+#include "../libfsrefs/libfsrefs_data_run.h"
+#include "../libfsrefs/libfsrefs_io_handle.h"
+#include "../libfsrefs/libfsrefs_libcdata.h"
+#include "../libfsrefs/libfsrefs_libfdata.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Appends a data run to the data runs array
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_data_block_stream_append_data_run(
+     libcdata_array_t *data_runs_array,
+     uint64_t logical_block_number,
+     uint64_t number_of_blocks,
+     uint64_t start_block_number,
+     libcerror_error_t **error )
+{
+	libfsrefs_data_run_t *data_run = NULL;
+	int entry_index                = 0;
+
+	if( libfsrefs_data_run_initialize(
+	     &data_run,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	data_run->logical_block_number = logical_block_number;
+	data_run->number_of_blocks     = number_of_blocks;
+	data_run->start_block_number   = start_block_number;
+
+	if( libcdata_array_append_entry(
+	     data_runs_array,
+	     &entry_index,
+	     (intptr_t *) data_run,
+	     error ) != 1 )
+	{
+		libfsrefs_data_run_free(
+		 &data_run,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfsrefs_data_block_stream_initialize_from_data_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_data_block_stream_initialize_from_data_runs(
+     libfsrefs_io_handle_t *io_handle,
+     libcdata_array_t *data_runs_array )
+{
+	libcdata_array_t *invalid_data_runs_array = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfdata_stream_t *data_block_stream      = NULL;
+	size64_t data_size                        = 0;
+	size64_t segment_size                     = 0;
+	off64_t segment_offset                    = 0;
+	uint32_t segment_flags                    = 0;
+	int number_of_segments                    = 0;
+	int segment_file_index                    = 0;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          io_handle,
+	          data_runs_array,
+	          ( 6 * 16384 ) - 100,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data block stream consists of: data, hole, data, hole
+	 */
+	result = libfdata_stream_get_number_of_segments(
+	          data_block_stream,
+	          &number_of_segments,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data run block numbers are in units of the metadata block size,
+	 * which differs from the cluster block size
+	 */
+	result = libfdata_stream_get_segment_by_index(
+	          data_block_stream,
+	          0,
+	          &segment_file_index,
+	          &segment_offset,
+	          &segment_size,
+	          &segment_flags,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 0x10 * 16384 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_size",
+	 (uint64_t) segment_size,
+	 (uint64_t) 2 * 16384 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_get_segment_by_index(
+	          data_block_stream,
+	          2,
+	          &segment_file_index,
+	          &segment_offset,
+	          &segment_size,
+	          &segment_flags,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 0x20 * 16384 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_size",
+	 (uint64_t) segment_size,
+	 (uint64_t) 16384 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_get_size(
+	          data_block_stream,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) ( 6 * 16384 ) - 100 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &data_block_stream,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          NULL,
+	          io_handle,
+	          data_runs_array,
+	          ( 6 * 16384 ) - 100,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          NULL,
+	          data_runs_array,
+	          ( 6 * 16384 ) - 100,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data runs overlap
+	 */
+	result = libcdata_array_initialize(
+	          &invalid_data_runs_array,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_data_block_stream_append_data_run(
+	          invalid_data_runs_array,
+	          0,
+	          4,
+	          0x10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fsrefs_test_data_block_stream_append_data_run(
+	          invalid_data_runs_array,
+	          2,
+	          4,
+	          0x20,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          io_handle,
+	          invalid_data_runs_array,
+	          6 * 16384,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &invalid_data_runs_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_data_run_free,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( invalid_data_runs_array != NULL )
+	{
+		libcdata_array_free(
+		 &invalid_data_runs_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_data_run_free,
+		 NULL );
+	}
+	if( data_block_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_block_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_data_block_stream_initialize_from_data_runs function with format version 3 containers
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_data_block_stream_initialize_from_data_runs_containers(
+     libcdata_array_t *data_runs_array )
+{
+	libcerror_error_t *error             = NULL;
+	libfdata_stream_t *data_block_stream = NULL;
+	libfsrefs_io_handle_t *io_handle     = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          4,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->cluster_block_size  = 4096;
+	io_handle->metadata_block_size = 4096;
+
+	/* Test regular cases where all data runs are stored in the first container
+	 */
+	io_handle->container_size = 0x40;
+
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          io_handle,
+	          data_runs_array,
+	          6 * 4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &data_block_stream,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where a data run is stored after the first container
+	 * and would require container translation
+	 */
+	io_handle->container_size = 0x18;
+
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          io_handle,
+	          data_runs_array,
+	          6 * 4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a data run crosses the end of the first container
+	 */
+	io_handle->container_size = 0x11;
+
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          io_handle,
+	          data_runs_array,
+	          6 * 4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_block_stream,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_data_block_stream_read_segment_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_data_block_stream_read_segment_data(
+     libfsrefs_io_handle_t *io_handle )
+{
+	uint8_t segment_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	size_t data_offset       = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     segment_data,
+	     0xff,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Sparse segment data is read without I/O
+	 */
+	read_count = libfsrefs_data_block_stream_read_segment_data(
+	              io_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              LIBFDATA_RANGE_FLAG_IS_SPARSE,
+	              0,
+	              &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 16;
+	     data_offset++ )
+	{
+		FSREFS_TEST_ASSERT_EQUAL_UINT8(
+		 "segment_data[ data_offset ]",
+		 segment_data[ data_offset ],
+		 (uint8_t) 0 );
+	}
+	/* Test error cases
+	 */
+	read_count = libfsrefs_data_block_stream_read_segment_data(
+	              NULL,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              LIBFDATA_RANGE_FLAG_IS_SPARSE,
+	              0,
+	              &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsrefs_data_block_stream_read_segment_data(
+	              io_handle,
+	              NULL,
+	              0,
+	              0,
+	              NULL,
+	              16,
+	              LIBFDATA_RANGE_FLAG_IS_SPARSE,
+	              0,
+	              &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_data_block_stream_get_next_range_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_data_block_stream_get_next_range_offset(
+     libfsrefs_io_handle_t *io_handle,
+     libcdata_array_t *data_runs_array )
+{
+	libcerror_error_t *error             = NULL;
+	libfdata_stream_t *data_block_stream = NULL;
+	off64_t range_offset                 = 0;
+	size64_t data_size                   = ( 6 * 16384 ) - 100;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_data_block_stream_initialize_from_data_runs(
+	          &data_block_stream,
+	          io_handle,
+	          data_runs_array,
+	          data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          0,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          40000,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 65536 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          0,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 32768 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          70000,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 81920 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with no data after the offset
+	 */
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          90000,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an offset at the end of the data
+	 */
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          (off64_t) data_size,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          -1,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_data_block_stream_get_next_range_offset(
+	          data_block_stream,
+	          data_size,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdata_stream_free(
+	          &data_block_stream,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "data_block_stream",
+	 data_block_stream );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_block_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+	libcdata_array_t *data_runs_array = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsrefs_io_handle_t *io_handle  = NULL;
+	int result                        = 0;
+#endif
+
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* In format version 1 the metadata block size differs from the cluster block size
+	 */
+	io_handle->cluster_block_size  = 65536;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &data_runs_array,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Blocks 0 - 1 are stored, blocks 2 - 3 are a hole, block 4 is stored
+	 * and the data after block 4 is a hole up to the data size
+	 */
+	result = fsrefs_test_data_block_stream_append_data_run(
+	          data_runs_array,
+	          0,
+	          2,
+	          0x10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_data_block_stream_append_data_run(
+	          data_runs_array,
+	          4,
+	          1,
+	          0x20,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_data_block_stream_initialize_from_data_runs",
+	 fsrefs_test_data_block_stream_initialize_from_data_runs,
+	 io_handle,
+	 data_runs_array );
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_data_block_stream_initialize_from_data_runs (containers)",
+	 fsrefs_test_data_block_stream_initialize_from_data_runs_containers,
+	 data_runs_array );
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_data_block_stream_read_segment_data",
+	 fsrefs_test_data_block_stream_read_segment_data,
+	 io_handle );
+
+	/* TODO add tests for libfsrefs_data_block_stream_seek_segment_offset */
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_data_block_stream_get_next_range_offset",
+	 fsrefs_test_data_block_stream_get_next_range_offset,
+	 io_handle,
+	 data_runs_array );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &data_runs_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_data_run_free,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_runs_array != NULL )
+	{
+		libcdata_array_free(
+		 &data_runs_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsrefs_data_run_free,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
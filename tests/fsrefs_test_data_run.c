@@ -301,8 +301,22 @@ int fsrefs_test_data_run_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_data_run_initialize(
 	          &data_run,
@@ -339,6 +353,21 @@ int fsrefs_test_data_run_read_data(
 	 "error",
 	 error );
 
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_run->logical_block_number",
+	 data_run->logical_block_number,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_run->number_of_blocks",
+	 data_run->number_of_blocks,
+	 (uint64_t) 4 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_run->start_block_number",
+	 data_run->start_block_number,
+	 (uint64_t) 0xe0 );
+
 	/* Test error cases
 	 */
 	result = libfsrefs_data_run_read_data(
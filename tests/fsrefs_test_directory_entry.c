@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,6 +35,8 @@
 #include "fsrefs_test_unused.h"
 
 #include "../libfsrefs/libfsrefs_directory_entry.h"
+#include "../libfsrefs/libfsrefs_io_handle.h"
+#include "../libfsrefs/libfsrefs_node_record.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
 
@@ -270,6 +273,674 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsrefs_directory_entry_read_node_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_entry_read_node_record(
+     void )
+{
+	uint8_t key_data1[ 8 ] = {
+		0x30, 0x00, 0x03, 0x00, 0x61, 0x00, 0x62, 0x00 };
+
+	/* The name data of an odd size cannot be converted
+	 */
+	uint8_t key_data2[ 7 ] = {
+		0x30, 0x00, 0x03, 0x00, 0x61, 0x00, 0x62 };
+
+	libfsrefs_node_record_t node_record;
+
+	uint8_t utf8_name[ 8 ];
+
+	libcerror_error_t *error                     = NULL;
+	libfsrefs_directory_entry_t *directory_entry = NULL;
+	size_t utf8_name_size                        = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &node_record,
+	 0,
+	 sizeof( libfsrefs_node_record_t ) );
+
+	node_record.key_data      = key_data1;
+	node_record.key_data_size = 8;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_entry_read_node_record(
+	          directory_entry,
+	          NULL,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry->utf8_name",
+	 directory_entry->utf8_name );
+
+	result = libfsrefs_directory_entry_get_utf8_name(
+	          directory_entry,
+	          utf8_name,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_name,
+	          "ab",
+	          3 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a name that cannot be converted only fails retrieving the name
+	 */
+	result = libfsrefs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	node_record.key_data      = key_data2;
+	node_record.key_data_size = 7;
+
+	result = libfsrefs_directory_entry_read_node_record(
+	          directory_entry,
+	          NULL,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry->utf8_name",
+	 directory_entry->utf8_name );
+
+	result = libfsrefs_directory_entry_get_utf8_name_size(
+	          directory_entry,
+	          &utf8_name_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_entry_read_node_record(
+	          NULL,
+	          NULL,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsrefs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_entry_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_entry_clone(
+     libfsrefs_directory_entry_t *directory_entry )
+{
+	libcerror_error_t *error                                 = NULL;
+	libfsrefs_directory_entry_t *destination_directory_entry = NULL;
+	int result                                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_entry_clone(
+	          &destination_directory_entry,
+	          directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_directory_entry",
+	 destination_directory_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_directory_entry->object_identifier",
+	 destination_directory_entry->object_identifier,
+	 directory_entry->object_identifier );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_directory_entry->data_size",
+	 (uint64_t) destination_directory_entry->data_size,
+	 (uint64_t) directory_entry->data_size );
+
+	result = libfsrefs_directory_entry_free(
+	          &destination_directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "destination_directory_entry",
+	 destination_directory_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_directory_entry_clone(
+	          &destination_directory_entry,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "destination_directory_entry",
+	 destination_directory_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_entry_clone(
+	          NULL,
+	          directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_directory_entry = (libfsrefs_directory_entry_t *) 0x12345678UL;
+
+	result = libfsrefs_directory_entry_clone(
+	          &destination_directory_entry,
+	          directory_entry,
+	          &error );
+
+	destination_directory_entry = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_directory_entry != NULL )
+	{
+		libfsrefs_directory_entry_free(
+		 &destination_directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_entry_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_entry_get_data_size(
+     libfsrefs_directory_entry_t *directory_entry )
+{
+	libcerror_error_t *error = NULL;
+	size64_t data_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_entry_get_data_size(
+	          directory_entry,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) 8192 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_entry_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_directory_entry_get_data_size(
+	          directory_entry,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_entry_get_number_of_attributes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_entry_get_number_of_attributes(
+     libfsrefs_directory_entry_t *directory_entry )
+{
+	libcerror_error_t *error         = NULL;
+	libfsrefs_io_handle_t *io_handle = NULL;
+	int number_of_attributes         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_entry_get_number_of_attributes(
+	          directory_entry,
+	          io_handle,
+	          &number_of_attributes,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_attributes",
+	 number_of_attributes,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory_entry->attributes_read",
+	 directory_entry->attributes_read,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_entry_get_number_of_attributes(
+	          NULL,
+	          io_handle,
+	          &number_of_attributes,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_directory_entry_get_number_of_attributes(
+	          directory_entry,
+	          NULL,
+	          &number_of_attributes,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_directory_entry_get_number_of_attributes(
+	          directory_entry,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_entry_get_stat function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_entry_get_stat(
+     libfsrefs_directory_entry_t *directory_entry )
+{
+	libfsrefs_file_entry_stat_t file_entry_stat;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_entry_get_stat(
+	          directory_entry,
+	          &file_entry_stat,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_entry_stat.object_identifier",
+	 file_entry_stat.object_identifier,
+	 (uint64_t) 0x00000701UL );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_entry_stat.creation_time",
+	 file_entry_stat.creation_time,
+	 (uint64_t) 0x01d1a3c3a5c5f2b0UL );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_entry_stat.size",
+	 (uint64_t) file_entry_stat.size,
+	 (uint64_t) 8192 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "file_entry_stat.file_attribute_flags",
+	 file_entry_stat.file_attribute_flags,
+	 (uint32_t) 0x00000020UL );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_entry_get_stat(
+	          NULL,
+	          &file_entry_stat,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_directory_entry_get_stat(
+	          directory_entry,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 
 /* The main program
@@ -284,6 +955,14 @@ int main(
      char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	libcerror_error_t *error                     = NULL;
+	libfsrefs_directory_entry_t *directory_entry = NULL;
+	int result                                   = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
 	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
 	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
 
@@ -299,7 +978,10 @@ int main(
 
 	/* TODO add tests for libfsrefs_directory_entry_read_directory_values */
 	/* TODO add tests for libfsrefs_directory_entry_read_file_values */
-	/* TODO add tests for libfsrefs_directory_entry_read_node_record */
+	/* TODO add tests for libfsrefs_directory_entry_read_attributes */
+	FSREFS_TEST_RUN(
+	 "libfsrefs_directory_entry_read_node_record",
+	 fsrefs_test_directory_entry_read_node_record );
 
 	/* TODO add tests for libfsrefs_directory_entry_get_object_identifier */
 	/* TODO add tests for libfsrefs_directory_entry_get_utf8_name_size */
@@ -312,15 +994,97 @@ int main(
 	/* TODO add tests for libfsrefs_directory_entry_get_entry_modification_time */
 	/* TODO add tests for libfsrefs_directory_entry_get_file_attribute_flags */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libfsrefs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry->object_identifier    = 0x00000701UL;
+	directory_entry->creation_time        = 0x01d1a3c3a5c5f2b0UL;
+	directory_entry->data_size            = 8192;
+	directory_entry->file_attribute_flags = 0x00000020UL;
+
+	/* Run tests
+	 */
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_directory_entry_clone",
+	 fsrefs_test_directory_entry_clone,
+	 directory_entry );
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_directory_entry_get_data_size",
+	 fsrefs_test_directory_entry_get_data_size,
+	 directory_entry );
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_directory_entry_get_stat",
+	 fsrefs_test_directory_entry_get_stat,
+	 directory_entry );
+
+	FSREFS_TEST_RUN_WITH_ARGS(
+	 "libfsrefs_directory_entry_get_number_of_attributes",
+	 fsrefs_test_directory_entry_get_number_of_attributes,
+	 directory_entry );
+
+	/* TODO add tests for libfsrefs_directory_entry_get_attribute_values_by_index */
+
+	/* Clean up
+	 */
+	result = libfsrefs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
-#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
-
 on_error:
-	return( EXIT_FAILURE );
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
 
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsrefs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
 }
 
@@ -74,9 +74,23 @@ int fsrefs_test_directory_object_initialize(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
-	io_handle->volume_size          = 2080374784;
+	io_handle->metadata_block_size = 16384;
+	io_handle->volume_size         = 2080374784;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_file_system_initialize(
 	          &file_system,
@@ -0,0 +1,1313 @@
+/*
+ * Library directory_object_cache type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_directory_object.h"
+#include "../libfsrefs/libfsrefs_directory_object_cache.h"
+#include "../libfsrefs/libfsrefs_file_system.h"
+#include "../libfsrefs/libfsrefs_io_handle.h"
+#include "../libfsrefs/libfsrefs_memory_budget.h"
+#include "../libfsrefs/libfsrefs_objects_tree.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_directory_object_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_object_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsrefs_directory_object_cache_t *directory_object_cache = NULL;
+	int result                                                 = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                            = 1;
+	int number_of_memset_fail_tests                            = 1;
+	int test_number                                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_object_cache_initialize(
+	          &directory_object_cache,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_object_cache",
+	 directory_object_cache );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_directory_object_cache_free(
+	          &directory_object_cache,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_object_cache",
+	 directory_object_cache );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_object_cache_initialize(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_object_cache = (libfsrefs_directory_object_cache_t *) 0x12345678UL;
+
+	result = libfsrefs_directory_object_cache_initialize(
+	          &directory_object_cache,
+	          NULL,
+	          &error );
+
+	directory_object_cache = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_directory_object_cache_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_directory_object_cache_initialize(
+		          &directory_object_cache,
+		          NULL,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( directory_object_cache != NULL )
+			{
+				libfsrefs_directory_object_cache_free(
+				 &directory_object_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "directory_object_cache",
+			 directory_object_cache );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_directory_object_cache_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_directory_object_cache_initialize(
+		          &directory_object_cache,
+		          NULL,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( directory_object_cache != NULL )
+			{
+				libfsrefs_directory_object_cache_free(
+				 &directory_object_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "directory_object_cache",
+			 directory_object_cache );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_object_cache != NULL )
+	{
+		libfsrefs_directory_object_cache_free(
+		 &directory_object_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_object_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_object_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_object_cache_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_object_cache_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_object_cache_add_reference(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsrefs_directory_object_cache_t *directory_object_cache = NULL;
+	libfsrefs_directory_object_cache_t *reference              = NULL;
+	int number_of_idle_directory_objects                       = 0;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_directory_object_cache_initialize(
+	          &directory_object_cache,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_object_cache",
+	 directory_object_cache );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_directory_object_cache_add_reference(
+	          directory_object_cache,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	reference = directory_object_cache;
+
+	/* Test that the directory object cache remains available after freeing the first reference
+	 */
+	result = libfsrefs_directory_object_cache_free(
+	          &directory_object_cache,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_object_cache",
+	 directory_object_cache );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_directory_object_cache_get_number_of_idle_directory_objects(
+	          reference,
+	          &number_of_idle_directory_objects,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_idle_directory_objects",
+	 number_of_idle_directory_objects,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_directory_object_cache_free(
+	          &reference,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_object_cache_add_reference(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference != NULL )
+	{
+		libfsrefs_directory_object_cache_free(
+		 &reference,
+		 NULL );
+	}
+	if( directory_object_cache != NULL )
+	{
+		libfsrefs_directory_object_cache_free(
+		 &directory_object_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_object_cache_evict function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_object_cache_evict(
+     void )
+{
+	libfsrefs_directory_object_t *directory_objects[ 3 ] = { NULL, NULL, NULL };
+
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_file_system_t *file_system                 = NULL;
+	libfsrefs_io_handle_t *io_handle                     = NULL;
+	libfsrefs_objects_tree_t *objects_tree               = NULL;
+	int directory_object_index                           = 0;
+	int number_of_evictions                              = 0;
+	int number_of_idle_directory_objects                 = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_system_initialize(
+	          &file_system,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_objects_tree_initialize(
+	          &objects_tree,
+	          file_system,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_set_maximum_size(
+	          io_handle->memory_budget,
+	          100,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Create 3 directory objects of 64 bytes each that exceed the memory budget
+	 */
+	for( directory_object_index = 0;
+	     directory_object_index < 3;
+	     directory_object_index++ )
+	{
+		result = libfsrefs_directory_object_initialize(
+		          &( directory_objects[ directory_object_index ] ),
+		          io_handle,
+		          objects_tree,
+		          (uint64_t) 0x00000701UL + directory_object_index,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_memory_budget_allocate(
+		          io_handle->memory_budget,
+		          64,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		directory_objects[ directory_object_index ]->memory_size = 64;
+
+		result = libfsrefs_directory_object_cache_append_idle_directory_object(
+		          io_handle->directory_object_cache,
+		          &( directory_objects[ directory_object_index ] ),
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsrefs_directory_object_cache_get_number_of_idle_directory_objects(
+	          io_handle->directory_object_cache,
+	          &number_of_idle_directory_objects,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_idle_directory_objects",
+	 number_of_idle_directory_objects,
+	 3 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Appending a directory object that is already idle fails
+	 */
+	result = libfsrefs_directory_object_cache_append_idle_directory_object(
+	          io_handle->directory_object_cache,
+	          &( directory_objects[ 0 ] ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Mark the second directory object as in use
+	 */
+	result = libfsrefs_directory_object_cache_remove_idle_directory_object(
+	          io_handle->directory_object_cache,
+	          &( directory_objects[ 1 ] ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the least recently used idle directory objects are evicted
+	 * until the memory budget is no longer exceeded and the directory object
+	 * in use is retained
+	 */
+	result = libfsrefs_directory_object_cache_evict(
+	          io_handle->directory_object_cache,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_objects[ 0 ]",
+	 directory_objects[ 0 ] );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_objects[ 1 ]",
+	 directory_objects[ 1 ] );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_objects[ 2 ]",
+	 directory_objects[ 2 ] );
+
+	result = libfsrefs_directory_object_cache_get_number_of_idle_directory_objects(
+	          io_handle->directory_object_cache,
+	          &number_of_idle_directory_objects,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_idle_directory_objects",
+	 number_of_idle_directory_objects,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an evicted directory object is not available
+	 */
+	result = libfsrefs_directory_object_cache_remove_idle_directory_object(
+	          io_handle->directory_object_cache,
+	          &( directory_objects[ 0 ] ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that nothing is evicted when the memory budget is not exceeded
+	 */
+	result = libfsrefs_directory_object_cache_append_idle_directory_object(
+	          io_handle->directory_object_cache,
+	          &( directory_objects[ 1 ] ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_directory_object_cache_evict(
+	          io_handle->directory_object_cache,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_objects[ 1 ]",
+	 directory_objects[ 1 ] );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_object_cache_evict(
+	          NULL,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_directory_object_cache_evict(
+	          io_handle->directory_object_cache,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_directory_object_cache_remove_idle_directory_object(
+	          io_handle->directory_object_cache,
+	          &( directory_objects[ 1 ] ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_directory_object_free(
+	          &( directory_objects[ 1 ] ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_objects_tree_free(
+	          &objects_tree,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( directory_object_index = 0;
+	     directory_object_index < 3;
+	     directory_object_index++ )
+	{
+		if( directory_objects[ directory_object_index ] != NULL )
+		{
+			if( io_handle != NULL )
+			{
+				libfsrefs_directory_object_cache_remove_idle_directory_object(
+				 io_handle->directory_object_cache,
+				 &( directory_objects[ directory_object_index ] ),
+				 NULL );
+			}
+			libfsrefs_directory_object_free(
+			 &( directory_objects[ directory_object_index ] ),
+			 NULL );
+		}
+	}
+	if( objects_tree != NULL )
+	{
+		libfsrefs_objects_tree_free(
+		 &objects_tree,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsrefs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_directory_object_cache_evict_process_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_directory_object_cache_evict_process_wide(
+     void )
+{
+	libfsrefs_directory_object_t *directory_objects[ 4 ] = { NULL, NULL, NULL, NULL };
+	libfsrefs_io_handle_t *io_handles[ 2 ]               = { NULL, NULL };
+
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_file_system_t *file_system                 = NULL;
+	libfsrefs_memory_budget_t *process_memory_budget     = NULL;
+	libfsrefs_objects_tree_t *objects_tree               = NULL;
+	int directory_object_index                           = 0;
+	int io_handle_index                                  = 0;
+	int number_of_evictions                              = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_set_process_maximum_size(
+	          150,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &process_memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The IO handles allocate from the process-wide memory budget
+	 */
+	for( io_handle_index = 0;
+	     io_handle_index < 2;
+	     io_handle_index++ )
+	{
+		result = libfsrefs_io_handle_initialize(
+		          &( io_handles[ io_handle_index ] ),
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsrefs_file_system_initialize(
+	          &file_system,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_objects_tree_initialize(
+	          &objects_tree,
+	          file_system,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Create 2 idle directory objects of 64 bytes each per IO handle,
+	 * which together exceed the process-wide memory budget
+	 */
+	for( directory_object_index = 0;
+	     directory_object_index < 4;
+	     directory_object_index++ )
+	{
+		io_handle_index = directory_object_index / 2;
+
+		result = libfsrefs_directory_object_initialize(
+		          &( directory_objects[ directory_object_index ] ),
+		          io_handles[ io_handle_index ],
+		          objects_tree,
+		          (uint64_t) 0x00000701UL + directory_object_index,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_memory_budget_allocate(
+		          io_handles[ io_handle_index ]->memory_budget,
+		          64,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		directory_objects[ directory_object_index ]->memory_size = 64;
+
+		result = libfsrefs_directory_object_cache_append_idle_directory_object(
+		          io_handles[ io_handle_index ]->directory_object_cache,
+		          &( directory_objects[ directory_object_index ] ),
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that the process-wide memory budget evicts the least recently used
+	 * idle directory object of each IO handle in turn, not only of the IO handle
+	 * that is evicting
+	 */
+	result = libfsrefs_directory_object_cache_evict(
+	          io_handles[ 1 ]->directory_object_cache,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_objects[ 0 ]",
+	 directory_objects[ 0 ] );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_objects[ 1 ]",
+	 directory_objects[ 1 ] );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory_objects[ 2 ]",
+	 directory_objects[ 2 ] );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_objects[ 3 ]",
+	 directory_objects[ 3 ] );
+
+	/* Test that nothing is evicted when the process-wide memory budget is not exceeded
+	 */
+	result = libfsrefs_directory_object_cache_evict_process_wide(
+	          process_memory_budget,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_directory_object_cache_evict_process_wide(
+	          NULL,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_directory_object_cache_evict_process_wide(
+	          process_memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 * The IO handles are freed before the remaining directory objects,
+	 * which hold a reference to the memory budget of their IO handle
+	 */
+	for( io_handle_index = 0;
+	     io_handle_index < 2;
+	     io_handle_index++ )
+	{
+		result = libfsrefs_directory_object_cache_remove_idle_directory_object(
+		          io_handles[ io_handle_index ]->directory_object_cache,
+		          &( directory_objects[ ( io_handle_index * 2 ) + 1 ] ),
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_io_handle_free(
+		          &( io_handles[ io_handle_index ] ),
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( directory_object_index = 1;
+	     directory_object_index < 4;
+	     directory_object_index += 2 )
+	{
+		result = libfsrefs_directory_object_free(
+		          &( directory_objects[ directory_object_index ] ),
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsrefs_objects_tree_free(
+	          &objects_tree,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_set_process_maximum_size(
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( directory_object_index = 0;
+	     directory_object_index < 4;
+	     directory_object_index++ )
+	{
+		if( directory_objects[ directory_object_index ] != NULL )
+		{
+			io_handle_index = directory_object_index / 2;
+
+			if( io_handles[ io_handle_index ] != NULL )
+			{
+				libfsrefs_directory_object_cache_remove_idle_directory_object(
+				 io_handles[ io_handle_index ]->directory_object_cache,
+				 &( directory_objects[ directory_object_index ] ),
+				 NULL );
+			}
+			libfsrefs_directory_object_free(
+			 &( directory_objects[ directory_object_index ] ),
+			 NULL );
+		}
+	}
+	if( objects_tree != NULL )
+	{
+		libfsrefs_objects_tree_free(
+		 &objects_tree,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsrefs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	for( io_handle_index = 0;
+	     io_handle_index < 2;
+	     io_handle_index++ )
+	{
+		if( io_handles[ io_handle_index ] != NULL )
+		{
+			libfsrefs_io_handle_free(
+			 &( io_handles[ io_handle_index ] ),
+			 NULL );
+		}
+	}
+	libfsrefs_memory_budget_set_process_maximum_size(
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_directory_object_cache_initialize",
+	 fsrefs_test_directory_object_cache_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_directory_object_cache_free",
+	 fsrefs_test_directory_object_cache_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_directory_object_cache_add_reference",
+	 fsrefs_test_directory_object_cache_add_reference );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_directory_object_cache_evict",
+	 fsrefs_test_directory_object_cache_evict );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_directory_object_cache_evict_process_wide",
+	 fsrefs_test_directory_object_cache_evict_process_wide );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
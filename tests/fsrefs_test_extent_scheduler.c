@@ -0,0 +1,1145 @@
+/*
+ * Library extent_scheduler type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_functions.h"
+#include "fsrefs_test_libbfio.h"
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_extent_scheduler.h"
+#include "../libfsrefs/libfsrefs_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Writes data into the test output buffer of a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_extent_scheduler_write_data(
+     int file_entry_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     intptr_t *user_data )
+{
+	uint8_t *output_data = (uint8_t *) user_data;
+
+	if( ( file_entry_index < 0 )
+	 || ( file_entry_index > 1 )
+	 || ( data_offset < 0 )
+	 || ( ( (size_t) data_offset + data_size ) > 128 ) )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( output_data[ ( file_entry_index * 128 ) + (size_t) data_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Fails to write data
+ * Returns -1
+ */
+int fsrefs_test_extent_scheduler_write_data_fail(
+     int file_entry_index FSREFS_TEST_ATTRIBUTE_UNUSED,
+     off64_t data_offset FSREFS_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data FSREFS_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size FSREFS_TEST_ATTRIBUTE_UNUSED,
+     intptr_t *user_data FSREFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( file_entry_index )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( data_offset )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( data )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( data_size )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( -1 );
+}
+
+/* Tests the libfsrefs_extent_scheduler_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_extent_scheduler_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_extent_scheduler_t *extent_scheduler = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_extent_scheduler_initialize(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_extent_scheduler_free(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_extent_scheduler_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_scheduler = (libfsrefs_extent_scheduler_t *) 0x12345678UL;
+
+	result = libfsrefs_extent_scheduler_initialize(
+	          &extent_scheduler,
+	          &error );
+
+	extent_scheduler = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_extent_scheduler_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_extent_scheduler_initialize(
+		          &extent_scheduler,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( extent_scheduler != NULL )
+			{
+				libfsrefs_extent_scheduler_free(
+				 &extent_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "extent_scheduler",
+			 extent_scheduler );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_extent_scheduler_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_extent_scheduler_initialize(
+		          &extent_scheduler,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( extent_scheduler != NULL )
+			{
+				libfsrefs_extent_scheduler_free(
+				 &extent_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "extent_scheduler",
+			 extent_scheduler );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_scheduler != NULL )
+	{
+		libfsrefs_extent_scheduler_free(
+		 &extent_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_extent_scheduler_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_extent_scheduler_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_extent_scheduler_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_extent_scheduler_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_extent_scheduler_append_extent(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_extent_scheduler_t *extent_scheduler = NULL;
+	int extent_index                               = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_extent_scheduler_initialize(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( extent_index = 0;
+	     extent_index < 100;
+	     extent_index++ )
+	{
+		result = libfsrefs_extent_scheduler_append_extent(
+		          extent_scheduler,
+		          (off64_t) extent_index * 4096,
+		          4096,
+		          0,
+		          extent_index,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_scheduler->number_of_extents",
+	 extent_scheduler->number_of_extents,
+	 100 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "extent_scheduler->extents[ 99 ].physical_offset",
+	 (int64_t) extent_scheduler->extents[ 99 ].physical_offset,
+	 (int64_t) 405504 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_extent_scheduler_append_extent(
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          -1,
+	          4096,
+	          0,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          0,
+	          4096,
+	          -1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          0,
+	          4096,
+	          0,
+	          -1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_extent_scheduler_free(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_scheduler != NULL )
+	{
+		libfsrefs_extent_scheduler_free(
+		 &extent_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_extent_scheduler_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_extent_scheduler_sort(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_extent_scheduler_t *extent_scheduler = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_extent_scheduler_initialize(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          8192,
+	          4096,
+	          0,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          0,
+	          4096,
+	          4096,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          0,
+	          4096,
+	          0,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_extent_scheduler_sort(
+	          extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "extent_scheduler->extents[ 0 ].physical_offset",
+	 (int64_t) extent_scheduler->extents[ 0 ].physical_offset,
+	 (int64_t) 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_scheduler->extents[ 0 ].file_entry_index",
+	 extent_scheduler->extents[ 0 ].file_entry_index,
+	 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "extent_scheduler->extents[ 1 ].physical_offset",
+	 (int64_t) extent_scheduler->extents[ 1 ].physical_offset,
+	 (int64_t) 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_scheduler->extents[ 1 ].file_entry_index",
+	 extent_scheduler->extents[ 1 ].file_entry_index,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "extent_scheduler->extents[ 2 ].physical_offset",
+	 (int64_t) extent_scheduler->extents[ 2 ].physical_offset,
+	 (int64_t) 8192 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_extent_scheduler_sort(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_extent_scheduler_free(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_scheduler != NULL )
+	{
+		libfsrefs_extent_scheduler_free(
+		 &extent_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_extent_scheduler_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_extent_scheduler_read(
+     void )
+{
+	uint8_t image_data[ 64 ];
+	uint8_t output_data[ 256 ];
+
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_extent_scheduler_t *extent_scheduler = NULL;
+	libfsrefs_io_handle_t *io_handle               = NULL;
+	size_t data_offset                             = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		image_data[ data_offset ] = (uint8_t) data_offset;
+	}
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_extent_scheduler_initialize(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* File entry 0 consists of the physical ranges 16 - 24 and 20 - 28,
+	 * file entry 1 of the physical ranges 48 - 56 and 0 - 16
+	 */
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          16,
+	          8,
+	          0,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          20,
+	          8,
+	          8,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          48,
+	          8,
+	          0,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsrefs_extent_scheduler_append_extent(
+	          extent_scheduler,
+	          0,
+	          16,
+	          8,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_extent_scheduler_sort(
+	          extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 output_data,
+	 0xff,
+	 256 );
+
+	result = libfsrefs_extent_scheduler_read(
+	          extent_scheduler,
+	          io_handle,
+	          file_io_handle,
+	          &fsrefs_test_extent_scheduler_write_data,
+	          (intptr_t *) output_data,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( image_data[ 16 ] ),
+	          8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( output_data[ 8 ] ),
+	          &( image_data[ 20 ] ),
+	          8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( output_data[ 128 ] ),
+	          &( image_data[ 48 ] ),
+	          8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( output_data[ 136 ] ),
+	          image_data,
+	          16 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "output_data[ 16 ]",
+	 output_data[ 16 ],
+	 (uint8_t) 0xff );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_extent_scheduler_read(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          &fsrefs_test_extent_scheduler_write_data,
+	          (intptr_t *) output_data,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_read(
+	          extent_scheduler,
+	          NULL,
+	          file_io_handle,
+	          &fsrefs_test_extent_scheduler_write_data,
+	          (intptr_t *) output_data,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_read(
+	          extent_scheduler,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          (intptr_t *) output_data,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_extent_scheduler_read(
+	          extent_scheduler,
+	          io_handle,
+	          file_io_handle,
+	          &fsrefs_test_extent_scheduler_write_data_fail,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with abort signalled
+	 */
+	io_handle->abort = 1;
+
+	result = libfsrefs_extent_scheduler_read(
+	          extent_scheduler,
+	          io_handle,
+	          file_io_handle,
+	          &fsrefs_test_extent_scheduler_write_data,
+	          (intptr_t *) output_data,
+	          &error );
+
+	io_handle->abort = 0;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_extent_scheduler_free(
+	          &extent_scheduler,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "extent_scheduler",
+	 extent_scheduler );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_scheduler != NULL )
+	{
+		libfsrefs_extent_scheduler_free(
+		 &extent_scheduler,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_extent_scheduler_initialize",
+	 fsrefs_test_extent_scheduler_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_extent_scheduler_free",
+	 fsrefs_test_extent_scheduler_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_extent_scheduler_append_extent",
+	 fsrefs_test_extent_scheduler_append_extent );
+
+	/* TODO add tests for libfsrefs_extent_scheduler_append_data_block_stream */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_extent_scheduler_sort",
+	 fsrefs_test_extent_scheduler_sort );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_extent_scheduler_read",
+	 fsrefs_test_extent_scheduler_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
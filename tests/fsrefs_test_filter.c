@@ -0,0 +1,1163 @@
+/*
+ * Library filter type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_filter.h"
+#include "../libfsrefs/libfsrefs_node_record.h"
+
+/* Directory record key of directory: Documents
+ */
+uint8_t fsrefs_test_filter_directory_key_data[ 22 ] = {
+	0x30, 0x00, 0x02, 0x00, 0x44, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x65, 0x00,
+	0x6e, 0x00, 0x74, 0x00, 0x73, 0x00 };
+
+/* Directory record values with creation time: 0x01d0000000000000
+ * and modification time: 0x01d1000000000000
+ */
+uint8_t fsrefs_test_filter_directory_value_data[ 72 ] = {
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfsrefs_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_filter_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsrefs_filter_t *filter      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_filter_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter = (libfsrefs_filter_t *) 0x12345678UL;
+
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	filter = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_filter_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libfsrefs_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_filter_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libfsrefs_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_filter_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_filter_set_utf8_name_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_filter_set_utf8_name_pattern(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfsrefs_filter_t *filter = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          (uint8_t *) "*.txt",
+	          5,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          (uint8_t *) "",
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          NULL,
+	          (uint8_t *) "*.txt",
+	          5,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          NULL,
+	          5,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_filter_set_creation_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_filter_set_creation_time_range(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfsrefs_filter_t *filter = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_filter_set_creation_time_range(
+	          filter,
+	          0x01d0000000000000ULL,
+	          0x01d1000000000000ULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_filter_set_creation_time_range(
+	          NULL,
+	          0x01d0000000000000ULL,
+	          0x01d1000000000000ULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_filter_set_creation_time_range(
+	          filter,
+	          0x01d1000000000000ULL,
+	          0x01d0000000000000ULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_filter_set_file_attribute_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_filter_set_file_attribute_flags(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfsrefs_filter_t *filter = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_filter_set_file_attribute_flags(
+	          filter,
+	          LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_filter_set_file_attribute_flags(
+	          NULL,
+	          LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_filter_set_file_attribute_flags(
+	          filter,
+	          LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+	          LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_internal_filter_match_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_internal_filter_match_name(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfsrefs_filter_t *filter = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_internal_filter_match_name(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &( fsrefs_test_filter_directory_key_data[ 4 ] ),
+	          18,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          (uint8_t *) "doc*",
+	          4,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_internal_filter_match_name(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &( fsrefs_test_filter_directory_key_data[ 4 ] ),
+	          18,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          (uint8_t *) "*m?nts",
+	          6,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_internal_filter_match_name(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &( fsrefs_test_filter_directory_key_data[ 4 ] ),
+	          18,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          (uint8_t *) "*.txt",
+	          5,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_internal_filter_match_name(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &( fsrefs_test_filter_directory_key_data[ 4 ] ),
+	          18,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_internal_filter_match_name(
+	          NULL,
+	          &( fsrefs_test_filter_directory_key_data[ 4 ] ),
+	          18,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_internal_filter_match_name(
+	          (libfsrefs_internal_filter_t *) filter,
+	          NULL,
+	          18,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_internal_filter_match_node_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_internal_filter_match_node_record(
+     void )
+{
+	libfsrefs_node_record_t node_record;
+
+	libcerror_error_t *error   = NULL;
+	libfsrefs_filter_t *filter = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	node_record.size            = 0;
+	node_record.flags           = 0;
+	node_record.key_data        = fsrefs_test_filter_directory_key_data;
+	node_record.key_data_size   = 22;
+	node_record.value_data      = fsrefs_test_filter_directory_value_data;
+	node_record.value_data_size = 72;
+
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_filter_set_creation_time_range(
+	          filter,
+	          0x01cf000000000000ULL,
+	          0x01d0000000000000ULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_file_attribute_flags(
+	          filter,
+	          LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_internal_filter_match_node_record(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_modification_time_range(
+	          filter,
+	          0x01d2000000000000ULL,
+	          0x01d3000000000000ULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_internal_filter_match_node_record(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_modification_time_range(
+	          filter,
+	          0,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_file_attribute_flags(
+	          filter,
+	          0,
+	          LIBFSREFS_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_internal_filter_match_node_record(
+	          (libfsrefs_internal_filter_t *) filter,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_internal_filter_match_node_record(
+	          NULL,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_internal_filter_match_node_record(
+	          (libfsrefs_internal_filter_t *) filter,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_filter_initialize",
+	 fsrefs_test_filter_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_filter_free",
+	 fsrefs_test_filter_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_filter_set_utf8_name_pattern",
+	 fsrefs_test_filter_set_utf8_name_pattern );
+
+	/* TODO add tests for libfsrefs_filter_set_utf16_name_pattern */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_filter_set_creation_time_range",
+	 fsrefs_test_filter_set_creation_time_range );
+
+	/* TODO add tests for libfsrefs_filter_set_modification_time_range */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_filter_set_file_attribute_flags",
+	 fsrefs_test_filter_set_file_attribute_flags );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_internal_filter_match_name",
+	 fsrefs_test_internal_filter_match_name );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_internal_filter_match_node_record",
+	 fsrefs_test_internal_filter_match_node_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,520 @@
+/*
+ * Generates a synthetic ReFS image for testing and benchmarking
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_functions.h"
+#include "fsrefs_test_getopt.h"
+#include "fsrefs_test_image_generator.h"
+#include "fsrefs_test_libcerror.h"
+
+/* Prints usage information
+ */
+void fsrefs_test_generate_image_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsrefs_test_generate_image to generate a synthetic ReFS image.\n\n" );
+
+	fprintf( stream, "Usage: fsrefs_test_generate_image [ -b blocks_per_run ] [ -c cluster_size ]\n"
+	                 "                                  [ -d depth ] [ -f format_version ]\n"
+	                 "                                  [ -m records_per_node ] [ -n files ]\n"
+	                 "                                  [ -r runs ] [ -s sub_directories ] [ -h ]\n"
+	                 "                                  target\n\n" );
+
+	fprintf( stream, "\ttarget: the image file to write\n\n" );
+	fprintf( stream, "\t-b:     number of blocks per data run, default is 1\n" );
+	fprintf( stream, "\t-c:     cluster block size: 4096 or 65536, default is 65536\n" );
+	fprintf( stream, "\t-d:     number of directory levels below the root directory,\n"
+	                 "\t        default is 1\n" );
+	fprintf( stream, "\t-f:     major format version: 1 or 3, default is 3\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     maximum number of records per ministore node, 0 represents\n"
+	                 "\t        as many as fit in a metadata block, default is 0\n" );
+	fprintf( stream, "\t-n:     number of files per directory, default is 16\n" );
+	fprintf( stream, "\t-r:     number of data runs per file, 0 represents resident data,\n"
+	                 "\t        default is 1\n" );
+	fprintf( stream, "\t-s:     number of sub directories per directory, default is 4\n" );
+}
+
+/* Copies an option argument to an int
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_generate_image_copy_option_to_int(
+     const system_character_t *option_argument,
+     int *value,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_generate_image_copy_option_to_int";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( option_argument == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid option argument.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 option_argument );
+
+	if( fsrefs_test_system_string_copy_from_64_bit_in_decimal(
+	     option_argument,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy option argument to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid option argument value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*value = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	char narrow_target[ 1024 ];
+
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libcerror_error_t *error                       = NULL;
+	system_character_t *option_blocks_per_run      = NULL;
+	system_character_t *option_cluster_size        = NULL;
+	system_character_t *option_depth               = NULL;
+	system_character_t *option_format_version      = NULL;
+	system_character_t *option_files               = NULL;
+	system_character_t *option_records_per_node    = NULL;
+	system_character_t *option_runs                = NULL;
+	system_character_t *option_sub_directories     = NULL;
+	system_character_t *target                     = NULL;
+	FILE *stream                                   = NULL;
+	size64_t file_data_size                        = 0;
+	system_integer_t option                        = 0;
+	uint64_t number_of_directories                 = 0;
+	uint64_t number_of_files                       = 0;
+	int cluster_block_size                         = 65536;
+	int format_version                             = 3;
+
+	while( ( option = fsrefs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:c:d:f:hm:n:r:s:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				fsrefs_test_generate_image_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_blocks_per_run = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				option_cluster_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_depth = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_format_version = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				fsrefs_test_generate_image_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				option_records_per_node = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_files = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_runs = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_sub_directories = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		fsrefs_test_generate_image_usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	target = argv[ optind ];
+
+	if( option_cluster_size != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_cluster_size,
+		     &cluster_block_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported cluster size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_format_version != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_format_version,
+		     &format_version,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported format version.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( format_version < 0 )
+	 || ( format_version > 255 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported format version.\n" );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_initialize(
+	     &image_generator,
+	     (uint8_t) format_version,
+	     (uint32_t) cluster_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize image generator.\n" );
+
+		goto on_error;
+	}
+	if( option_blocks_per_run != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_blocks_per_run,
+		     &( image_generator->data_run_size ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of blocks per data run.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_depth != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_depth,
+		     &( image_generator->directory_depth ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported directory depth.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_records_per_node != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_records_per_node,
+		     &( image_generator->maximum_number_of_node_records ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of records per node.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_files != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_files,
+		     &( image_generator->number_of_files ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of files.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_runs != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_runs,
+		     &( image_generator->number_of_data_runs ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of data runs.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_sub_directories != NULL )
+	{
+		if( fsrefs_test_generate_image_copy_option_to_int(
+		     option_sub_directories,
+		     &( image_generator->number_of_sub_directories ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of sub directories.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fsrefs_test_image_generator_get_number_of_directories(
+	     image_generator,
+	     &number_of_directories,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve number of directories.\n" );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_get_number_of_files(
+	     image_generator,
+	     &number_of_files,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve number of files.\n" );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_get_file_data_size(
+	     image_generator,
+	     &file_data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve file data size.\n" );
+
+		goto on_error;
+	}
+	if( fsrefs_test_get_narrow_source(
+	     target,
+	     narrow_target,
+	     1024,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve narrow target.\n" );
+
+		goto on_error;
+	}
+	stream = file_stream_open(
+	          narrow_target,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %s.\n",
+		 narrow_target );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_write(
+	     image_generator,
+	     stream,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write image.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	stream = NULL;
+
+	fprintf(
+	 stdout,
+	 "format_version=%d.%" PRIu8 "\n"
+	 "cluster_block_size=%" PRIu32 "\n"
+	 "metadata_block_size=%" PRIu32 "\n"
+	 "number_of_directories=%" PRIu64 "\n"
+	 "number_of_files=%" PRIu64 "\n"
+	 "file_data_size=%" PRIu64 "\n"
+	 "number_of_metadata_blocks=%" PRIu64 "\n"
+	 "maximum_number_of_tree_levels=%d\n"
+	 "image_size=%" PRIu64 "\n",
+	 format_version,
+	 image_generator->minor_format_version,
+	 image_generator->cluster_block_size,
+	 image_generator->metadata_block_size,
+	 number_of_directories,
+	 number_of_files,
+	 file_data_size,
+	 image_generator->number_of_metadata_blocks,
+	 image_generator->maximum_number_of_tree_levels,
+	 image_generator->next_block_number * image_generator->metadata_block_size );
+
+	if( fsrefs_test_image_generator_free(
+	     &image_generator,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free image generator.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
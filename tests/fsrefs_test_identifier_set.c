@@ -0,0 +1,787 @@
+/*
+ * Library identifier_set type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_identifier_set.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_identifier_set_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_identifier_set_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsrefs_identifier_set_t *identifier_set = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_identifier_set_initialize(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_identifier_set_free(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_identifier_set_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	identifier_set = (libfsrefs_identifier_set_t *) 0x12345678UL;
+
+	result = libfsrefs_identifier_set_initialize(
+	          &identifier_set,
+	          &error );
+
+	identifier_set = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_identifier_set_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_identifier_set_initialize(
+		          &identifier_set,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( identifier_set != NULL )
+			{
+				libfsrefs_identifier_set_free(
+				 &identifier_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "identifier_set",
+			 identifier_set );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_identifier_set_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_identifier_set_initialize(
+		          &identifier_set,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( identifier_set != NULL )
+			{
+				libfsrefs_identifier_set_free(
+				 &identifier_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "identifier_set",
+			 identifier_set );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_set != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &identifier_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_identifier_set_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_identifier_set_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_identifier_set_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_identifier_set_insert function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_identifier_set_insert(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsrefs_identifier_set_t *identifier_set = NULL;
+	uint64_t identifier                        = 0;
+	int number_of_identifiers                  = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_identifier_set_initialize(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Insert enough identifiers to resize the slots multiple times
+	 */
+	for( identifier = 0;
+	     identifier < 1024;
+	     identifier++ )
+	{
+		result = libfsrefs_identifier_set_insert(
+		          identifier_set,
+		          identifier,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( identifier = 0;
+	     identifier < 1024;
+	     identifier++ )
+	{
+		result = libfsrefs_identifier_set_insert(
+		          identifier_set,
+		          identifier,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Identifiers that do not fit in a signed 64-bit offset
+	 */
+	result = libfsrefs_identifier_set_insert(
+	          identifier_set,
+	          (uint64_t) INT64_MAX,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_identifier_set_insert(
+	          identifier_set,
+	          UINT64_MAX,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_identifier_set_insert(
+	          identifier_set,
+	          UINT64_MAX,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_identifier_set_get_number_of_identifiers(
+	          identifier_set,
+	          &number_of_identifiers,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_identifiers",
+	 number_of_identifiers,
+	 1024 + 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_identifier_set_insert(
+	          NULL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_identifier_set_free(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_set != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &identifier_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_identifier_set_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_identifier_set_resize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsrefs_identifier_set_t *identifier_set = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_identifier_set_initialize(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_identifier_set_resize(
+	          identifier_set,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "identifier_set->number_of_slots",
+	 identifier_set->number_of_slots,
+	 256 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_identifier_set_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_identifier_set_resize(
+	          identifier_set,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	/* Test libfsrefs_identifier_set_resize with malloc failing
+	 */
+	fsrefs_test_malloc_attempts_before_fail = 0;
+
+	result = libfsrefs_identifier_set_resize(
+	          identifier_set,
+	          9,
+	          &error );
+
+	if( fsrefs_test_malloc_attempts_before_fail != -1 )
+	{
+		fsrefs_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSREFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfsrefs_identifier_set_free(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_set != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &identifier_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_identifier_set_get_number_of_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_identifier_set_get_number_of_identifiers(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsrefs_identifier_set_t *identifier_set = NULL;
+	int number_of_identifiers                  = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_identifier_set_initialize(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_identifier_set_get_number_of_identifiers(
+	          identifier_set,
+	          &number_of_identifiers,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_identifiers",
+	 number_of_identifiers,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_identifier_set_get_number_of_identifiers(
+	          NULL,
+	          &number_of_identifiers,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_identifier_set_get_number_of_identifiers(
+	          identifier_set,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_identifier_set_free(
+	          &identifier_set,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "identifier_set",
+	 identifier_set );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_set != NULL )
+	{
+		libfsrefs_identifier_set_free(
+		 &identifier_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_identifier_set_initialize",
+	 fsrefs_test_identifier_set_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_identifier_set_free",
+	 fsrefs_test_identifier_set_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_identifier_set_resize",
+	 fsrefs_test_identifier_set_resize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_identifier_set_insert",
+	 fsrefs_test_identifier_set_insert );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_identifier_set_get_number_of_identifiers",
+	 fsrefs_test_identifier_set_get_number_of_identifiers );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
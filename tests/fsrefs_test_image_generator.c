@@ -0,0 +1,4190 @@
+/*
+ * Synthetic ReFS image generator for testing
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "fsrefs_test_image_generator.h"
+#include "fsrefs_test_libcerror.h"
+
+/* The size of the node record header, the key data is stored 8-byte aligned after it
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_NODE_RECORD_HEADER_SIZE	16
+
+/* The size of the node header
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE		32
+
+/* The size of the tree header, including the preceding node header offset
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE		40
+
+/* The size of the file values, which is stored as header data of the embedded node
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_FILE_VALUES_SIZE		128
+
+/* The size of the directory values
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_DIRECTORY_VALUES_SIZE	72
+
+/* The size of the non-resident attribute values, which is stored as header data of the embedded node
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_NON_RESIDENT_VALUES_SIZE	96
+
+/* The size of the resident attribute values, the inline data is stored directly after it
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_RESIDENT_VALUES_SIZE	60
+
+/* The size of a data run record value
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_DATA_RUN_SIZE		32
+
+/* The size of an objects tree record value
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_OBJECT_VALUE_SIZE		48
+
+/* The maximum size of a node record value, since the value size is stored in 16-bit
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_VALUE_DATA_SIZE	0xfff0
+
+#define fsrefs_test_image_generator_align8( value ) \
+	( ( ( value ) + 7 ) & ~( (size_t) 7 ) )
+
+uint32_t fsrefs_test_image_generator_crc32c_table[ 256 ];
+
+int fsrefs_test_image_generator_crc32c_table_computed = 0;
+
+/* Creates an image generator
+ * Make sure the value image_generator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_initialize(
+     fsrefs_test_image_generator_t **image_generator,
+     uint8_t major_format_version,
+     uint32_t cluster_block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_initialize";
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_generator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image generator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( major_format_version != 1 )
+	 && ( major_format_version != 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported major format version: %" PRIu8 ".",
+		 function,
+		 major_format_version );
+
+		return( -1 );
+	}
+	if( ( cluster_block_size != 4096 )
+	 && ( cluster_block_size != 65536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cluster block size: %" PRIu32 ".",
+		 function,
+		 cluster_block_size );
+
+		return( -1 );
+	}
+	*image_generator = memory_allocate_structure(
+	                    fsrefs_test_image_generator_t );
+
+	if( *image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *image_generator,
+	     0,
+	     sizeof( fsrefs_test_image_generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image generator.",
+		 function );
+
+		memory_free(
+		 *image_generator );
+
+		*image_generator = NULL;
+
+		return( -1 );
+	}
+	( *image_generator )->major_format_version = major_format_version;
+	( *image_generator )->bytes_per_sector     = 512;
+	( *image_generator )->cluster_block_size   = cluster_block_size;
+
+	if( major_format_version == 1 )
+	{
+		( *image_generator )->minor_format_version       = 2;
+		( *image_generator )->metadata_block_size        = 16384;
+		( *image_generator )->metadata_block_header_size = 48;
+		( *image_generator )->block_reference_size       = 24;
+	}
+	else
+	{
+		( *image_generator )->minor_format_version       = 4;
+		( *image_generator )->metadata_block_size        = cluster_block_size;
+		( *image_generator )->metadata_block_header_size = 80;
+		( *image_generator )->block_reference_size       = 48;
+	}
+	( *image_generator )->directory_depth           = 1;
+	( *image_generator )->number_of_sub_directories = 4;
+	( *image_generator )->number_of_files           = 16;
+	( *image_generator )->number_of_data_runs       = 1;
+	( *image_generator )->data_run_size             = 1;
+	( *image_generator )->maximum_value_data_size   = FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_VALUE_DATA_SIZE;
+
+	( *image_generator )->block_data = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * ( *image_generator )->metadata_block_size );
+
+	if( ( *image_generator )->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	( *image_generator )->data_block_data = (uint8_t *) memory_allocate(
+	                                                     sizeof( uint8_t ) * ( *image_generator )->metadata_block_size );
+
+	if( ( *image_generator )->data_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block data.",
+		 function );
+
+		goto on_error;
+	}
+	( *image_generator )->value_data = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * ( *image_generator )->maximum_value_data_size );
+
+	if( ( *image_generator )->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
+		 function );
+
+		goto on_error;
+	}
+	( *image_generator )->attribute_value_data = (uint8_t *) memory_allocate(
+	                                                          sizeof( uint8_t ) * ( *image_generator )->maximum_value_data_size );
+
+	if( ( *image_generator )->attribute_value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create attribute value data.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_node_initialize(
+	     &( ( *image_generator )->file_values_node ),
+	     ( *image_generator )->maximum_value_data_size - ( FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE + FSREFS_TEST_IMAGE_GENERATOR_FILE_VALUES_SIZE + FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file values node.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_node_initialize(
+	     &( ( *image_generator )->data_runs_node ),
+	     ( *image_generator )->maximum_value_data_size - ( FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE + FSREFS_TEST_IMAGE_GENERATOR_NON_RESIDENT_VALUES_SIZE + FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data runs node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 image_generator,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an image generator
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_free(
+     fsrefs_test_image_generator_t **image_generator,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_free";
+	int result            = 1;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_generator != NULL )
+	{
+		if( ( *image_generator )->data_runs_node != NULL )
+		{
+			if( fsrefs_test_image_node_free(
+			     &( ( *image_generator )->data_runs_node ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data runs node.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *image_generator )->file_values_node != NULL )
+		{
+			if( fsrefs_test_image_node_free(
+			     &( ( *image_generator )->file_values_node ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file values node.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *image_generator )->attribute_value_data != NULL )
+		{
+			memory_free(
+			 ( *image_generator )->attribute_value_data );
+		}
+		if( ( *image_generator )->value_data != NULL )
+		{
+			memory_free(
+			 ( *image_generator )->value_data );
+		}
+		if( ( *image_generator )->data_block_data != NULL )
+		{
+			memory_free(
+			 ( *image_generator )->data_block_data );
+		}
+		if( ( *image_generator )->block_data != NULL )
+		{
+			memory_free(
+			 ( *image_generator )->block_data );
+		}
+		memory_free(
+		 *image_generator );
+
+		*image_generator = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of directories, including the root directory
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_get_number_of_directories(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t *number_of_directories,
+     libcerror_error_t **error )
+{
+	static char *function            = "fsrefs_test_image_generator_get_number_of_directories";
+	uint64_t number_of_level_entries = 1;
+	uint64_t safe_number_of_entries  = 1;
+	int directory_level              = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_generator->directory_depth < 0 )
+	 || ( image_generator->number_of_sub_directories < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image generator - directory depth or number of sub directories value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	for( directory_level = 0;
+	     directory_level < image_generator->directory_depth;
+	     directory_level++ )
+	{
+		if( number_of_level_entries > ( (uint64_t) UINT32_MAX / (uint64_t) image_generator->number_of_sub_directories ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: number of directories value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_level_entries *= (uint64_t) image_generator->number_of_sub_directories;
+		safe_number_of_entries  += number_of_level_entries;
+
+		if( number_of_level_entries == 0 )
+		{
+			break;
+		}
+	}
+	*number_of_directories = safe_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_get_number_of_files(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t *number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function          = "fsrefs_test_image_generator_get_number_of_files";
+	uint64_t number_of_directories = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->number_of_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image generator - number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_generator_get_number_of_directories(
+	     image_generator,
+	     &number_of_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = number_of_directories * (uint64_t) image_generator->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the data size of a generated file
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_get_file_data_size(
+     fsrefs_test_image_generator_t *image_generator,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_get_file_data_size";
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_generator->number_of_data_runs < 0 )
+	 || ( image_generator->data_run_size < 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image generator - number of data runs or data run size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Files with resident data contain their name "file%08d"
+	 */
+	if( image_generator->number_of_data_runs == 0 )
+	{
+		*data_size = 12;
+	}
+	else
+	{
+		*data_size = (size64_t) image_generator->number_of_data_runs
+		           * (size64_t) image_generator->data_run_size
+		           * image_generator->metadata_block_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the byte value that fills a data block of a generated file
+ * Returns the byte value
+ */
+uint8_t fsrefs_test_image_generator_get_data_block_value(
+         uint64_t logical_block_number )
+{
+	return( (uint8_t) ( 'A' + ( logical_block_number % 26 ) ) );
+}
+
+/* Calculates a CRC-32C (Castagnoli) of the data
+ * Returns the checksum
+ */
+uint32_t fsrefs_test_image_generator_calculate_crc32c(
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t checksum  = 0xffffffffUL;
+	uint32_t value     = 0;
+	uint16_t table_index = 0;
+	uint8_t bit_iterator = 0;
+
+	if( fsrefs_test_image_generator_crc32c_table_computed == 0 )
+	{
+		for( table_index = 0;
+		     table_index < 256;
+		     table_index++ )
+		{
+			value = (uint32_t) table_index;
+
+			for( bit_iterator = 0;
+			     bit_iterator < 8;
+			     bit_iterator++ )
+			{
+				if( ( value & 1 ) != 0 )
+				{
+					value = 0x82f63b78UL ^ ( value >> 1 );
+				}
+				else
+				{
+					value >>= 1;
+				}
+			}
+			fsrefs_test_image_generator_crc32c_table[ table_index ] = value;
+		}
+		fsrefs_test_image_generator_crc32c_table_computed = 1;
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		checksum = fsrefs_test_image_generator_crc32c_table[ ( checksum ^ data[ data_offset ] ) & 0xff ]
+		         ^ ( checksum >> 8 );
+	}
+	return( checksum ^ 0xffffffffUL );
+}
+
+/* Writes the image
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write(
+     fsrefs_test_image_generator_t *image_generator,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	uint8_t ministore_tree_references_data[ FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES * 48 ];
+	uint8_t object_value_data[ FSREFS_TEST_IMAGE_GENERATOR_OBJECT_VALUE_SIZE ];
+	uint8_t object_key_data[ 16 ];
+
+	fsrefs_test_image_tree_t *objects_tree = NULL;
+	uint8_t *directory_references_data     = NULL;
+	static char *function                  = "fsrefs_test_image_generator_write";
+	size_t directory_references_data_size  = 0;
+	uint64_t directory_index               = 0;
+	uint64_t number_of_directories         = 0;
+	uint64_t object_identifier             = 0;
+	int tree_index                         = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_generator->number_of_files < 0 )
+	 || ( image_generator->number_of_data_runs < 0 )
+	 || ( image_generator->data_run_size < 1 )
+	 || ( image_generator->maximum_number_of_node_records < 0 )
+	 || ( image_generator->maximum_number_of_node_records == 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image generator - settings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_generator_get_number_of_directories(
+	     image_generator,
+	     &number_of_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of directories.",
+		 function );
+
+		goto on_error;
+	}
+	image_generator->stream                        = stream;
+	image_generator->next_block_number             = FSREFS_TEST_IMAGE_GENERATOR_SECONDARY_CHECKPOINT_BLOCK_NUMBER + 1;
+	image_generator->number_of_metadata_blocks     = 0;
+	image_generator->maximum_number_of_tree_levels = 0;
+	image_generator->entry_counter                 = 0;
+
+	directory_references_data_size = (size_t) number_of_directories * image_generator->block_reference_size;
+
+	directory_references_data = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * directory_references_data_size );
+
+	if( directory_references_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory references data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The ministore trees other than the objects tree all reference the same empty root node
+	 */
+	if( fsrefs_test_image_tree_initialize(
+	     &objects_tree,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create empty tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_finalize(
+	     objects_tree,
+	     image_generator,
+	     &( ministore_tree_references_data[ image_generator->block_reference_size ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write empty tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_free(
+	     &objects_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free empty tree.",
+		 function );
+
+		goto on_error;
+	}
+	for( tree_index = 2;
+	     tree_index < FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES;
+	     tree_index++ )
+	{
+		if( memory_copy(
+		     &( ministore_tree_references_data[ tree_index * image_generator->block_reference_size ] ),
+		     &( ministore_tree_references_data[ image_generator->block_reference_size ] ),
+		     image_generator->block_reference_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy ministore tree: %d reference.",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+	}
+	if( memory_set(
+	     object_value_data,
+	     0,
+	     FSREFS_TEST_IMAGE_GENERATOR_OBJECT_VALUE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object value data.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_write_volume_information(
+	     image_generator,
+	     object_value_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write volume information.",
+		 function );
+
+		goto on_error;
+	}
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		if( fsrefs_test_image_generator_write_directory(
+		     image_generator,
+		     directory_index,
+		     number_of_directories,
+		     &( directory_references_data[ directory_index * image_generator->block_reference_size ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write directory: %" PRIu64 ".",
+			 function,
+			 directory_index );
+
+			goto on_error;
+		}
+	}
+	/* The objects tree must consist of a single leaf node
+	 */
+	if( fsrefs_test_image_tree_initialize(
+	     &objects_tree,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create objects tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     object_key_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object key data.",
+		 function );
+
+		goto on_error;
+	}
+	for( directory_index = 0;
+	     directory_index <= number_of_directories;
+	     directory_index++ )
+	{
+		if( directory_index == 0 )
+		{
+			object_identifier = 0x00000500UL;
+		}
+		else
+		{
+			if( directory_index == 1 )
+			{
+				object_identifier = 0x00000600UL;
+			}
+			else
+			{
+				object_identifier = 0x00000700UL + directory_index - 1;
+			}
+			if( memory_copy(
+			     object_value_data,
+			     &( directory_references_data[ ( directory_index - 1 ) * image_generator->block_reference_size ] ),
+			     image_generator->block_reference_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy directory: %" PRIu64 " reference.",
+				 function,
+				 directory_index - 1 );
+
+				goto on_error;
+			}
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( object_key_data[ 8 ] ),
+		 object_identifier );
+
+		if( fsrefs_test_image_tree_append_record(
+		     objects_tree,
+		     image_generator,
+		     0,
+		     object_key_data,
+		     16,
+		     0,
+		     object_value_data,
+		     FSREFS_TEST_IMAGE_GENERATOR_OBJECT_VALUE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append object: 0x%08" PRIx64 " record.",
+			 function,
+			 object_identifier );
+
+			goto on_error;
+		}
+		if( objects_tree->number_of_written_nodes[ 0 ] != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: number of directories: %" PRIu64 " exceeds the capacity of the objects tree root node.",
+			 function,
+			 number_of_directories );
+
+			goto on_error;
+		}
+	}
+	if( fsrefs_test_image_tree_finalize(
+	     objects_tree,
+	     image_generator,
+	     ministore_tree_references_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write objects tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_free(
+	     &objects_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free objects tree.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 directory_references_data );
+
+	directory_references_data = NULL;
+
+	/* The primary checkpoint has the highest sequence number
+	 */
+	if( fsrefs_test_image_generator_write_checkpoint(
+	     image_generator,
+	     FSREFS_TEST_IMAGE_GENERATOR_PRIMARY_CHECKPOINT_BLOCK_NUMBER,
+	     2,
+	     ministore_tree_references_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write primary checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_write_checkpoint(
+	     image_generator,
+	     FSREFS_TEST_IMAGE_GENERATOR_SECONDARY_CHECKPOINT_BLOCK_NUMBER,
+	     1,
+	     ministore_tree_references_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write secondary checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_write_superblock(
+	     image_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write superblock.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_write_volume_header(
+	     image_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write volume header.",
+		 function );
+
+		goto on_error;
+	}
+	if( fflush(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush stream.",
+		 function );
+
+		goto on_error;
+	}
+	image_generator->stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( objects_tree != NULL )
+	{
+		fsrefs_test_image_tree_free(
+		 &objects_tree,
+		 NULL );
+	}
+	if( directory_references_data != NULL )
+	{
+		memory_free(
+		 directory_references_data );
+	}
+	image_generator->stream = NULL;
+
+	return( -1 );
+}
+
+/* Writes the image to memory
+ * The image data is allocated and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_to_memory(
+     fsrefs_test_image_generator_t *image_generator,
+     uint8_t **image_data,
+     size_t *image_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_write_to_memory";
+	FILE *stream          = NULL;
+	size64_t image_size   = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image data.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image data size.",
+		 function );
+
+		return( -1 );
+	}
+	stream = tmpfile();
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_write(
+	     image_generator,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image.",
+		 function );
+
+		goto on_error;
+	}
+	image_size = image_generator->next_block_number * image_generator->metadata_block_size;
+
+	if( ( image_size == 0 )
+	 || ( image_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*image_data_size = (size_t) image_size;
+
+	*image_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * *image_data_size );
+
+	if( *image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of image.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_read(
+	     stream,
+	     *image_data,
+	     *image_data_size ) != *image_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image.",
+		 function );
+
+		goto on_error;
+	}
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( *image_data != NULL )
+	{
+		memory_free(
+		 *image_data );
+
+		*image_data = NULL;
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Writes data at the offset of a block
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_at_block(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_write_at_block";
+	off64_t block_offset  = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number > ( (uint64_t) INT64_MAX / image_generator->metadata_block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) image_generator->metadata_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_offset = (off64_t) ( block_number * image_generator->metadata_block_size );
+
+	if( file_stream_seek_offset(
+	     image_generator->stream,
+	     block_offset,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek block: %" PRIu64 " offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_number,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     image_generator->stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block: %" PRIu64 " data.",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the metadata block header into the block data and writes the metadata block
+ * If the self reference offset is not 0 a reference to the block itself is stored
+ * at this offset, before the block is written
+ * If block reference data is not NULL a reference to the written block is stored in it
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_metadata_block(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     const char *signature,
+     uint64_t object_identifier,
+     size_t self_reference_offset,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_write_metadata_block";
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( self_reference_offset != 0 )
+	 && ( ( self_reference_offset < image_generator->metadata_block_header_size )
+	  ||  ( self_reference_offset > ( image_generator->metadata_block_size - image_generator->block_reference_size ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid self reference offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     image_generator->block_data,
+	     0,
+	     image_generator->metadata_block_header_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata block header.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->major_format_version == 1 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( image_generator->block_data[ 0 ] ),
+		 block_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( image_generator->block_data[ 8 ] ),
+		 (uint64_t) 1 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( image_generator->block_data[ 24 ] ),
+		 object_identifier );
+	}
+	else
+	{
+		if( memory_copy(
+		     image_generator->block_data,
+		     signature,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( image_generator->block_data[ 4 ] ),
+		 2 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( image_generator->block_data[ 32 ] ),
+		 block_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( image_generator->block_data[ 72 ] ),
+		 object_identifier );
+	}
+	if( self_reference_offset != 0 )
+	{
+		if( fsrefs_test_image_generator_write_block_reference(
+		     image_generator,
+		     block_number,
+		     image_generator->block_data,
+		     &( image_generator->block_data[ self_reference_offset ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set self reference.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( block_reference_data != NULL )
+	{
+		if( fsrefs_test_image_generator_write_block_reference(
+		     image_generator,
+		     block_number,
+		     image_generator->block_data,
+		     block_reference_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block reference.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( fsrefs_test_image_generator_write_at_block(
+	     image_generator,
+	     block_number,
+	     image_generator->block_data,
+	     (size_t) image_generator->metadata_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	image_generator->number_of_metadata_blocks += 1;
+
+	return( 1 );
+}
+
+/* Writes a block reference with a CRC-32C checksum of the block data
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_block_reference(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     const uint8_t *block_data,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error )
+{
+	static char *function         = "fsrefs_test_image_generator_write_block_reference";
+	size_t block_descriptor_offset = 0;
+	uint32_t checksum             = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reference_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference data.",
+		 function );
+
+		return( -1 );
+	}
+	checksum = fsrefs_test_image_generator_calculate_crc32c(
+	            block_data,
+	            (size_t) image_generator->metadata_block_size );
+
+	if( memory_set(
+	     block_reference_data,
+	     0,
+	     image_generator->block_reference_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block reference data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 block_reference_data,
+	 block_number );
+
+	/* The version 3 block reference contains 4 block numbers
+	 */
+	if( image_generator->major_format_version == 1 )
+	{
+		block_descriptor_offset = 8;
+	}
+	else
+	{
+		block_descriptor_offset = 32;
+	}
+	/* Checksum type 1 (CRC-32C) with the checksum data 8 bytes after the descriptor
+	 */
+	block_reference_data[ block_descriptor_offset + 2 ] = 1;
+	block_reference_data[ block_descriptor_offset + 3 ] = 8;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( block_reference_data[ block_descriptor_offset + 4 ] ),
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_reference_data[ block_descriptor_offset + 8 ] ),
+	 checksum );
+
+	return( 1 );
+}
+
+/* Creates a node
+ * Make sure the value node is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_node_initialize(
+     fsrefs_test_image_node_t **node,
+     size_t maximum_records_data_size,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function                = "fsrefs_test_image_node_initialize";
+	size_t maximum_record_offsets_size   = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_records_data_size == 0 )
+	 || ( maximum_records_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*node = memory_allocate_structure(
+	         fsrefs_test_image_node_t );
+
+	if( *node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *node,
+	     0,
+	     sizeof( fsrefs_test_image_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		memory_free(
+		 *node );
+
+		*node = NULL;
+
+		return( -1 );
+	}
+	( *node )->records_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * maximum_records_data_size );
+
+	if( ( *node )->records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records data.",
+		 function );
+
+		goto on_error;
+	}
+	/* A record consists of at least its 16-byte header and an 8-byte key
+	 * and needs 4 bytes for its record offset
+	 */
+	maximum_record_offsets_size = ( ( maximum_records_data_size / 28 ) + 1 ) * sizeof( uint32_t );
+
+	( *node )->record_offsets = (uint32_t *) memory_allocate(
+	                                          maximum_record_offsets_size );
+
+	if( ( *node )->record_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *node )->maximum_records_data_size = maximum_records_data_size;
+	( *node )->maximum_number_of_records = maximum_number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( *node != NULL )
+	{
+		if( ( *node )->records_data != NULL )
+		{
+			memory_free(
+			 ( *node )->records_data );
+		}
+		memory_free(
+		 *node );
+
+		*node = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a node
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_node_free(
+     fsrefs_test_image_node_t **node,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_node_free";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node != NULL )
+	{
+		memory_free(
+		 ( *node )->record_offsets );
+
+		memory_free(
+		 ( *node )->records_data );
+
+		memory_free(
+		 *node );
+
+		*node = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a record to the node
+ * Returns 1 if successful, 0 if the node has no space left for the record or -1 on error
+ */
+int fsrefs_test_image_node_append_record(
+     fsrefs_test_image_node_t *node,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t flags,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *record_data  = NULL;
+	static char *function = "fsrefs_test_image_node_append_record";
+	size_t record_size    = 0;
+	size_t value_offset   = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size == 0 )
+	 || ( key_data_size > (size_t) FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_VALUE_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	value_offset = FSREFS_TEST_IMAGE_GENERATOR_NODE_RECORD_HEADER_SIZE
+	             + fsrefs_test_image_generator_align8( key_data_size );
+
+	if( ( value_offset + value_data_size ) > (size_t) FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_VALUE_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	record_size = fsrefs_test_image_generator_align8( value_offset + value_data_size );
+
+	if( ( node->maximum_number_of_records > 0 )
+	 && ( node->number_of_records >= node->maximum_number_of_records ) )
+	{
+		return( 0 );
+	}
+	if( ( node->records_data_size + record_size + ( ( node->number_of_records + 1 ) * sizeof( uint32_t ) ) ) > node->maximum_records_data_size )
+	{
+		return( 0 );
+	}
+	record_data = &( node->records_data[ node->records_data_size ] );
+
+	if( memory_set(
+	     record_data,
+	     0,
+	     record_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 0 ] ),
+	 (uint32_t) record_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( record_data[ 4 ] ),
+	 (uint16_t) FSREFS_TEST_IMAGE_GENERATOR_NODE_RECORD_HEADER_SIZE );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( record_data[ 6 ] ),
+	 (uint16_t) key_data_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( record_data[ 8 ] ),
+	 flags );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( record_data[ 10 ] ),
+	 (uint16_t) value_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( record_data[ 12 ] ),
+	 (uint16_t) value_data_size );
+
+	if( memory_copy(
+	     &( record_data[ FSREFS_TEST_IMAGE_GENERATOR_NODE_RECORD_HEADER_SIZE ] ),
+	     key_data,
+	     key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( record_data[ value_offset ] ),
+		     value_data,
+		     value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	node->record_offsets[ node->number_of_records ] = (uint32_t) node->records_data_size;
+
+	node->last_key_data      = &( record_data[ FSREFS_TEST_IMAGE_GENERATOR_NODE_RECORD_HEADER_SIZE ] );
+	node->last_key_data_size = key_data_size;
+	node->records_data_size += record_size;
+	node->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the node when embedded in a record value
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_node_get_embedded_data_size(
+     fsrefs_test_image_node_t *node,
+     size_t header_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_node_get_embedded_data_size";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE
+	           + header_data_size
+	           + FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE
+	           + node->records_data_size
+	           + ( node->number_of_records * sizeof( uint32_t ) );
+
+	return( 1 );
+}
+
+/* Copies the node to data
+ * The data starts with the node header offset, optionally followed by the tree header
+ * and header data, followed by the node header and the records, the record offsets
+ * are stored at the end of the data
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_node_copy_to_data(
+     fsrefs_test_image_node_t *node,
+     uint8_t major_format_version,
+     uint8_t node_level,
+     uint8_t node_type_flags,
+     const uint8_t *header_data,
+     size_t header_data_size,
+     int has_tree_header,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "fsrefs_test_image_node_copy_to_data";
+	size_t node_header_offset            = 4;
+	size_t record_offsets_start_offset   = 0;
+	size_t records_data_end_offset       = 0;
+	uint32_t record_offset               = 0;
+	int record_index                     = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header_data == NULL )
+	 && ( header_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_tree_header != 0 )
+	{
+		node_header_offset = FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE + header_data_size;
+	}
+	records_data_end_offset = node_header_offset
+	                        + FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE
+	                        + node->records_data_size;
+
+	if( ( data_size > (size_t) UINT32_MAX )
+	 || ( ( records_data_end_offset + ( node->number_of_records * sizeof( uint32_t ) ) ) > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 (uint32_t) node_header_offset );
+
+	if( has_tree_header != 0 )
+	{
+		/* The table data offset is relative to the start of the data
+		 */
+		byte_stream_copy_from_uint16_little_endian(
+		 &( data[ 4 ] ),
+		 (uint16_t) FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE );
+
+		if( header_data_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE ] ),
+			     header_data,
+			     header_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy header data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	record_offsets_start_offset = data_size - ( node->number_of_records * sizeof( uint32_t ) );
+
+	/* The values in the node header are relative to the start of the node header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ node_header_offset ] ),
+	 (uint32_t) FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ node_header_offset + 4 ] ),
+	 (uint32_t) ( records_data_end_offset - node_header_offset ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ node_header_offset + 8 ] ),
+	 (uint32_t) ( record_offsets_start_offset - records_data_end_offset ) );
+
+	data[ node_header_offset + 12 ] = node_level;
+	data[ node_header_offset + 13 ] = node_type_flags;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ node_header_offset + 16 ] ),
+	 (uint32_t) ( record_offsets_start_offset - node_header_offset ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ node_header_offset + 20 ] ),
+	 (uint32_t) node->number_of_records );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ node_header_offset + 24 ] ),
+	 (uint32_t) ( data_size - node_header_offset ) );
+
+	if( node->records_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ node_header_offset + FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE ] ),
+		     node->records_data,
+		     node->records_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy records data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( record_index = 0;
+	     record_index < node->number_of_records;
+	     record_index++ )
+	{
+		record_offset = FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE + node->record_offsets[ record_index ];
+
+		/* In version 3 only the lower 16-bits contain the record offset
+		 */
+		if( major_format_version == 3 )
+		{
+			record_offset |= 0xffff0000UL;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ record_offsets_start_offset + ( record_index * sizeof( uint32_t ) ) ] ),
+		 record_offset );
+	}
+	return( 1 );
+}
+
+/* Creates a tree
+ * Make sure the value tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_tree_initialize(
+     fsrefs_test_image_tree_t **tree,
+     uint64_t object_identifier,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_tree_initialize";
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*tree = memory_allocate_structure(
+	         fsrefs_test_image_tree_t );
+
+	if( *tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *tree,
+	     0,
+	     sizeof( fsrefs_test_image_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree.",
+		 function );
+
+		memory_free(
+		 *tree );
+
+		*tree = NULL;
+
+		return( -1 );
+	}
+	( *tree )->object_identifier         = object_identifier;
+	( *tree )->maximum_number_of_records = maximum_number_of_records;
+
+	return( 1 );
+}
+
+/* Frees a tree
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_tree_free(
+     fsrefs_test_image_tree_t **tree,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_tree_free";
+	int level             = 0;
+	int result            = 1;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree != NULL )
+	{
+		for( level = 0;
+		     level < FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_NUMBER_OF_TREE_LEVELS;
+		     level++ )
+		{
+			if( ( *tree )->nodes[ level ] != NULL )
+			{
+				if( fsrefs_test_image_node_free(
+				     &( ( *tree )->nodes[ level ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free level: %d node.",
+					 function,
+					 level );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 *tree );
+
+		*tree = NULL;
+	}
+	return( result );
+}
+
+/* Appends a record to the node of a specific level of the tree
+ * If the node is full it is written and a branch record referencing it is appended to the next level
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_tree_append_record(
+     fsrefs_test_image_tree_t *tree,
+     fsrefs_test_image_generator_t *image_generator,
+     int level,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t flags,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "fsrefs_test_image_tree_append_record";
+	size_t maximum_records_data_size = 0;
+	int result                       = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( level < 0 )
+	 || ( level >= FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_NUMBER_OF_TREE_LEVELS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree->nodes[ level ] == NULL )
+	{
+		/* The records data of a node must fit in a metadata block together with
+		 * the tree header and node header of a root node
+		 */
+		maximum_records_data_size = image_generator->metadata_block_size
+		                          - image_generator->metadata_block_header_size
+		                          - FSREFS_TEST_IMAGE_GENERATOR_TREE_HEADER_SIZE
+		                          - FSREFS_TEST_IMAGE_GENERATOR_NODE_HEADER_SIZE;
+
+		if( fsrefs_test_image_node_initialize(
+		     &( tree->nodes[ level ] ),
+		     maximum_records_data_size,
+		     tree->maximum_number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create level: %d node.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( tree->number_of_levels <= level )
+		{
+			tree->number_of_levels = level + 1;
+		}
+	}
+	result = fsrefs_test_image_node_append_record(
+	          tree->nodes[ level ],
+	          key_data,
+	          key_data_size,
+	          flags,
+	          value_data,
+	          value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record to level: %d node.",
+		 function,
+		 level );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( tree->nodes[ level ]->number_of_records == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: record too large for node.",
+			 function );
+
+			return( -1 );
+		}
+		if( fsrefs_test_image_tree_write_node(
+		     tree,
+		     image_generator,
+		     level,
+		     0,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write level: %d node.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		result = fsrefs_test_image_node_append_record(
+		          tree->nodes[ level ],
+		          key_data,
+		          key_data_size,
+		          flags,
+		          value_data,
+		          value_data_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record to level: %d node.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the node of a specific level of the tree to a newly allocated metadata block
+ * A non-root node is referenced by a branch record in the next level, which uses the key
+ * of the last record in the node, after which the node is emptied
+ * A reference to a root node is stored in block reference data
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_tree_write_node(
+     fsrefs_test_image_tree_t *tree,
+     fsrefs_test_image_generator_t *image_generator,
+     int level,
+     uint8_t is_root,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error )
+{
+	uint8_t branch_block_reference_data[ 48 ];
+
+	fsrefs_test_image_node_t *node = NULL;
+	static char *function          = "fsrefs_test_image_tree_write_node";
+	uint64_t block_number          = 0;
+	uint8_t node_type_flags        = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( level < 0 )
+	 || ( level >= tree->number_of_levels ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_root == 0 )
+	 && ( level >= ( FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_NUMBER_OF_TREE_LEVELS - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of tree levels exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_root != 0 )
+	 && ( block_reference_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference data.",
+		 function );
+
+		return( -1 );
+	}
+	node = tree->nodes[ level ];
+
+	if( ( is_root == 0 )
+	 && ( node->number_of_records == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level: %d node - missing records.",
+		 function,
+		 level );
+
+		return( -1 );
+	}
+	if( level > 0 )
+	{
+		node_type_flags |= 0x01;
+	}
+	if( is_root != 0 )
+	{
+		node_type_flags |= 0x02;
+	}
+	block_number = image_generator->next_block_number;
+
+	image_generator->next_block_number += 1;
+
+	if( fsrefs_test_image_node_copy_to_data(
+	     node,
+	     image_generator->major_format_version,
+	     (uint8_t) level,
+	     node_type_flags,
+	     NULL,
+	     0,
+	     (int) is_root,
+	     &( image_generator->block_data[ image_generator->metadata_block_header_size ] ),
+	     image_generator->metadata_block_size - image_generator->metadata_block_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy level: %d node to block data.",
+		 function,
+		 level );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_generator_write_metadata_block(
+	     image_generator,
+	     block_number,
+	     "MSB+",
+	     tree->object_identifier,
+	     0,
+	     branch_block_reference_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write level: %d node.",
+		 function,
+		 level );
+
+		return( -1 );
+	}
+	tree->number_of_written_nodes[ level ] += 1;
+
+	if( is_root != 0 )
+	{
+		if( memory_copy(
+		     block_reference_data,
+		     branch_block_reference_data,
+		     image_generator->block_reference_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block reference.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( fsrefs_test_image_tree_append_record(
+	     tree,
+	     image_generator,
+	     level + 1,
+	     node->last_key_data,
+	     node->last_key_data_size,
+	     0,
+	     branch_block_reference_data,
+	     image_generator->block_reference_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append branch record to level: %d node.",
+		 function,
+		 level + 1 );
+
+		return( -1 );
+	}
+	node->records_data_size  = 0;
+	node->number_of_records  = 0;
+	node->last_key_data      = NULL;
+	node->last_key_data_size = 0;
+
+	return( 1 );
+}
+
+/* Writes the remaining nodes of the tree
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_tree_finalize(
+     fsrefs_test_image_tree_t *tree,
+     fsrefs_test_image_generator_t *image_generator,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_tree_finalize";
+	uint8_t is_root       = 0;
+	int level             = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree->number_of_levels == 0 )
+	{
+		if( fsrefs_test_image_node_initialize(
+		     &( tree->nodes[ 0 ] ),
+		     image_generator->metadata_block_size - image_generator->metadata_block_header_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create empty root node.",
+			 function );
+
+			return( -1 );
+		}
+		tree->number_of_levels = 1;
+	}
+	/* The number of levels can increase while the nodes are written
+	 */
+	for( level = 0;
+	     level < tree->number_of_levels;
+	     level++ )
+	{
+		if( ( level == ( tree->number_of_levels - 1 ) )
+		 && ( tree->number_of_written_nodes[ level ] == 0 ) )
+		{
+			is_root = 1;
+		}
+		if( fsrefs_test_image_tree_write_node(
+		     tree,
+		     image_generator,
+		     level,
+		     is_root,
+		     block_reference_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write level: %d node.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( is_root != 0 )
+		{
+			break;
+		}
+	}
+	if( tree->number_of_levels > image_generator->maximum_number_of_tree_levels )
+	{
+		image_generator->maximum_number_of_tree_levels = tree->number_of_levels;
+	}
+	return( 1 );
+}
+
+/* Copies an ASCII name to a directory entry key
+ * The key consists of the record type 0x0030, the entry type and the UTF-16 little-endian name
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_copy_name_to_key(
+     const char *name,
+     uint16_t entry_type,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_data_length,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_image_generator_copy_name_to_key";
+	size_t key_data_index = 0;
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data length.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	if( ( key_data_size < 4 )
+	 || ( name_length > ( ( key_data_size - 4 ) / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( key_data[ 0 ] ),
+	 0x0030 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( key_data[ 2 ] ),
+	 entry_type );
+
+	key_data_index = 4;
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		key_data[ key_data_index++ ] = (uint8_t) name[ name_index ];
+		key_data[ key_data_index++ ] = 0;
+	}
+	*key_data_length = key_data_index;
+
+	return( 1 );
+}
+
+/* Writes the data blocks of a file and fills the data runs node
+ * The data runs are stored in reverse physical order so that adjacent runs cannot be merged
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_data_runs(
+     fsrefs_test_image_generator_t *image_generator,
+     libcerror_error_t **error )
+{
+	uint8_t data_run_data[ FSREFS_TEST_IMAGE_GENERATOR_DATA_RUN_SIZE ];
+
+	static char *function         = "fsrefs_test_image_generator_write_data_runs";
+	uint64_t base_block_number    = 0;
+	uint64_t block_index          = 0;
+	uint64_t logical_block_number = 0;
+	uint64_t physical_block_number = 0;
+	int data_run_index            = 0;
+	int result                    = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->data_runs_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing data runs node.",
+		 function );
+
+		return( -1 );
+	}
+	image_generator->data_runs_node->records_data_size = 0;
+	image_generator->data_runs_node->number_of_records = 0;
+
+	base_block_number = image_generator->next_block_number;
+
+	image_generator->next_block_number += (uint64_t) image_generator->number_of_data_runs * image_generator->data_run_size;
+
+	for( data_run_index = 0;
+	     data_run_index < image_generator->number_of_data_runs;
+	     data_run_index++ )
+	{
+		logical_block_number  = (uint64_t) data_run_index * image_generator->data_run_size;
+		physical_block_number = base_block_number
+		                      + ( (uint64_t) ( image_generator->number_of_data_runs - 1 - data_run_index ) * image_generator->data_run_size );
+
+		for( block_index = 0;
+		     block_index < (uint64_t) image_generator->data_run_size;
+		     block_index++ )
+		{
+			if( memory_set(
+			     image_generator->data_block_data,
+			     fsrefs_test_image_generator_get_data_block_value(
+			      logical_block_number + block_index ),
+			     image_generator->metadata_block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set data block data.",
+				 function );
+
+				return( -1 );
+			}
+			if( fsrefs_test_image_generator_write_at_block(
+			     image_generator,
+			     physical_block_number + block_index,
+			     image_generator->data_block_data,
+			     (size_t) image_generator->metadata_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data block: %" PRIu64 ".",
+				 function,
+				 physical_block_number + block_index );
+
+				return( -1 );
+			}
+		}
+		if( memory_set(
+		     data_run_data,
+		     0,
+		     FSREFS_TEST_IMAGE_GENERATOR_DATA_RUN_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data run data.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data_run_data[ 0 ] ),
+		 logical_block_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data_run_data[ 8 ] ),
+		 (uint64_t) image_generator->data_run_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data_run_data[ 16 ] ),
+		 physical_block_number );
+
+		/* The key of a data run record consists of the logical block number and the number of blocks
+		 */
+		result = fsrefs_test_image_node_append_record(
+		          image_generator->data_runs_node,
+		          data_run_data,
+		          16,
+		          0,
+		          data_run_data,
+		          FSREFS_TEST_IMAGE_GENERATOR_DATA_RUN_SIZE,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data run: %d record.",
+			 function,
+			 data_run_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a file record to a directory tree
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_file_record(
+     fsrefs_test_image_generator_t *image_generator,
+     fsrefs_test_image_tree_t *tree,
+     uint64_t directory_object_identifier,
+     int file_index,
+     libcerror_error_t **error )
+{
+	uint8_t attribute_key_data[ 16 ];
+	uint8_t file_values_data[ FSREFS_TEST_IMAGE_GENERATOR_FILE_VALUES_SIZE ];
+	uint8_t non_resident_values_data[ FSREFS_TEST_IMAGE_GENERATOR_NON_RESIDENT_VALUES_SIZE ];
+	uint8_t key_data[ 64 ];
+	char name[ 32 ];
+
+	static char *function            = "fsrefs_test_image_generator_write_file_record";
+	size64_t data_size               = 0;
+	size_t attribute_value_data_size = 0;
+	size_t key_data_size             = 0;
+	size_t name_length               = 0;
+	size_t value_data_size           = 0;
+	uint64_t filetime                = 0;
+	uint16_t attribute_flags         = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_generator->value_data == NULL )
+	 || ( image_generator->attribute_value_data == NULL )
+	 || ( image_generator->file_values_node == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing value data or file values node.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_snprintf(
+	     name,
+	     32,
+	     "file%08d",
+	     file_index ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	if( fsrefs_test_image_generator_copy_name_to_key(
+	     name,
+	     1,
+	     key_data,
+	     64,
+	     &key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_generator->has_invalid_name != 0 )
+	 && ( file_index == ( image_generator->number_of_files - 1 ) ) )
+	{
+		/* The trailing byte keeps the key of the last file in key order
+		 */
+		key_data[ key_data_size++ ] = 0;
+	}
+	if( fsrefs_test_image_generator_get_file_data_size(
+	     image_generator,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->number_of_data_runs == 0 )
+	{
+		/* The resident data contains the name of the file
+		 */
+		if( memory_set(
+		     image_generator->attribute_value_data,
+		     0,
+		     FSREFS_TEST_IMAGE_GENERATOR_RESIDENT_VALUES_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear resident attribute values.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( image_generator->attribute_value_data[ 4 ] ),
+		 (uint32_t) FSREFS_TEST_IMAGE_GENERATOR_RESIDENT_VALUES_SIZE );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( image_generator->attribute_value_data[ 8 ] ),
+		 (uint32_t) name_length );
+
+		if( memory_copy(
+		     &( image_generator->attribute_value_data[ FSREFS_TEST_IMAGE_GENERATOR_RESIDENT_VALUES_SIZE ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy resident data.",
+			 function );
+
+			return( -1 );
+		}
+		attribute_value_data_size = FSREFS_TEST_IMAGE_GENERATOR_RESIDENT_VALUES_SIZE + name_length;
+		attribute_flags           = 0;
+	}
+	else
+	{
+		if( fsrefs_test_image_generator_write_data_runs(
+		     image_generator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data runs.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     non_resident_values_data,
+		     0,
+		     FSREFS_TEST_IMAGE_GENERATOR_NON_RESIDENT_VALUES_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear non-resident attribute values.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( non_resident_values_data[ 12 ] ),
+		 (uint64_t) data_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( non_resident_values_data[ 20 ] ),
+		 (uint64_t) data_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( non_resident_values_data[ 28 ] ),
+		 (uint64_t) data_size );
+
+		if( fsrefs_test_image_node_get_embedded_data_size(
+		     image_generator->data_runs_node,
+		     FSREFS_TEST_IMAGE_GENERATOR_NON_RESIDENT_VALUES_SIZE,
+		     &attribute_value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data runs node size.",
+			 function );
+
+			return( -1 );
+		}
+		if( fsrefs_test_image_node_copy_to_data(
+		     image_generator->data_runs_node,
+		     image_generator->major_format_version,
+		     0,
+		     0x02,
+		     non_resident_values_data,
+		     FSREFS_TEST_IMAGE_GENERATOR_NON_RESIDENT_VALUES_SIZE,
+		     1,
+		     image_generator->attribute_value_data,
+		     attribute_value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy data runs node.",
+			 function );
+
+			return( -1 );
+		}
+		attribute_flags = 0x0008;
+	}
+	/* The attribute key contains the attribute type $DATA (0x80) and an empty name
+	 */
+	if( memory_set(
+	     attribute_key_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear attribute key data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( attribute_key_data[ 8 ] ),
+	 0x00000080UL );
+
+	image_generator->file_values_node->records_data_size = 0;
+	image_generator->file_values_node->number_of_records = 0;
+
+	if( fsrefs_test_image_node_append_record(
+	     image_generator->file_values_node,
+	     attribute_key_data,
+	     14,
+	     attribute_flags,
+	     image_generator->attribute_value_data,
+	     attribute_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append attribute record.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_values_data,
+	     0,
+	     FSREFS_TEST_IMAGE_GENERATOR_FILE_VALUES_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file values data.",
+		 function );
+
+		return( -1 );
+	}
+	filetime = FSREFS_TEST_IMAGE_GENERATOR_BASE_FILETIME + ( image_generator->entry_counter * 10000000UL );
+
+	image_generator->entry_counter += 1;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 0 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 8 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 16 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 24 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_values_data[ 32 ] ),
+	 0x00000020UL );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 40 ] ),
+	 (uint64_t) file_index );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 48 ] ),
+	 directory_object_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 64 ] ),
+	 (uint64_t) data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_values_data[ 72 ] ),
+	 (uint64_t) data_size );
+
+	if( fsrefs_test_image_node_get_embedded_data_size(
+	     image_generator->file_values_node,
+	     FSREFS_TEST_IMAGE_GENERATOR_FILE_VALUES_SIZE,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file values node size.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_node_copy_to_data(
+	     image_generator->file_values_node,
+	     image_generator->major_format_version,
+	     0,
+	     0x02,
+	     file_values_data,
+	     FSREFS_TEST_IMAGE_GENERATOR_FILE_VALUES_SIZE,
+	     1,
+	     image_generator->value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy file values node.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_tree_append_record(
+	     tree,
+	     image_generator,
+	     0,
+	     key_data,
+	     key_data_size,
+	     0x0008,
+	     image_generator->value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file: %d record.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a sub directory record to a directory tree
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_directory_record(
+     fsrefs_test_image_generator_t *image_generator,
+     fsrefs_test_image_tree_t *tree,
+     uint64_t object_identifier,
+     int directory_index,
+     libcerror_error_t **error )
+{
+	uint8_t directory_values_data[ FSREFS_TEST_IMAGE_GENERATOR_DIRECTORY_VALUES_SIZE ];
+	uint8_t key_data[ 64 ];
+	char name[ 32 ];
+
+	static char *function = "fsrefs_test_image_generator_write_directory_record";
+	size_t key_data_size  = 0;
+	uint64_t filetime     = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_snprintf(
+	     name,
+	     32,
+	     "directory%06d",
+	     directory_index ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_generator_copy_name_to_key(
+	     name,
+	     2,
+	     key_data,
+	     64,
+	     &key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     directory_values_data,
+	     0,
+	     FSREFS_TEST_IMAGE_GENERATOR_DIRECTORY_VALUES_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory values data.",
+		 function );
+
+		return( -1 );
+	}
+	filetime = FSREFS_TEST_IMAGE_GENERATOR_BASE_FILETIME + ( image_generator->entry_counter * 10000000UL );
+
+	image_generator->entry_counter += 1;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( directory_values_data[ 0 ] ),
+	 object_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( directory_values_data[ 16 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( directory_values_data[ 24 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( directory_values_data[ 32 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( directory_values_data[ 40 ] ),
+	 filetime );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( directory_values_data[ 64 ] ),
+	 0x00000010UL );
+
+	if( fsrefs_test_image_tree_append_record(
+	     tree,
+	     image_generator,
+	     0,
+	     key_data,
+	     key_data_size,
+	     0,
+	     directory_values_data,
+	     FSREFS_TEST_IMAGE_GENERATOR_DIRECTORY_VALUES_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory: %d record.",
+		 function,
+		 directory_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the tree of a directory
+ * The directories are numbered breadth-first, the sub directories of directory i
+ * are i * F + 1 to i * F + F, where F is the number of sub directories per directory
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_directory(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t directory_index,
+     uint64_t number_of_directories,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error )
+{
+	fsrefs_test_image_tree_t *tree           = NULL;
+	static char *function                    = "fsrefs_test_image_generator_write_directory";
+	uint64_t object_identifier               = 0;
+	uint64_t sub_directory_index             = 0;
+	int file_index                           = 0;
+	int sub_directory_number                 = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_index >= number_of_directories )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_index == 0 )
+	{
+		object_identifier = 0x00000600UL;
+	}
+	else
+	{
+		object_identifier = 0x00000700UL + directory_index;
+	}
+	if( fsrefs_test_image_tree_initialize(
+	     &tree,
+	     object_identifier,
+	     image_generator->maximum_number_of_node_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tree.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file records (entry type 1) are stored before the directory records (entry type 2)
+	 * to keep the records in key order
+	 */
+	for( file_index = 0;
+	     file_index < image_generator->number_of_files;
+	     file_index++ )
+	{
+		if( fsrefs_test_image_generator_write_file_record(
+		     image_generator,
+		     tree,
+		     object_identifier,
+		     file_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file: %d record.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	for( sub_directory_number = 0;
+	     sub_directory_number < image_generator->number_of_sub_directories;
+	     sub_directory_number++ )
+	{
+		sub_directory_index = ( directory_index * image_generator->number_of_sub_directories )
+		                    + sub_directory_number + 1;
+
+		if( sub_directory_index >= number_of_directories )
+		{
+			break;
+		}
+		if( fsrefs_test_image_generator_write_directory_record(
+		     image_generator,
+		     tree,
+		     0x00000700UL + sub_directory_index,
+		     sub_directory_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write directory: %d record.",
+			 function,
+			 sub_directory_number );
+
+			goto on_error;
+		}
+	}
+	if( ( image_generator->has_directory_cycle != 0 )
+	 && ( directory_index == ( number_of_directories - 1 ) ) )
+	{
+		if( fsrefs_test_image_generator_write_directory_record(
+		     image_generator,
+		     tree,
+		     0x00000600UL,
+		     image_generator->number_of_sub_directories,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write root directory record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( fsrefs_test_image_tree_finalize(
+	     tree,
+	     image_generator,
+	     block_reference_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_free(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( tree != NULL )
+	{
+		fsrefs_test_image_tree_free(
+		 &tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the volume information tree
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_volume_information(
+     fsrefs_test_image_generator_t *image_generator,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 8 ];
+	uint8_t value_data[ 32 ];
+
+	fsrefs_test_image_tree_t *tree = NULL;
+	static char *function          = "fsrefs_test_image_generator_write_volume_information";
+	const char *volume_name        = "SYNTHETIC";
+	size_t value_data_size         = 0;
+	size_t volume_name_index       = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 key_data,
+	 (uint64_t) 0x00000510UL );
+
+	while( volume_name[ volume_name_index ] != 0 )
+	{
+		value_data[ value_data_size++ ] = (uint8_t) volume_name[ volume_name_index++ ];
+		value_data[ value_data_size++ ] = 0;
+	}
+	if( fsrefs_test_image_tree_initialize(
+	     &tree,
+	     0x00000500UL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_append_record(
+	     tree,
+	     image_generator,
+	     0,
+	     key_data,
+	     8,
+	     0,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append volume name record.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_finalize(
+	     tree,
+	     image_generator,
+	     block_reference_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_tree_free(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( tree != NULL )
+	{
+		fsrefs_test_image_tree_free(
+		 &tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes a checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_checkpoint(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     uint64_t sequence_number,
+     const uint8_t *ministore_tree_references_data,
+     libcerror_error_t **error )
+{
+	static char *function                 = "fsrefs_test_image_generator_write_checkpoint";
+	size_t checkpoint_trailer_size        = 0;
+	size_t data_offset                    = 0;
+	size_t offsets_data_offset            = 0;
+	size_t self_reference_offset          = 0;
+	size_t tree_references_offset         = 0;
+	int tree_index                        = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ministore_tree_references_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ministore tree references data.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->major_format_version == 1 )
+	{
+		checkpoint_trailer_size = 28;
+	}
+	else
+	{
+		checkpoint_trailer_size = 52;
+	}
+	data_offset            = image_generator->metadata_block_header_size;
+	offsets_data_offset    = data_offset + 16 + checkpoint_trailer_size;
+	self_reference_offset  = fsrefs_test_image_generator_align8(
+	                          offsets_data_offset + ( FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES * 4 ) );
+	tree_references_offset = self_reference_offset + image_generator->block_reference_size;
+
+	if( memory_set(
+	     image_generator->block_data,
+	     0,
+	     image_generator->metadata_block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( image_generator->block_data[ data_offset + 4 ] ),
+	 (uint16_t) image_generator->major_format_version );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( image_generator->block_data[ data_offset + 6 ] ),
+	 (uint16_t) image_generator->minor_format_version );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ data_offset + 8 ] ),
+	 (uint32_t) self_reference_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ data_offset + 12 ] ),
+	 (uint32_t) image_generator->block_reference_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( image_generator->block_data[ data_offset + 16 ] ),
+	 sequence_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ offsets_data_offset - 4 ] ),
+	 (uint32_t) FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES );
+
+	for( tree_index = 0;
+	     tree_index < FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES;
+	     tree_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( image_generator->block_data[ offsets_data_offset + ( tree_index * 4 ) ] ),
+		 (uint32_t) ( tree_references_offset + ( tree_index * image_generator->block_reference_size ) ) );
+	}
+	if( memory_copy(
+	     &( image_generator->block_data[ tree_references_offset ] ),
+	     ministore_tree_references_data,
+	     FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES * image_generator->block_reference_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy ministore tree references.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsrefs_test_image_generator_write_metadata_block(
+	     image_generator,
+	     block_number,
+	     "CHKP",
+	     0,
+	     self_reference_offset,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint metadata block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the superblock
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_superblock(
+     fsrefs_test_image_generator_t *image_generator,
+     libcerror_error_t **error )
+{
+	static char *function        = "fsrefs_test_image_generator_write_superblock";
+	size_t checkpoints_offset    = 0;
+	size_t data_offset           = 0;
+	size_t self_reference_offset = 0;
+	uint8_t byte_index           = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_generator->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image generator - missing block data.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset           = image_generator->metadata_block_header_size;
+	checkpoints_offset    = data_offset + 48;
+	self_reference_offset = checkpoints_offset + 16;
+
+	if( memory_set(
+	     image_generator->block_data,
+	     0,
+	     image_generator->metadata_block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The volume identifier is a fixed GUID
+	 */
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		image_generator->block_data[ data_offset + byte_index ] = byte_index + 1;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ data_offset + 32 ] ),
+	 (uint32_t) checkpoints_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ data_offset + 36 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ data_offset + 40 ] ),
+	 (uint32_t) self_reference_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_generator->block_data[ data_offset + 44 ] ),
+	 (uint32_t) image_generator->block_reference_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( image_generator->block_data[ checkpoints_offset ] ),
+	 (uint64_t) FSREFS_TEST_IMAGE_GENERATOR_PRIMARY_CHECKPOINT_BLOCK_NUMBER );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( image_generator->block_data[ checkpoints_offset + 8 ] ),
+	 (uint64_t) FSREFS_TEST_IMAGE_GENERATOR_SECONDARY_CHECKPOINT_BLOCK_NUMBER );
+
+	if( fsrefs_test_image_generator_write_metadata_block(
+	     image_generator,
+	     FSREFS_TEST_IMAGE_GENERATOR_SUPERBLOCK_BLOCK_NUMBER,
+	     "SUPB",
+	     0,
+	     self_reference_offset,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write superblock metadata block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the volume header
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_image_generator_write_volume_header(
+     fsrefs_test_image_generator_t *image_generator,
+     libcerror_error_t **error )
+{
+	uint8_t volume_header_data[ 512 ];
+
+	static char *function      = "fsrefs_test_image_generator_write_volume_header";
+	uint64_t number_of_sectors = 0;
+	uint64_t volume_size       = 0;
+
+	if( image_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image generator.",
+		 function );
+
+		return( -1 );
+	}
+	volume_size = image_generator->next_block_number * image_generator->metadata_block_size;
+
+	/* The volume size is the number of sectors plus 1 times the bytes per sector
+	 */
+	number_of_sectors = ( volume_size / image_generator->bytes_per_sector ) - 1;
+
+	if( memory_set(
+	     volume_header_data,
+	     0,
+	     512 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( volume_header_data[ 3 ] ),
+	     "ReFS\0\0\0\0",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file system signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( volume_header_data[ 16 ] ),
+	     "FSRS",
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( volume_header_data[ 20 ] ),
+	 512 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( volume_header_data[ 24 ] ),
+	 number_of_sectors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( volume_header_data[ 32 ] ),
+	 image_generator->bytes_per_sector );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( volume_header_data[ 36 ] ),
+	 image_generator->cluster_block_size / image_generator->bytes_per_sector );
+
+	volume_header_data[ 40 ] = image_generator->major_format_version;
+	volume_header_data[ 41 ] = image_generator->minor_format_version;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( volume_header_data[ 56 ] ),
+	 0x0123456789abcdefULL );
+
+	/* A version 3 container size of 1 TiB keeps all block numbers within the first container,
+	 * which the library reads without translation using the container tree
+	 */
+	if( image_generator->major_format_version == 3 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( volume_header_data[ 64 ] ),
+		 0x0000010000000000ULL );
+	}
+	if( fsrefs_test_image_generator_write_at_block(
+	     image_generator,
+	     0,
+	     volume_header_data,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write volume header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,439 @@
+/*
+ * Synthetic ReFS image generator for testing
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSREFS_TEST_IMAGE_GENERATOR_H )
+#define _FSREFS_TEST_IMAGE_GENERATOR_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsrefs_test_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of levels of a generated ministore tree
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_NUMBER_OF_TREE_LEVELS	8
+
+/* The number of ministore trees referenced by the checkpoint
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_NUMBER_OF_MINISTORE_TREES		8
+
+/* The metadata block numbers of the superblock and the checkpoints
+ * the metadata blocks of the ministore trees and the file data are
+ * allocated after these
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_SUPERBLOCK_BLOCK_NUMBER		30
+#define FSREFS_TEST_IMAGE_GENERATOR_PRIMARY_CHECKPOINT_BLOCK_NUMBER	31
+#define FSREFS_TEST_IMAGE_GENERATOR_SECONDARY_CHECKPOINT_BLOCK_NUMBER	32
+
+/* The FILETIME of the first generated entry: Jan 1, 2020 00:00:00 UTC
+ * every following entry is 1 second later
+ */
+#define FSREFS_TEST_IMAGE_GENERATOR_BASE_FILETIME			0x01d5c03669050000ULL
+
+typedef struct fsrefs_test_image_node fsrefs_test_image_node_t;
+
+/* A ministore node that is being filled with records
+ * The records are stored without the node header and are laid out
+ * when the node is copied to a metadata block or record value
+ */
+struct fsrefs_test_image_node
+{
+	/* The records data
+	 */
+	uint8_t *records_data;
+
+	/* The records data size
+	 */
+	size_t records_data_size;
+
+	/* The maximum records data size
+	 * This includes the 4 bytes per record offset
+	 */
+	size_t maximum_records_data_size;
+
+	/* The record offsets, relative to the start of the records data
+	 */
+	uint32_t *record_offsets;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records
+	 */
+	int maximum_number_of_records;
+
+	/* The key data of the last record
+	 */
+	uint8_t *last_key_data;
+
+	/* The size of the key data of the last record
+	 */
+	size_t last_key_data_size;
+};
+
+typedef struct fsrefs_test_image_tree fsrefs_test_image_tree_t;
+
+/* A ministore tree that is built bottom-up from records in key order
+ * only the node that is being filled is kept per level
+ */
+struct fsrefs_test_image_tree
+{
+	/* The nodes per level, where level 0 contains the leaf nodes
+	 */
+	fsrefs_test_image_node_t *nodes[ FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_NUMBER_OF_TREE_LEVELS ];
+
+	/* The number of nodes written per level
+	 */
+	uint64_t number_of_written_nodes[ FSREFS_TEST_IMAGE_GENERATOR_MAXIMUM_NUMBER_OF_TREE_LEVELS ];
+
+	/* The number of levels in use
+	 */
+	int number_of_levels;
+
+	/* The object identifier
+	 */
+	uint64_t object_identifier;
+
+	/* The maximum number of records per node
+	 */
+	int maximum_number_of_records;
+};
+
+typedef struct fsrefs_test_image_generator fsrefs_test_image_generator_t;
+
+struct fsrefs_test_image_generator
+{
+	/* The major format version
+	 */
+	uint8_t major_format_version;
+
+	/* The minor format version
+	 */
+	uint8_t minor_format_version;
+
+	/* The bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The cluster block size
+	 */
+	uint32_t cluster_block_size;
+
+	/* The metadata block size
+	 */
+	uint32_t metadata_block_size;
+
+	/* The metadata block header size
+	 */
+	size_t metadata_block_header_size;
+
+	/* The metadata block reference size
+	 */
+	size_t block_reference_size;
+
+	/* The number of directory levels below the root directory
+	 */
+	int directory_depth;
+
+	/* The number of sub directories per directory, the directory fan-out
+	 */
+	int number_of_sub_directories;
+
+	/* The number of files per directory
+	 */
+	int number_of_files;
+
+	/* The number of data runs per file
+	 * 0 represents files with resident data
+	 */
+	int number_of_data_runs;
+
+	/* The number of blocks per data run
+	 */
+	int data_run_size;
+
+	/* The maximum number of records per ministore node
+	 * 0 represents as many records as fit in a metadata block
+	 */
+	int maximum_number_of_node_records;
+
+	/* Value to indicate the last directory contains a directory record that references
+	 * the root directory, which creates a cycle in the directory hierarchy
+	 */
+	uint8_t has_directory_cycle;
+
+	/* Value to indicate the name of the last file of every directory is an invalid
+	 * UTF-16 string, that has a trailing byte
+	 */
+	uint8_t has_invalid_name;
+
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The metadata block data
+	 */
+	uint8_t *block_data;
+
+	/* The data block data
+	 */
+	uint8_t *data_block_data;
+
+	/* The record value data
+	 */
+	uint8_t *value_data;
+
+	/* The attribute record value data
+	 */
+	uint8_t *attribute_value_data;
+
+	/* The maximum record value data size
+	 */
+	size_t maximum_value_data_size;
+
+	/* The node of the file values, which is embedded in a directory entry value
+	 */
+	fsrefs_test_image_node_t *file_values_node;
+
+	/* The node of the data runs, which is embedded in a non-resident attribute value
+	 */
+	fsrefs_test_image_node_t *data_runs_node;
+
+	/* The next unallocated block number
+	 */
+	uint64_t next_block_number;
+
+	/* The number of metadata blocks written
+	 */
+	uint64_t number_of_metadata_blocks;
+
+	/* The maximum number of levels of the directory ministore trees
+	 */
+	int maximum_number_of_tree_levels;
+
+	/* The entry counter, used to generate timestamps
+	 */
+	uint64_t entry_counter;
+};
+
+int fsrefs_test_image_generator_initialize(
+     fsrefs_test_image_generator_t **image_generator,
+     uint8_t major_format_version,
+     uint32_t cluster_block_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_free(
+     fsrefs_test_image_generator_t **image_generator,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_get_number_of_directories(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t *number_of_directories,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_get_number_of_files(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t *number_of_files,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_get_file_data_size(
+     fsrefs_test_image_generator_t *image_generator,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+uint8_t fsrefs_test_image_generator_get_data_block_value(
+         uint64_t logical_block_number );
+
+uint32_t fsrefs_test_image_generator_calculate_crc32c(
+          const uint8_t *data,
+          size_t data_size );
+
+int fsrefs_test_image_generator_write(
+     fsrefs_test_image_generator_t *image_generator,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_to_memory(
+     fsrefs_test_image_generator_t *image_generator,
+     uint8_t **image_data,
+     size_t *image_data_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_at_block(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_metadata_block(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     const char *signature,
+     uint64_t object_identifier,
+     size_t self_reference_offset,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_block_reference(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     const uint8_t *block_data,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_node_initialize(
+     fsrefs_test_image_node_t **node,
+     size_t maximum_records_data_size,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_node_free(
+     fsrefs_test_image_node_t **node,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_node_append_record(
+     fsrefs_test_image_node_t *node,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t flags,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_node_get_embedded_data_size(
+     fsrefs_test_image_node_t *node,
+     size_t header_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_node_copy_to_data(
+     fsrefs_test_image_node_t *node,
+     uint8_t major_format_version,
+     uint8_t node_level,
+     uint8_t node_type_flags,
+     const uint8_t *header_data,
+     size_t header_data_size,
+     int has_tree_header,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_tree_initialize(
+     fsrefs_test_image_tree_t **tree,
+     uint64_t object_identifier,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_tree_free(
+     fsrefs_test_image_tree_t **tree,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_tree_append_record(
+     fsrefs_test_image_tree_t *tree,
+     fsrefs_test_image_generator_t *image_generator,
+     int level,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t flags,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_tree_write_node(
+     fsrefs_test_image_tree_t *tree,
+     fsrefs_test_image_generator_t *image_generator,
+     int level,
+     uint8_t is_root,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_tree_finalize(
+     fsrefs_test_image_tree_t *tree,
+     fsrefs_test_image_generator_t *image_generator,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_copy_name_to_key(
+     const char *name,
+     uint16_t entry_type,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_data_length,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_data_runs(
+     fsrefs_test_image_generator_t *image_generator,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_file_record(
+     fsrefs_test_image_generator_t *image_generator,
+     fsrefs_test_image_tree_t *tree,
+     uint64_t directory_object_identifier,
+     int file_index,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_directory_record(
+     fsrefs_test_image_generator_t *image_generator,
+     fsrefs_test_image_tree_t *tree,
+     uint64_t object_identifier,
+     int directory_index,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_directory(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t directory_index,
+     uint64_t number_of_directories,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_volume_information(
+     fsrefs_test_image_generator_t *image_generator,
+     uint8_t *block_reference_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_checkpoint(
+     fsrefs_test_image_generator_t *image_generator,
+     uint64_t block_number,
+     uint64_t sequence_number,
+     const uint8_t *ministore_tree_references_data,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_superblock(
+     fsrefs_test_image_generator_t *image_generator,
+     libcerror_error_t **error );
+
+int fsrefs_test_image_generator_write_volume_header(
+     fsrefs_test_image_generator_t *image_generator,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSREFS_TEST_IMAGE_GENERATOR_H ) */
+
@@ -48,8 +48,8 @@ int fsrefs_test_io_handle_initialize(
 	int result                       = 0;
 
 #if defined( HAVE_FSREFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests  = 1;
-	int number_of_memset_fail_tests  = 1;
+	int number_of_malloc_fail_tests  = 2;
+	int number_of_memset_fail_tests  = 2;
 	int test_number                  = 0;
 #endif
 
@@ -398,6 +398,368 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsrefs_io_handle_set_format_version function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_io_handle_set_format_version(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsrefs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          2,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->major_format_version",
+	 io_handle->major_format_version,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->metadata_block_header_size",
+	 io_handle->metadata_block_header_size,
+	 (size_t) 48 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->record_data_offset_mask",
+	 io_handle->record_data_offset_mask,
+	 (uint32_t) 0xffffffffUL );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->read_metadata_block_header",
+	 io_handle->read_metadata_block_header );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->read_block_reference",
+	 io_handle->read_block_reference );
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          4,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->major_format_version",
+	 io_handle->major_format_version,
+	 3 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->record_data_offset_mask",
+	 io_handle->record_data_offset_mask,
+	 (uint32_t) 0x0000ffffUL );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_io_handle_set_format_version(
+	          NULL,
+	          3,
+	          4,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          2,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Trace callback function that counts the number of events
+ */
+void fsrefs_test_io_handle_trace_callback(
+      int event_type FSREFS_TEST_ATTRIBUTE_UNUSED,
+      int node_type FSREFS_TEST_ATTRIBUTE_UNUSED,
+      off64_t offset FSREFS_TEST_ATTRIBUTE_UNUSED,
+      size64_t size FSREFS_TEST_ATTRIBUTE_UNUSED,
+      uint64_t duration FSREFS_TEST_ATTRIBUTE_UNUSED,
+      intptr_t *user_data )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( event_type )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( node_type )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( offset )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( size )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( duration )
+
+	if( user_data != NULL )
+	{
+		*( (int *) user_data ) += 1;
+	}
+}
+
+/* Tests the libfsrefs_io_handle_set_trace_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_io_handle_set_trace_callback(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsrefs_io_handle_t *io_handle = NULL;
+	int number_of_events             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_io_handle_set_trace_callback(
+	          io_handle,
+	          &fsrefs_test_io_handle_trace_callback,
+	          (intptr_t *) &number_of_events,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_NODE_READ_START,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 0x4000,
+	 16384,
+	 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 1 );
+
+	/* Test if the trace callback is retained when the IO handle is cleared
+	 */
+	result = libfsrefs_io_handle_clear(
+	          io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_NODE_READ_END,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 0x4000,
+	 16384,
+	 1000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 2 );
+
+	result = libfsrefs_io_handle_set_trace_callback(
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfsrefs_io_handle_trace_event(
+	 io_handle,
+	 LIBFSREFS_TRACE_EVENT_NODE_READ_START,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 0x4000,
+	 16384,
+	 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_io_handle_set_trace_callback(
+	          NULL,
+	          &fsrefs_test_io_handle_trace_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +791,14 @@ int main(
 	 "libfsrefs_io_handle_clear",
 	 fsrefs_test_io_handle_clear );
 
+	FSREFS_TEST_RUN(
+	 "libfsrefs_io_handle_set_format_version",
+	 fsrefs_test_io_handle_set_format_version );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_io_handle_set_trace_callback",
+	 fsrefs_test_io_handle_set_trace_callback );
+
 	/* TODO: add tests for libfsrefs_io_handle_read_volume_header */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
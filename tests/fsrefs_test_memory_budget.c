@@ -0,0 +1,1682 @@
+/*
+ * Library memory_budget type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_memory_budget.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_memory_budget_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_budget = (libfsrefs_memory_budget_t *) 0x12345678UL;
+
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	memory_budget = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_memory_budget_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_memory_budget_initialize(
+		          &memory_budget,
+		          NULL,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( memory_budget != NULL )
+			{
+				libfsrefs_memory_budget_free(
+				 &memory_budget,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "memory_budget",
+			 memory_budget );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_memory_budget_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_memory_budget_initialize(
+		          &memory_budget,
+		          NULL,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( memory_budget != NULL )
+			{
+				libfsrefs_memory_budget_free(
+				 &memory_budget,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "memory_budget",
+			 memory_budget );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_add_reference(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	libfsrefs_memory_budget_t *reference     = NULL;
+	size64_t current_size                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_add_reference(
+	          memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	reference = memory_budget;
+
+	/* Test that the memory budget remains available after freeing the first reference
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          reference,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          reference,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 64 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_free(
+	          &reference,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_add_reference(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &reference,
+		 NULL );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_get_maximum_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_get_maximum_size(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	size64_t maximum_size                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_get_maximum_size(
+	          memory_budget,
+	          &maximum_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 (uint64_t) maximum_size,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_get_maximum_size(
+	          NULL,
+	          &maximum_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_memory_budget_get_maximum_size(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_set_maximum_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_set_maximum_size(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	size64_t maximum_size                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_set_maximum_size(
+	          memory_budget,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_maximum_size(
+	          memory_budget,
+	          &maximum_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 (uint64_t) maximum_size,
+	 (uint64_t) 4096 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_set_maximum_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_get_current_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_get_current_size(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	size64_t current_size                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_get_current_size(
+	          memory_budget,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_get_current_size(
+	          NULL,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_allocate(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	size64_t current_size                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          2048,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          memory_budget,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 3072 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_allocate(
+	          NULL,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          (size64_t) UINT64_MAX,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_release function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_release(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	size64_t current_size                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          3072,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_release(
+	          memory_budget,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          memory_budget,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 2048 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test release of more than the current size
+	 */
+	result = libfsrefs_memory_budget_release(
+	          memory_budget,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          memory_budget,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_release(
+	          NULL,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_is_exceeded function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_is_exceeded(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsrefs_memory_budget_t *memory_budget        = NULL;
+	libfsrefs_memory_budget_t *parent_memory_budget = NULL;
+	size64_t current_size                           = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_memory_budget_initialize(
+	          &parent_memory_budget,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_initialize(
+	          &memory_budget,
+	          parent_memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_is_exceeded(
+	          memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_set_maximum_size(
+	          memory_budget,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_is_exceeded(
+	          memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_is_exceeded(
+	          memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_release(
+	          memory_budget,
+	          4097,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the size is also allocated from the parent memory budget
+	 */
+	result = libfsrefs_memory_budget_set_maximum_size(
+	          parent_memory_budget,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_allocate(
+	          memory_budget,
+	          2048,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          parent_memory_budget,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 2048 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_is_exceeded(
+	          memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_release(
+	          memory_budget,
+	          2048,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_current_size(
+	          parent_memory_budget,
+	          &current_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_size",
+	 (uint64_t) current_size,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_is_exceeded(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_free(
+	          &parent_memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	if( parent_memory_budget != NULL )
+	{
+		libfsrefs_memory_budget_free(
+		 &parent_memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_memory_budget_get_process_memory_budget, libfsrefs_memory_budget_set_process_maximum_size
+ * and libfsrefs_memory_budget_free_process_memory_budget functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_memory_budget_process_memory_budget(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_memory_budget_t *memory_budget = NULL;
+	size64_t maximum_size                    = 0;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A maximum size of 0 does not create the process-wide memory budget
+	 */
+	result = libfsrefs_memory_budget_set_process_maximum_size(
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_set_process_maximum_size(
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_get_maximum_size(
+	          memory_budget,
+	          &maximum_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 (uint64_t) maximum_size,
+	 (uint64_t) 1024 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_memory_budget_free_process_memory_budget(
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_budget = NULL;
+
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          &memory_budget,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Freeing the process-wide memory budget when it is not available succeeds
+	 */
+	result = libfsrefs_memory_budget_free_process_memory_budget(
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_memory_budget_get_process_memory_budget(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfsrefs_memory_budget_free_process_memory_budget(
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_initialize",
+	 fsrefs_test_memory_budget_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_free",
+	 fsrefs_test_memory_budget_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_add_reference",
+	 fsrefs_test_memory_budget_add_reference );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_get_maximum_size",
+	 fsrefs_test_memory_budget_get_maximum_size );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_set_maximum_size",
+	 fsrefs_test_memory_budget_set_maximum_size );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_get_current_size",
+	 fsrefs_test_memory_budget_get_current_size );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_allocate",
+	 fsrefs_test_memory_budget_allocate );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_release",
+	 fsrefs_test_memory_budget_release );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_is_exceeded",
+	 fsrefs_test_memory_budget_is_exceeded );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_memory_budget_process_memory_budget",
+	 fsrefs_test_memory_budget_process_memory_budget );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1210 @@
+/*
+ * Library metadata_block_scanner type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_functions.h"
+#include "fsrefs_test_libbfio.h"
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_io_handle.h"
+#include "../libfsrefs/libfsrefs_metadata_block_scanner.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+uint8_t fsrefs_test_metadata_block_scanner_data1[ 4 * 4096 ];
+
+/* Initializes the test image data
+ * Blocks 1 and 3 contain a metadata block header, block 2 contains a metadata
+ * block header with block number 0 and block 0 contains no metadata block header
+ */
+void fsrefs_test_metadata_block_scanner_initialize_data(
+      void )
+{
+	memory_set(
+	 fsrefs_test_metadata_block_scanner_data1,
+	 0,
+	 4 * 4096 );
+
+	memory_copy(
+	 &( fsrefs_test_metadata_block_scanner_data1[ 4096 ] ),
+	 "MSB+",
+	 4 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fsrefs_test_metadata_block_scanner_data1[ 4096 + 32 ] ),
+	 (uint64_t) 0x1234 );
+
+	memory_copy(
+	 &( fsrefs_test_metadata_block_scanner_data1[ 2 * 4096 ] ),
+	 "MSB+",
+	 4 );
+
+	memory_copy(
+	 &( fsrefs_test_metadata_block_scanner_data1[ 3 * 4096 ] ),
+	 "MSB+",
+	 4 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fsrefs_test_metadata_block_scanner_data1[ ( 3 * 4096 ) + 32 ] ),
+	 (uint64_t) 0x5678 );
+}
+
+/* Counts the candidate blocks
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_metadata_block_scanner_count_block(
+     off64_t block_offset,
+     uint64_t block_number,
+     intptr_t *user_data )
+{
+	int *number_of_blocks = (int *) user_data;
+
+	if( ( block_offset != 4096 )
+	 && ( block_offset != ( 3 * 4096 ) ) )
+	{
+		return( -1 );
+	}
+	if( ( block_number != 0x1234 )
+	 && ( block_number != 0x5678 ) )
+	{
+		return( -1 );
+	}
+	*number_of_blocks += 1;
+
+	return( 1 );
+}
+
+/* Stops the scan at the first candidate block
+ * Returns 0
+ */
+int fsrefs_test_metadata_block_scanner_stop(
+     off64_t block_offset FSREFS_TEST_ATTRIBUTE_UNUSED,
+     uint64_t block_number FSREFS_TEST_ATTRIBUTE_UNUSED,
+     intptr_t *user_data FSREFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( block_offset )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( block_number )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( 0 );
+}
+
+/* Fails at the first candidate block
+ * Returns -1
+ */
+int fsrefs_test_metadata_block_scanner_fail(
+     off64_t block_offset FSREFS_TEST_ATTRIBUTE_UNUSED,
+     uint64_t block_number FSREFS_TEST_ATTRIBUTE_UNUSED,
+     intptr_t *user_data FSREFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( block_offset )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( block_number )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( -1 );
+}
+
+/* Tests the libfsrefs_metadata_block_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_metadata_block_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsrefs_io_handle_t *io_handle                           = NULL;
+	libfsrefs_metadata_block_scanner_t *metadata_block_scanner = NULL;
+	int result                                                 = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                            = 3;
+	int number_of_memset_fail_tests                            = 2;
+	int test_number                                            = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_block_scanner->read_buffer_size % 4096",
+	 metadata_block_scanner->read_buffer_size % 4096,
+	 (size_t) 0 );
+
+	result = libfsrefs_metadata_block_scanner_free(
+	          &metadata_block_scanner,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          NULL,
+	          io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_block_scanner = (libfsrefs_metadata_block_scanner_t *) 0x12345678UL;
+
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          io_handle,
+	          &error );
+
+	metadata_block_scanner = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with format version 1 that has no metadata block signature
+	 */
+	io_handle->major_format_version = 1;
+
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          io_handle,
+	          &error );
+
+	io_handle->major_format_version = 3;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a metadata block size that is too small
+	 */
+	io_handle->metadata_block_size = 16;
+
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          io_handle,
+	          &error );
+
+	io_handle->metadata_block_size = 4096;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_metadata_block_scanner_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_metadata_block_scanner_initialize(
+		          &metadata_block_scanner,
+		          io_handle,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_block_scanner != NULL )
+			{
+				libfsrefs_metadata_block_scanner_free(
+				 &metadata_block_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "metadata_block_scanner",
+			 metadata_block_scanner );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_metadata_block_scanner_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_metadata_block_scanner_initialize(
+		          &metadata_block_scanner,
+		          io_handle,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( metadata_block_scanner != NULL )
+			{
+				libfsrefs_metadata_block_scanner_free(
+				 &metadata_block_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "metadata_block_scanner",
+			 metadata_block_scanner );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_block_scanner != NULL )
+	{
+		libfsrefs_metadata_block_scanner_free(
+		 &metadata_block_scanner,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_metadata_block_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_metadata_block_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_metadata_block_scanner_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_metadata_block_scanner_scan_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_metadata_block_scanner_scan_data(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsrefs_io_handle_t *io_handle                           = NULL;
+	libfsrefs_metadata_block_scanner_t *metadata_block_scanner = NULL;
+	int number_of_blocks                                       = 0;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	fsrefs_test_metadata_block_scanner_initialize_data();
+
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "metadata_block_scanner->number_of_candidates",
+	 metadata_block_scanner->number_of_candidates,
+	 (uint64_t) 2 );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_stop,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          NULL,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          NULL,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          NULL,
+	          4 * 4096,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          -1,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          0,
+	          NULL,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_data(
+	          metadata_block_scanner,
+	          io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_fail,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_metadata_block_scanner_free(
+	          &metadata_block_scanner,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_block_scanner != NULL )
+	{
+		libfsrefs_metadata_block_scanner_free(
+		 &metadata_block_scanner,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_metadata_block_scanner_scan_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_metadata_block_scanner_scan_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle                           = NULL;
+	libcerror_error_t *error                                   = NULL;
+	libfsrefs_io_handle_t *io_handle                           = NULL;
+	libfsrefs_metadata_block_scanner_t *metadata_block_scanner = NULL;
+	int number_of_blocks                                       = 0;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	fsrefs_test_metadata_block_scanner_initialize_data();
+
+	result = libfsrefs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->metadata_block_size = 4096;
+	io_handle->volume_size         = 4 * 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsrefs_test_metadata_block_scanner_data1,
+	          4 * 4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_metadata_block_scanner_initialize(
+	          &metadata_block_scanner,
+	          io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+	          metadata_block_scanner,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 2 );
+
+	/* Test scanning a range where the start offset is rounded up to block 2
+	 */
+	number_of_blocks = 0;
+
+	result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+	          metadata_block_scanner,
+	          io_handle,
+	          file_io_handle,
+	          4097,
+	          4096 * 2,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+	          metadata_block_scanner,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+	          metadata_block_scanner,
+	          io_handle,
+	          file_io_handle,
+	          -1,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a volume size that exceeds the data
+	 */
+	io_handle->volume_size = 8 * 4096;
+
+	result = libfsrefs_metadata_block_scanner_scan_file_io_handle(
+	          metadata_block_scanner,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          &fsrefs_test_metadata_block_scanner_count_block,
+	          (intptr_t *) &number_of_blocks,
+	          &error );
+
+	io_handle->volume_size = 4 * 4096;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_metadata_block_scanner_free(
+	          &metadata_block_scanner,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "metadata_block_scanner",
+	 metadata_block_scanner );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_block_scanner != NULL )
+	{
+		libfsrefs_metadata_block_scanner_free(
+		 &metadata_block_scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsrefs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_metadata_block_scanner_initialize",
+	 fsrefs_test_metadata_block_scanner_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_metadata_block_scanner_free",
+	 fsrefs_test_metadata_block_scanner_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_metadata_block_scanner_scan_data",
+	 fsrefs_test_metadata_block_scanner_scan_data );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_metadata_block_scanner_scan_file_io_handle",
+	 fsrefs_test_metadata_block_scanner_scan_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
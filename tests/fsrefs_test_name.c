@@ -0,0 +1,480 @@
+/*
+ * Library name functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_name.h"
+
+/* "$MFT.dat" in UTF-16 little-endian
+ */
+uint8_t fsrefs_test_name_ascii_utf16_stream[ 16 ] = {
+	0x24, 0x00, 0x4d, 0x00, 0x46, 0x00, 0x54, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00 };
+
+/* "caf" followed by U+00e9 in UTF-16 little-endian
+ */
+uint8_t fsrefs_test_name_non_ascii_utf16_stream[ 8 ] = {
+	0x63, 0x00, 0x61, 0x00, 0x66, 0x00, 0xe9, 0x00 };
+
+/* "ab\0cdefg" in UTF-16 little-endian
+ */
+uint8_t fsrefs_test_name_embedded_zero_utf16_stream[ 16 ] = {
+	0x61, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_name_utf16_stream_is_ascii function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_name_utf16_stream_is_ascii(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a size that is not a multiple of 8
+	 */
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_ascii_utf16_stream,
+	          14,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_non_ascii_utf16_stream,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_non_ascii_utf16_stream,
+	          6,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_embedded_zero_utf16_stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_ascii_utf16_stream,
+	          15,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          NULL,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_name_utf16_stream_is_ascii(
+	          fsrefs_test_name_ascii_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_name_get_utf8_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_name_get_utf8_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_name_get_utf8_string_size_from_utf16_stream(
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_name_get_utf8_string_size_from_utf16_stream(
+	          fsrefs_test_name_non_ascii_utf16_stream,
+	          8,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_name_get_utf8_string_size_from_utf16_stream(
+	          NULL,
+	          16,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_name_get_utf8_string_size_from_utf16_stream(
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_name_copy_utf8_string_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_name_copy_utf8_string_from_utf16_stream(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	uint8_t expected_ascii_utf8_string[ 9 ] = {
+		'$', 'M', 'F', 'T', '.', 'd', 'a', 't', 0 };
+
+	uint8_t expected_non_ascii_utf8_string[ 6 ] = {
+		'c', 'a', 'f', 0xc3, 0xa9, 0 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_name_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          16,
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_ascii_utf8_string,
+	          9 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_name_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          16,
+	          fsrefs_test_name_non_ascii_utf16_stream,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_non_ascii_utf8_string,
+	          6 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_name_copy_utf8_string_from_utf16_stream(
+	          NULL,
+	          16,
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_name_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_name_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          8,
+	          fsrefs_test_name_ascii_utf16_stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_name_utf16_stream_is_ascii",
+	 fsrefs_test_name_utf16_stream_is_ascii );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_name_get_utf8_string_size_from_utf16_stream",
+	 fsrefs_test_name_get_utf8_string_size_from_utf16_stream );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_name_copy_utf8_string_from_utf16_stream",
+	 fsrefs_test_name_copy_utf8_string_from_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,811 @@
+/*
+ * Library open_request type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_open_request.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Ignores the result passed by an open request
+ */
+void fsrefs_test_open_request_callback(
+      libfsrefs_volume_t *volume FSREFS_TEST_ATTRIBUTE_UNUSED,
+      int result FSREFS_TEST_ATTRIBUTE_UNUSED,
+      libcerror_error_t *error FSREFS_TEST_ATTRIBUTE_UNUSED,
+      intptr_t *user_data FSREFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( volume )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( result )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( error )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( user_data )
+}
+
+/* Tests the libfsrefs_open_request_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_open_request_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_open_request_t *open_request = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_open_request_free(
+	          &open_request,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_open_request_initialize(
+	          NULL,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	open_request = (libfsrefs_open_request_t *) 0x12345678UL;
+
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	open_request = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          NULL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_open_request_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_open_request_initialize(
+		          &open_request,
+		          (libfsrefs_volume_t *) 0x12345678UL,
+		          LIBFSREFS_OPEN_READ,
+		          &fsrefs_test_open_request_callback,
+		          NULL,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( open_request != NULL )
+			{
+				libfsrefs_open_request_free(
+				 &open_request,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "open_request",
+			 open_request );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_open_request_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_open_request_initialize(
+		          &open_request,
+		          (libfsrefs_volume_t *) 0x12345678UL,
+		          LIBFSREFS_OPEN_READ,
+		          &fsrefs_test_open_request_callback,
+		          NULL,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( open_request != NULL )
+			{
+				libfsrefs_open_request_free(
+				 &open_request,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "open_request",
+			 open_request );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( open_request != NULL )
+	{
+		libfsrefs_open_request_free(
+		 &open_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_open_request_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_open_request_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_open_request_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_open_request_set_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_open_request_set_filename(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_open_request_t *open_request = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_open_request_set_filename(
+	          open_request,
+	          "volume.raw",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_open_request_set_filename(
+	          open_request,
+	          "volume.raw",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_set_filename(
+	          NULL,
+	          "volume.raw",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_set_filename(
+	          open_request,
+	          NULL,
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_set_filename(
+	          open_request,
+	          "volume.raw",
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_open_request_free(
+	          &open_request,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( open_request != NULL )
+	{
+		libfsrefs_open_request_free(
+		 &open_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libfsrefs_open_request_set_filename_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_open_request_set_filename_wide(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_open_request_t *open_request = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_open_request_set_filename_wide(
+	          open_request,
+	          L"volume.raw",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_open_request_set_filename_wide(
+	          open_request,
+	          L"volume.raw",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_set_filename_wide(
+	          NULL,
+	          L"volume.raw",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_set_filename_wide(
+	          open_request,
+	          NULL,
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_open_request_free(
+	          &open_request,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( open_request != NULL )
+	{
+		libfsrefs_open_request_free(
+		 &open_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libfsrefs_open_request_process function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_open_request_process(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_open_request_t *open_request = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_open_request_initialize(
+	          &open_request,
+	          (libfsrefs_volume_t *) 0x12345678UL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_open_request_callback,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_open_request_process(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_open_request_process(
+	          open_request,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_open_request_free(
+	          &open_request,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "open_request",
+	 open_request );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( open_request != NULL )
+	{
+		libfsrefs_open_request_free(
+		 &open_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_open_request_initialize",
+	 fsrefs_test_open_request_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_open_request_free",
+	 fsrefs_test_open_request_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_open_request_set_filename",
+	 fsrefs_test_open_request_set_filename );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_open_request_set_filename_wide",
+	 fsrefs_test_open_request_set_filename_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_open_request_process",
+	 fsrefs_test_open_request_process );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1251 @@
+/*
+ * Library parent_index type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_parent_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_parent_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_parent_index_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_parent_index_t *parent_index = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_parent_index_initialize(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_parent_index_free(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_parent_index_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parent_index = (libfsrefs_parent_index_t *) 0x12345678UL;
+
+	result = libfsrefs_parent_index_initialize(
+	          &parent_index,
+	          &error );
+
+	parent_index = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_parent_index_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_parent_index_initialize(
+		          &parent_index,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( parent_index != NULL )
+			{
+				libfsrefs_parent_index_free(
+				 &parent_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "parent_index",
+			 parent_index );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_parent_index_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_parent_index_initialize(
+		          &parent_index,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( parent_index != NULL )
+			{
+				libfsrefs_parent_index_free(
+				 &parent_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "parent_index",
+			 parent_index );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_index != NULL )
+	{
+		libfsrefs_parent_index_free(
+		 &parent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_parent_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_parent_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_parent_index_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_parent_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_parent_index_append_entry(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_parent_index_t *parent_index = NULL;
+	int entry_index                        = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_parent_index_initialize(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 1000;
+	     entry_index++ )
+	{
+		result = libfsrefs_parent_index_append_entry(
+		          parent_index,
+		          (uint64_t) 0x00000700UL + entry_index,
+		          0x00000600UL,
+		          (uint8_t *) "directory",
+		          10,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "parent_index->number_of_entries",
+	 parent_index->number_of_entries,
+	 1000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "parent_index->names_data_size",
+	 parent_index->names_data_size,
+	 (size_t) 9000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "parent_index->entries[ 999 ].name_offset",
+	 parent_index->entries[ 999 ].name_offset,
+	 (uint32_t) 8991 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "parent_index->entries[ 999 ].name_size",
+	 parent_index->entries[ 999 ].name_size,
+	 (uint32_t) 9 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "parent_index->is_sorted",
+	 parent_index->is_sorted,
+	 1 );
+
+	result = libfsrefs_parent_index_append_entry(
+	          parent_index,
+	          0x00000680UL,
+	          0x00000600UL,
+	          (uint8_t *) "unsorted",
+	          9,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "parent_index->is_sorted",
+	 parent_index->is_sorted,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_parent_index_append_entry(
+	          NULL,
+	          0x00000700UL,
+	          0x00000600UL,
+	          (uint8_t *) "directory",
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_append_entry(
+	          parent_index,
+	          0x00000700UL,
+	          0x00000600UL,
+	          NULL,
+	          10,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_append_entry(
+	          parent_index,
+	          0x00000700UL,
+	          0x00000600UL,
+	          (uint8_t *) "directory",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_parent_index_free(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_index != NULL )
+	{
+		libfsrefs_parent_index_free(
+		 &parent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates a parent index with test entries
+ * The entries are appended out of order
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_parent_index_create_test_index(
+     libfsrefs_parent_index_t **parent_index,
+     libcerror_error_t **error )
+{
+	if( libfsrefs_parent_index_initialize(
+	     parent_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsrefs_parent_index_append_entry(
+	     *parent_index,
+	     0x00000701UL,
+	     0x00000700UL,
+	     (uint8_t *) "sub",
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_parent_index_append_entry(
+	     *parent_index,
+	     0x00000700UL,
+	     0x00000600UL,
+	     (uint8_t *) "directory",
+	     10,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_parent_index_append_entry(
+	     *parent_index,
+	     0x00000702UL,
+	     0x00000600UL,
+	     (uint8_t *) "other",
+	     6,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Entries that reference each other as parent
+	 */
+	if( libfsrefs_parent_index_append_entry(
+	     *parent_index,
+	     0x00000801UL,
+	     0x00000800UL,
+	     (uint8_t *) "loop1",
+	     6,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_parent_index_append_entry(
+	     *parent_index,
+	     0x00000800UL,
+	     0x00000801UL,
+	     (uint8_t *) "loop2",
+	     6,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_parent_index_sort(
+	     *parent_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfsrefs_parent_index_free(
+	 parent_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfsrefs_parent_index_get_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_parent_index_get_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_parent_index_entry_t *entry  = NULL;
+	libfsrefs_parent_index_t *parent_index = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_parent_index_create_test_index(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_parent_index_get_entry_by_identifier(
+	          parent_index,
+	          0x00000701UL,
+	          &entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "entry->parent_object_identifier",
+	 entry->parent_object_identifier,
+	 (uint64_t) 0x00000700UL );
+
+	result = libfsrefs_parent_index_get_entry_by_identifier(
+	          parent_index,
+	          0x00000703UL,
+	          &entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_parent_index_get_entry_by_identifier(
+	          NULL,
+	          0x00000701UL,
+	          &entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_get_entry_by_identifier(
+	          parent_index,
+	          0x00000701UL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parent_index->is_sorted = 0;
+
+	result = libfsrefs_parent_index_get_entry_by_identifier(
+	          parent_index,
+	          0x00000701UL,
+	          &entry,
+	          &error );
+
+	parent_index->is_sorted = 1;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_parent_index_free(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_index != NULL )
+	{
+		libfsrefs_parent_index_free(
+		 &parent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_parent_index_get_utf8_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_parent_index_get_utf8_path_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_parent_index_t *parent_index = NULL;
+	size_t utf8_string_size                = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_parent_index_create_test_index(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          0x00000600UL,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 15 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          0x00000701UL,
+	          (uint8_t *) "file.txt",
+	          9,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 24 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          0x00000703UL,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          NULL,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with entries that reference each other as parent
+	 */
+	result = libfsrefs_parent_index_get_utf8_path_size(
+	          parent_index,
+	          0x00000800UL,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_parent_index_free(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_index != NULL )
+	{
+		libfsrefs_parent_index_free(
+		 &parent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_parent_index_get_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_parent_index_get_utf8_path(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error               = NULL;
+	libfsrefs_parent_index_t *parent_index = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_parent_index_create_test_index(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000600UL,
+	          NULL,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\",
+	          2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000600UL,
+	          (uint8_t *) "file.txt",
+	          9,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\file.txt",
+	          10 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000701UL,
+	          (uint8_t *) "file.txt",
+	          9,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\directory\\sub\\file.txt",
+	          24 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000703UL,
+	          NULL,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_parent_index_get_utf8_path(
+	          NULL,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          NULL,
+	          64,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_parent_index_get_utf8_path(
+	          parent_index,
+	          0x00000701UL,
+	          NULL,
+	          0,
+	          utf8_string,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_parent_index_free(
+	          &parent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "parent_index",
+	 parent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_index != NULL )
+	{
+		libfsrefs_parent_index_free(
+		 &parent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_parent_index_initialize",
+	 fsrefs_test_parent_index_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_parent_index_free",
+	 fsrefs_test_parent_index_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_parent_index_append_entry",
+	 fsrefs_test_parent_index_append_entry );
+
+	/* TODO add tests for libfsrefs_parent_index_get_entry_by_index */
+
+	/* TODO add tests for libfsrefs_parent_index_sort */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_parent_index_get_entry_by_identifier",
+	 fsrefs_test_parent_index_get_entry_by_identifier );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_parent_index_get_utf8_path_size",
+	 fsrefs_test_parent_index_get_utf8_path_size );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_parent_index_get_utf8_path",
+	 fsrefs_test_parent_index_get_utf8_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
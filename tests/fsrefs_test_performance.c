@@ -0,0 +1,1595 @@
+/*
+ * Micro benchmarks of the library hot paths for performance regression testing
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_functions.h"
+#include "fsrefs_test_getopt.h"
+#include "fsrefs_test_image_generator.h"
+#include "fsrefs_test_libbfio.h"
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+
+#include "../libfsrefs/libfsrefs_io_handle.h"
+#include "../libfsrefs/libfsrefs_ministore_node.h"
+#include "../libfsrefs/libfsrefs_node_record.h"
+#include "../libfsrefs/libfsrefs_statistics.h"
+
+/* The calibration workload is the same as that of fsrefsbench
+ */
+#define FSREFS_TEST_PERFORMANCE_CALIBRATION_DATA_SIZE			65536
+#define FSREFS_TEST_PERFORMANCE_NUMBER_OF_CALIBRATION_OPERATIONS	2000
+
+#define FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE				16384
+#define FSREFS_TEST_PERFORMANCE_NUMBER_OF_NODE_RECORDS			128
+#define FSREFS_TEST_PERFORMANCE_FIRST_OBJECT_IDENTIFIER			0x00000600UL
+
+#define FSREFS_TEST_PERFORMANCE_NUMBER_OF_FILES				512
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+typedef struct fsrefs_test_performance_context fsrefs_test_performance_context_t;
+
+struct fsrefs_test_performance_context
+{
+	/* The IO handle
+	 */
+	libfsrefs_io_handle_t *io_handle;
+
+	/* The ministore node data
+	 */
+	uint8_t *node_data;
+
+	/* The ministore node
+	 */
+	libfsrefs_ministore_node_t *ministore_node;
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+	/* The image data
+	 */
+	uint8_t *image_data;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The volume
+	 */
+	libfsrefs_volume_t *volume;
+
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+	/* The random number generator state
+	 */
+	uint64_t random_state;
+};
+
+typedef struct fsrefs_test_performance_result fsrefs_test_performance_result_t;
+
+struct fsrefs_test_performance_result
+{
+	/* The number of operations
+	 */
+	uint64_t number_of_operations;
+
+	/* The duration in nano seconds
+	 */
+	uint64_t duration;
+
+	/* The number of allocations reported by the library statistics
+	 */
+	uint64_t number_of_allocations;
+};
+
+typedef struct fsrefs_test_performance_benchmark fsrefs_test_performance_benchmark_t;
+
+struct fsrefs_test_performance_benchmark
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The benchmark function
+	 */
+	int (*function)(
+	       fsrefs_test_performance_context_t *context,
+	       uint64_t number_of_operations,
+	       fsrefs_test_performance_result_t *result,
+	       libcerror_error_t **error );
+
+	/* The number of operations per repetition
+	 */
+	uint64_t number_of_operations;
+};
+
+int fsrefs_test_performance_ministore_parse(
+     fsrefs_test_performance_context_t *context,
+     uint64_t number_of_operations,
+     fsrefs_test_performance_result_t *result,
+     libcerror_error_t **error );
+
+int fsrefs_test_performance_key_lookup(
+     fsrefs_test_performance_context_t *context,
+     uint64_t number_of_operations,
+     fsrefs_test_performance_result_t *result,
+     libcerror_error_t **error );
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+
+int fsrefs_test_performance_directory_enumeration(
+     fsrefs_test_performance_context_t *context,
+     uint64_t number_of_operations,
+     fsrefs_test_performance_result_t *result,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+fsrefs_test_performance_benchmark_t fsrefs_test_performance_benchmarks[] = {
+	{ "ministore_parse", &fsrefs_test_performance_ministore_parse, 20000 },
+	{ "key_lookup", &fsrefs_test_performance_key_lookup, 200000 },
+#if defined( LIBFSREFS_HAVE_BFIO )
+	{ "directory_enumeration", &fsrefs_test_performance_directory_enumeration, 200 },
+#endif
+	{ NULL, NULL, 0 } };
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* Prints usage information
+ */
+void fsrefs_test_performance_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsrefs_test_performance to run micro benchmarks of the library hot paths.\n\n" );
+
+	fprintf( stream, "Usage: fsrefs_test_performance [ -r repetitions ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-r:     number of repetitions of every benchmark, of which the fastest\n"
+	                 "\t        is reported, default is 5\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "Per benchmark a line is written to stdout with the name, the normalized\n"
+	                 "number of operations per second and the number of allocations per\n"
+	                 "operation.\n" );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Retrieves the next value of a xorshift random number generator
+ */
+uint64_t fsrefs_test_performance_get_random(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Retrieves the number of allocations of all node types from statistics
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_get_number_of_allocations(
+     libfsrefs_statistics_t *statistics,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_performance_get_number_of_allocations";
+	uint64_t value        = 0;
+	int node_type         = 0;
+
+	if( number_of_allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_allocations = 0;
+
+	for( node_type = LIBFSREFS_NODE_TYPE_UNKNOWN;
+	     node_type <= LIBFSREFS_NODE_TYPE_DATA;
+	     node_type++ )
+	{
+		if( libfsrefs_statistics_get_value(
+		     statistics,
+		     node_type,
+		     LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of allocations of node type: %d.",
+			 function,
+			 node_type );
+
+			return( -1 );
+		}
+		*number_of_allocations += value;
+	}
+	return( 1 );
+}
+
+/* Determines the number of calibration operations per second
+ * The fastest of the repetitions is used
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_calibrate(
+     int number_of_repetitions,
+     double *calibration_operations_per_second,
+     libcerror_error_t **error )
+{
+	uint8_t *data                = NULL;
+	static char *function        = "fsrefs_test_performance_calibrate";
+	volatile uint32_t hash_value = 0;
+	uint64_t duration            = 0;
+	uint64_t minimum_duration    = 0;
+	uint64_t start_timestamp     = 0;
+	size_t data_index            = 0;
+	int operation_index          = 0;
+	int repetition               = 0;
+
+	if( calibration_operations_per_second == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calibration operations per second.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * FSREFS_TEST_PERFORMANCE_CALIBRATION_DATA_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_index = 0;
+	     data_index < FSREFS_TEST_PERFORMANCE_CALIBRATION_DATA_SIZE;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index * 31 );
+	}
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		start_timestamp = libfsrefs_statistics_get_timestamp();
+
+		for( operation_index = 0;
+		     operation_index < FSREFS_TEST_PERFORMANCE_NUMBER_OF_CALIBRATION_OPERATIONS;
+		     operation_index++ )
+		{
+			hash_value = 0x811c9dc5UL ^ (uint32_t) operation_index;
+
+			for( data_index = 0;
+			     data_index < FSREFS_TEST_PERFORMANCE_CALIBRATION_DATA_SIZE;
+			     data_index++ )
+			{
+				hash_value = ( hash_value ^ data[ data_index ] ) * 0x01000193UL;
+			}
+		}
+		duration = libfsrefs_statistics_get_timestamp() - start_timestamp;
+
+		if( ( repetition == 0 )
+		 || ( duration < minimum_duration ) )
+		{
+			minimum_duration = duration;
+		}
+	}
+	memory_free(
+	 data );
+
+	if( minimum_duration == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported timestamp resolution.",
+		 function );
+
+		return( -1 );
+	}
+	*calibration_operations_per_second = ( (double) FSREFS_TEST_PERFORMANCE_NUMBER_OF_CALIBRATION_OPERATIONS * 1000000000.0 ) / (double) minimum_duration;
+
+	return( 1 );
+}
+
+/* Creates the ministore node data
+ * The node resembles an objects tree leaf node with 16-byte keys that contain
+ * consecutive object identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_create_node_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 16 ];
+	uint8_t value_data[ 32 ];
+
+	fsrefs_test_image_node_t *node = NULL;
+	static char *function          = "fsrefs_test_performance_create_node_data";
+	int record_index               = 0;
+	int result                     = 0;
+
+	if( memory_set(
+	     key_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     value_data,
+	     0,
+	     32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear value data.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_node_initialize(
+	     &node,
+	     FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE / 2,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < FSREFS_TEST_PERFORMANCE_NUMBER_OF_NODE_RECORDS;
+	     record_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( key_data[ 8 ] ),
+		 FSREFS_TEST_PERFORMANCE_FIRST_OBJECT_IDENTIFIER + (uint64_t) record_index );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 value_data,
+		 (uint64_t) record_index );
+
+		result = fsrefs_test_image_node_append_record(
+		          node,
+		          key_data,
+		          16,
+		          0,
+		          value_data,
+		          32,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to node.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	if( fsrefs_test_image_node_copy_to_data(
+	     node,
+	     3,
+	     0,
+	     0,
+	     NULL,
+	     0,
+	     1,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy node to data.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_node_free(
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		fsrefs_test_image_node_free(
+		 &node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Initializes the benchmark context
+ * The context is freed on error
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_context_initialize(
+     fsrefs_test_performance_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_performance_context_initialize";
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	size_t image_data_size                         = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     context,
+	     0,
+	     sizeof( fsrefs_test_performance_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+	context->random_state = 0x9e3779b97f4a7c15ULL;
+
+	if( libfsrefs_io_handle_initialize(
+	     &( context->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	context->io_handle->metadata_block_size = FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE;
+
+	if( libfsrefs_io_handle_set_format_version(
+	     context->io_handle,
+	     3,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format version.",
+		 function );
+
+		goto on_error;
+	}
+	context->node_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE );
+
+	if( context->node_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node data.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_performance_create_node_data(
+	     context->node_data,
+	     FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_ministore_node_initialize(
+	     &( context->ministore_node ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create ministore node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_ministore_node_read_data(
+	     context->ministore_node,
+	     context->io_handle,
+	     context->node_data,
+	     FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE,
+	     LIBFSREFS_NODE_TYPE_OBJECTS_TREE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ministore node.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBFSREFS_HAVE_BFIO )
+	/* The directory enumeration uses a single directory with resident file data
+	 */
+	if( fsrefs_test_image_generator_initialize(
+	     &image_generator,
+	     3,
+	     65536,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create image generator.",
+		 function );
+
+		goto on_error;
+	}
+	image_generator->directory_depth           = 0;
+	image_generator->number_of_sub_directories = 0;
+	image_generator->number_of_files           = FSREFS_TEST_PERFORMANCE_NUMBER_OF_FILES;
+	image_generator->number_of_data_runs       = 0;
+
+	if( fsrefs_test_image_generator_write_to_memory(
+	     image_generator,
+	     &( context->image_data ),
+	     &image_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_image_generator_free(
+	     &image_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free image generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsrefs_test_open_file_io_handle(
+	     &( context->file_io_handle ),
+	     context->image_data,
+	     image_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_initialize(
+	     &( context->volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsrefs_volume_open_file_io_handle(
+	     context->volume,
+	     context->file_io_handle,
+	     LIBFSREFS_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+	return( 1 );
+
+on_error:
+#if defined( LIBFSREFS_HAVE_BFIO )
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+#endif
+	fsrefs_test_performance_context_free(
+	 context,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the benchmark context
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_context_free(
+     fsrefs_test_performance_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "fsrefs_test_performance_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFSREFS_HAVE_BFIO )
+	if( context->volume != NULL )
+	{
+		if( libfsrefs_volume_free(
+		     &( context->volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( context->file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( context->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( context->image_data != NULL )
+	{
+		memory_free(
+		 context->image_data );
+
+		context->image_data = NULL;
+	}
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+	if( context->ministore_node != NULL )
+	{
+		if( libfsrefs_ministore_node_free(
+		     &( context->ministore_node ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ministore node.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( context->node_data != NULL )
+	{
+		memory_free(
+		 context->node_data );
+
+		context->node_data = NULL;
+	}
+	if( context->io_handle != NULL )
+	{
+		if( libfsrefs_io_handle_free(
+		     &( context->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Benchmarks parsing a ministore node
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_ministore_parse(
+     fsrefs_test_performance_context_t *context,
+     uint64_t number_of_operations,
+     fsrefs_test_performance_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsrefs_ministore_node_t *ministore_node = NULL;
+	static char *function                      = "fsrefs_test_performance_ministore_parse";
+	uint64_t operation_index                   = 0;
+	uint64_t start_timestamp                   = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_statistics_clear(
+	     &( context->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
+	for( operation_index = 0;
+	     operation_index < number_of_operations;
+	     operation_index++ )
+	{
+		if( libfsrefs_ministore_node_initialize(
+		     &ministore_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create ministore node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsrefs_ministore_node_read_data(
+		     ministore_node,
+		     context->io_handle,
+		     context->node_data,
+		     FSREFS_TEST_PERFORMANCE_NODE_DATA_SIZE,
+		     LIBFSREFS_NODE_TYPE_OBJECTS_TREE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read ministore node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsrefs_ministore_node_free(
+		     &ministore_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ministore node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result->duration             = libfsrefs_statistics_get_timestamp() - start_timestamp;
+	result->number_of_operations = number_of_operations;
+
+	if( fsrefs_test_performance_get_number_of_allocations(
+	     &( context->io_handle->statistics ),
+	     &( result->number_of_allocations ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ministore_node != NULL )
+	{
+		libfsrefs_ministore_node_free(
+		 &ministore_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks looking up records in a ministore node by key
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_key_lookup(
+     fsrefs_test_performance_context_t *context,
+     uint64_t number_of_operations,
+     fsrefs_test_performance_result_t *result,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 16 ];
+
+	libfsrefs_node_record_t *node_record = NULL;
+	static char *function                = "fsrefs_test_performance_key_lookup";
+	uint64_t object_identifier           = 0;
+	uint64_t operation_index             = 0;
+	uint64_t start_timestamp             = 0;
+	int lookup_result                    = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     key_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_statistics_clear(
+	     &( context->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
+	for( operation_index = 0;
+	     operation_index < number_of_operations;
+	     operation_index++ )
+	{
+		object_identifier = FSREFS_TEST_PERFORMANCE_FIRST_OBJECT_IDENTIFIER
+		                  + ( fsrefs_test_performance_get_random(
+		                       &( context->random_state ) ) % FSREFS_TEST_PERFORMANCE_NUMBER_OF_NODE_RECORDS );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( key_data[ 8 ] ),
+		 object_identifier );
+
+		lookup_result = libfsrefs_ministore_node_get_record_by_key(
+		                 context->ministore_node,
+		                 key_data,
+		                 16,
+		                 &node_record,
+		                 error );
+
+		if( lookup_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record of object identifier: 0x%08" PRIx64 ".",
+			 function,
+			 object_identifier );
+
+			return( -1 );
+		}
+	}
+	result->duration             = libfsrefs_statistics_get_timestamp() - start_timestamp;
+	result->number_of_operations = number_of_operations;
+
+	if( fsrefs_test_performance_get_number_of_allocations(
+	     &( context->io_handle->statistics ),
+	     &( result->number_of_allocations ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+
+/* Benchmarks enumerating the sub file entries of a directory
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_directory_enumeration(
+     fsrefs_test_performance_context_t *context,
+     uint64_t number_of_operations,
+     fsrefs_test_performance_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsrefs_file_entry_t *root_directory = NULL;
+	libfsrefs_file_entry_t *sub_file_entry = NULL;
+	static char *function                  = "fsrefs_test_performance_directory_enumeration";
+	uint64_t operation_index               = 0;
+	uint64_t start_timestamp               = 0;
+	uint64_t value                         = 0;
+	int node_type                          = 0;
+	int number_of_sub_file_entries         = 0;
+	int sub_file_entry_index               = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsrefs_volume_clear_statistics(
+	     context->volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+	start_timestamp = libfsrefs_statistics_get_timestamp();
+
+	for( operation_index = 0;
+	     operation_index < number_of_operations;
+	     operation_index++ )
+	{
+		if( libfsrefs_volume_get_root_directory(
+		     context->volume,
+		     &root_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsrefs_file_entry_get_number_of_sub_file_entries(
+		     root_directory,
+		     &number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub file entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_sub_file_entries != FSREFS_TEST_PERFORMANCE_NUMBER_OF_FILES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unexpected number of sub file entries: %d.",
+			 function,
+			 number_of_sub_file_entries );
+
+			goto on_error;
+		}
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < number_of_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			if( libfsrefs_file_entry_get_sub_file_entry_by_index(
+			     root_directory,
+			     sub_file_entry_index,
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			if( libfsrefs_file_entry_free(
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+		}
+		if( libfsrefs_file_entry_free(
+		     &root_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result->duration              = libfsrefs_statistics_get_timestamp() - start_timestamp;
+	result->number_of_operations  = number_of_operations;
+	result->number_of_allocations = 0;
+
+	for( node_type = LIBFSREFS_NODE_TYPE_UNKNOWN;
+	     node_type <= LIBFSREFS_NODE_TYPE_DATA;
+	     node_type++ )
+	{
+		if( libfsrefs_volume_get_statistics(
+		     context->volume,
+		     node_type,
+		     LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of allocations of node type: %d.",
+			 function,
+			 node_type );
+
+			goto on_error;
+		}
+		result->number_of_allocations += value;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+/* Runs a benchmark and prints the fastest of the repetitions
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_performance_run_benchmark(
+     fsrefs_test_performance_context_t *context,
+     fsrefs_test_performance_benchmark_t *benchmark,
+     int number_of_repetitions,
+     double calibration_operations_per_second,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	fsrefs_test_performance_result_t fastest_result;
+	fsrefs_test_performance_result_t result;
+
+	static char *function                    = "fsrefs_test_performance_run_benchmark";
+	double allocations_per_operation         = 0.0;
+	double normalized_operations_per_second  = 0.0;
+	double operations_per_second             = 0.0;
+	int repetition                           = 0;
+
+	if( benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_repetitions <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of repetitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( calibration_operations_per_second <= 0.0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid calibration operations per second value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &fastest_result,
+	     0,
+	     sizeof( fsrefs_test_performance_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear fastest result.",
+		 function );
+
+		return( -1 );
+	}
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		if( memory_set(
+		     &result,
+		     0,
+		     sizeof( fsrefs_test_performance_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear result.",
+			 function );
+
+			return( -1 );
+		}
+		if( benchmark->function(
+		     context,
+		     benchmark->number_of_operations,
+		     &result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run benchmark: %s.",
+			 function,
+			 benchmark->name );
+
+			return( -1 );
+		}
+		if( ( repetition == 0 )
+		 || ( result.duration < fastest_result.duration ) )
+		{
+			fastest_result = result;
+		}
+	}
+	if( ( fastest_result.number_of_operations == 0 )
+	 || ( fastest_result.duration == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid benchmark: %s result value out of bounds.",
+		 function,
+		 benchmark->name );
+
+		return( -1 );
+	}
+	operations_per_second            = ( (double) fastest_result.number_of_operations * 1000000000.0 ) / (double) fastest_result.duration;
+	normalized_operations_per_second = operations_per_second / calibration_operations_per_second;
+	allocations_per_operation        = (double) fastest_result.number_of_allocations / (double) fastest_result.number_of_operations;
+
+	fprintf(
+	 stream,
+	 "%s\t%.6f\t%.3f\n",
+	 benchmark->name,
+	 normalized_operations_per_second,
+	 allocations_per_operation );
+
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+	fsrefs_test_performance_context_t context;
+
+	libcerror_error_t *error                   = NULL;
+	system_character_t *option_repetitions     = NULL;
+	double calibration_operations_per_second   = 0.0;
+	size_t string_length                       = 0;
+	uint64_t value_64bit                       = 0;
+	int benchmark_index                        = 0;
+	int context_is_initialized                 = 0;
+	int number_of_repetitions                  = 5;
+#endif
+	system_integer_t option                    = 0;
+
+	while( ( option = fsrefs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hr:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				fsrefs_test_performance_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				fsrefs_test_performance_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'r':
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+				option_repetitions = optarg;
+#endif
+				break;
+		}
+	}
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+	if( option_repetitions != NULL )
+	{
+		string_length = system_string_length(
+		                 option_repetitions );
+
+		if( ( fsrefs_test_system_string_copy_from_64_bit_in_decimal(
+		       option_repetitions,
+		       string_length + 1,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of repetitions.\n" );
+
+			goto on_error;
+		}
+		number_of_repetitions = (int) value_64bit;
+	}
+	if( fsrefs_test_performance_calibrate(
+	     number_of_repetitions,
+	     &calibration_operations_per_second,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to calibrate.\n" );
+
+		goto on_error;
+	}
+	if( fsrefs_test_performance_context_initialize(
+	     &context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize context.\n" );
+
+		goto on_error;
+	}
+	context_is_initialized = 1;
+
+	for( benchmark_index = 0;
+	     fsrefs_test_performance_benchmarks[ benchmark_index ].name != NULL;
+	     benchmark_index++ )
+	{
+		if( fsrefs_test_performance_run_benchmark(
+		     &context,
+		     &( fsrefs_test_performance_benchmarks[ benchmark_index ] ),
+		     number_of_repetitions,
+		     calibration_operations_per_second,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s.\n",
+			 fsrefs_test_performance_benchmarks[ benchmark_index ].name );
+
+			goto on_error;
+		}
+	}
+	context_is_initialized = 0;
+
+	if( fsrefs_test_performance_context_free(
+	     &context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free context.\n" );
+
+		goto on_error;
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( context_is_initialized != 0 )
+	{
+		fsrefs_test_performance_context_free(
+		 &context,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
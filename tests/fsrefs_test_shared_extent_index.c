@@ -0,0 +1,1237 @@
+/*
+ * Library shared_extent_index type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_extent_scheduler.h"
+#include "../libfsrefs/libfsrefs_shared_extent_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_shared_extent_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_shared_extent_index_initialize(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	int result                                           = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                      = 2;
+	int number_of_memset_fail_tests                      = 2;
+	int test_number                                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_shared_extent_index_initialize(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_shared_extent_index_free(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_shared_extent_index_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	shared_extent_index = (libfsrefs_shared_extent_index_t *) 0x12345678UL;
+
+	result = libfsrefs_shared_extent_index_initialize(
+	          &shared_extent_index,
+	          &error );
+
+	shared_extent_index = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_shared_extent_index_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_shared_extent_index_initialize(
+		          &shared_extent_index,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( shared_extent_index != NULL )
+			{
+				libfsrefs_shared_extent_index_free(
+				 &shared_extent_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "shared_extent_index",
+			 shared_extent_index );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_shared_extent_index_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_shared_extent_index_initialize(
+		          &shared_extent_index,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( shared_extent_index != NULL )
+			{
+				libfsrefs_shared_extent_index_free(
+				 &shared_extent_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "shared_extent_index",
+			 shared_extent_index );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_extent_index != NULL )
+	{
+		libfsrefs_shared_extent_index_free(
+		 &shared_extent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_shared_extent_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_shared_extent_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_shared_extent_index_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_shared_extent_index_append_file function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_shared_extent_index_append_file(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	int file_index                                       = 0;
+	int result                                           = 0;
+	int test_index                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_shared_extent_index_initialize(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 1000;
+	     test_index++ )
+	{
+		result = libfsrefs_shared_extent_index_append_file(
+		          shared_extent_index,
+		          0x00000600UL,
+		          (uint8_t *) "file.txt",
+		          9,
+		          &file_index,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "file_index",
+		 file_index,
+		 test_index );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->number_of_files",
+	 shared_extent_index->number_of_files,
+	 1000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "shared_extent_index->names_data_size",
+	 shared_extent_index->names_data_size,
+	 (size_t) 8000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "shared_extent_index->files[ 999 ].name_offset",
+	 shared_extent_index->files[ 999 ].name_offset,
+	 (uint32_t) 7992 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "shared_extent_index->files[ 999 ].name_size",
+	 shared_extent_index->files[ 999 ].name_size,
+	 (uint32_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_shared_extent_index_append_file(
+	          NULL,
+	          0x00000600UL,
+	          (uint8_t *) "file.txt",
+	          9,
+	          &file_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_append_file(
+	          shared_extent_index,
+	          0x00000600UL,
+	          NULL,
+	          9,
+	          &file_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_append_file(
+	          shared_extent_index,
+	          0x00000600UL,
+	          (uint8_t *) "file.txt",
+	          9,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_shared_extent_index_free(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_extent_index != NULL )
+	{
+		libfsrefs_shared_extent_index_free(
+		 &shared_extent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates a finalized shared extent index for testing
+ * The index contains 3 files and 2 shared extents:
+ *   0x10000 - 0x13000 referenced by file 0 and 1, which overlap partially
+ *   0x30000 - 0x31000 referenced by file 0 and 2
+ * and the unshared extents 0x20000 - 0x21000 and 0x31000 - 0x32000, where the
+ * latter is adjacent to, but does not overlap with, the second shared extent
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_shared_extent_index_create_test_index(
+     libfsrefs_shared_extent_index_t **shared_extent_index,
+     libcerror_error_t **error )
+{
+	int file_index = 0;
+
+	if( libfsrefs_shared_extent_index_initialize(
+	     shared_extent_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsrefs_shared_extent_index_append_file(
+	     *shared_extent_index,
+	     0x00000600UL,
+	     (uint8_t *) "original",
+	     9,
+	     &file_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_shared_extent_index_append_file(
+	     *shared_extent_index,
+	     0x00000600UL,
+	     (uint8_t *) "clone1",
+	     7,
+	     &file_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_shared_extent_index_append_file(
+	     *shared_extent_index,
+	     0x00000700UL,
+	     (uint8_t *) "clone2",
+	     7,
+	     &file_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_extent_scheduler_append_extent(
+	     ( *shared_extent_index )->references,
+	     0x31000,
+	     0x1000,
+	     0x1000,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_extent_scheduler_append_extent(
+	     ( *shared_extent_index )->references,
+	     0x30000,
+	     0x1000,
+	     0x1000,
+	     2,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_extent_scheduler_append_extent(
+	     ( *shared_extent_index )->references,
+	     0x20000,
+	     0x1000,
+	     0,
+	     2,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_extent_scheduler_append_extent(
+	     ( *shared_extent_index )->references,
+	     0x11000,
+	     0x2000,
+	     0,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_extent_scheduler_append_extent(
+	     ( *shared_extent_index )->references,
+	     0x30000,
+	     0x1000,
+	     0x2000,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_extent_scheduler_append_extent(
+	     ( *shared_extent_index )->references,
+	     0x10000,
+	     0x2000,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_shared_extent_index_finalize(
+	     *shared_extent_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfsrefs_shared_extent_index_free(
+	 shared_extent_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfsrefs_shared_extent_index_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_shared_extent_index_finalize(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	int result                                           = 0;
+
+	/* Test regular cases
+	 */
+	result = fsrefs_test_shared_extent_index_create_test_index(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->number_of_shared_extents",
+	 shared_extent_index->number_of_shared_extents,
+	 2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "shared_extent_index->shared_extents[ 0 ].physical_offset",
+	 (int64_t) shared_extent_index->shared_extents[ 0 ].physical_offset,
+	 (int64_t) 0x10000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "shared_extent_index->shared_extents[ 0 ].size",
+	 (uint64_t) shared_extent_index->shared_extents[ 0 ].size,
+	 (uint64_t) 0x3000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->shared_extents[ 0 ].first_reference_index",
+	 shared_extent_index->shared_extents[ 0 ].first_reference_index,
+	 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->shared_extents[ 0 ].number_of_references",
+	 shared_extent_index->shared_extents[ 0 ].number_of_references,
+	 2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "shared_extent_index->shared_extents[ 1 ].physical_offset",
+	 (int64_t) shared_extent_index->shared_extents[ 1 ].physical_offset,
+	 (int64_t) 0x30000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "shared_extent_index->shared_extents[ 1 ].size",
+	 (uint64_t) shared_extent_index->shared_extents[ 1 ].size,
+	 (uint64_t) 0x1000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->shared_extents[ 1 ].first_reference_index",
+	 shared_extent_index->shared_extents[ 1 ].first_reference_index,
+	 2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->shared_extents[ 1 ].number_of_references",
+	 shared_extent_index->shared_extents[ 1 ].number_of_references,
+	 2 );
+
+	/* The unshared references are discarded
+	 */
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->references->number_of_extents",
+	 shared_extent_index->references->number_of_extents,
+	 4 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->references->extents[ 2 ].file_entry_index",
+	 shared_extent_index->references->extents[ 2 ].file_entry_index,
+	 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index->references->extents[ 3 ].file_entry_index",
+	 shared_extent_index->references->extents[ 3 ].file_entry_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_shared_extent_index_finalize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test finalize on an index that was already finalized
+	 */
+	result = libfsrefs_shared_extent_index_finalize(
+	          shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_shared_extent_index_free(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_extent_index != NULL )
+	{
+		libfsrefs_shared_extent_index_free(
+		 &shared_extent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_shared_extent_index_get_shared_extent_index_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_shared_extent_index_get_shared_extent_index_by_offset(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	int result                                           = 0;
+	int shared_extent_index_value                        = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_shared_extent_index_create_test_index(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          shared_extent_index,
+	          0x12fff,
+	          &shared_extent_index_value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index_value",
+	 shared_extent_index_value,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          shared_extent_index,
+	          0x30000,
+	          &shared_extent_index_value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "shared_extent_index_value",
+	 shared_extent_index_value,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offsets outside the shared extents
+	 */
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          shared_extent_index,
+	          0x20000,
+	          &shared_extent_index_value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          shared_extent_index,
+	          0x31000,
+	          &shared_extent_index_value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          shared_extent_index,
+	          0,
+	          &shared_extent_index_value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          NULL,
+	          0x10000,
+	          &shared_extent_index_value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_get_shared_extent_index_by_offset(
+	          shared_extent_index,
+	          0x10000,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_shared_extent_index_free(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_extent_index != NULL )
+	{
+		libfsrefs_shared_extent_index_free(
+		 &shared_extent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_shared_extent_index_get_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_shared_extent_index_get_reference(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsrefs_scheduled_extent_t *reference              = NULL;
+	libfsrefs_shared_extent_file_t *file                 = NULL;
+	libfsrefs_shared_extent_index_t *shared_extent_index = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_shared_extent_index_create_test_index(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_shared_extent_index_get_reference(
+	          shared_extent_index,
+	          0,
+	          1,
+	          &reference,
+	          &file,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "reference",
+	 reference );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "reference->physical_offset",
+	 (int64_t) reference->physical_offset,
+	 (int64_t) 0x11000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "reference->size",
+	 (uint64_t) reference->size,
+	 (uint64_t) 0x2000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "file->name_offset",
+	 file->name_offset,
+	 (uint32_t) 8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "file->name_size",
+	 file->name_size,
+	 (uint32_t) 6 );
+
+	result = libfsrefs_shared_extent_index_get_reference(
+	          shared_extent_index,
+	          1,
+	          1,
+	          &reference,
+	          &file,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "reference->data_offset",
+	 (int64_t) reference->data_offset,
+	 (int64_t) 0x1000 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file->parent_object_identifier",
+	 file->parent_object_identifier,
+	 (uint64_t) 0x00000700UL );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_shared_extent_index_get_reference(
+	          NULL,
+	          0,
+	          0,
+	          &reference,
+	          &file,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_get_reference(
+	          shared_extent_index,
+	          2,
+	          0,
+	          &reference,
+	          &file,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_get_reference(
+	          shared_extent_index,
+	          0,
+	          2,
+	          &reference,
+	          &file,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_get_reference(
+	          shared_extent_index,
+	          0,
+	          0,
+	          NULL,
+	          &file,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_shared_extent_index_get_reference(
+	          shared_extent_index,
+	          0,
+	          0,
+	          &reference,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_shared_extent_index_free(
+	          &shared_extent_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "shared_extent_index",
+	 shared_extent_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_extent_index != NULL )
+	{
+		libfsrefs_shared_extent_index_free(
+		 &shared_extent_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_shared_extent_index_initialize",
+	 fsrefs_test_shared_extent_index_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_shared_extent_index_free",
+	 fsrefs_test_shared_extent_index_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_shared_extent_index_append_file",
+	 fsrefs_test_shared_extent_index_append_file );
+
+	/* TODO add tests for libfsrefs_shared_extent_index_append_data_block_stream */
+
+	/* TODO add tests for libfsrefs_shared_extent_index_append_shared_extent */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_shared_extent_index_finalize",
+	 fsrefs_test_shared_extent_index_finalize );
+
+	/* TODO add tests for libfsrefs_shared_extent_index_get_shared_extent_by_index */
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_shared_extent_index_get_shared_extent_index_by_offset",
+	 fsrefs_test_shared_extent_index_get_shared_extent_index_by_offset );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_shared_extent_index_get_reference",
+	 fsrefs_test_shared_extent_index_get_reference );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,443 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+/* Tests the libfsrefs_statistics_add_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_statistics_add_value(
+     void )
+{
+	libfsrefs_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_statistics_clear(
+	          &statistics,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	libfsrefs_statistics_add_value(
+	 &statistics,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	 4096 );
+
+	libfsrefs_statistics_add_value(
+	 &statistics,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	 4096 );
+
+	result = libfsrefs_statistics_get_value(
+	          &statistics,
+	          LIBFSREFS_NODE_TYPE_DIRECTORY,
+	          LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	          &value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 8192 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_statistics_get_value(
+	          &statistics,
+	          LIBFSREFS_NODE_TYPE_OBJECTS_TREE,
+	          LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	          &value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	libfsrefs_statistics_add_value(
+	 NULL,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	 4096 );
+
+	libfsrefs_statistics_add_value(
+	 &statistics,
+	 -1,
+	 LIBFSREFS_STATISTICS_VALUE_BYTES_READ,
+	 4096 );
+
+	libfsrefs_statistics_add_value(
+	 &statistics,
+	 LIBFSREFS_NODE_TYPE_DIRECTORY,
+	 -1,
+	 4096 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_statistics_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_statistics_get_value(
+     void )
+{
+	libfsrefs_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_statistics_clear(
+	          &statistics,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_statistics_get_value(
+	          &statistics,
+	          LIBFSREFS_NODE_TYPE_CONTAINER,
+	          LIBFSREFS_STATISTICS_VALUE_PARSE_TIME,
+	          &value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_statistics_get_value(
+	          NULL,
+	          LIBFSREFS_NODE_TYPE_CONTAINER,
+	          LIBFSREFS_STATISTICS_VALUE_PARSE_TIME,
+	          &value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_statistics_get_value(
+	          &statistics,
+	          -1,
+	          LIBFSREFS_STATISTICS_VALUE_PARSE_TIME,
+	          &value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_statistics_get_value(
+	          &statistics,
+	          LIBFSREFS_NODE_TYPE_CONTAINER,
+	          -1,
+	          &value,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_statistics_get_value(
+	          &statistics,
+	          LIBFSREFS_NODE_TYPE_CONTAINER,
+	          LIBFSREFS_STATISTICS_VALUE_PARSE_TIME,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_statistics_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_statistics_clear(
+     void )
+{
+	libfsrefs_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_statistics_clear(
+	          &statistics,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_statistics_clear(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	/* Test libfsrefs_statistics_clear with memset failing
+	 */
+	fsrefs_test_memset_attempts_before_fail = 0;
+
+	result = libfsrefs_statistics_clear(
+	          &statistics,
+	          &error );
+
+	if( fsrefs_test_memset_attempts_before_fail != -1 )
+	{
+		fsrefs_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSREFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_statistics_get_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_statistics_get_timestamp(
+     void )
+{
+	uint64_t first_timestamp  = 0;
+	uint64_t second_timestamp = 0;
+
+	/* Test regular cases
+	 */
+	first_timestamp  = libfsrefs_statistics_get_timestamp();
+	second_timestamp = libfsrefs_statistics_get_timestamp();
+
+	if( first_timestamp != 0 )
+	{
+		FSREFS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "first_timestamp",
+		 first_timestamp,
+		 second_timestamp + 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_statistics_add_value",
+	 fsrefs_test_statistics_add_value );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_statistics_get_value",
+	 fsrefs_test_statistics_get_value );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_statistics_clear",
+	 fsrefs_test_statistics_clear );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_statistics_get_timestamp",
+	 fsrefs_test_statistics_get_timestamp );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -1584,8 +1584,22 @@ int fsrefs_test_superblock_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_superblock_initialize(
 	          &superblock,
@@ -1773,8 +1787,22 @@ int fsrefs_test_superblock_read_data(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 4096;
-	io_handle->major_format_version = 3;
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libfsrefs_superblock_initialize(
 	          &superblock,
@@ -1897,8 +1925,22 @@ int fsrefs_test_superblock_read_file_io_handle(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 16384;
-	io_handle->major_format_version = 1;
+	io_handle->metadata_block_size = 16384;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          1,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2161,8 +2203,22 @@ int fsrefs_test_superblock_read_file_io_handle(
 	 "io_handle",
 	 io_handle );
 
-	io_handle->metadata_block_size  = 4096;
-	io_handle->major_format_version = 3;
+	io_handle->metadata_block_size = 4096;
+
+	result = libfsrefs_io_handle_set_format_version(
+	          io_handle,
+	          3,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
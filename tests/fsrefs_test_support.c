@@ -199,6 +199,324 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsrefs_get_memory_limit function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_get_memory_limit(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size64_t memory_limit    = 0;
+	int result               = 0;
+
+	result = libfsrefs_get_memory_limit(
+	          &memory_limit,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_get_memory_limit(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_set_memory_limit function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_set_memory_limit(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size64_t memory_limit    = 0;
+	int result               = 0;
+
+	result = libfsrefs_set_memory_limit(
+	          64 * 1024 * 1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_get_memory_limit(
+	          &memory_limit,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_limit",
+	 (uint64_t) memory_limit,
+	 (uint64_t) 64 * 1024 * 1024 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_set_memory_limit(
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_get_memory_usage(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size64_t memory_usage    = 0;
+	int result               = 0;
+
+	result = libfsrefs_get_memory_usage(
+	          &memory_usage,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_get_memory_usage(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_get_number_of_open_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_get_number_of_open_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	result = libfsrefs_get_number_of_open_threads(
+	          &number_of_threads,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_get_number_of_open_threads(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_set_number_of_open_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_set_number_of_open_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	result = libfsrefs_get_number_of_open_threads(
+	          &number_of_threads,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_set_number_of_open_threads(
+	          number_of_threads,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_set_number_of_open_threads(
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_wait_for_open_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_wait_for_open_requests(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libfsrefs_wait_for_open_requests(
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsrefs_check_volume_signature function
  * Returns 1 if successful or 0 if not
  */
@@ -795,6 +1113,30 @@ int main(
 	 "libfsrefs_set_codepage",
 	 fsrefs_test_set_codepage );
 
+	FSREFS_TEST_RUN(
+	 "libfsrefs_get_memory_limit",
+	 fsrefs_test_get_memory_limit );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_set_memory_limit",
+	 fsrefs_test_set_memory_limit );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_get_memory_usage",
+	 fsrefs_test_get_memory_usage );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_get_number_of_open_threads",
+	 fsrefs_test_get_number_of_open_threads );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_set_number_of_open_threads",
+	 fsrefs_test_set_number_of_open_threads );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_wait_for_open_requests",
+	 fsrefs_test_wait_for_open_requests );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( ( source != NULL )
 	 && ( volume_offset == 0 ) )
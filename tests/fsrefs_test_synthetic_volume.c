@@ -0,0 +1,2978 @@
+/*
+ * Library volume type test program using synthetic images
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_functions.h"
+#include "fsrefs_test_image_generator.h"
+#include "fsrefs_test_libbfio.h"
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+
+typedef struct fsrefs_test_synthetic_volume_walk_values fsrefs_test_synthetic_volume_walk_values_t;
+
+struct fsrefs_test_synthetic_volume_walk_values
+{
+	/* The number of directories
+	 */
+	uint64_t number_of_directories;
+
+	/* The number of files
+	 */
+	uint64_t number_of_files;
+
+	/* The number of files with an unexpected size
+	 */
+	uint64_t number_of_unexpected_sizes;
+
+	/* The expected file size
+	 */
+	size64_t file_size;
+};
+
+/* Counts the file entries passed by libfsrefs_volume_walk_file_entries
+ * Returns 1 to continue or -1 on error
+ */
+int fsrefs_test_synthetic_volume_walk_callback(
+     libfsrefs_file_entry_t *file_entry,
+     intptr_t *user_data )
+{
+	fsrefs_test_synthetic_volume_walk_values_t *walk_values = NULL;
+	size64_t size                                           = 0;
+	uint32_t file_attribute_flags                           = 0;
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	walk_values = (fsrefs_test_synthetic_volume_walk_values_t *) user_data;
+
+	if( libfsrefs_file_entry_get_file_attribute_flags(
+	     file_entry,
+	     &file_attribute_flags,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( ( file_attribute_flags & 0x00000010UL ) != 0 )
+	{
+		walk_values->number_of_directories += 1;
+
+		return( 1 );
+	}
+	walk_values->number_of_files += 1;
+
+	if( libfsrefs_file_entry_get_size(
+	     file_entry,
+	     &size,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( size != walk_values->file_size )
+	{
+		walk_values->number_of_unexpected_sizes += 1;
+	}
+	return( 1 );
+}
+
+/* Tests the libfsrefs_volume_walk_file_entries function and reads file data on a synthetic image
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_walk_image(
+     uint8_t major_format_version,
+     uint32_t cluster_block_size,
+     int maximum_number_of_node_records,
+     int number_of_data_runs )
+{
+	fsrefs_test_synthetic_volume_walk_values_t walk_values;
+
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_file_entry_t *root_directory         = NULL;
+	libfsrefs_file_entry_t *sub_file_entry         = NULL;
+	libfsrefs_volume_t *volume                     = NULL;
+	uint8_t *data                                  = NULL;
+	uint8_t *image_data                            = NULL;
+	size64_t file_data_size                        = 0;
+	size_t data_offset                             = 0;
+	size_t image_data_size                         = 0;
+	ssize_t read_count                             = 0;
+	uint64_t checkpoint_sequence_number            = 0;
+	uint64_t number_of_directories                 = 0;
+	uint64_t number_of_files                       = 0;
+	uint8_t expected_value                         = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          major_format_version,
+	          cluster_block_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_generator->directory_depth                = 2;
+	image_generator->number_of_sub_directories      = 3;
+	image_generator->number_of_files                = 20;
+	image_generator->number_of_data_runs            = number_of_data_runs;
+	image_generator->data_run_size                  = 2;
+	image_generator->maximum_number_of_node_records = maximum_number_of_node_records;
+
+	result = fsrefs_test_image_generator_get_number_of_directories(
+	          image_generator,
+	          &number_of_directories,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_directories",
+	 number_of_directories,
+	 (uint64_t) 13 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_image_generator_get_number_of_files(
+	          image_generator,
+	          &number_of_files,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_files",
+	 number_of_files,
+	 (uint64_t) 260 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_image_generator_get_file_data_size(
+	          image_generator,
+	          &file_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_image_generator_write_to_memory(
+	          image_generator,
+	          &image_data,
+	          &image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_data",
+	 image_data );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( maximum_number_of_node_records > 0 )
+	{
+		FSREFS_TEST_ASSERT_GREATER_THAN_INT(
+		 "image_generator->maximum_number_of_tree_levels",
+		 image_generator->maximum_number_of_tree_levels,
+		 1 );
+	}
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the sequence number of the primary checkpoint, which is the most recent one
+	 */
+	result = libfsrefs_volume_get_checkpoint_sequence_number(
+	          volume,
+	          &checkpoint_sequence_number,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint_sequence_number",
+	 checkpoint_sequence_number,
+	 (uint64_t) 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_checkpoint_sequence_number(
+	          NULL,
+	          &checkpoint_sequence_number,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walking all file entries
+	 */
+	walk_values.number_of_directories      = 0;
+	walk_values.number_of_files            = 0;
+	walk_values.number_of_unexpected_sizes = 0;
+	walk_values.file_size                  = file_data_size;
+
+	result = libfsrefs_volume_walk_file_entries(
+	          volume,
+	          NULL,
+	          &fsrefs_test_synthetic_volume_walk_callback,
+	          (intptr_t *) &walk_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The root directory is not passed to the callback
+	 */
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "walk_values.number_of_directories",
+	 walk_values.number_of_directories,
+	 number_of_directories - 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "walk_values.number_of_files",
+	 walk_values.number_of_files,
+	 number_of_files );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "walk_values.number_of_unexpected_sizes",
+	 walk_values.number_of_unexpected_sizes,
+	 (uint64_t) 0 );
+
+	/* Test reading the data of the first file in the root directory
+	 */
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_sub_file_entry_by_index(
+	          root_directory,
+	          0,
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_file_entry",
+	 sub_file_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_data_size );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libfsrefs_file_entry_read_buffer(
+	              sub_file_entry,
+	              data,
+	              (size_t) file_data_size,
+	              &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_data_size );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_data_runs == 0 )
+	{
+		result = memory_compare(
+		          data,
+		          "file00000000",
+		          12 );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	else
+	{
+		for( data_offset = 0;
+		     data_offset < (size_t) file_data_size;
+		     data_offset++ )
+		{
+			expected_value = fsrefs_test_image_generator_get_data_block_value(
+			                  (uint64_t) ( data_offset / image_generator->metadata_block_size ) );
+
+			if( data[ data_offset ] != expected_value )
+			{
+				break;
+			}
+		}
+		FSREFS_TEST_ASSERT_EQUAL_SIZE(
+		 "data_offset",
+		 data_offset,
+		 (size_t) file_data_size );
+	}
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	/* Clean up
+	 */
+	result = libfsrefs_file_entry_free(
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_close(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests a synthetic format version 1 image
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_format_version1(
+     void )
+{
+	return( fsrefs_test_synthetic_volume_walk_image(
+	         1,
+	         65536,
+	         0,
+	         3 ) );
+}
+
+/* Tests a synthetic format version 1 image with a cluster block size smaller than the metadata block size
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_format_version1_small_clusters(
+     void )
+{
+	return( fsrefs_test_synthetic_volume_walk_image(
+	         1,
+	         4096,
+	         0,
+	         3 ) );
+}
+
+/* Tests a synthetic format version 3 image
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_format_version3(
+     void )
+{
+	return( fsrefs_test_synthetic_volume_walk_image(
+	         3,
+	         65536,
+	         0,
+	         3 ) );
+}
+
+/* Tests a synthetic format version 3 image with multi-level directory trees
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_branch_nodes(
+     void )
+{
+	return( fsrefs_test_synthetic_volume_walk_image(
+	         3,
+	         4096,
+	         4,
+	         2 ) );
+}
+
+/* Tests a synthetic format version 1 image with resident file data
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_resident_data(
+     void )
+{
+	return( fsrefs_test_synthetic_volume_walk_image(
+	         1,
+	         65536,
+	         3,
+	         0 ) );
+}
+
+/* Retrieves the directory node statistics values used by the memory limit test
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_synthetic_volume_get_directory_statistics(
+     libfsrefs_volume_t *volume,
+     uint64_t *cache_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	if( libfsrefs_volume_get_statistics(
+	     volume,
+	     LIBFSREFS_NODE_TYPE_DIRECTORY,
+	     LIBFSREFS_STATISTICS_VALUE_CACHE_MISSES,
+	     cache_misses,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsrefs_volume_get_statistics(
+	     volume,
+	     LIBFSREFS_NODE_TYPE_DIRECTORY,
+	     LIBFSREFS_STATISTICS_VALUE_NUMBER_OF_EVICTIONS,
+	     number_of_evictions,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests walking a directory that is larger than the memory limit using the file entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_memory_limit(
+     void )
+{
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_file_entry_t *root_directory         = NULL;
+	libfsrefs_file_entry_t *sub_file_entry         = NULL;
+	libfsrefs_volume_t *volume                     = NULL;
+	uint8_t *image_data                            = NULL;
+	size_t image_data_size                         = 0;
+	uint64_t cache_misses                          = 0;
+	uint64_t number_of_evictions                   = 0;
+	int number_of_sub_directory_entries            = 0;
+	int number_of_sub_file_entries                 = 0;
+	int result                                     = 0;
+	int sub_file_entry_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          1,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_generator->directory_depth                = 1;
+	image_generator->number_of_sub_directories      = 4;
+	image_generator->number_of_files                = 200;
+	image_generator->number_of_data_runs            = 0;
+	image_generator->maximum_number_of_node_records = 32;
+
+	result = fsrefs_test_image_generator_write_to_memory(
+	          image_generator,
+	          &image_data,
+	          &image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A memory limit of 1 byte is smaller than any directory object
+	 */
+	result = libfsrefs_volume_set_memory_limit(
+	          volume,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_clear_statistics(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that listing the root directory reads its directory object only once
+	 * although the directory object exceeds the memory limit
+	 */
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 204 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		result = libfsrefs_file_entry_get_sub_file_entry_by_index(
+		          root_directory,
+		          sub_file_entry_index,
+		          &sub_file_entry,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_file_entry_free(
+		          &sub_file_entry,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = fsrefs_test_synthetic_volume_get_directory_statistics(
+	          volume,
+	          &cache_misses,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_misses",
+	 cache_misses,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that reading each sub directory evicts the idle root directory object
+	 * which is then read again once when the listing continues
+	 */
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		result = libfsrefs_file_entry_get_sub_file_entry_by_index(
+		          root_directory,
+		          sub_file_entry_index,
+		          &sub_file_entry,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+		          sub_file_entry,
+		          &number_of_sub_directory_entries,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_file_entry_free(
+		          &sub_file_entry,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_synthetic_volume_get_directory_statistics(
+	          volume,
+	          &cache_misses,
+	          &number_of_evictions,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_misses",
+	 cache_misses,
+	 (uint64_t) 8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 4 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests freeing file entries after the volume was freed
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_free_file_entry_after_volume(
+     void )
+{
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_file_entry_t *root_directory         = NULL;
+	libfsrefs_file_entry_t *sub_file_entry         = NULL;
+	libfsrefs_volume_t *volume                     = NULL;
+	uint8_t *image_data                            = NULL;
+	size_t image_data_size                         = 0;
+	int number_of_sub_directory_entries            = 0;
+	int number_of_sub_file_entries                 = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          1,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_generator->directory_depth           = 1;
+	image_generator->number_of_sub_directories = 2;
+	image_generator->number_of_files           = 4;
+	image_generator->number_of_data_runs       = 0;
+
+	result = fsrefs_test_image_generator_write_to_memory(
+	          image_generator,
+	          &image_data,
+	          &image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_set_memory_limit(
+	          volume,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the directory objects so that these are idle in the directory object cache
+	 */
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_sub_file_entry_by_index(
+	          root_directory,
+	          0,
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          sub_file_entry,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test freeing the file entries after the volume
+	 */
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_free(
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "sub_file_entry",
+	 sub_file_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests retrieving the stat values of the sub file entries of a directory with an invalid name
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_sub_file_entries_stat_invalid_name(
+     void )
+{
+	libfsrefs_file_entry_stat_t file_entry_stats[ 8 ];
+	uint8_t utf8_names[ 256 ];
+
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_file_entry_t *root_directory         = NULL;
+	libfsrefs_volume_t *volume                     = NULL;
+	uint8_t *image_data                            = NULL;
+	size_t image_data_size                         = 0;
+	size_t names_size                              = 0;
+	size_t utf8_names_size                         = 0;
+	int number_of_sub_file_entries                 = 0;
+	int number_of_unnamed_sub_file_entries         = 0;
+	int result                                     = 0;
+	int stat_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          1,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_generator->directory_depth           = 1;
+	image_generator->number_of_sub_directories = 2;
+	image_generator->number_of_files           = 4;
+	image_generator->number_of_data_runs       = 0;
+	image_generator->has_invalid_name          = 1;
+
+	result = fsrefs_test_image_generator_write_to_memory(
+	          image_generator,
+	          &image_data,
+	          &image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 6 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_sub_file_entries_utf8_names_size(
+	          root_directory,
+	          &utf8_names_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "utf8_names_size",
+	 (uint64_t) utf8_names_size,
+	 (uint64_t) 256 );
+
+	result = libfsrefs_file_entry_get_sub_file_entries_stat(
+	          root_directory,
+	          file_entry_stats,
+	          8,
+	          utf8_names,
+	          utf8_names_size,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 6 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stat_index = 0;
+	     stat_index < number_of_sub_file_entries;
+	     stat_index++ )
+	{
+		if( file_entry_stats[ stat_index ].name_size == 0 )
+		{
+			number_of_unnamed_sub_file_entries++;
+		}
+		names_size += file_entry_stats[ stat_index ].name_size;
+	}
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_unnamed_sub_file_entries",
+	 number_of_unnamed_sub_file_entries,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "names_size",
+	 names_size,
+	 utf8_names_size );
+
+	/* The last file is the last record of the files
+	 */
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "file_entry_stats[ 3 ].name_size",
+	 file_entry_stats[ 3 ].name_size,
+	 (size_t) 0 );
+
+	/* Clean up
+	 */
+	result = libfsrefs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests exporting and importing the volume index
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_export_import_index(
+     void )
+{
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libbfio_handle_t *index_file_io_handle         = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_file_entry_t *root_directory         = NULL;
+	libfsrefs_file_entry_t *sub_file_entry         = NULL;
+	libfsrefs_volume_t *volume                     = NULL;
+	uint8_t *image_data                            = NULL;
+	uint8_t *index_data                            = NULL;
+	size_t image_data_size                         = 0;
+	size_t index_data_size                         = 65536;
+	uint8_t byte_value                             = 0;
+	int expected_number_of_sub_directory_entries   = 0;
+	int expected_number_of_sub_file_entries        = 0;
+	int number_of_sub_directory_entries            = 0;
+	int number_of_sub_file_entries                 = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          1,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_generator->directory_depth           = 1;
+	image_generator->number_of_sub_directories = 2;
+	image_generator->number_of_files           = 4;
+	image_generator->number_of_data_runs       = 1;
+
+	result = fsrefs_test_image_generator_write_to_memory(
+	          image_generator,
+	          &image_data,
+	          &image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * index_data_size );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_data",
+	 index_data );
+
+	result = libbfio_memory_range_initialize(
+	          &index_file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          index_file_io_handle,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          index_file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test export of the volume index
+	 */
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_export_index_file_io_handle(
+	          volume,
+	          index_file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &expected_number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "expected_number_of_sub_file_entries",
+	 expected_number_of_sub_file_entries,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_sub_file_entry_by_index(
+	          root_directory,
+	          0,
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          sub_file_entry,
+	          &expected_number_of_sub_directory_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_free(
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test import of the volume index
+	 */
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test import of a volume index with a mismatching checkpoint sequence number
+	 */
+	byte_value = index_data[ 24 ];
+
+	index_data[ 24 ] = (uint8_t) ( byte_value + 1 );
+
+	result = libfsrefs_volume_import_index_file_io_handle(
+	          volume,
+	          index_file_io_handle,
+	          &error );
+
+	index_data[ 24 ] = byte_value;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_import_index_file_io_handle(
+	          volume,
+	          index_file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the volume index was already imported
+	 */
+	result = libfsrefs_volume_import_index_file_io_handle(
+	          volume,
+	          index_file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the directories are read from the imported volume index
+	 */
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_file_entries",
+	 number_of_sub_file_entries,
+	 expected_number_of_sub_file_entries );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_sub_file_entry_by_index(
+	          root_directory,
+	          0,
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_number_of_sub_file_entries(
+	          sub_file_entry,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_directory_entries",
+	 number_of_sub_directory_entries,
+	 expected_number_of_sub_directory_entries );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_file_entry_free(
+	          &sub_file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          index_file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 index_data );
+
+	index_data = NULL;
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests a synthetic image with a cycle in the directory hierarchy
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_directory_cycle(
+     void )
+{
+	fsrefs_test_synthetic_volume_walk_values_t walk_values;
+
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsrefs_volume_t *volume                     = NULL;
+	uint8_t *image_data                            = NULL;
+	size_t image_data_size                         = 0;
+	int number_of_shared_extents                   = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          1,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_generator->directory_depth           = 2;
+	image_generator->number_of_sub_directories = 2;
+	image_generator->number_of_files           = 2;
+	image_generator->has_directory_cycle       = 1;
+
+	result = fsrefs_test_image_generator_write_to_memory(
+	          image_generator,
+	          &image_data,
+	          &image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          image_data_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSREFS_OPEN_READ,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that building the parent index terminates
+	 */
+	result = libfsrefs_volume_build_parent_index(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that walking the file entries terminates and walks every directory once
+	 * where the directory record that references the root directory is passed but not walked
+	 */
+	walk_values.number_of_directories      = 0;
+	walk_values.number_of_files            = 0;
+	walk_values.number_of_unexpected_sizes = 0;
+	walk_values.file_size                  = 0;
+
+	result = libfsrefs_volume_walk_file_entries(
+	          volume,
+	          NULL,
+	          &fsrefs_test_synthetic_volume_walk_callback,
+	          (intptr_t *) &walk_values,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "walk_values.number_of_directories",
+	 walk_values.number_of_directories,
+	 (uint64_t) 7 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "walk_values.number_of_files",
+	 walk_values.number_of_files,
+	 (uint64_t) 14 );
+
+	/* Test that building the shared extent index, which walks the file entries, terminates
+	 */
+	result = libfsrefs_volume_build_shared_extent_index(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_number_of_shared_extents(
+	          volume,
+	          &number_of_shared_extents,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_shared_extents",
+	 number_of_shared_extents,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsrefs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+/* Tests the fsrefs_test_image_node_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_node_append_record(
+     void )
+{
+	uint8_t key_data[ 16 ];
+	uint8_t value_data[ 32 ];
+
+	fsrefs_test_image_node_t *node = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_image_node_initialize(
+	          &node,
+	          128,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          key_data,
+	          0,
+	          16 ) != NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          value_data,
+	          0,
+	          32 ) != NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 * a record of 64 bytes and its record offset fits once in 128 bytes
+	 */
+	result = fsrefs_test_image_node_append_record(
+	          node,
+	          key_data,
+	          16,
+	          0,
+	          value_data,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "node->records_data_size",
+	 node->records_data_size,
+	 (size_t) 64 );
+
+	result = fsrefs_test_image_node_append_record(
+	          node,
+	          key_data,
+	          16,
+	          0,
+	          value_data,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = fsrefs_test_image_node_append_record(
+	          NULL,
+	          key_data,
+	          16,
+	          0,
+	          value_data,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsrefs_test_image_node_append_record(
+	          node,
+	          NULL,
+	          16,
+	          0,
+	          value_data,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsrefs_test_image_node_free(
+	          &node,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		fsrefs_test_image_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fsrefs_test_image_generator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_synthetic_volume_image_generator_initialize(
+     void )
+{
+	fsrefs_test_image_generator_t *image_generator = NULL;
+	libcerror_error_t *error                       = NULL;
+	int result                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          3,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "image_generator->metadata_block_size",
+	 image_generator->metadata_block_size,
+	 (uint32_t) 4096 );
+
+	result = fsrefs_test_image_generator_free(
+	          &image_generator,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = fsrefs_test_image_generator_initialize(
+	          NULL,
+	          3,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          2,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsrefs_test_image_generator_initialize(
+	          &image_generator,
+	          3,
+	          8192,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "image_generator",
+	 image_generator );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_generator != NULL )
+	{
+		fsrefs_test_image_generator_free(
+		 &image_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "fsrefs_test_image_generator_initialize",
+	 fsrefs_test_synthetic_volume_image_generator_initialize );
+
+	FSREFS_TEST_RUN(
+	 "fsrefs_test_image_node_append_record",
+	 fsrefs_test_synthetic_volume_node_append_record );
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_walk_file_entries (format version 1)",
+	 fsrefs_test_synthetic_volume_format_version1 );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_walk_file_entries (format version 1 with 4 KiB clusters)",
+	 fsrefs_test_synthetic_volume_format_version1_small_clusters );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_walk_file_entries (format version 3)",
+	 fsrefs_test_synthetic_volume_format_version3 );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_walk_file_entries (branch nodes)",
+	 fsrefs_test_synthetic_volume_branch_nodes );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_walk_file_entries (resident data)",
+	 fsrefs_test_synthetic_volume_resident_data );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_set_memory_limit (directory larger than limit)",
+	 fsrefs_test_synthetic_volume_memory_limit );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_file_entry_free (after libfsrefs_volume_free)",
+	 fsrefs_test_synthetic_volume_free_file_entry_after_volume );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_walk_file_entries (directory cycle)",
+	 fsrefs_test_synthetic_volume_directory_cycle );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_file_entry_get_sub_file_entries_stat (invalid name)",
+	 fsrefs_test_synthetic_volume_sub_file_entries_stat_invalid_name );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_import_index_file_io_handle",
+	 fsrefs_test_synthetic_volume_export_import_index );
+
+#endif /* defined( LIBFSREFS_HAVE_BFIO ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
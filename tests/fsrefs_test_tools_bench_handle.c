@@ -0,0 +1,777 @@
+/*
+ * Tools bench_handle type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../fsrefstools/bench_handle.h"
+
+/* Tests the bench_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_bench_handle_initialize(
+     void )
+{
+	bench_handle_t *bench_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = bench_handle_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bench_handle = (bench_handle_t *) 0x12345678UL;
+
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	bench_handle = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test bench_handle_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = bench_handle_initialize(
+		          &bench_handle,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( bench_handle != NULL )
+			{
+				bench_handle_free(
+				 &bench_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "bench_handle",
+			 bench_handle );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test bench_handle_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = bench_handle_initialize(
+		          &bench_handle,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( bench_handle != NULL )
+			{
+				bench_handle_free(
+				 &bench_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "bench_handle",
+			 bench_handle );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_bench_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = bench_handle_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_set_backend function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_bench_handle_set_backend(
+     void )
+{
+	bench_handle_t *bench_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = bench_handle_set_backend(
+	          bench_handle,
+	          _SYSTEM_STRING( "memory" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->backend",
+	 bench_handle->backend,
+	 BENCH_HANDLE_BACKEND_MEMORY );
+
+	result = bench_handle_set_backend(
+	          bench_handle,
+	          _SYSTEM_STRING( "file" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->backend",
+	 bench_handle->backend,
+	 BENCH_HANDLE_BACKEND_FILE );
+
+	result = bench_handle_set_backend(
+	          bench_handle,
+	          _SYSTEM_STRING( "mmap" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = bench_handle_set_backend(
+	          NULL,
+	          _SYSTEM_STRING( "file" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = bench_handle_set_backend(
+	          bench_handle,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_set_scenarios function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_bench_handle_set_scenarios(
+     void )
+{
+	bench_handle_t *bench_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = bench_handle_set_scenarios(
+	          bench_handle,
+	          _SYSTEM_STRING( "walk,random_read,stat" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "bench_handle->scenario_flags",
+	 bench_handle->scenario_flags,
+	 (uint8_t) ( ( 1 << BENCH_HANDLE_SCENARIO_WALK ) | ( 1 << BENCH_HANDLE_SCENARIO_RANDOM_READ ) | ( 1 << BENCH_HANDLE_SCENARIO_STAT ) ) );
+
+	result = bench_handle_set_scenarios(
+	          bench_handle,
+	          _SYSTEM_STRING( "all" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "bench_handle->scenario_flags",
+	 bench_handle->scenario_flags,
+	 (uint8_t) BENCH_HANDLE_SCENARIO_FLAGS_ALL );
+
+	/* Unsupported scenario names leave the scenarios unchanged
+	 */
+	result = bench_handle_set_scenarios(
+	          bench_handle,
+	          _SYSTEM_STRING( "open,bogus" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT8(
+	 "bench_handle->scenario_flags",
+	 bench_handle->scenario_flags,
+	 (uint8_t) BENCH_HANDLE_SCENARIO_FLAGS_ALL );
+
+	/* Test error cases
+	 */
+	result = bench_handle_set_scenarios(
+	          NULL,
+	          _SYSTEM_STRING( "all" ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = bench_handle_set_scenarios(
+	          bench_handle,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_get_percentile function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_bench_handle_get_percentile(
+     void )
+{
+	uint64_t latencies[ 10 ] = {
+		1, 2, 3, 4, 5, 6, 7, 8, 9, 100 };
+
+	libcerror_error_t *error = NULL;
+	uint64_t latency         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = bench_handle_get_percentile(
+	          latencies,
+	          10,
+	          50,
+	          &latency,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "latency",
+	 latency,
+	 (uint64_t) 5 );
+
+	result = bench_handle_get_percentile(
+	          latencies,
+	          10,
+	          99,
+	          &latency,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "latency",
+	 latency,
+	 (uint64_t) 100 );
+
+	result = bench_handle_get_percentile(
+	          NULL,
+	          0,
+	          50,
+	          &latency,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "latency",
+	 latency,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = bench_handle_get_percentile(
+	          NULL,
+	          10,
+	          50,
+	          &latency,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = bench_handle_get_percentile(
+	          latencies,
+	          10,
+	          101,
+	          &latency,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = bench_handle_get_percentile(
+	          latencies,
+	          10,
+	          50,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "bench_handle_initialize",
+	 fsrefs_test_tools_bench_handle_initialize );
+
+	FSREFS_TEST_RUN(
+	 "bench_handle_free",
+	 fsrefs_test_tools_bench_handle_free );
+
+	FSREFS_TEST_RUN(
+	 "bench_handle_set_backend",
+	 fsrefs_test_tools_bench_handle_set_backend );
+
+	FSREFS_TEST_RUN(
+	 "bench_handle_set_scenarios",
+	 fsrefs_test_tools_bench_handle_set_scenarios );
+
+	FSREFS_TEST_RUN(
+	 "bench_handle_get_percentile",
+	 fsrefs_test_tools_bench_handle_get_percentile );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
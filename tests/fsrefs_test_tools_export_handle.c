@@ -1,5 +1,5 @@
 /*
- * Library block_tree_node type test program
+ * Tools export_handle type test program
  *
  * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -28,38 +29,32 @@
 #endif
 
 #include "fsrefs_test_libcerror.h"
-#include "fsrefs_test_libfsrefs.h"
 #include "fsrefs_test_macros.h"
 #include "fsrefs_test_memory.h"
 #include "fsrefs_test_unused.h"
 
-#include "../libfsrefs/libfsrefs_block_tree_node.h"
+#include "../fsrefstools/export_handle.h"
 
-#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
-
-/* Tests the libfsrefs_block_tree_node_initialize function
+/* Tests the export_handle_initialize function
  * Returns 1 if successful or 0 if not
  */
-int fsrefs_test_block_tree_node_initialize(
+int fsrefs_test_tools_export_handle_initialize(
      void )
 {
-	libcerror_error_t *error                     = NULL;
-	libfsrefs_block_tree_node_t *block_tree_node = NULL;
-	int result                                   = 0;
+	export_handle_t *export_handle  = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
 
 #if defined( HAVE_FSREFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests              = 1;
-	int number_of_memset_fail_tests              = 1;
-	int test_number                              = 0;
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
 #endif
 
-	/* Test block_tree_node initialization
+	/* Test regular cases
 	 */
-	result = libfsrefs_block_tree_node_initialize(
-	          &block_tree_node,
-	          0,
-	          1024,
-	          256,
+	result = export_handle_initialize(
+	          &export_handle,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -68,16 +63,15 @@ int fsrefs_test_block_tree_node_initialize(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree_node",
-	 block_tree_node );
+	 "export_handle",
+	 export_handle );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsrefs_block_tree_node_free(
-	          &block_tree_node,
-	          NULL,
+	result = export_handle_free(
+	          &export_handle,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -86,8 +80,8 @@ int fsrefs_test_block_tree_node_initialize(
 	 1 );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
-	 "block_tree_node",
-	 block_tree_node );
+	 "export_handle",
+	 export_handle );
 
 	FSREFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -95,11 +89,8 @@ int fsrefs_test_block_tree_node_initialize(
 
 	/* Test error cases
 	 */
-	result = libfsrefs_block_tree_node_initialize(
+	result = export_handle_initialize(
 	          NULL,
-	          0,
-	          1024,
-	          256,
 	          &error );
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
@@ -114,16 +105,13 @@ int fsrefs_test_block_tree_node_initialize(
 	libcerror_error_free(
 	 &error );
 
-	block_tree_node = (libfsrefs_block_tree_node_t *) 0x12345678UL;
+	export_handle = (export_handle_t *) 0x12345678UL;
 
-	result = libfsrefs_block_tree_node_initialize(
-	          &block_tree_node,
-	          0,
-	          1024,
-	          256,
+	result = export_handle_initialize(
+	          &export_handle,
 	          &error );
 
-	block_tree_node = NULL;
+	export_handle = NULL;
 
 	FSREFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -143,26 +131,22 @@ int fsrefs_test_block_tree_node_initialize(
 	     test_number < number_of_malloc_fail_tests;
 	     test_number++ )
 	{
-		/* Test libfsrefs_block_tree_node_initialize with malloc failing
+		/* Test export_handle_initialize with malloc failing
 		 */
 		fsrefs_test_malloc_attempts_before_fail = test_number;
 
-		result = libfsrefs_block_tree_node_initialize(
-		          &block_tree_node,
-		          0,
-		          1024,
-		          256,
+		result = export_handle_initialize(
+		          &export_handle,
 		          &error );
 
 		if( fsrefs_test_malloc_attempts_before_fail != -1 )
 		{
 			fsrefs_test_malloc_attempts_before_fail = -1;
 
-			if( block_tree_node != NULL )
+			if( export_handle != NULL )
 			{
-				libfsrefs_block_tree_node_free(
-				 &block_tree_node,
-				 NULL,
+				export_handle_free(
+				 &export_handle,
 				 NULL );
 			}
 		}
@@ -174,8 +158,8 @@ int fsrefs_test_block_tree_node_initialize(
 			 -1 );
 
 			FSREFS_TEST_ASSERT_IS_NULL(
-			 "block_tree_node",
-			 block_tree_node );
+			 "export_handle",
+			 export_handle );
 
 			FSREFS_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -189,26 +173,22 @@ int fsrefs_test_block_tree_node_initialize(
 	     test_number < number_of_memset_fail_tests;
 	     test_number++ )
 	{
-		/* Test libfsrefs_block_tree_node_initialize with memset failing
+		/* Test export_handle_initialize with memset failing
 		 */
 		fsrefs_test_memset_attempts_before_fail = test_number;
 
-		result = libfsrefs_block_tree_node_initialize(
-		          &block_tree_node,
-		          0,
-		          1024,
-		          256,
+		result = export_handle_initialize(
+		          &export_handle,
 		          &error );
 
 		if( fsrefs_test_memset_attempts_before_fail != -1 )
 		{
 			fsrefs_test_memset_attempts_before_fail = -1;
 
-			if( block_tree_node != NULL )
+			if( export_handle != NULL )
 			{
-				libfsrefs_block_tree_node_free(
-				 &block_tree_node,
-				 NULL,
+				export_handle_free(
+				 &export_handle,
 				 NULL );
 			}
 		}
@@ -220,8 +200,8 @@ int fsrefs_test_block_tree_node_initialize(
 			 -1 );
 
 			FSREFS_TEST_ASSERT_IS_NULL(
-			 "block_tree_node",
-			 block_tree_node );
+			 "export_handle",
+			 export_handle );
 
 			FSREFS_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -241,20 +221,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( block_tree_node != NULL )
+	if( export_handle != NULL )
 	{
-		libfsrefs_block_tree_node_free(
-		 &block_tree_node,
-		 NULL,
+		export_handle_free(
+		 &export_handle,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libfsrefs_block_tree_node_free function
+/* Tests the export_handle_free function
  * Returns 1 if successful or 0 if not
  */
-int fsrefs_test_block_tree_node_free(
+int fsrefs_test_tools_export_handle_free(
      void )
 {
 	libcerror_error_t *error = NULL;
@@ -262,8 +241,7 @@ int fsrefs_test_block_tree_node_free(
 
 	/* Test error cases
 	 */
-	result = libfsrefs_block_tree_node_free(
-	          NULL,
+	result = export_handle_free(
 	          NULL,
 	          &error );
 
@@ -290,8 +268,6 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
-
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -307,25 +283,17 @@ int main(
 	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
 	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
 
-#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
-
 	FSREFS_TEST_RUN(
-	 "libfsrefs_block_tree_node_initialize",
-	 fsrefs_test_block_tree_node_initialize );
+	 "export_handle_initialize",
+	 fsrefs_test_tools_export_handle_initialize );
 
 	FSREFS_TEST_RUN(
-	 "libfsrefs_block_tree_node_free",
-	 fsrefs_test_block_tree_node_free );
-
-#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+	 "export_handle_free",
+	 fsrefs_test_tools_export_handle_free );
 
 	return( EXIT_SUCCESS );
 
-#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
-
 on_error:
 	return( EXIT_FAILURE );
-
-#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
 }
 
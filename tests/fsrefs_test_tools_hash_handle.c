@@ -0,0 +1,488 @@
+/*
+ * Tools hash_handle type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../fsrefstools/hash_handle.h"
+
+/* Tests the hash_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_hash_handle_initialize(
+     void )
+{
+	hash_handle_t *hash_handle      = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = hash_handle_initialize(
+	          &hash_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_handle_free(
+	          &hash_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = hash_handle_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_handle = (hash_handle_t *) 0x12345678UL;
+
+	result = hash_handle_initialize(
+	          &hash_handle,
+	          &error );
+
+	hash_handle = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test hash_handle_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = hash_handle_initialize(
+		          &hash_handle,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( hash_handle != NULL )
+			{
+				hash_handle_free(
+				 &hash_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "hash_handle",
+			 hash_handle );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test hash_handle_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = hash_handle_initialize(
+		          &hash_handle,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( hash_handle != NULL )
+			{
+				hash_handle_free(
+				 &hash_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "hash_handle",
+			 hash_handle );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_handle != NULL )
+	{
+		hash_handle_free(
+		 &hash_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_hash_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = hash_handle_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_handle_append_pending_job and hash_handle_discard_pending_jobs functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_hash_handle_discard_pending_jobs(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	hash_handle_t *hash_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = hash_handle_initialize(
+	          &hash_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	hash_handle->number_of_batch_files = 1;
+
+	memory_set(
+	 data,
+	 'A',
+	 16 );
+
+	/* Test regular cases
+	 */
+	result = hash_handle_append_pending_job(
+	          hash_handle,
+	          0,
+	          8192,
+	          data,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_handle_append_pending_job(
+	          hash_handle,
+	          0,
+	          4096,
+	          data,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_handle->batch_files[ 0 ].pending_jobs",
+	 hash_handle->batch_files[ 0 ].pending_jobs );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT64(
+	 "hash_handle->batch_files[ 0 ].pending_jobs->data_offset",
+	 (int64_t) hash_handle->batch_files[ 0 ].pending_jobs->data_offset,
+	 (int64_t) 4096 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_handle->batch_files[ 0 ].pending_data_size",
+	 (uint64_t) hash_handle->batch_files[ 0 ].pending_data_size,
+	 (uint64_t) 32 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_handle->pending_data_size",
+	 (uint64_t) hash_handle->pending_data_size,
+	 (uint64_t) 32 );
+
+	result = hash_handle_discard_pending_jobs(
+	          hash_handle,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "hash_handle->batch_files[ 0 ].pending_jobs",
+	 hash_handle->batch_files[ 0 ].pending_jobs );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_handle->batch_files[ 0 ].pending_data_size",
+	 (uint64_t) hash_handle->batch_files[ 0 ].pending_data_size,
+	 (uint64_t) 0 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_handle->pending_data_size",
+	 (uint64_t) hash_handle->pending_data_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = hash_handle_discard_pending_jobs(
+	          NULL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	hash_handle->number_of_batch_files = 0;
+
+	result = hash_handle_free(
+	          &hash_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_handle != NULL )
+	{
+		hash_handle_discard_pending_jobs(
+		 hash_handle,
+		 0,
+		 NULL );
+
+		hash_handle->number_of_batch_files = 0;
+
+		hash_handle_free(
+		 &hash_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "hash_handle_initialize",
+	 fsrefs_test_tools_hash_handle_initialize );
+
+	FSREFS_TEST_RUN(
+	 "hash_handle_free",
+	 fsrefs_test_tools_hash_handle_free );
+
+	FSREFS_TEST_RUN(
+	 "hash_handle_discard_pending_jobs",
+	 fsrefs_test_tools_hash_handle_discard_pending_jobs );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
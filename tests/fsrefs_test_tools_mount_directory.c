@@ -0,0 +1,471 @@
+/*
+ * Tools mount_directory type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../fsrefstools/mount_directory.h"
+
+/* Tests the mount_directory_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_mount_directory_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	mount_directory_t *directory = NULL;
+	int result                   = 0;
+
+	/* Test error cases
+	 */
+	result = mount_directory_initialize(
+	          NULL,
+	          (libfsrefs_file_entry_t *) 0x12345678UL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory = (mount_directory_t *) 0x12345678UL;
+
+	result = mount_directory_initialize(
+	          &directory,
+	          (libfsrefs_file_entry_t *) 0x12345678UL,
+	          &error );
+
+	directory = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_directory_initialize(
+	          &directory,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_directory_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_mount_directory_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = mount_directory_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_directory_sorted_name_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_mount_directory_sorted_name_compare(
+     void )
+{
+	mount_directory_sorted_name_t first_sorted_name;
+	mount_directory_sorted_name_t second_sorted_name;
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	first_sorted_name.name  = "file.txt";
+	second_sorted_name.name = "file.txt";
+
+	result = mount_directory_sorted_name_compare(
+	          &first_sorted_name,
+	          &second_sorted_name );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	second_sorted_name.name = "file.txt2";
+
+	result = mount_directory_sorted_name_compare(
+	          &first_sorted_name,
+	          &second_sorted_name );
+
+	FSREFS_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	second_sorted_name.name = "File.txt";
+
+	result = mount_directory_sorted_name_compare(
+	          &first_sorted_name,
+	          &second_sorted_name );
+
+	FSREFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the mount_directory_compare_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_mount_directory_compare_name(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = mount_directory_compare_name(
+	          "file.txt",
+	          "file.txt/data",
+	          8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mount_directory_compare_name(
+	          "file",
+	          "file.txt",
+	          8 );
+
+	FSREFS_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mount_directory_compare_name(
+	          "file.txt",
+	          "file",
+	          4 );
+
+	FSREFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a name that contains an end of string character
+	 */
+	result = mount_directory_compare_name(
+	          "file",
+	          "file\0txt",
+	          8 );
+
+	FSREFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the mount_directory_get_sub_file_entry_index_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_mount_directory_get_sub_file_entry_index_by_name(
+     void )
+{
+	mount_directory_sorted_name_t sorted_names[ 3 ];
+	mount_directory_t directory;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int sub_file_entry_index = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &directory,
+	 0,
+	 sizeof( mount_directory_t ) );
+
+	sorted_names[ 0 ].name                 = "$Extend";
+	sorted_names[ 0 ].sub_file_entry_index = 2;
+	sorted_names[ 1 ].name                 = "Users";
+	sorted_names[ 1 ].sub_file_entry_index = 0;
+	sorted_names[ 2 ].name                 = "Windows";
+	sorted_names[ 2 ].sub_file_entry_index = 1;
+
+	directory.number_of_sub_file_entries = 3;
+	directory.sorted_names               = sorted_names;
+	directory.number_of_sorted_names     = 3;
+
+	/* Test regular cases
+	 */
+	result = mount_directory_get_sub_file_entry_index_by_name(
+	          &directory,
+	          "Windows",
+	          7,
+	          &sub_file_entry_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "sub_file_entry_index",
+	 sub_file_entry_index,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_directory_get_sub_file_entry_index_by_name(
+	          &directory,
+	          "$Extend/$Deleted",
+	          7,
+	          &sub_file_entry_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "sub_file_entry_index",
+	 sub_file_entry_index,
+	 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_directory_get_sub_file_entry_index_by_name(
+	          &directory,
+	          "User",
+	          4,
+	          &sub_file_entry_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_directory_get_sub_file_entry_index_by_name(
+	          NULL,
+	          "Windows",
+	          7,
+	          &sub_file_entry_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_directory_get_sub_file_entry_index_by_name(
+	          &directory,
+	          NULL,
+	          7,
+	          &sub_file_entry_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_directory_get_sub_file_entry_index_by_name(
+	          &directory,
+	          "Windows",
+	          7,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "mount_directory_initialize",
+	 fsrefs_test_tools_mount_directory_initialize );
+
+	FSREFS_TEST_RUN(
+	 "mount_directory_free",
+	 fsrefs_test_tools_mount_directory_free );
+
+	FSREFS_TEST_RUN(
+	 "mount_directory_sorted_name_compare",
+	 fsrefs_test_tools_mount_directory_sorted_name_compare );
+
+	FSREFS_TEST_RUN(
+	 "mount_directory_compare_name",
+	 fsrefs_test_tools_mount_directory_compare_name );
+
+	FSREFS_TEST_RUN(
+	 "mount_directory_get_sub_file_entry_index_by_name",
+	 fsrefs_test_tools_mount_directory_get_sub_file_entry_index_by_name );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,837 @@
+/*
+ * Tools output buffer functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../fsrefstools/output_buffer.h"
+
+/* Reads the data written to a stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fsrefs_test_tools_output_buffer_read_stream(
+         FILE *stream,
+         uint8_t *data,
+         size_t data_size )
+{
+	size_t read_count = 0;
+
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		return( -1 );
+	}
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              data_size );
+
+	return( (ssize_t) read_count );
+}
+
+/* Tests the output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_output_buffer_initialize(
+     void )
+{
+	output_buffer_t *output_buffer = NULL;
+	libcerror_error_t *error       = NULL;
+	FILE *stream                   = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	stream = tmpfile();
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	/* Test error cases
+	 */
+	result = output_buffer_initialize(
+	          NULL,
+	          stream,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (output_buffer_t *) 0x12345678UL;
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          1024,
+	          &error );
+
+	output_buffer = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_buffer_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = output_buffer_initialize(
+		          &output_buffer,
+		          stream,
+		          1024,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( output_buffer != NULL )
+			{
+				output_buffer_free(
+				 &output_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "output_buffer",
+			 output_buffer );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_buffer_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_output_buffer_append_data(
+     void )
+{
+	uint8_t data[ 64 ];
+	uint8_t large_data[ 32 ];
+
+	output_buffer_t *output_buffer = NULL;
+	libcerror_error_t *error       = NULL;
+	FILE *stream                   = NULL;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	result = memory_set(
+	          large_data,
+	          (int) 'x',
+	          32 ) != NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	stream = tmpfile();
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_append_data(
+	          output_buffer,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "output_buffer->data_offset",
+	 (int) output_buffer->data_offset,
+	 3 );
+
+	/* Test that data that does not fit flushes the buffer and that data larger than the buffer is written directly
+	 */
+	result = output_buffer_append_data(
+	          output_buffer,
+	          large_data,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "output_buffer->data_offset",
+	 (int) output_buffer->data_offset,
+	 0 );
+
+	result = output_buffer_append_string(
+	          output_buffer,
+	          "def",
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "output_buffer->data_offset",
+	 (int) output_buffer->data_offset,
+	 0 );
+
+	read_count = fsrefs_test_tools_output_buffer_read_stream(
+	              stream,
+	              data,
+	              64 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "read_count",
+	 (int) read_count,
+	 38 );
+
+	result = memory_compare(
+	          data,
+	          "abc",
+	          3 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 3 ] ),
+	          large_data,
+	          32 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 35 ] ),
+	          "def",
+	          3 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_data(
+	          NULL,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_append_data(
+	          output_buffer,
+	          NULL,
+	          3,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_append_string(
+	          output_buffer,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_flush(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_escaped_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_output_buffer_append_escaped_utf8_string(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	output_buffer_t *output_buffer = NULL;
+	libcerror_error_t *error       = NULL;
+	FILE *stream                   = NULL;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	stream = tmpfile();
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Control characters and undefined Unicode characters are escaped and special characters
+	 * are prefixed with the escape character
+	 */
+	result = output_buffer_append_escaped_utf8_string(
+	          output_buffer,
+	          (uint8_t *) "a|b\\c\x01\xc3\xa9\xef\xbf\xbe",
+	          11,
+	          "|\\",
+	          (uint8_t) '\\',
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_escaped_utf8_string(
+	          output_buffer,
+	          (uint8_t *) "|",
+	          1,
+	          NULL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = fsrefs_test_tools_output_buffer_read_stream(
+	              stream,
+	              data,
+	              64 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "read_count",
+	 (int) read_count,
+	 20 );
+
+	result = memory_compare(
+	          data,
+	          "a\\|b\\\\c\\x01\xc3\xa9\\ufffe|",
+	          20 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_escaped_utf8_string(
+	          NULL,
+	          (uint8_t *) "abc",
+	          3,
+	          NULL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_append_escaped_utf8_string(
+	          output_buffer,
+	          NULL,
+	          3,
+	          NULL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_append_escaped_utf8_string(
+	          output_buffer,
+	          (uint8_t *) "abc",
+	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "output_buffer_initialize",
+	 fsrefs_test_tools_output_buffer_initialize );
+
+	FSREFS_TEST_RUN(
+	 "output_buffer_free",
+	 fsrefs_test_tools_output_buffer_free );
+
+	FSREFS_TEST_RUN(
+	 "output_buffer_append_data",
+	 fsrefs_test_tools_output_buffer_append_data );
+
+	FSREFS_TEST_RUN(
+	 "output_buffer_append_escaped_utf8_string",
+	 fsrefs_test_tools_output_buffer_append_escaped_utf8_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,704 @@
+/*
+ * Tools record writer functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../fsrefstools/record_writer.h"
+
+/* Writes a header and a single file entry record and reads back the data written
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fsrefs_test_tools_record_writer_write_record(
+         int format,
+         uint8_t *data,
+         size_t data_size )
+{
+	libfsrefs_file_entry_stat_t file_entry_stat;
+
+	record_writer_t *record_writer = NULL;
+	FILE *stream                   = NULL;
+	size_t read_count              = 0;
+
+	if( memory_set(
+	     &file_entry_stat,
+	     0,
+	     sizeof( libfsrefs_file_entry_stat_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	file_entry_stat.object_identifier       = 0x701;
+	file_entry_stat.creation_time           = 1;
+	file_entry_stat.modification_time       = 2;
+	file_entry_stat.access_time             = 3;
+	file_entry_stat.entry_modification_time = 4;
+	file_entry_stat.size                    = 5;
+	file_entry_stat.file_attribute_flags    = 0x20;
+
+	stream = tmpfile();
+
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+	if( record_writer_initialize(
+	     &record_writer,
+	     stream,
+	     format,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( record_writer_write_header(
+	     record_writer,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( record_writer_write_file_entry(
+	     record_writer,
+	     0x600,
+	     &file_entry_stat,
+	     (uint8_t *) "a\"b\\\x01",
+	     5,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( record_writer_flush(
+	     record_writer,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( record_writer_free(
+	     &record_writer,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		goto on_error;
+	}
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              data_size );
+
+	file_stream_close(
+	 stream );
+
+	return( (ssize_t) read_count );
+
+on_error:
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	file_stream_close(
+	 stream );
+
+	return( -1 );
+}
+
+/* Tests the record_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_record_writer_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	record_writer_t *record_writer = NULL;
+	FILE *stream                   = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	stream = tmpfile();
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = record_writer_initialize(
+	          &record_writer,
+	          stream,
+	          RECORD_WRITER_FORMAT_JSONL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_writer",
+	 record_writer );
+
+	result = record_writer_free(
+	          &record_writer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "record_writer",
+	 record_writer );
+
+	/* Test error cases
+	 */
+	result = record_writer_initialize(
+	          NULL,
+	          stream,
+	          RECORD_WRITER_FORMAT_JSONL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_writer = (record_writer_t *) 0x12345678UL;
+
+	result = record_writer_initialize(
+	          &record_writer,
+	          stream,
+	          RECORD_WRITER_FORMAT_JSONL,
+	          &error );
+
+	record_writer = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_initialize(
+	          &record_writer,
+	          stream,
+	          -1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_initialize(
+	          &record_writer,
+	          NULL,
+	          RECORD_WRITER_FORMAT_JSONL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "record_writer",
+	 record_writer );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test record_writer_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = record_writer_initialize(
+		          &record_writer,
+		          stream,
+		          RECORD_WRITER_FORMAT_JSONL,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( record_writer != NULL )
+			{
+				record_writer_free(
+				 &record_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "record_writer",
+			 record_writer );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_record_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = record_writer_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_copy_decimal_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_record_writer_copy_decimal_string(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = record_writer_copy_decimal_string(
+	          0,
+	          string,
+	          32,
+	          &string_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = record_writer_copy_decimal_string(
+	          0xffffffffffffffffUL,
+	          string,
+	          32,
+	          &string_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 21 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "018446744073709551615",
+	          21 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = record_writer_copy_decimal_string(
+	          0,
+	          NULL,
+	          32,
+	          &string_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_copy_decimal_string(
+	          0,
+	          string,
+	          32,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 30;
+
+	result = record_writer_copy_decimal_string(
+	          100,
+	          string,
+	          32,
+	          &string_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 30 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_write_file_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_record_writer_write_file_entry(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	const char *expected_csv   = "identifier,parent_identifier,creation_time,modification_time,access_time,entry_modification_time,size,file_attribute_flags,name\n"
+	                             "1793,1536,1,2,3,4,5,32,\"a\"\"b\\\x01\"\n";
+	const char *expected_jsonl = "{\"identifier\":1793,\"parent_identifier\":1536,\"creation_time\":1,\"modification_time\":2,\"access_time\":3,\"entry_modification_time\":4,\"size\":5,\"file_attribute_flags\":32,\"name\":\"a\\\"b\\\\\\u0001\"}\n";
+	libcerror_error_t *error   = NULL;
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	read_count = fsrefs_test_tools_record_writer_write_record(
+	              RECORD_WRITER_FORMAT_JSONL,
+	              data,
+	              512 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 186 );
+
+	result = memory_compare(
+	          data,
+	          expected_jsonl,
+	          186 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = fsrefs_test_tools_record_writer_write_record(
+	              RECORD_WRITER_FORMAT_CSV,
+	              data,
+	              512 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 160 );
+
+	result = memory_compare(
+	          data,
+	          expected_csv,
+	          160 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = fsrefs_test_tools_record_writer_write_record(
+	              RECORD_WRITER_FORMAT_BINARY,
+	              data,
+	              512 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( RECORD_WRITER_BINARY_HEADER_SIZE + RECORD_WRITER_BINARY_RECORD_HEADER_SIZE + 5 ) );
+
+	result = memory_compare(
+	          data,
+	          "FSREFSRC\x01\x00\x00\x00\x42\x00\x00\x00",
+	          16 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 16 ] ),
+	          "\x47\x00\x00\x00\x01\x07\x00\x00\x00\x00\x00\x00\x00\x06\x00\x00\x00\x00\x00\x00",
+	          20 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 76 ] ),
+	          "\x20\x00\x00\x00\x05\x00" "a\"b\\\x01",
+	          11 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = record_writer_write_file_entry(
+	          NULL,
+	          0,
+	          NULL,
+	          (uint8_t *) "a",
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "record_writer_initialize",
+	 fsrefs_test_tools_record_writer_initialize );
+
+	FSREFS_TEST_RUN(
+	 "record_writer_free",
+	 fsrefs_test_tools_record_writer_free );
+
+	FSREFS_TEST_RUN(
+	 "record_writer_copy_decimal_string",
+	 fsrefs_test_tools_record_writer_copy_decimal_string );
+
+	FSREFS_TEST_RUN(
+	 "record_writer_write_file_entry",
+	 fsrefs_test_tools_record_writer_write_file_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
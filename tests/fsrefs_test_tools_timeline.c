@@ -0,0 +1,977 @@
+/*
+ * Tools timeline functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../fsrefstools/output_buffer.h"
+#include "../fsrefstools/timeline.h"
+
+/* Tests the timeline_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_timeline_initialize(
+     void )
+{
+	timeline_t *timeline     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = timeline_initialize(
+	          &timeline,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline",
+	 timeline );
+
+	result = timeline_free(
+	          &timeline,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "timeline",
+	 timeline );
+
+	/* Test error cases
+	 */
+	result = timeline_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline = (timeline_t *) 0x12345678UL;
+
+	result = timeline_initialize(
+	          &timeline,
+	          4096,
+	          &error );
+
+	timeline = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_initialize(
+	          &timeline,
+	          8,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test timeline_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = timeline_initialize(
+		          &timeline,
+		          4096,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( timeline != NULL )
+			{
+				timeline_free(
+				 &timeline,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "timeline",
+			 timeline );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the timeline_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_timeline_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = timeline_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the timeline_copy_filetime_to_date_time_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_timeline_copy_filetime_to_date_time_string(
+     void )
+{
+	char string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = timeline_copy_filetime_to_date_time_string(
+	          0,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "1601-01-01T00:00:00.0000000Z",
+	          29 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_date_time_string(
+	          116444736000000000,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "1970-01-01T00:00:00.0000000Z",
+	          29 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_date_time_string(
+	          125963036550000001,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "2000-02-29T13:14:15.0000001Z",
+	          29 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_date_time_string(
+	          126227807990000000,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "2000-12-31T23:59:59.0000000Z",
+	          29 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_date_time_string(
+	          132590304000000000,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "2021-03-01T00:00:00.0000000Z",
+	          29 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = timeline_copy_filetime_to_date_time_string(
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_copy_filetime_to_date_time_string(
+	          0,
+	          string,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the timeline_copy_filetime_to_posix_time_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_timeline_copy_filetime_to_posix_time_string(
+     void )
+{
+	char string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = timeline_copy_filetime_to_posix_time_string(
+	          0,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "0",
+	          2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_posix_time_string(
+	          116444736000000001,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "0.0000001",
+	          10 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_posix_time_string(
+	          125963036550000000,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "951830055.0000000",
+	          18 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = timeline_copy_filetime_to_posix_time_string(
+	          116444735990000000,
+	          string,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "-1.0000000",
+	          11 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = timeline_copy_filetime_to_posix_time_string(
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_copy_filetime_to_posix_time_string(
+	          0,
+	          string,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the timeline_write function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_tools_timeline_write(
+     void )
+{
+	char line[ 128 ];
+	char previous_line[ 128 ];
+	char name[ 16 ];
+
+	libfsrefs_file_entry_stat_t file_entry_stat;
+
+	output_buffer_t *output_buffer = NULL;
+	timeline_t *timeline           = NULL;
+	libcerror_error_t *error       = NULL;
+	FILE *stream                   = NULL;
+	int file_entry_index           = 0;
+	int number_of_lines            = 0;
+	int print_count                = 0;
+	int result                     = 0;
+
+	result = memory_set(
+	          &file_entry_stat,
+	          0,
+	          sizeof( libfsrefs_file_entry_stat_t ) ) != NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	stream = tmpfile();
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          1024,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small run data size to force multiple runs to be written to temporary files
+	 * and the runs to be merged when the maximum number of runs is reached
+	 */
+	result = timeline_initialize(
+	          &timeline,
+	          256,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Every file entry has 3 distinct timestamps, one of them shared by 2 MACB values
+	 */
+	for( file_entry_index = 0;
+	     file_entry_index < 200;
+	     file_entry_index++ )
+	{
+		file_entry_stat.object_identifier       = (uint64_t) file_entry_index;
+		file_entry_stat.creation_time           = 125963036550000000ULL + ( (uint64_t) ( ( file_entry_index * 7919 ) % 1000 ) * 10000000ULL );
+		file_entry_stat.modification_time       = file_entry_stat.creation_time + ( (uint64_t) ( 1 + ( ( file_entry_index * 104729 ) % 997 ) ) * 10000000ULL );
+		file_entry_stat.access_time             = file_entry_stat.modification_time;
+		file_entry_stat.entry_modification_time = file_entry_stat.creation_time + 1;
+		file_entry_stat.size                    = (size64_t) file_entry_index;
+
+		print_count = narrow_string_snprintf(
+		               name,
+		               16,
+		               "\\file%d",
+		               file_entry_index );
+
+		result = timeline_append_file_entry(
+		          timeline,
+		          &file_entry_stat,
+		          (uint8_t *) name,
+		          (size_t) print_count,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "timeline->number_of_runs",
+	 ( timeline->number_of_runs > 1 ),
+	 1 );
+
+	result = timeline_write(
+	          timeline,
+	          output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The timeline has a header and is sorted by date and time
+	 */
+	result = file_stream_seek_offset(
+	          stream,
+	          0,
+	          SEEK_SET );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	previous_line[ 0 ] = 0;
+
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        128 ) != NULL )
+	{
+		if( number_of_lines == 0 )
+		{
+			result = narrow_string_compare(
+			          line,
+			          "Date,Size,Type,Mode,UID,GID,Meta,File Name\n",
+			          44 );
+		}
+		else if( number_of_lines > 1 )
+		{
+			/* The date and time strings sort in chronological order
+			 */
+			result = ( narrow_string_compare(
+			            previous_line,
+			            line,
+			            29 ) <= 0 ) ? 0 : 1;
+		}
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( narrow_string_copy(
+		     previous_line,
+		     line,
+		     128 ) == NULL )
+		{
+			goto on_error;
+		}
+		number_of_lines++;
+	}
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lines",
+	 number_of_lines,
+	 1 + ( 200 * 3 ) );
+
+	/* Test error cases
+	 */
+	result = timeline_append_file_entry(
+	          NULL,
+	          &file_entry_stat,
+	          (uint8_t *) name,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_append_file_entry(
+	          timeline,
+	          NULL,
+	          (uint8_t *) name,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_append_file_entry(
+	          timeline,
+	          &file_entry_stat,
+	          NULL,
+	          1,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_append_file_entry(
+	          timeline,
+	          &file_entry_stat,
+	          (uint8_t *) name,
+	          256,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = timeline_write(
+	          NULL,
+	          output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = timeline_free(
+	          &timeline,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSREFS_TEST_RUN(
+	 "timeline_initialize",
+	 fsrefs_test_tools_timeline_initialize );
+
+	FSREFS_TEST_RUN(
+	 "timeline_free",
+	 fsrefs_test_tools_timeline_free );
+
+	FSREFS_TEST_RUN(
+	 "timeline_copy_filetime_to_date_time_string",
+	 fsrefs_test_tools_timeline_copy_filetime_to_date_time_string );
+
+	FSREFS_TEST_RUN(
+	 "timeline_copy_filetime_to_posix_time_string",
+	 fsrefs_test_tools_timeline_copy_filetime_to_posix_time_string );
+
+	FSREFS_TEST_RUN(
+	 "timeline_write",
+	 fsrefs_test_tools_timeline_write );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
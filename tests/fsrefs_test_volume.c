@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +38,7 @@
 #include "fsrefs_test_libuna.h"
 #include "fsrefs_test_macros.h"
 #include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -930,6 +932,204 @@ on_error:
 	return( 0 );
 }
 
+/* Stores the result passed by libfsrefs_volume_open_async
+ */
+void fsrefs_test_volume_open_async_callback(
+      libfsrefs_volume_t *volume FSREFS_TEST_ATTRIBUTE_UNUSED,
+      int result,
+      libcerror_error_t *error FSREFS_TEST_ATTRIBUTE_UNUSED,
+      intptr_t *user_data )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( volume )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	*( (int *) user_data ) = result;
+}
+
+/* Tests the libfsrefs_volume_open_async function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_open_async(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error   = NULL;
+	libfsrefs_volume_t *volume = NULL;
+	int open_result            = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_volume_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfsrefs_volume_open_async(
+	          volume,
+	          narrow_source,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_volume_open_async_callback,
+	          (intptr_t *) &open_result,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_wait_for_open_requests(
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "open_result",
+	 open_result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_open_async(
+	          NULL,
+	          narrow_source,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_volume_open_async_callback,
+	          (intptr_t *) &open_result,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_open_async(
+	          volume,
+	          NULL,
+	          LIBFSREFS_OPEN_READ,
+	          &fsrefs_test_volume_open_async_callback,
+	          (intptr_t *) &open_result,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_open_async(
+	          volume,
+	          narrow_source,
+	          LIBFSREFS_OPEN_READ,
+	          NULL,
+	          (intptr_t *) &open_result,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_volume_free(
+	          &volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfsrefs_wait_for_open_requests(
+	 NULL );
+
+	if( volume != NULL )
+	{
+		libfsrefs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Tests the libfsrefs_volume_open_wide function
@@ -1677,81 +1877,742 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libfsrefs_volume_get_file_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+int fsrefs_test_volume_get_file_entry_by_identifier(
+     libfsrefs_volume_t *volume )
 {
-	libcerror_error_t *error   = NULL;
-	libfsrefs_volume_t *volume = NULL;
-	system_character_t *source = NULL;
-	system_integer_t option    = 0;
-	int result                 = 0;
+	libcerror_error_t *error           = NULL;
+	libfsrefs_file_entry_t *file_entry = NULL;
+	uint64_t object_identifier         = 0;
+	int result                         = 0;
 
-	while( ( option = fsrefs_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM ".\n",
-				 argv[ optind - 1 ] );
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_get_file_entry_by_identifier(
+	          volume,
+	          0x00000600UL,
+	          &file_entry,
+	          &error );
 
-				return( EXIT_FAILURE );
-		}
-	}
-	if( optind < argc )
-	{
-		source = argv[ optind ];
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( FSREFS_TEST_VOLUME_VERBOSE )
-	libfsrefs_notify_set_verbose(
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libfsrefs_notify_set_stream(
-	 stderr,
-	 NULL );
-#endif
-
-	FSREFS_TEST_RUN(
-	 "libfsrefs_volume_initialize",
-	 fsrefs_test_volume_initialize );
 
-	FSREFS_TEST_RUN(
-	 "libfsrefs_volume_free",
-	 fsrefs_test_volume_free );
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
 
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-	if( source != NULL )
-	{
-		FSREFS_TEST_RUN_WITH_ARGS(
-		 "libfsrefs_volume_open",
-		 fsrefs_test_volume_open,
-		 source );
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	result = libfsrefs_file_entry_get_object_identifier(
+	          file_entry,
+	          &object_identifier,
+	          &error );
 
-		FSREFS_TEST_RUN_WITH_ARGS(
-		 "libfsrefs_volume_open_wide",
-		 fsrefs_test_volume_open_wide,
-		 source );
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "object_identifier",
+	 object_identifier,
+	 (uint64_t) 0x00000600UL );
 
-#if defined( LIBFSREFS_HAVE_BFIO )
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		/* TODO add test for libfsrefs_volume_open_file_io_handle */
+	result = libfsrefs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_file_entry_by_identifier(
+	          volume,
+	          0xffffffffffffffffUL,
+	          &file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_get_file_entry_by_identifier(
+	          NULL,
+	          0x00000600UL,
+	          &file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_get_file_entry_by_identifier(
+	          volume,
+	          0x00000600UL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_volume_build_parent_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_build_parent_index(
+     libfsrefs_volume_t *volume )
+{
+	uint8_t utf8_path[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libfsrefs_file_entry_t *file_entry = NULL;
+	size_t utf8_path_size              = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_build_parent_index(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_build_parent_index(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_root_directory(
+	          volume,
+	          &file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_utf8_path_size(
+	          file_entry,
+	          &utf8_path_size,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 2 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_file_entry_get_utf8_path(
+	          file_entry,
+	          utf8_path,
+	          16,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          "\\",
+	          2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_build_parent_index(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsrefs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Counts the file entries passed by libfsrefs_volume_walk_file_entries
+ * Returns 1 to continue the walk
+ */
+int fsrefs_test_volume_walk_file_entries_callback(
+     libfsrefs_file_entry_t *file_entry FSREFS_TEST_ATTRIBUTE_UNUSED,
+     intptr_t *user_data )
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( file_entry )
+
+	*( (int *) user_data ) += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsrefs_volume_walk_file_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_walk_file_entries(
+     libfsrefs_volume_t *volume )
+{
+	libcerror_error_t *error   = NULL;
+	libfsrefs_filter_t *filter = NULL;
+	int number_of_file_entries = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_walk_file_entries(
+	          volume,
+	          NULL,
+	          &fsrefs_test_volume_walk_file_entries_callback,
+	          (intptr_t *) &number_of_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_initialize(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_filter_set_utf8_name_pattern(
+	          filter,
+	          (uint8_t *) "?*.fsrefs_test_no_match",
+	          23,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_file_entries = 0;
+
+	result = libfsrefs_volume_walk_file_entries(
+	          volume,
+	          filter,
+	          &fsrefs_test_volume_walk_file_entries_callback,
+	          (intptr_t *) &number_of_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_walk_file_entries(
+	          NULL,
+	          filter,
+	          &fsrefs_test_volume_walk_file_entries_callback,
+	          (intptr_t *) &number_of_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_walk_file_entries(
+	          volume,
+	          filter,
+	          NULL,
+	          (intptr_t *) &number_of_file_entries,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_filter_free(
+	          &filter,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libfsrefs_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_volume_build_shared_extent_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_build_shared_extent_index(
+     libfsrefs_volume_t *volume )
+{
+	libcerror_error_t *error     = NULL;
+	size64_t size                = 0;
+	off64_t data_offset          = 0;
+	off64_t physical_offset      = 0;
+	off64_t reference_offset     = 0;
+	uint64_t parent_identifier   = 0;
+	int number_of_references     = 0;
+	int number_of_shared_extents = 0;
+	int result                   = 0;
+	int shared_extent_index      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_build_shared_extent_index(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_build_shared_extent_index(
+	          volume,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_get_number_of_shared_extents(
+	          volume,
+	          &number_of_shared_extents,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_shared_extents > 0 )
+	{
+		result = libfsrefs_volume_get_shared_extent_by_index(
+		          volume,
+		          0,
+		          &physical_offset,
+		          &size,
+		          &number_of_references,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_references",
+		 number_of_references,
+		 1 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_volume_get_shared_extent_index_by_offset(
+		          volume,
+		          physical_offset,
+		          &shared_extent_index,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "shared_extent_index",
+		 shared_extent_index,
+		 0 );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsrefs_volume_get_shared_extent_reference_by_index(
+		          volume,
+		          0,
+		          0,
+		          &parent_identifier,
+		          &data_offset,
+		          &reference_offset,
+		          &size,
+		          &error );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSREFS_TEST_ASSERT_EQUAL_INT64(
+		 "reference_offset",
+		 (int64_t) reference_offset,
+		 (int64_t) physical_offset );
+
+		FSREFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_build_shared_extent_index(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_get_number_of_shared_extents(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_get_shared_extent_by_index(
+	          volume,
+	          -1,
+	          &physical_offset,
+	          &size,
+	          &number_of_references,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error   = NULL;
+	libfsrefs_volume_t *volume = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int result                 = 0;
+
+	while( ( option = fsrefs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( FSREFS_TEST_VOLUME_VERBOSE )
+	libfsrefs_notify_set_verbose(
+	 1 );
+	libfsrefs_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_initialize",
+	 fsrefs_test_volume_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_free",
+	 fsrefs_test_volume_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_open",
+		 fsrefs_test_volume_open,
+		 source );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_open_wide",
+		 fsrefs_test_volume_open_wide,
+		 source );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_open_async",
+		 fsrefs_test_volume_open_async,
+		 source );
+
+#if defined( LIBFSREFS_HAVE_BFIO )
+
+		/* TODO add test for libfsrefs_volume_open_file_io_handle */
 
 #endif /* defined( LIBFSREFS_HAVE_BFIO ) */
 
@@ -1815,6 +2676,26 @@ int main(
 		 fsrefs_test_volume_get_utf16_name,
 		 volume );
 
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_get_file_entry_by_identifier",
+		 fsrefs_test_volume_get_file_entry_by_identifier,
+		 volume );
+
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_build_parent_index",
+		 fsrefs_test_volume_build_parent_index,
+		 volume );
+
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_walk_file_entries",
+		 fsrefs_test_volume_walk_file_entries,
+		 volume );
+
+		FSREFS_TEST_RUN_WITH_ARGS(
+		 "libfsrefs_volume_build_shared_extent_index",
+		 fsrefs_test_volume_build_shared_extent_index,
+		 volume );
+
 		/* Clean up
 		 */
 		result = fsrefs_test_volume_close_source(
@@ -0,0 +1,1505 @@
+/*
+ * Library volume_index type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsrefs_test_libbfio.h"
+#include "fsrefs_test_libcerror.h"
+#include "fsrefs_test_libfsrefs.h"
+#include "fsrefs_test_macros.h"
+#include "fsrefs_test_memory.h"
+#include "fsrefs_test_unused.h"
+
+#include "../libfsrefs/libfsrefs_node_record.h"
+#include "../libfsrefs/libfsrefs_volume_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+uint8_t fsrefs_test_volume_index_key_data1[ 4 ] = {
+	0x30, 0x00, 0x01, 0x00 };
+
+uint8_t fsrefs_test_volume_index_value_data1[ 3 ] = {
+	0x01, 0x02, 0x03 };
+
+uint8_t fsrefs_test_volume_index_key_data2[ 6 ] = {
+	0x30, 0x00, 0x02, 0x00, 0x61, 0x00 };
+
+uint8_t fsrefs_test_volume_index_value_data2[ 8 ] = {
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfsrefs_volume_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_index_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsrefs_volume_index_t *volume_index = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_index_initialize(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_initialize(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_index = (libfsrefs_volume_index_t *) 0x12345678UL;
+
+	result = libfsrefs_volume_index_initialize(
+	          &volume_index,
+	          &error );
+
+	volume_index = NULL;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSREFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_volume_index_initialize with malloc failing
+		 */
+		fsrefs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsrefs_volume_index_initialize(
+		          &volume_index,
+		          &error );
+
+		if( fsrefs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsrefs_test_malloc_attempts_before_fail = -1;
+
+			if( volume_index != NULL )
+			{
+				libfsrefs_volume_index_free(
+				 &volume_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "volume_index",
+			 volume_index );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsrefs_volume_index_initialize with memset failing
+		 */
+		fsrefs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsrefs_volume_index_initialize(
+		          &volume_index,
+		          &error );
+
+		if( fsrefs_test_memset_attempts_before_fail != -1 )
+		{
+			fsrefs_test_memset_attempts_before_fail = -1;
+
+			if( volume_index != NULL )
+			{
+				libfsrefs_volume_index_free(
+				 &volume_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSREFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSREFS_TEST_ASSERT_IS_NULL(
+			 "volume_index",
+			 volume_index );
+
+			FSREFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSREFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_volume_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_free(
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Creates a volume index with test objects and records
+ * The objects are appended out of order
+ * Returns 1 if successful or -1 on error
+ */
+int fsrefs_test_volume_index_create_test_index(
+     libfsrefs_volume_index_t **volume_index,
+     libcerror_error_t **error )
+{
+	libfsrefs_node_record_t node_record;
+
+	if( libfsrefs_volume_index_initialize(
+	     volume_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *volume_index )->volume_serial_number       = 0x1122334455667788UL;
+	( *volume_index )->checkpoint_sequence_number = 5;
+
+	if( libfsrefs_volume_index_append_object(
+	     *volume_index,
+	     0x00000600UL,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_volume_index_set_current_object(
+	     *volume_index,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	node_record.size            = 7;
+	node_record.flags           = 0;
+	node_record.key_data        = fsrefs_test_volume_index_key_data1;
+	node_record.key_data_size   = 4;
+	node_record.value_data      = fsrefs_test_volume_index_value_data1;
+	node_record.value_data_size = 3;
+
+	if( libfsrefs_volume_index_append_record(
+	     *volume_index,
+	     &node_record,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	node_record.size            = 14;
+	node_record.key_data        = fsrefs_test_volume_index_key_data2;
+	node_record.key_data_size   = 6;
+	node_record.value_data      = fsrefs_test_volume_index_value_data2;
+	node_record.value_data_size = 8;
+
+	if( libfsrefs_volume_index_append_record(
+	     *volume_index,
+	     &node_record,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_volume_index_append_object(
+	     *volume_index,
+	     0x00000701UL,
+	     0x00000600UL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_volume_index_append_object(
+	     *volume_index,
+	     0x00000700UL,
+	     0x00000600UL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_volume_index_set_current_object(
+	     *volume_index,
+	     2,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	node_record.size            = 4;
+	node_record.key_data        = fsrefs_test_volume_index_key_data1;
+	node_record.key_data_size   = 4;
+	node_record.value_data      = NULL;
+	node_record.value_data_size = 0;
+
+	if( libfsrefs_volume_index_append_record(
+	     *volume_index,
+	     &node_record,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsrefs_volume_index_sort(
+	     *volume_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfsrefs_volume_index_free(
+	 volume_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfsrefs_volume_index_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_index_append_record(
+     void )
+{
+	libfsrefs_node_record_t node_record;
+
+	libcerror_error_t *error               = NULL;
+	libfsrefs_volume_index_t *volume_index = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsrefs_volume_index_initialize(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_index_append_object(
+	          volume_index,
+	          0x00000600UL,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	node_record.size            = 7;
+	node_record.flags           = 0;
+	node_record.key_data        = fsrefs_test_volume_index_key_data1;
+	node_record.key_data_size   = 4;
+	node_record.value_data      = fsrefs_test_volume_index_value_data1;
+	node_record.value_data_size = 3;
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_append_record(
+	          volume_index,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_index_set_current_object(
+	          volume_index,
+	          0,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_index_append_record(
+	          volume_index,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "volume_index->number_of_records",
+	 volume_index->number_of_records,
+	 1 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_index->objects[ 0 ].number_of_records",
+	 volume_index->objects[ 0 ].number_of_records,
+	 1 );
+
+	/* The record data is 8-byte aligned
+	 */
+	FSREFS_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_index->record_data_size",
+	 volume_index->record_data_size,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_append_record(
+	          NULL,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_index_append_record(
+	          volume_index,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_record.key_data = NULL;
+
+	result = libfsrefs_volume_index_append_record(
+	          volume_index,
+	          &node_record,
+	          &error );
+
+	node_record.key_data = fsrefs_test_volume_index_key_data1;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_volume_index_get_object_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_index_get_object_by_identifier(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsrefs_volume_index_object_t *object  = NULL;
+	libfsrefs_volume_index_t *volume_index   = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_volume_index_create_test_index(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          volume_index,
+	          0x00000700UL,
+	          &object,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "object",
+	 object );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "object->parent_object_identifier",
+	 object->parent_object_identifier,
+	 (uint64_t) 0x00000600UL );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "object->first_record_index",
+	 object->first_record_index,
+	 2 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "object->number_of_records",
+	 object->number_of_records,
+	 1 );
+
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          volume_index,
+	          0x00000701UL,
+	          &object,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "object->number_of_records",
+	 object->number_of_records,
+	 0 );
+
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          volume_index,
+	          0x00000702UL,
+	          &object,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          NULL,
+	          0x00000700UL,
+	          &object,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          volume_index,
+	          0x00000700UL,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_index->is_sorted = 0;
+
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          volume_index,
+	          0x00000700UL,
+	          &object,
+	          &error );
+
+	volume_index->is_sorted = 1;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_volume_index_get_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_index_get_record_by_index(
+     void )
+{
+	libfsrefs_node_record_t node_record;
+
+	libcerror_error_t *error               = NULL;
+	libfsrefs_volume_index_t *volume_index = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fsrefs_test_volume_index_create_test_index(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_index_get_record_by_index(
+	          volume_index,
+	          1,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT16(
+	 "node_record.key_data_size",
+	 node_record.key_data_size,
+	 6 );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT16(
+	 "node_record.value_data_size",
+	 node_record.value_data_size,
+	 8 );
+
+	result = memory_compare(
+	          node_record.key_data,
+	          fsrefs_test_volume_index_key_data2,
+	          6 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          node_record.value_data,
+	          fsrefs_test_volume_index_value_data2,
+	          8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_volume_index_get_record_by_index(
+	          volume_index,
+	          2,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "node_record.value_data",
+	 node_record.value_data );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_get_record_by_index(
+	          NULL,
+	          0,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_index_get_record_by_index(
+	          volume_index,
+	          3,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_index_get_record_by_index(
+	          volume_index,
+	          0,
+	          NULL,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsrefs_volume_index_write_file_io_handle and libfsrefs_volume_index_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsrefs_test_volume_index_write_and_read_file_io_handle(
+     void )
+{
+	uint8_t index_data[ 1024 ];
+
+	libfsrefs_node_record_t node_record;
+
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsrefs_volume_index_object_t *object   = NULL;
+	libfsrefs_volume_index_t *read_index      = NULL;
+	libfsrefs_volume_index_t *volume_index    = NULL;
+	void *memset_result                       = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 index_data,
+	                 0,
+	                 sizeof( index_data ) );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = fsrefs_test_volume_index_create_test_index(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          index_data,
+	          sizeof( index_data ),
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsrefs_volume_index_write_file_io_handle(
+	          volume_index,
+	          file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_index_initialize(
+	          &read_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_index_read_file_io_handle(
+	          read_index,
+	          file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_index->volume_serial_number",
+	 read_index->volume_serial_number,
+	 volume_index->volume_serial_number );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_index->checkpoint_sequence_number",
+	 read_index->checkpoint_sequence_number,
+	 volume_index->checkpoint_sequence_number );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "read_index->number_of_objects",
+	 read_index->number_of_objects,
+	 3 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "read_index->number_of_records",
+	 read_index->number_of_records,
+	 3 );
+
+	result = libfsrefs_volume_index_get_object_by_identifier(
+	          read_index,
+	          0x00000600UL,
+	          &object,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT32(
+	 "object->number_of_records",
+	 object->number_of_records,
+	 2 );
+
+	result = libfsrefs_volume_index_get_record_by_index(
+	          read_index,
+	          (int) object->first_record_index + 1,
+	          &node_record,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSREFS_TEST_ASSERT_EQUAL_UINT16(
+	 "node_record.value_data_size",
+	 node_record.value_data_size,
+	 8 );
+
+	result = memory_compare(
+	          node_record.value_data,
+	          fsrefs_test_volume_index_value_data2,
+	          8 );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsrefs_volume_index_free(
+	          &read_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsrefs_volume_index_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_index->is_sorted = 0;
+
+	result = libfsrefs_volume_index_write_file_io_handle(
+	          volume_index,
+	          file_io_handle,
+	          &error );
+
+	volume_index->is_sorted = 1;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_index_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsrefs_volume_index_initialize(
+	          &read_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid signature
+	 */
+	index_data[ 0 ] = 0xff;
+
+	result = libfsrefs_volume_index_read_file_io_handle(
+	          read_index,
+	          file_io_handle,
+	          &error );
+
+	index_data[ 0 ] = 'F';
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of records that exceeds the file size
+	 */
+	index_data[ 36 ] = 0xff;
+
+	result = libfsrefs_volume_index_read_file_io_handle(
+	          read_index,
+	          file_io_handle,
+	          &error );
+
+	index_data[ 36 ] = 3;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a record that references data outside the record data
+	 */
+	index_data[ 72 + ( 3 * 24 ) + 16 + 8 ] = 0xff;
+
+	result = libfsrefs_volume_index_read_file_io_handle(
+	          read_index,
+	          file_io_handle,
+	          &error );
+
+	index_data[ 72 + ( 3 * 24 ) + 16 + 8 ] = 0x06;
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSREFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The volume index can be read after the failed reads
+	 */
+	result = libfsrefs_volume_index_read_file_io_handle(
+	          read_index,
+	          file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsrefs_volume_index_free(
+	          &read_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsrefs_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	FSREFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "volume_index",
+	 volume_index );
+
+	FSREFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( read_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &read_index,
+		 NULL );
+	}
+	if( volume_index != NULL )
+	{
+		libfsrefs_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSREFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSREFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSREFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_index_initialize",
+	 fsrefs_test_volume_index_initialize );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_index_free",
+	 fsrefs_test_volume_index_free );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_index_append_record",
+	 fsrefs_test_volume_index_append_record );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_index_get_object_by_identifier",
+	 fsrefs_test_volume_index_get_object_by_identifier );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_index_get_record_by_index",
+	 fsrefs_test_volume_index_get_record_by_index );
+
+	FSREFS_TEST_RUN(
+	 "libfsrefs_volume_index_write_file_io_handle",
+	 fsrefs_test_volume_index_write_and_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSREFS_DLL_IMPORT ) */
+}
+
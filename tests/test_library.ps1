@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "attribute_values block_descriptor block_reference block_tree block_tree_node checkpoint data_run directory_entry directory_object error file_entry file_system io_handle metadata_block_header ministore_node node_header node_record notify objects_tree superblock tree_header volume_header"
+$LibraryTests = "attribute attribute_values block_descriptor block_reference block_set checkpoint data_block_stream data_run directory_entry directory_object directory_object_cache error extent_scheduler file_entry file_system filter identifier_set io_handle memory_budget metadata_block_header metadata_block_scanner ministore_node name node_header node_record notify objects_tree open_pool open_request parent_index shared_extent_index statistics superblock synthetic_volume tree_header volume_header volume_index"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "offset" -split " "
 
@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output signal"
+$ToolsTests = "bench_handle export_handle hash_handle info_handle mount_directory mount_handle output output_buffer record_writer signal timeline"
 $OptionSets = "offset" -split " "
 
 . .\test_functions.ps1